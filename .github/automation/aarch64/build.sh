@@ -32,6 +32,7 @@ CMAKE_BUILD_TYPE=${CMAKE_BUILD_TYPE:-"Release"}
 ONEDNN_TEST_SET=${ONEDNN_TEST_SET:-"SMOKE"}
 ONEDNN_BUILD_GRAPH=${ONEDNN_BUILD_GRAPH:-"ON"}
 ONEDNN_EXPERIMENTAL_UKERNEL=${ONEDNN_EXPERIMENTAL_UKERNEL:-"ON"}
+ONEDNN_ENABLE_TRACE=${ONEDNN_ENABLE_TRACE:-"OFF"}
 
 if [[ "$ONEDNN_ACTION" == "configure" ]]; then
     if [[ "$GITHUB_JOB" == "pr-clang-tidy" ]]; then
@@ -61,7 +62,8 @@ if [[ "$ONEDNN_ACTION" == "configure" ]]; then
             -DCMAKE_BUILD_TYPE=$CMAKE_BUILD_TYPE \
             -DCMAKE_SKIP_BUILD_RPATH=FALSE \
             -DCMAKE_BUILD_RPATH_USE_ORIGIN=ON \
-            -DDNNL_EXPERIMENTAL_UKERNEL=$ONEDNN_EXPERIMENTAL_UKERNEL
+            -DDNNL_EXPERIMENTAL_UKERNEL=$ONEDNN_EXPERIMENTAL_UKERNEL \
+            -DDNNL_ENABLE_TRACE=$ONEDNN_ENABLE_TRACE
         set +x
     fi
 elif [[ "$ONEDNN_ACTION" == "build" ]]; then
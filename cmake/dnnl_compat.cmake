@@ -52,6 +52,7 @@ set(COMPAT_CACHE_BOOL_VARS
     "WERROR"
     "ENABLE_JIT_PROFILING"
     "ENABLE_ITT_TASKS"
+    "ENABLE_TRACE"
     "ENABLE_MEM_DEBUG"
     "ENABLE_STACK_CHECKER"
     "AARCH64_USE_ACL"
@@ -127,9 +127,10 @@ set(DNNL_ENABLE_PRIMITIVE "ALL" CACHE STRING
     - ALL (the default). Includes all primitives to be enabled.
     - <PRIMITIVE_NAME>. Includes only the selected primitive to be enabled.
       Possible values are: BATCH_NORMALIZATION, BINARY, CONCAT, CONVOLUTION,
-      DECONVOLUTION, ELTWISE, GATED_MLP, GROUP_NORMALIZATION, INNER_PRODUCT,
-      LAYER_NORMALIZATION, LRN, MATMUL, POOLING, PRELU, REDUCTION, REORDER,
-      RESAMPLING, RNN, SDPA, SHUFFLE, SOFTMAX, SUM.
+      DECONVOLUTION, ELTWISE, EMBEDDING_BAG, GATED_MLP, GROUP_NORMALIZATION,
+      INNER_PRODUCT, LAYER_NORMALIZATION, LRN, MATMUL, POOLING, PRELU,
+      REDUCTION, REORDER, RESAMPLING, RNN, ROPE, SDPA, SHUFFLE, SOFTMAX, SUM,
+      TOPK.
     - <PRIMITIVE_NAME>;<PRIMITIVE_NAME>;... Includes only selected primitives to
       be enabled at build time. This is treated as CMake string, thus, semicolon
       is a mandatory delimiter between names. This is the way to specify several
@@ -257,6 +258,12 @@ option(DNNL_ENABLE_ITT_TASKS
     on those ITT tasks and show corresponding timeline information."
     ON)
 
+option(DNNL_ENABLE_TRACE
+    "Enable recording of the execution timeline of primitives and parallel
+    regions (off by default). Recording is activated at runtime with the
+    ONEDNN_TRACE environment variable or dnnl_set_trace()."
+    OFF)
+
 # ===================
 # Engine capabilities
 # ===================
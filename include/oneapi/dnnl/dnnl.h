@@ -1126,6 +1126,60 @@ dnnl_status_t DNNL_API dnnl_memory_desc_create_with_coo_encoding(
         dnnl_data_type_t data_type, dnnl_dim_t nnz,
         dnnl_data_type_t indices_dt);
 
+/// Creates a memory descriptor for BSR encoding.
+///
+/// The created memory descriptor will describe a memory object that
+/// contains 3 buffers for a 2-dimensional tensor split into blocks of
+/// @p block_dims. The buffers have the following meaning and assigned
+/// numbers (index):
+///  - 0: values of the non-zero blocks, each block stored in row-major order
+///  - 1: block column indices, one per non-zero block
+///  - 2: block row pointers, `dims[0] / block_dims[0] + 1` entries
+///
+/// @param memory_desc Output memory descriptor.
+/// @param ndims Number of dimensions.
+/// @param dims Array of dimensions.
+/// @param data_type Elements data type.
+/// @param nnz Number of stored entries. Must be a multiple of the block
+///     size.
+/// @param block_dims Array of block dimensions. Must divide @p dims.
+/// @param indices_dt Data type of block column indices.
+/// @param pointers_dt Data type of block row pointers.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_desc_create_with_bsr_encoding(
+        dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
+        dnnl_data_type_t data_type, dnnl_dim_t nnz,
+        const dnnl_dims_t block_dims, dnnl_data_type_t indices_dt,
+        dnnl_data_type_t pointers_dt);
+
+/// Creates a memory descriptor for 2:4 structured sparse encoding.
+///
+/// The created memory descriptor will describe a memory object that
+/// contains 2 buffers for a 2-dimensional tensor of shape `R x C`.
+/// The buffers have the following meaning and assigned numbers (index):
+///  - 0: values, a row-major `R/2 x C` matrix where rows `2g` and `2g+1`
+///    hold the two kept elements of the group `g` in increasing order of
+///    their positions
+///  - 1: metadata, a row-major `R/4 x C` matrix where bits [1:0] and
+///    [3:2] of each entry hold the positions of the two kept elements
+///    within the group
+///
+/// @note
+///     Only u8 metadata is currently supported.
+///
+/// @param memory_desc Output memory descriptor.
+/// @param ndims Number of dimensions.
+/// @param dims Array of dimensions. The first dimension must be
+///     a multiple of 4.
+/// @param data_type Elements data type.
+/// @param metadata_dt Data type of metadata.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_desc_create_with_structured_2_4_encoding(
+        dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
+        dnnl_data_type_t data_type, dnnl_data_type_t metadata_dt);
+
 /// Creates a memory descriptor for packed sparse encoding.
 ///
 /// The created memory descriptor cannot be used to create a memory
@@ -3888,6 +3942,81 @@ dnnl_status_t DNNL_API dnnl_get_primitive_cache_capacity(int *capacity);
 ///     success.
 dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity(int capacity);
 
+/// Sets the number of primitives of a kind that can be held in the primitive
+/// cache at a time.
+///
+/// When the limit is reached, a newly created primitive of the kind evicts
+/// the least recently used primitive of the same kind rather than the least
+/// recently used primitive in the cache. This prevents a large number of
+/// primitives that are cheap to create, e.g. reorders for dynamic shapes,
+/// from evicting the primitives that are expensive to create. The limit does
+/// not increase the primitive cache capacity.
+///
+/// @param kind Primitive kind.
+/// @param capacity Primitive cache capacity for the primitive kind. The value
+///     of -1 removes the limit, and the value of 0 stops caching primitives
+///     of the kind. If @p capacity is less than the number of primitives of
+///     the kind that the primitive cache already has then the excess entries
+///     will be evicted.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p kind or @p capacity value is invalid, and
+///     #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_set_primitive_cache_kind_capacity(
+        dnnl_primitive_kind_t kind, int capacity);
+
+/// Returns primitive cache statistics for a primitive kind.
+///
+/// @param kind Primitive kind. Passing #dnnl_undefined_primitive returns the
+///     statistics of the whole primitive cache.
+/// @param stats Output statistics. The capacity is the one set with
+///     dnnl_set_primitive_cache_kind_capacity() for a primitive kind, or the
+///     primitive cache capacity for #dnnl_undefined_primitive.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p kind value is invalid or @p stats is NULL, and
+///     #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_stats(
+        dnnl_primitive_kind_t kind, dnnl_primitive_cache_stats_t *stats);
+
+/// Saves the primitives that the primitive cache holds for an engine into a
+/// bundle file.
+///
+/// The bundle stores the information required to re-create the primitives
+/// with the implementations that were dispatched originally. It is tied to the
+/// library version and the effective CPU ISA of the process that saved it.
+/// Primitives that cannot be recorded in a bundle are skipped.
+///
+/// @note
+///     Only CPU engines are supported.
+///
+/// @param engine Engine to save the primitives for.
+/// @param path Path to the bundle file. The file is overwritten.
+/// @param n_saved Output number of saved primitives. May be NULL.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_cache_save_bundle(
+        dnnl_engine_t engine, const char *path, int *n_saved);
+
+/// Creates the primitives recorded in a bundle file for an engine and puts
+/// them into the primitive cache.
+///
+/// The primitives are created in parallel. Each primitive is created directly
+/// with the recorded implementation, skipping implementation dispatching.
+/// Primitives that cannot be re-created are skipped.
+///
+/// @note
+///     Only CPU engines are supported.
+///
+/// @param engine Engine to create the primitives for.
+/// @param path Path to the bundle file.
+/// @param n_loaded Output number of primitives put into the primitive cache.
+///     May be NULL.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     bundle is malformed or was saved by a different library version or for
+///     a different CPU ISA, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_primitive_cache_load_bundle(
+        dnnl_engine_t engine, const char *path, int *n_loaded);
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_service
@@ -4040,6 +4169,39 @@ dnnl_status_t DNNL_API dnnl_set_cpu_isa_hints(dnnl_cpu_isa_hints_t isa_hints);
 /// library can follow.
 dnnl_cpu_isa_hints_t DNNL_API dnnl_get_cpu_isa_hints(void);
 
+/// Enables or disables recording of the execution timeline. When enabled,
+/// every thread records the time it spends creating and executing primitives
+/// and working in parallel regions.
+///
+/// @note
+///     This setting overrides the ONEDNN_TRACE environment variable.
+///
+/// @sa @ref dev_guide_trace
+///
+/// @param enable Flag value. Set to 0 to disable and set to 1 to enable.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p enable value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_set_trace(int enable);
+
+/// Writes the execution timeline recorded since the previous call to a file.
+///
+/// @note
+///     The function should not be called concurrently with primitive
+///     creation or execution, otherwise the most recent events may be
+///     missing from the file.
+///
+/// @sa @ref dev_guide_trace
+///
+/// @param path Path to the output file.
+/// @param format Format of the output file.
+/// @returns #dnnl_success/#dnnl::status::success on success,
+///     #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     arguments are invalid, and #dnnl_runtime_error/
+///     #dnnl::status::runtime_error if the file cannot be written.
+dnnl_status_t DNNL_API dnnl_dump_trace(
+        const char *path, dnnl_trace_format_t format);
+
 /// @} dnnl_api_service
 
 #ifdef DNNL_EXPERIMENTAL_PROFILING
@@ -4264,6 +4426,542 @@ dnnl_status_t DNNL_API dnnl_gemm_s8s8s32(char transa, char transb, char offsetc,
         dnnl_dim_t lda, int8_t ao, const int8_t *B, dnnl_dim_t ldb, int8_t bo,
         float beta, int32_t *C, dnnl_dim_t ldc, const int32_t *co);
 
+/// Performs bfloat16 matrix-matrix multiply with single-precision resulting
+/// matrix C.
+///
+/// The operation is defined as:
+///
+/// `C := alpha * op( A ) * op( B ) + beta * C`
+///
+/// where
+///  - `op( X ) = X` or `op( X ) = X**T`,
+///  - `alpha` and `beta` are scalars, and
+///  - `A`, `B`, and `C` are matrices:
+///     - `op( A )` is an `MxK` matrix,
+///     - `op( B )` is an `KxN` matrix,
+///     - `C` is an `MxN` matrix.
+///
+/// The matrices are assumed to be stored in row-major order (the elements in
+/// each of the matrix rows are contiguous in memory). Matrices A and B hold
+/// bfloat16 values stored as `uint16_t`.
+///
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A A pointer to the A matrix data.
+/// @param lda The leading dimension for the matrix A.
+/// @param B A pointer to the B matrix data.
+/// @param ldb The leading dimension for the matrix B.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint16_t *A, dnnl_dim_t lda, const uint16_t *B, dnnl_dim_t ldb,
+        float beta, float *C, dnnl_dim_t ldc);
+
+/// Performs a batch of single-precision matrix-matrix multiplies with
+/// matrices located at a constant stride from each other.
+///
+/// For each `i` in `[0, batch)` the operation is defined as:
+///
+/// `C_i := alpha * op( A_i ) * op( B_i ) + beta * C_i`
+///
+/// where `A_i = A + i * stride_a`, `B_i = B + i * stride_b`, and
+/// `C_i = C + i * stride_c`. The remaining parameters have the same meaning
+/// as for dnnl_sgemm().
+///
+/// The problems are distributed across threads along the batch dimension
+/// when there are enough of them to occupy all threads. Otherwise each
+/// multiply is parallelized internally.
+///
+/// @note
+///     The resulting matrices `C_i` must not overlap.
+///
+/// @param transa Transposition flag for matrices A: 'N' or 'n' means A is
+///     not transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrices B: 'N' or 'n' means B is
+///     not transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A A pointer to the first A matrix data.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance in elements between consecutive A matrices.
+/// @param B A pointer to the first B matrix data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance in elements between consecutive B matrices.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C A pointer to the first C matrix data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance in elements between consecutive C matrices.
+/// @param batch The number of multiplies in the batch.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_batch_strided(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A,
+        dnnl_dim_t lda, dnnl_dim_t stride_a, const float *B, dnnl_dim_t ldb,
+        dnnl_dim_t stride_b, float beta, float *C, dnnl_dim_t ldc,
+        dnnl_dim_t stride_c, dnnl_dim_t batch);
+
+/// Performs a batch of single-precision matrix-matrix multiplies with
+/// matrices passed as arrays of pointers.
+///
+/// For each `i` in `[0, batch)` the operation is defined as:
+///
+/// `C[i] := alpha * op( A[i] ) * op( B[i] ) + beta * C[i]`
+///
+/// All the problems share the same dimensions, leading dimensions,
+/// transposition flags, and scalars. The remaining parameters have the same
+/// meaning as for dnnl_sgemm().
+///
+/// @note
+///     The resulting matrices `C[i]` must not overlap.
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A An array of @p batch pointers to the A matrices data.
+/// @param lda The leading dimension for the matrices A.
+/// @param B An array of @p batch pointers to the B matrices data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C An array of @p batch pointers to the C matrices data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param batch The number of multiplies in the batch.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_batch(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const float *const *A, dnnl_dim_t lda, const float *const *B,
+        dnnl_dim_t ldb, float beta, float *const *C, dnnl_dim_t ldc,
+        dnnl_dim_t batch);
+
+/// Performs a batch of integer matrix-matrix multiplies on 8-bit unsigned
+/// matrices A, 8-bit signed matrices B, and 32-bit signed resulting matrices
+/// C located at a constant stride from each other.
+///
+/// For each `i` in `[0, batch)` the operation is the one defined for
+/// dnnl_gemm_u8s8s32() applied to `A + i * stride_a`, `B + i * stride_b`,
+/// and `C + i * stride_c`. The offsets @p ao, @p bo, and @p co are shared by
+/// all the problems in the batch.
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param offsetc Flag specifying how offsets should be applied to matrices
+///     C. Has the same meaning as for dnnl_gemm_u8s8s32().
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A A pointer to the first A matrix data.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance in elements between consecutive A matrices.
+/// @param ao The offset value for the matrices A.
+/// @param B A pointer to the first B matrix data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance in elements between consecutive B matrices.
+/// @param bo The offset value for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C A pointer to the first C matrix data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance in elements between consecutive C matrices.
+/// @param co An array of offset values for the matrices C.
+/// @param batch The number of multiplies in the batch.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_batch_strided(char transa,
+        char transb, char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        float alpha, const uint8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a,
+        uint8_t ao, const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b,
+        int8_t bo, float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t batch);
+
+/// Performs a batch of integer matrix-matrix multiplies on 8-bit signed
+/// matrices A, 8-bit signed matrices B, and 32-bit signed resulting matrices
+/// C located at a constant stride from each other.
+///
+/// For each `i` in `[0, batch)` the operation is the one defined for
+/// dnnl_gemm_s8s8s32() applied to `A + i * stride_a`, `B + i * stride_b`,
+/// and `C + i * stride_c`. The offsets @p ao, @p bo, and @p co are shared by
+/// all the problems in the batch.
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param offsetc Flag specifying how offsets should be applied to matrices
+///     C. Has the same meaning as for dnnl_gemm_s8s8s32().
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A A pointer to the first A matrix data.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance in elements between consecutive A matrices.
+/// @param ao The offset value for the matrices A.
+/// @param B A pointer to the first B matrix data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance in elements between consecutive B matrices.
+/// @param bo The offset value for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C A pointer to the first C matrix data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance in elements between consecutive C matrices.
+/// @param co An array of offset values for the matrices C.
+/// @param batch The number of multiplies in the batch.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_batch_strided(char transa,
+        char transb, char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        float alpha, const int8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a,
+        int8_t ao, const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b,
+        int8_t bo, float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t batch);
+
+/// Performs a batch of bfloat16 matrix-matrix multiplies with
+/// single-precision resulting matrices C located at a constant stride from
+/// each other.
+///
+/// For each `i` in `[0, batch)` the operation is the one defined for
+/// dnnl_gemm_bf16bf16f32() applied to `A + i * stride_a`,
+/// `B + i * stride_b`, and `C + i * stride_c`.
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A A pointer to the first A matrix data.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance in elements between consecutive A matrices.
+/// @param B A pointer to the first B matrix data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance in elements between consecutive B matrices.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C A pointer to the first C matrix data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance in elements between consecutive C matrices.
+/// @param batch The number of multiplies in the batch.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_batch_strided(char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint16_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a,
+        const uint16_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b, float beta,
+        float *C, dnnl_dim_t ldc, dnnl_dim_t stride_c, dnnl_dim_t batch);
+
+/// Returns the size in bytes of a buffer required to hold a packed copy of
+/// one of the matrices of a single-precision matrix-matrix multiply.
+///
+/// A packed matrix can be passed to dnnl_sgemm_compute() any number of times
+/// to avoid repacking a matrix that does not change between the calls, such
+/// as the weights of a fully-connected layer.
+///
+/// @param identifier Specifies the matrix to be packed: 'A' or 'a' for
+///     matrix A and 'B' or 'b' for matrix B.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param size Output size of the packed buffer in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise. Returns #dnnl_unimplemented if packing
+///     is not supported on the platform.
+dnnl_status_t DNNL_API dnnl_sgemm_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size);
+
+/// Packs one of the matrices of a single-precision matrix-matrix multiply
+/// into an opaque buffer that can be used by dnnl_sgemm_compute().
+///
+/// @param identifier Specifies the matrix to be packed: 'A' or 'a' for
+///     matrix A and 'B' or 'b' for matrix B.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param src A pointer to the matrix to be packed.
+/// @param dst A pointer to the packed buffer of the size returned by
+///     dnnl_sgemm_pack_get_size().
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_pack(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const float *src, float *dst);
+
+/// Performs single-precision matrix-matrix multiply with one or both
+/// matrices A and B possibly packed by dnnl_sgemm_pack().
+///
+/// The operation is defined as:
+///
+/// `C := op( A ) * op( B ) + beta * C`
+///
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, 'T' or 't' means that A is transposed, and 'P' or 'p'
+///     means that A is packed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, 'T' or 't' means that B is transposed, and 'P' or 'p'
+///     means that B is packed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the A matrix data or the packed buffer.
+/// @param lda The leading dimension for the matrix A. Must be the same as
+///     the one used for packing if A is packed.
+/// @param B A pointer to the B matrix data or the packed buffer.
+/// @param ldb The leading dimension for the matrix B. Must be the same as
+///     the one used for packing if B is packed.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_compute(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const float *A,
+        dnnl_dim_t lda, const float *B, dnnl_dim_t ldb, float beta, float *C,
+        dnnl_dim_t ldc);
+
+/// Returns the size in bytes of a buffer required to hold a packed copy of
+/// one of the matrices of an integer matrix-matrix multiply on 8-bit
+/// unsigned matrix A and 8-bit signed matrix B.
+///
+/// @param identifier Specifies the matrix to be packed: 'A' or 'a' for
+///     matrix A and 'B' or 'b' for matrix B.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param size Output size of the packed buffer in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_pack_get_size(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, size_t *size);
+
+/// Packs one of the matrices of an integer matrix-matrix multiply on 8-bit
+/// unsigned matrix A and 8-bit signed matrix B into an opaque buffer that
+/// can be used by dnnl_gemm_u8s8s32_compute().
+///
+/// @param identifier Specifies the matrix to be packed: 'A' or 'a' for
+///     matrix A and 'B' or 'b' for matrix B.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param src A pointer to the matrix to be packed.
+/// @param dst A pointer to the packed buffer of the size returned by
+///     dnnl_gemm_u8s8s32_pack_get_size().
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_pack(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst);
+
+/// Performs integer matrix-matrix multiply on 8-bit unsigned matrix A, 8-bit
+/// signed matrix B, and 32-bit signed resulting matrix C with one or both
+/// matrices A and B possibly packed by dnnl_gemm_u8s8s32_pack().
+///
+/// The operation is defined as:
+///
+/// `C := op(A) * op(B) + beta * C + C_offset`
+///
+/// @param transa Transposition flag for matrix A: 'N', 'T', or 'P' if A is
+///     packed.
+/// @param transb Transposition flag for matrix B: 'N', 'T', or 'P' if B is
+///     packed.
+/// @param offsetc Flag specifying how offsets should be applied to matrix C.
+///     Has the same meaning as for dnnl_gemm_u8s8s32().
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the A matrix data or the packed buffer.
+/// @param lda The leading dimension for the matrix A.
+/// @param B A pointer to the B matrix data or the packed buffer.
+/// @param ldb The leading dimension for the matrix B.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @param co An array of offset values for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_compute(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        const uint8_t *A, dnnl_dim_t lda, const int8_t *B, dnnl_dim_t ldb,
+        float beta, int32_t *C, dnnl_dim_t ldc, const int32_t *co);
+
+/// Returns the size in bytes of a buffer required to hold a packed copy of
+/// one of the matrices of an integer matrix-matrix multiply on 8-bit signed
+/// matrices A and B.
+///
+/// @param identifier Specifies the matrix to be packed: 'A' or 'a' for
+///     matrix A and 'B' or 'b' for matrix B.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param size Output size of the packed buffer in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_pack_get_size(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, size_t *size);
+
+/// Packs one of the matrices of an integer matrix-matrix multiply on 8-bit
+/// signed matrices A and B into an opaque buffer that can be used by
+/// dnnl_gemm_s8s8s32_compute().
+///
+/// @param identifier Specifies the matrix to be packed: 'A' or 'a' for
+///     matrix A and 'B' or 'b' for matrix B.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param src A pointer to the matrix to be packed.
+/// @param dst A pointer to the packed buffer of the size returned by
+///     dnnl_gemm_s8s8s32_pack_get_size().
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_pack(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst);
+
+/// Performs integer matrix-matrix multiply on 8-bit signed matrices A and B,
+/// and 32-bit signed resulting matrix C with one or both matrices A and B
+/// possibly packed by dnnl_gemm_s8s8s32_pack().
+///
+/// The operation is defined as:
+///
+/// `C := op(A) * op(B) + beta * C + C_offset`
+///
+/// @param transa Transposition flag for matrix A: 'N', 'T', or 'P' if A is
+///     packed.
+/// @param transb Transposition flag for matrix B: 'N', 'T', or 'P' if B is
+///     packed.
+/// @param offsetc Flag specifying how offsets should be applied to matrix C.
+///     Has the same meaning as for dnnl_gemm_s8s8s32().
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the A matrix data or the packed buffer.
+/// @param lda The leading dimension for the matrix A.
+/// @param B A pointer to the B matrix data or the packed buffer.
+/// @param ldb The leading dimension for the matrix B.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @param co An array of offset values for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_compute(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        const int8_t *A, dnnl_dim_t lda, const int8_t *B, dnnl_dim_t ldb,
+        float beta, int32_t *C, dnnl_dim_t ldc, const int32_t *co);
+
+/// Returns the size in bytes of a buffer required to hold a packed copy of
+/// one of the matrices of a bfloat16 matrix-matrix multiply.
+///
+/// @param identifier Specifies the matrix to be packed: 'A' or 'a' for
+///     matrix A and 'B' or 'b' for matrix B.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param size Output size of the packed buffer in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise. Returns #dnnl_unimplemented if packing
+///     is not supported on the platform.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_pack_get_size(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, size_t *size);
+
+/// Packs one of the matrices of a bfloat16 matrix-matrix multiply into an
+/// opaque buffer that can be used by dnnl_gemm_bf16bf16f32_compute().
+///
+/// @param identifier Specifies the matrix to be packed: 'A' or 'a' for
+///     matrix A and 'B' or 'b' for matrix B.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param src A pointer to the matrix to be packed.
+/// @param dst A pointer to the packed buffer of the size returned by
+///     dnnl_gemm_bf16bf16f32_pack_get_size().
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_pack(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, const uint16_t *src, uint16_t *dst);
+
+/// Performs bfloat16 matrix-matrix multiply with single-precision resulting
+/// matrix C with one or both matrices A and B possibly packed by
+/// dnnl_gemm_bf16bf16f32_pack().
+///
+/// The operation is defined as:
+///
+/// `C := op( A ) * op( B ) + beta * C`
+///
+/// @param transa Transposition flag for matrix A: 'N', 'T', or 'P' if A is
+///     packed.
+/// @param transb Transposition flag for matrix B: 'N', 'T', or 'P' if B is
+///     packed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the A matrix data or the packed buffer.
+/// @param lda The leading dimension for the matrix A.
+/// @param B A pointer to the B matrix data or the packed buffer.
+/// @param ldb The leading dimension for the matrix B.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_compute(char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        const uint16_t *A, dnnl_dim_t lda, const uint16_t *B, dnnl_dim_t ldb,
+        float beta, float *C, dnnl_dim_t ldc);
+
 /// @} dnnl_api_blas
 
 /// @} dnnl_api
@@ -624,6 +624,9 @@ enum class rnn_flags : unsigned {
     undef = dnnl_rnn_flags_undef,
     /// Do not add weights gradient to existing diff_weights memory
     diff_weights_overwrite = dnnl_rnn_flags_diff_weights_overwrite,
+    /// Use per-sample sequence lengths passed at execution time via
+    /// #DNNL_ARG_SEQ_LENGTHS
+    variable_length = dnnl_rnn_flags_variable_length,
 };
 
 /// Converts RNN cell flags enum value from C++ API to C API type.
@@ -983,6 +986,10 @@ struct memory : public handle<dnnl_memory_t> {
         packed = dnnl_packed,
         /// Coordinate Sparse (COO) encoding.
         coo = dnnl_coo,
+        /// Block Compressed Sparse Row (BSR) encoding.
+        bsr = dnnl_bsr,
+        /// 2:4 structured sparse encoding.
+        structured_2_4 = dnnl_structured_2_4,
 #if DNNL_EXPERIMENTAL_GROUPED_MEMORY
         /// Grouped Encoding.
         grouped = dnnl_grouped,
@@ -2995,6 +3002,80 @@ struct memory : public handle<dnnl_memory_t> {
             return desc {md};
         }
 
+        /// Function for creating a memory descriptor for BSR sparse encoding.
+        ///
+        /// The created memory descriptor will describe a memory object that
+        /// contains 3 buffers. The buffers have the following meaning and
+        /// assigned numbers (index):
+        ///  - 0: values of the non-zero blocks, each block in row-major order
+        ///  - 1: block column indices
+        ///  - 2: block row pointers
+        ///
+        /// @param adims Tensor dimensions.
+        /// @param adata_type Data precision/type.
+        /// @param nnz Number of stored entries, a multiple of the block size.
+        /// @param ablock_dims Block dimensions.
+        /// @param index_dt Data type of block column indices.
+        /// @param pointer_dt Data type of block row pointers.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case a
+        ///     zero memory descriptor will be constructed. This flag is
+        ///     optional and defaults to false.
+        /// @sa @ref dev_guide_sparsity
+        static desc bsr(const dims &adims, data_type adata_type, dim nnz,
+                const dims &ablock_dims, data_type index_dt,
+                data_type pointer_dt, bool allow_empty = false) {
+            validate_dims(adims);
+            validate_container_size(ablock_dims,
+                    "block dimensions are invalid", (int)adims.size(),
+                    (int)adims.size());
+            dnnl_memory_desc_t md = nullptr;
+            dnnl_status_t status = dnnl_memory_desc_create_with_bsr_encoding(
+                    &md, (int)adims.size(), adims.data(),
+                    convert_to_c(adata_type), nnz, ablock_dims.data(),
+                    convert_to_c(index_dt), convert_to_c(pointer_dt));
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a memory descriptor for BSR sparse "
+                        "encoding");
+            return desc {md};
+        }
+
+        /// Function for creating a memory descriptor for 2:4 structured
+        /// sparse encoding.
+        ///
+        /// The created memory descriptor will describe a memory object that
+        /// contains 2 buffers. The buffers have the following meaning and
+        /// assigned numbers (index):
+        ///  - 0: values, the two kept elements of each group of four
+        ///    elements along the first dimension
+        ///  - 1: metadata, the 2-bit positions of the kept elements
+        ///
+        /// @param adims Tensor dimensions.
+        /// @param adata_type Data precision/type.
+        /// @param metadata_dt Data type of metadata.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case a
+        ///     zero memory descriptor will be constructed. This flag is
+        ///     optional and defaults to false.
+        /// @sa @ref dev_guide_sparsity
+        static desc structured_2_4(const dims &adims, data_type adata_type,
+                data_type metadata_dt = data_type::u8,
+                bool allow_empty = false) {
+            validate_dims(adims);
+            dnnl_memory_desc_t md = nullptr;
+            dnnl_status_t status
+                    = dnnl_memory_desc_create_with_structured_2_4_encoding(&md,
+                            (int)adims.size(), adims.data(),
+                            convert_to_c(adata_type),
+                            convert_to_c(metadata_dt));
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a memory descriptor for 2:4 "
+                        "structured sparse encoding");
+            return desc {md};
+        }
+
         /// Function for creating a memory descriptor for packed sparse
         /// encoding.
         ///
@@ -9684,6 +9765,14 @@ struct rnn_primitive_desc_base : public primitive_desc {
         return base::query_md(query::exec_arg_md, DNNL_ARG_DST_ITER_C);
     }
 
+    /// Returns sequence lengths memory descriptor.
+    /// @returns Sequence lengths memory descriptor.
+    /// @returns A zero memory descriptor if the primitive was not created
+    ///          with the #dnnl::rnn_flags::variable_length flag.
+    memory::desc seq_lengths_desc() const {
+        return base::query_md(query::exec_arg_md, DNNL_ARG_SEQ_LENGTHS);
+    }
+
     /// Returns diff source layer memory descriptor.
     /// @returns Diff source layer memory descriptor.
     memory::desc diff_src_layer_desc() const {
@@ -14203,6 +14292,25 @@ inline cpu_isa_hints get_cpu_isa_hints() {
     return static_cast<cpu_isa_hints>(dnnl_get_cpu_isa_hints());
 }
 
+/// @copydoc dnnl_trace_format_t
+enum class trace_format {
+    /// @copydoc dnnl_trace_format_chrome_json
+    chrome_json = dnnl_trace_format_chrome_json,
+    /// @copydoc dnnl_trace_format_perfetto
+    perfetto = dnnl_trace_format_perfetto,
+};
+
+/// @copydoc dnnl_set_trace()
+inline status set_trace(int enable) {
+    return static_cast<status>(dnnl_set_trace(enable));
+}
+
+/// @copydoc dnnl_dump_trace()
+inline status dump_trace(const std::string &path, trace_format format) {
+    return static_cast<status>(dnnl_dump_trace(
+            path.c_str(), static_cast<dnnl_trace_format_t>(format)));
+}
+
 /// @} dnnl_api_service
 
 #ifdef DNNL_EXPERIMENTAL_PROFILING
@@ -14284,6 +14392,73 @@ inline void set_primitive_cache_capacity(int capacity) {
             "could not set primitive cache capacity");
 }
 
+/// @copydoc dnnl_primitive_cache_stats_t
+using primitive_cache_stats = dnnl_primitive_cache_stats_t;
+
+/// Sets the number of primitives of a kind that can be held in the primitive
+/// cache at a time.
+///
+/// @sa dnnl_set_primitive_cache_kind_capacity
+///
+/// @param akind Primitive kind.
+/// @param capacity Primitive cache capacity for the primitive kind, -1 to
+///     remove the limit.
+inline void set_primitive_cache_capacity(primitive::kind akind, int capacity) {
+    error::wrap_c_api(dnnl_set_primitive_cache_kind_capacity(
+                              convert_to_c(akind), capacity),
+            "could not set primitive cache capacity for a primitive kind");
+}
+
+/// Returns primitive cache statistics for a primitive kind.
+///
+/// @sa dnnl_get_primitive_cache_stats
+///
+/// @param akind Primitive kind, #dnnl::primitive::kind::undef for the
+///     statistics of the whole primitive cache.
+/// @returns Primitive cache statistics.
+inline primitive_cache_stats get_primitive_cache_stats(
+        primitive::kind akind = primitive::kind::undef) {
+    primitive_cache_stats result {};
+    error::wrap_c_api(
+            dnnl_get_primitive_cache_stats(convert_to_c(akind), &result),
+            "could not get primitive cache statistics");
+    return result;
+}
+
+/// Saves the primitives that the primitive cache holds for an engine into a
+/// bundle file.
+///
+/// @sa dnnl_primitive_cache_save_bundle
+///
+/// @param aengine Engine to save the primitives for.
+/// @param path Path to the bundle file.
+/// @returns The number of saved primitives.
+inline int save_primitive_cache_bundle(
+        const engine &aengine, const std::string &path) {
+    int result = 0;
+    error::wrap_c_api(dnnl_primitive_cache_save_bundle(
+                              aengine.get(), path.c_str(), &result),
+            "could not save primitive cache bundle");
+    return result;
+}
+
+/// Creates the primitives recorded in a bundle file for an engine and puts
+/// them into the primitive cache.
+///
+/// @sa dnnl_primitive_cache_load_bundle
+///
+/// @param aengine Engine to create the primitives for.
+/// @param path Path to the bundle file.
+/// @returns The number of primitives put into the primitive cache.
+inline int load_primitive_cache_bundle(
+        const engine &aengine, const std::string &path) {
+    int result = 0;
+    error::wrap_c_api(dnnl_primitive_cache_load_bundle(
+                              aengine.get(), path.c_str(), &result),
+            "could not load primitive cache bundle");
+    return result;
+}
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_blas BLAS functions
@@ -14319,6 +14494,169 @@ inline status gemm_s8s8s32(char transa, char transb, char offsetc, dnnl_dim_t M,
             K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co));
 }
 
+/// @copydoc dnnl_gemm_bf16bf16f32()
+inline status gemm_bf16bf16f32(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const uint16_t *A,
+        dnnl_dim_t lda, const uint16_t *B, dnnl_dim_t ldb, float beta,
+        float *C, dnnl_dim_t ldc) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32(
+            transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc));
+}
+
+/// @copydoc dnnl_sgemm_batch_strided()
+inline status sgemm_batch_strided(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A,
+        dnnl_dim_t lda, dnnl_dim_t stride_a, const float *B, dnnl_dim_t ldb,
+        dnnl_dim_t stride_b, float beta, float *C, dnnl_dim_t ldc,
+        dnnl_dim_t stride_c, dnnl_dim_t batch) {
+    return static_cast<status>(dnnl_sgemm_batch_strided(transa, transb, M, N,
+            K, alpha, A, lda, stride_a, B, ldb, stride_b, beta, C, ldc,
+            stride_c, batch));
+}
+
+/// @copydoc dnnl_sgemm_batch()
+inline status sgemm_batch(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *const *A,
+        dnnl_dim_t lda, const float *const *B, dnnl_dim_t ldb, float beta,
+        float *const *C, dnnl_dim_t ldc, dnnl_dim_t batch) {
+    return static_cast<status>(dnnl_sgemm_batch(transa, transb, M, N, K, alpha,
+            A, lda, B, ldb, beta, C, ldc, batch));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_batch_strided()
+inline status gemm_u8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a, uint8_t ao,
+        const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b, int8_t bo,
+        float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t batch) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_batch_strided(transa, transb,
+            offsetc, M, N, K, alpha, A, lda, stride_a, ao, B, ldb, stride_b, bo,
+            beta, C, ldc, stride_c, co, batch));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_batch_strided()
+inline status gemm_s8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const int8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a, int8_t ao,
+        const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b, int8_t bo,
+        float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t batch) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_batch_strided(transa, transb,
+            offsetc, M, N, K, alpha, A, lda, stride_a, ao, B, ldb, stride_b, bo,
+            beta, C, ldc, stride_c, co, batch));
+}
+
+/// @copydoc dnnl_gemm_bf16bf16f32_batch_strided()
+inline status gemm_bf16bf16f32_batch_strided(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint16_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a,
+        const uint16_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b, float beta,
+        float *C, dnnl_dim_t ldc, dnnl_dim_t stride_c, dnnl_dim_t batch) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32_batch_strided(transa,
+            transb, M, N, K, alpha, A, lda, stride_a, B, ldb, stride_b, beta, C,
+            ldc, stride_c, batch));
+}
+
+/// @copydoc dnnl_sgemm_pack_get_size()
+inline status sgemm_pack_get_size(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_sgemm_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_sgemm_pack()
+inline status sgemm_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const float *src, float *dst) {
+    return static_cast<status>(dnnl_sgemm_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_sgemm_compute()
+inline status sgemm_compute(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, const float *A, dnnl_dim_t lda,
+        const float *B, dnnl_dim_t ldb, float beta, float *C, dnnl_dim_t ldc) {
+    return static_cast<status>(dnnl_sgemm_compute(
+            transa, transb, M, N, K, A, lda, B, ldb, beta, C, ldc));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_pack_get_size()
+inline status gemm_u8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_pack()
+inline status gemm_u8s8s32_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_compute()
+inline status gemm_u8s8s32_compute(char transa, char transb, char offsetc,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const uint8_t *A,
+        dnnl_dim_t lda, const int8_t *B, dnnl_dim_t ldb, float beta,
+        int32_t *C, dnnl_dim_t ldc, const int32_t *co) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_compute(transa, transb,
+            offsetc, M, N, K, A, lda, B, ldb, beta, C, ldc, co));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_pack_get_size()
+inline status gemm_s8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_pack()
+inline status gemm_s8s8s32_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_compute()
+inline status gemm_s8s8s32_compute(char transa, char transb, char offsetc,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const int8_t *A,
+        dnnl_dim_t lda, const int8_t *B, dnnl_dim_t ldb, float beta,
+        int32_t *C, dnnl_dim_t ldc, const int32_t *co) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_compute(transa, transb,
+            offsetc, M, N, K, A, lda, B, ldb, beta, C, ldc, co));
+}
+
+/// @copydoc dnnl_gemm_bf16bf16f32_pack_get_size()
+inline status gemm_bf16bf16f32_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_gemm_bf16bf16f32_pack()
+inline status gemm_bf16bf16f32_pack(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const uint16_t *src, uint16_t *dst) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_gemm_bf16bf16f32_compute()
+inline status gemm_bf16bf16f32_compute(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, const uint16_t *A, dnnl_dim_t lda,
+        const uint16_t *B, dnnl_dim_t ldb, float beta, float *C,
+        dnnl_dim_t ldc) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32_compute(
+            transa, transb, M, N, K, A, lda, B, ldb, beta, C, ldc));
+}
+
 /// @} dnnl_api_blas
 
 // implementation section
@@ -866,6 +866,12 @@ public:
         GenIndex = dnnl_graph_op_gen_index,
         GreaterEqual = dnnl_graph_op_greater_equal,
         Dropout = dnnl_graph_op_dropout,
+        EmbeddingBag = dnnl_graph_op_embedding_bag,
+        RoPE = dnnl_graph_op_rope,
+        TopK = dnnl_graph_op_topk,
+        Slice = dnnl_graph_op_slice,
+        Split = dnnl_graph_op_split,
+        Pad = dnnl_graph_op_pad,
         // Sentinel
         LastSymbol = dnnl_graph_op_last_symbol,
     };
@@ -894,6 +900,10 @@ public:
         min = dnnl_graph_op_attr_min,
         /// Specifies a momentum attribute to an op.
         momentum = dnnl_graph_op_attr_momentum,
+        /// Specifies a temperature attribute to an op.
+        temperature = dnnl_graph_op_attr_temperature,
+        /// Specifies a pad_value attribute to an op.
+        pad_value = dnnl_graph_op_attr_pad_value,
 
         // float32 vector attributes. The value of these attributes can be a
         // vector of float32 numbers.
@@ -910,6 +920,8 @@ public:
         begin_norm_axis = dnnl_graph_op_attr_begin_norm_axis,
         /// Specifies a groups attribute to an op.
         groups = dnnl_graph_op_attr_groups,
+        /// Specifies a k attribute to an op.
+        k = dnnl_graph_op_attr_k,
 
         // int64_t vector attributes. The value of these attributes can be a
         // vector of int64 numbers.
@@ -948,6 +960,10 @@ public:
         /// size, which indicates the number of elements that will share the
         /// same scaling factor.
         group_shape = dnnl_graph_op_attr_group_shape,
+        /// Specifies a starts attribute to an op.
+        starts = dnnl_graph_op_attr_starts,
+        /// Specifies an ends attribute to an op.
+        ends = dnnl_graph_op_attr_ends,
 
         // bool attributes. The value of these attributes can be any single bool
         // value.
@@ -278,6 +278,12 @@ typedef enum {
     dnnl_graph_op_greater_equal,
     dnnl_graph_op_rms_norm,
     dnnl_graph_op_dropout,
+    dnnl_graph_op_embedding_bag,
+    dnnl_graph_op_rope,
+    dnnl_graph_op_topk,
+    dnnl_graph_op_slice,
+    dnnl_graph_op_split,
+    dnnl_graph_op_pad,
     dnnl_graph_op_last_symbol,
 } dnnl_graph_op_kind_t;
 
@@ -301,6 +307,10 @@ typedef enum {
     dnnl_graph_op_attr_min,
     /// Specifies a momentum attribute to an op.
     dnnl_graph_op_attr_momentum,
+    /// Specifies a temperature attribute to an op.
+    dnnl_graph_op_attr_temperature,
+    /// Specifies a pad_value attribute to an op.
+    dnnl_graph_op_attr_pad_value,
 
     // float32 vector attributes. The value of these attributes can be a vector
     // of float32 numbers.
@@ -317,6 +327,8 @@ typedef enum {
     dnnl_graph_op_attr_begin_norm_axis,
     /// Specifies a groups attribute to an op.
     dnnl_graph_op_attr_groups,
+    /// Specifies a k attribute to an op.
+    dnnl_graph_op_attr_k,
 
     // int64_t vector attributes. The value of these attributes can be a vector
     // of int64 numbers.
@@ -351,6 +363,10 @@ typedef enum {
     dnnl_graph_op_attr_zps,
     /// Specifies a group shape attribute to an op.
     dnnl_graph_op_attr_group_shape,
+    /// Specifies a starts attribute to an op.
+    dnnl_graph_op_attr_starts,
+    /// Specifies an ends attribute to an op.
+    dnnl_graph_op_attr_ends,
 
     // bool attributes. The value of these attributes can be any single bool
     // value.
@@ -77,6 +77,15 @@ typedef enum {
     dnnl_packed,
     /// Coordinate Sparse Encoding (COO).
     dnnl_coo,
+    /// Block Compressed Sparse Row (BSR) encoding. The tensor is split
+    /// into dense blocks of a fixed shape and only non-zero blocks are
+    /// stored, each of them in row-major order.
+    dnnl_bsr,
+    /// 2:4 structured sparsity encoding. Every group of four consecutive
+    /// elements along the first dimension contains at most two non-zero
+    /// elements. The tensor is stored as the compressed values and
+    /// a 2-bit position of each kept value within its group.
+    dnnl_structured_2_4,
 #if DNNL_EXPERIMENTAL_GROUPED_MEMORY
     /// Grouped Encoding represents a tensor where one dimension has variable
     /// size per group.
@@ -2389,6 +2398,10 @@ typedef enum {
     dnnl_rnn_flags_undef = 0x0,
     /// Do not add weights gradient to existing diff_weights memory
     dnnl_rnn_flags_diff_weights_overwrite = 0x1,
+    /// Use per-sample sequence lengths passed at execution time via
+    /// #DNNL_ARG_SEQ_LENGTHS. Time steps beyond the length of a sample are
+    /// not computed.
+    dnnl_rnn_flags_variable_length = 0x2,
 } dnnl_rnn_flags_t;
 
 /// A direction of RNN primitive execution.
@@ -2481,7 +2494,9 @@ typedef enum {
     dnnl_quantization_mode_dynamic_mx,
     /// dynamic quantization mode where quantization parameter is computed by
     /// oneDNN as \f$scale\_dt(amax(X) / max(dst\_dt))\f$ in `f32` then
-    /// converted to a scale type and written as an output.
+    /// converted to a scale type and written as an output. For matmul source
+    /// scales, `dst_dt` stands for the weights data type the source is
+    /// quantized to.
     dnnl_quantization_mode_dynamic_fp,
 } dnnl_quantization_mode_t;
 
@@ -2570,6 +2585,12 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// #DNNL_ARG_SRC_3.
 #define DNNL_ARG_AUGRU_ATTENTION DNNL_ARG_SRC_3
 
+/// Source argument #4.
+#define DNNL_ARG_SRC_4 5
+/// A special mnemonic for RNN per-sample sequence lengths. An alias for
+/// #DNNL_ARG_SRC_4.
+#define DNNL_ARG_SEQ_LENGTHS DNNL_ARG_SRC_4
+
 /// Destination argument #0.
 #define DNNL_ARG_DST_0 17
 /// A special mnemonic for destination argument for primitives that have a
@@ -3030,8 +3051,37 @@ typedef enum {
     dnnl_cpu_isa_prefer_ymm = 0x1,
 } dnnl_cpu_isa_hints_t;
 
+/// Timeline trace formats.
+typedef enum {
+    /// Chrome trace event format (JSON). Can be opened with chrome://tracing
+    /// or the Perfetto UI.
+    dnnl_trace_format_chrome_json = 0,
+    /// Perfetto trace format (protobuf).
+    dnnl_trace_format_perfetto = 1,
+} dnnl_trace_format_t;
+
 /// @} dnnl_api_service
 
+/// @addtogroup dnnl_api_primitive_cache
+/// @{
+
+/// Primitive cache statistics.
+typedef struct {
+    /// Number of primitive creations that took the primitive from the cache.
+    int64_t hits;
+    /// Number of primitive creations that did not find the primitive in the
+    /// cache.
+    int64_t misses;
+    /// Number of primitives evicted from the cache.
+    int64_t evictions;
+    /// Number of primitives in the cache.
+    int size;
+    /// Maximum number of primitives the cache can hold, -1 if not limited.
+    int capacity;
+} dnnl_primitive_cache_stats_t;
+
+/// @} dnnl_api_primitive_cache
+
 /// @} dnnl_api
 
 #ifdef __cplusplus
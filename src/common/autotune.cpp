@@ -0,0 +1,356 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "cpu/platform.hpp"
+
+#include "autotune.hpp"
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "engine.hpp"
+#include "memory_desc_wrapper.hpp"
+#include "primitive_desc.hpp"
+#include "primitive_desc_iface.hpp"
+#include "primitive_desc_iterator.hpp"
+#include "primitive_iface.hpp"
+#include "primitive_serialization.hpp"
+#include "serialization.hpp"
+#include "utils.hpp"
+#include "verbose.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace autotune {
+
+namespace {
+
+// Each candidate is executed until either of the limits is reached, the
+// fastest run is taken as its time.
+constexpr int max_timed_runs = 10;
+constexpr double max_time_per_candidate_ms = 100.0;
+
+struct entry_t {
+    std::string impl_name;
+    // Several implementations may share a name, the occurrence tells which of
+    // the candidates with the name won.
+    int occurrence = 0;
+    double time_ms = 0.0;
+};
+
+// The tuning database is a text file with one tab-separated entry per line:
+//     <problem key> <cpu model> <implementation name> <occurrence> <time, ms>
+// The problem key includes the CPU model, the effective ISA and the number of
+// threads, so the same file can be shared between machines. Entries are
+// appended as problems get tuned; the last entry for a key wins.
+struct tuning_db_t {
+    static tuning_db_t &get() {
+        static tuning_db_t db;
+        return db;
+    }
+
+    bool find(const std::string &key, entry_t &entry) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto it = entries_.find(key);
+        if (it == entries_.end()) return false;
+        entry = it->second;
+        return true;
+    }
+
+    void store(const std::string &key, const entry_t &entry) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_[key] = entry;
+
+        std::ofstream ofs(path_, std::ios::app);
+        if (!ofs) {
+            VWARN(common, autotune, "cannot write tuning database %s",
+                    path_.c_str());
+            return;
+        }
+        ofs << key << '\t' << cpu::platform::get_cpu_model() << '\t'
+            << entry.impl_name << '\t' << entry.occurrence << '\t'
+            << entry.time_ms << '\n';
+    }
+
+private:
+    tuning_db_t() {
+        path_ = getenv_string_user("AUTOTUNE_DB");
+        if (path_.empty()) path_ = "onednn_autotune.db";
+
+        std::ifstream ifs(path_);
+        std::string line;
+        while (std::getline(ifs, line)) {
+            if (line.empty() || line[0] == '#') continue;
+            std::vector<std::string> fields;
+            std::istringstream iss(line);
+            std::string field;
+            while (std::getline(iss, field, '\t'))
+                fields.push_back(field);
+            if (fields.size() != 5) continue;
+
+            entry_t entry;
+            entry.impl_name = fields[2];
+            entry.occurrence = std::atoi(fields[3].c_str());
+            entry.time_ms = std::atof(fields[4].c_str());
+            entries_[fields[0]] = entry;
+        }
+    }
+
+    std::mutex mutex_;
+    std::string path_;
+    std::unordered_map<std::string, entry_t> entries_;
+};
+
+// 64-bit FNV-1a. Unlike std::hash the result is the same for every process
+// and build, which is required for the key to be persisted.
+uint64_t hash_bytes(const std::vector<uint8_t> &data) {
+    uint64_t h = 14695981039346656037ULL;
+    for (const auto b : data) {
+        h ^= b;
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+status_t get_problem_key(
+        const primitive_desc_iterator_t &iterator, std::string &key) {
+    serialization_stream_t sstream;
+    CHECK(serialize_desc(sstream, iterator.op_desc()));
+    serialize(sstream, iterator.attr());
+    if (iterator.hint_fwd_pd()) {
+        for (const auto &md : iterator.hint_fwd_pd()->hint_mds(true))
+            serialize(sstream, md);
+    }
+
+    const auto *engine = iterator.engine();
+    sstream.append(engine->kind());
+    sstream.append(engine->runtime_kind());
+    sstream.append(dnnl_get_max_threads());
+
+    const auto version = dnnl_version();
+    sstream.append(version->major);
+    sstream.append(version->minor);
+    sstream.append(version->patch);
+    sstream.append_array(std::strlen(version->hash), version->hash);
+
+    const char *cpu_model = cpu::platform::get_cpu_model();
+    sstream.append_array(std::strlen(cpu_model), cpu_model);
+    const char *isa = cpu::platform::get_isa_info();
+    sstream.append_array(std::strlen(isa), isa);
+
+    char buf[17];
+    snprintf(buf, sizeof(buf), "%016llx",
+            static_cast<unsigned long long>(hash_bytes(sstream.get_data())));
+    key = buf;
+    return status::success;
+}
+
+// Returns the arguments of the primitive that must be provided at execution.
+// Fails when the memory descriptor of a required argument is not known in
+// advance (e.g. runtime quantization parameters), such problems are not tuned.
+status_t get_exec_args(const primitive_desc_t *pd, std::vector<int> &args) {
+    using arg_usage_t = primitive_desc_t::arg_usage_t;
+
+    std::vector<int> candidates;
+    for (int arg = 1; arg <= DNNL_ARG_ATTR_OUTPUT_SCALES; ++arg)
+        candidates.push_back(arg);
+    for (int idx = 0; idx < pd->attr()->post_ops_.len(); ++idx) {
+        for (int arg : {DNNL_ARG_SRC_1, DNNL_ARG_SRC_2, DNNL_ARG_WEIGHTS})
+            candidates.push_back(DNNL_ARG_ATTR_MULTIPLE_POST_OP(idx) | arg);
+    }
+
+    if (!pd->attr()->scales_.has_default_values()
+            || !pd->attr()->zero_points_.has_default_values()
+            || !pd->attr()->precomputed_reductions_.has_default_values())
+        return status::unimplemented;
+
+    for (const int arg : candidates) {
+        if (pd->arg_usage(arg) == arg_usage_t::unused) continue;
+        const auto *md = pd->arg_md(arg);
+        if (!md || memory_desc_wrapper(md).is_zero()
+                || memory_desc_wrapper(md).has_runtime_dims_or_strides())
+            return status::unimplemented;
+        args.push_back(arg);
+    }
+    return status::success;
+}
+
+// Creates the primitive for `pd`, executes it on zero-initialized memory and
+// returns the time of the fastest run.
+status_t time_candidate(const std::shared_ptr<primitive_desc_t> &pd,
+        engine_t *engine, double &time_ms) {
+    std::vector<int> args;
+    CHECK(get_exec_args(pd.get(), args));
+
+    primitive_desc_iface_t pd_iface(pd, engine);
+    primitive_iface_t *primitive_ptr = nullptr;
+    CHECK(dnnl_primitive_create(&primitive_ptr, &pd_iface));
+    std::unique_ptr<primitive_iface_t, decltype(&dnnl_primitive_destroy)>
+            primitive(primitive_ptr, &dnnl_primitive_destroy);
+
+    stream_t *stream_ptr = nullptr;
+    CHECK(dnnl_stream_create(&stream_ptr, engine, dnnl_stream_default_flags));
+    std::unique_ptr<stream_t, decltype(&dnnl_stream_destroy)> stream(
+            stream_ptr, &dnnl_stream_destroy);
+
+    std::vector<std::unique_ptr<memory_t, decltype(&dnnl_memory_destroy)>>
+            memories;
+    std::vector<dnnl_exec_arg_t> exec_args;
+    for (const int arg : args) {
+        const auto *md = pd->arg_md(arg);
+        memory_t *mem_ptr = nullptr;
+        CHECK(dnnl_memory_create(&mem_ptr, md, engine, DNNL_MEMORY_ALLOCATE));
+        memories.emplace_back(mem_ptr, &dnnl_memory_destroy);
+
+        void *handle = nullptr;
+        CHECK(dnnl_memory_get_data_handle(mem_ptr, &handle));
+        if (handle) std::memset(handle, 0, memory_desc_wrapper(md).size());
+        exec_args.push_back({arg, mem_ptr});
+    }
+
+    const auto execute = [&]() {
+        CHECK(dnnl_primitive_execute(primitive.get(), stream.get(),
+                static_cast<int>(exec_args.size()), exec_args.data()));
+        return dnnl_stream_wait(stream.get());
+    };
+
+    // The first run warms up the caches and is not timed.
+    CHECK(execute());
+
+    double total_ms = 0.0;
+    time_ms = 0.0;
+    for (int run = 0; run < max_timed_runs; ++run) {
+        const double start_ms = get_msec();
+        CHECK(execute());
+        const double run_ms = get_msec() - start_ms;
+        time_ms = run == 0 ? run_ms : nstl::min(time_ms, run_ms);
+        total_ms += run_ms;
+        if (total_ms >= max_time_per_candidate_ms) break;
+    }
+    return status::success;
+}
+
+// Times every candidate the iterator yields and returns the fastest one.
+bool tune(primitive_desc_iterator_t &iterator, entry_t &winner) {
+    std::unordered_map<std::string, int> occurrences;
+    bool found = false;
+
+    for (++iterator; iterator != iterator.end(); ++iterator) {
+        const auto &pd = *iterator;
+        const std::string name = pd->name();
+        const int occurrence = occurrences[name]++;
+
+        double time_ms = 0.0;
+        const auto status = time_candidate(pd, iterator.engine(), time_ms);
+        if (status != status::success) {
+            VINFO(primitive, create, dispatch, autotune,
+                    "%s,candidate %s could not be timed",
+                    pd->info(iterator.engine()), name.c_str());
+            continue;
+        }
+        VINFO(primitive, create, dispatch, autotune,
+                "%s,candidate %s took %g ms", pd->info(iterator.engine()),
+                name.c_str(), time_ms);
+
+        if (!found || time_ms < winner.time_ms) {
+            winner.impl_name = name;
+            winner.occurrence = occurrence;
+            winner.time_ms = time_ms;
+            found = true;
+        }
+    }
+    return found;
+}
+
+std::unique_ptr<primitive_desc_iterator_t> clone_iterator(
+        const primitive_desc_iterator_t &iterator) {
+    return utils::make_unique<primitive_desc_iterator_t>(iterator.engine(),
+            iterator.op_desc(), &iterator.attr(), iterator.hint_fwd_pd());
+}
+
+// Candidates created while tuning must not be tuned themselves.
+thread_local bool is_tuning = false;
+
+} // namespace
+
+mode_t get_mode() {
+    static const mode_t mode = []() {
+        const int value = getenv_int_user("AUTOTUNE", 0);
+        if (value == static_cast<int>(mode_t::reuse)) return mode_t::reuse;
+        if (value == static_cast<int>(mode_t::tune)) return mode_t::tune;
+        return mode_t::disabled;
+    }();
+    return mode;
+}
+
+status_t select_impl(std::unique_ptr<primitive_desc_iterator_t> &iterator) {
+    const mode_t mode = get_mode();
+    if (mode == mode_t::disabled || is_tuning) return status::success;
+    // Only the host memory can be initialized for the timed runs.
+    if (iterator->engine()->kind() != engine_kind::cpu)
+        return status::success;
+
+    std::string key;
+    if (get_problem_key(*iterator, key) != status::success)
+        return status::success;
+
+    auto &db = tuning_db_t::get();
+    entry_t entry;
+    if (!db.find(key, entry)) {
+        if (mode != mode_t::tune) return status::success;
+
+        auto tune_iterator = clone_iterator(*iterator);
+        if (!tune_iterator || !tune_iterator->is_initialized())
+            return status::out_of_memory;
+        is_tuning = true;
+        const bool found = tune(*tune_iterator, entry);
+        is_tuning = false;
+        if (!found) return status::success;
+        db.store(key, entry);
+    }
+
+    // Position a fresh iterator at the selected implementation so that
+    // querying the next implementation keeps working.
+    auto selected = clone_iterator(*iterator);
+    if (!selected || !selected->is_initialized()) return status::out_of_memory;
+    int occurrence = 0;
+    for (++(*selected); *selected != selected->end(); ++(*selected)) {
+        if (entry.impl_name != (**selected)->name()) continue;
+        if (occurrence++ != entry.occurrence) continue;
+
+        VINFO(primitive, create, dispatch, autotune,
+                "%s,selected implementation %s from tuning database",
+                (**selected)->info(selected->engine()),
+                entry.impl_name.c_str());
+        iterator = std::move(selected);
+        return status::success;
+    }
+    // The implementation is not available anymore, e.g. the database was
+    // produced by another version of the library.
+    return status::success;
+}
+
+} // namespace autotune
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,55 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_AUTOTUNE_HPP
+#define COMMON_AUTOTUNE_HPP
+
+#include <memory>
+
+#include "c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct primitive_desc_iterator_t;
+
+namespace autotune {
+
+// Controlled by the ONEDNN_AUTOTUNE environment variable.
+enum class mode_t {
+    // Implementations are selected by the order of the implementation lists.
+    disabled = 0,
+    // Implementations stored in the tuning database are reused, problems
+    // missing from the database use the implementation list order.
+    reuse = 1,
+    // Problems missing from the tuning database are tuned by timing every
+    // implementation that supports them, and the winners are stored.
+    tune = 2,
+};
+
+mode_t get_mode();
+
+// Moves the iterator, which points to the first implementation, to the
+// implementation the tuning database holds for the problem. The problem is
+// tuned first when it is missing from the database and the mode allows it. The
+// iterator is left untouched when there is nothing better to select.
+status_t select_impl(std::unique_ptr<primitive_desc_iterator_t> &iterator);
+
+} // namespace autotune
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -155,6 +155,10 @@ const alg_kind_t softmax_accurate_inf_as_zero
         = (alg_kind_t)(internal_only_start + 2);
 // GPU only via jit_eltwise injector.
 const alg_kind_t eltwise_mx_scale = (alg_kind_t)(internal_only_start + 3);
+// Rotary position embedding variants: pairs are formed either from adjacent
+// elements or from the two halves of the rotated dimension.
+const alg_kind_t rope_interleaved = (alg_kind_t)(internal_only_start + 4);
+const alg_kind_t rope_half = (alg_kind_t)(internal_only_start + 5);
 } // namespace alg_kind
 
 using data_type_t = dnnl_data_type_t;
@@ -228,6 +232,8 @@ const sparse_encoding_t undef = dnnl_sparse_encoding_undef;
 const sparse_encoding_t csr = dnnl_csr;
 const sparse_encoding_t coo = dnnl_coo;
 const sparse_encoding_t packed = dnnl_packed;
+const sparse_encoding_t bsr = dnnl_bsr;
+const sparse_encoding_t structured_2_4 = dnnl_structured_2_4;
 #if DNNL_EXPERIMENTAL_GROUPED_MEMORY
 const sparse_encoding_t grouped = dnnl_grouped;
 #endif
@@ -1977,6 +1983,7 @@ namespace rnn_flags {
 const rnn_flags_t undef = dnnl_rnn_flags_undef;
 const rnn_flags_t diff_weights_overwrite
         = dnnl_rnn_flags_diff_weights_overwrite;
+const rnn_flags_t variable_length = dnnl_rnn_flags_variable_length;
 } // namespace rnn_flags
 
 using engine_kind_t = dnnl_engine_kind_t;
@@ -2038,6 +2045,10 @@ const primitive_kind_t internal_only_start = (primitive_kind_t)(1 << 12);
 const primitive_kind_t zero_pad = internal_only_start;
 const primitive_kind_t sdpa = (primitive_kind_t)(internal_only_start + 1);
 const primitive_kind_t gated_mlp = (primitive_kind_t)(internal_only_start + 2);
+const primitive_kind_t embedding_bag
+        = (primitive_kind_t)(internal_only_start + 3);
+const primitive_kind_t rope = (primitive_kind_t)(internal_only_start + 4);
+const primitive_kind_t topk = (primitive_kind_t)(internal_only_start + 5);
 } // namespace primitive_kind
 
 using query_t = dnnl_query_t;
@@ -18,17 +18,17 @@
 #define COMMON_CACHE_UTILS_HPP
 
 #include <algorithm>
+#include <chrono>
 #include <future>
 #include <memory>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "oneapi/dnnl/dnnl_config.h"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "cpu/platform.hpp"
-#else
-#include <chrono>
 #endif
 
 #ifdef _WIN32
@@ -47,6 +47,17 @@ namespace utils {
 template <typename K, typename O>
 using key_merge_t = void (*)(const K &, const O &);
 
+// Statistics of a cache partition. Hits and misses are counted on
+// get_or_create() calls.
+struct cache_partition_stats_t {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+    int size = 0;
+    // The maximum number of entries of the partition, -1 if not limited.
+    int capacity = -1;
+};
+
 template <typename K, typename O, typename C,
         key_merge_t<K, O> key_merge = nullptr>
 struct cache_t {
@@ -83,8 +94,10 @@ struct cache_t {
         if (!force_create && p_future.valid()) {
             // The requested object is present in the cache or is being created
             // by another thread.
+            count_lookup(key, true);
             return p_future.get();
         } else {
+            count_lookup(key, false);
             // The requested object is NOT present in the cache therefore we
             // have to create it and notify the waiting threads once the
             // creation is done.
@@ -115,13 +128,18 @@ protected:
     virtual value_t get_or_add(const key_t &key, const value_t &value) = 0;
     virtual void remove_if_invalidated(const key_t &key) = 0;
     virtual void update_entry(const key_t &key, const object_t &p) = 0;
+    virtual void count_lookup(const key_t &key, bool hit) = 0;
     static utils::rw_mutex_t &rw_mutex() {
         static utils::rw_mutex_t mutex;
         return mutex;
     }
 };
 
-// The cache uses LRU replacement policy
+// The cache uses LRU replacement policy. Entries can optionally be assigned to
+// partitions, e.g. by the kind of the cached object. Each partition keeps its
+// own statistics and can be given its own capacity, in which case an entry
+// added to a full partition evicts the least recently used entry of that
+// partition rather than of the whole cache.
 template <typename K, typename O, typename C,
         key_merge_t<K, O> key_merge = nullptr>
 struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
@@ -130,7 +148,17 @@ struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
     using object_t = typename lru_base_t::object_t;
     using cache_object_t = typename lru_base_t::cache_object_t;
     using value_t = typename lru_base_t::value_t;
-    lru_cache_t(int capacity) : capacity_(capacity) {}
+    using partition_func_t = int (*)(const key_t &);
+
+    lru_cache_t(int capacity, int n_partitions = 1,
+            partition_func_t partition_func = nullptr)
+        : capacity_(capacity)
+        , n_partitions_(n_partitions)
+        , partition_func_(partition_func)
+        , partitions_(new partition_t[n_partitions]) {
+        assert(n_partitions > 0);
+        assert(n_partitions == 1 || partition_func != nullptr);
+    }
 
     ~lru_cache_t() override {
         if (cache_mapper().empty()) return;
@@ -184,11 +212,71 @@ struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
         capacity_ = capacity;
     }
 
+    // Sets the maximum number of entries of the partition. -1 removes the
+    // limit, 0 stops caching the entries of the partition.
+    status_t set_partition_capacity(int partition, int capacity) {
+        if (partition < 0 || partition >= n_partitions_ || capacity < -1)
+            return status::invalid_arguments;
+
+        utils::lock_write_t lock_w(this->rw_mutex());
+        auto &part = partitions_[partition];
+        part.capacity = capacity;
+        if (capacity >= 0 && part.size > capacity)
+            evict(part.size - capacity, partition);
+        return status::success;
+    }
+
+    cache_partition_stats_t get_partition_stats(int partition) const {
+        cache_partition_stats_t stats;
+        if (partition < 0 || partition >= n_partitions_) return stats;
+
+        utils::lock_read_t lock_r(this->rw_mutex());
+        const auto &part = partitions_[partition];
+        stats.hits = part.hits.load(std::memory_order_relaxed);
+        stats.misses = part.misses.load(std::memory_order_relaxed);
+        stats.evictions = part.evictions;
+        stats.size = part.size;
+        stats.capacity = part.capacity;
+        return stats;
+    }
+
     int get_size() const override {
         utils::lock_read_t lock_r(this->rw_mutex());
         return get_size_no_lock();
     }
 
+    // Returns the objects whose keys satisfy the predicate, the least recently
+    // used first. Entries that are still being created are skipped.
+    template <typename pred_t>
+    std::vector<cache_object_t> get_objects(const pred_t &pred) const {
+        using v_t =
+                typename std::unordered_map<key_t, timed_entry_t>::value_type;
+
+        utils::lock_read_t lock_r(this->rw_mutex());
+        std::vector<const v_t *> entries;
+        for (const auto &e : cache_mapper()) {
+            if (!pred(e.first)) continue;
+            const auto &value = e.second.value_;
+            if (value.wait_for(std::chrono::seconds(0))
+                    != std::future_status::ready)
+                continue;
+            entries.push_back(&e);
+        }
+        std::sort(entries.begin(), entries.end(),
+                [](const v_t *left, const v_t *right) {
+                    return left->second.timestamp_.load(
+                                   std::memory_order_relaxed)
+                            < right->second.timestamp_.load(
+                                    std::memory_order_relaxed);
+                });
+
+        std::vector<cache_object_t> objects;
+        objects.reserve(entries.size());
+        for (const auto *e : entries)
+            objects.push_back(e->second.value_.get());
+        return objects;
+    }
+
 protected:
     int get_size_no_lock() const { return (int)cache_mapper().size(); }
 
@@ -197,7 +285,7 @@ protected:
             // 1. Section with shared access (read lock)
             utils::lock_read_t lock_r(this->rw_mutex());
             // Check if the cache is enabled.
-            if (capacity_ == 0) { return value_t(); }
+            if (capacity_ == 0 || !is_cached(key)) { return value_t(); }
             // Check if the requested entry is present in the cache (likely
             // cache_hit)
             auto e = get_future(key);
@@ -211,7 +299,7 @@ protected:
         // and acquiring the write lock (a.k.a. ABA problem), therefore
         // additional checks have to be performed for correctness. Double check
         // the capacity due to possible race condition
-        if (capacity_ == 0) { return value_t(); }
+        if (capacity_ == 0 || !is_cached(key)) { return value_t(); }
 
         // Double check if the requested entry is present in the cache (unlikely
         // cache_hit).
@@ -237,9 +325,15 @@ protected:
         if (!value.get().is_empty()) { return; }
 
         // Remove the invalidated entry
+        partitions_[partition_of(key)].size--;
         cache_mapper().erase(it);
     }
 
+    void count_lookup(const key_t &key, bool hit) override {
+        auto &part = partitions_[partition_of(key)];
+        (hit ? part.hits : part.misses).fetch_add(1, std::memory_order_relaxed);
+    }
+
 private:
     static size_t get_timestamp() {
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
@@ -273,45 +367,82 @@ private:
         key_merge(it->first, p);
     }
 
-    void evict(int n) {
+    int partition_of(const key_t &key) const {
+        const int partition = partition_func_ ? partition_func_(key) : 0;
+        assert(partition >= 0 && partition < n_partitions_);
+        return partition;
+    }
+
+    bool is_cached(const key_t &key) const {
+        return partitions_[partition_of(key)].capacity != 0;
+    }
+
+    // Evicts `n` least recently used entries of the partition, or of the whole
+    // cache if `partition` is negative.
+    void evict(int n, int partition = -1) {
         using v_t =
                 typename std::unordered_map<key_t, timed_entry_t>::value_type;
 
-        if (n == capacity_) {
+        if (partition < 0 && n == capacity_) {
+            for (int p = 0; p < n_partitions_; p++) {
+                partitions_[p].evictions += partitions_[p].size;
+                partitions_[p].size = 0;
+            }
             cache_mapper().clear();
             return;
         }
 
+        const auto is_older = [](const v_t &left, const v_t &right) {
+            // By default, load() and operator T use sequentially
+            // consistent memory ordering, which enforces writing
+            // the timestamps into registers in the same exact order
+            // they are read from the CPU cache line. Since eviction
+            // is performed under a write lock, this order is not
+            // important, therefore we can safely use the weakest
+            // memory ordering (relaxed). This brings about a few
+            // microseconds performance improvement for default
+            // cache capacity.
+            return left.second.timestamp_.load(std::memory_order_relaxed)
+                    < right.second.timestamp_.load(std::memory_order_relaxed);
+        };
+
         for (int e = 0; e < n; e++) {
             // Find the smallest timestamp
             // TODO: revisit the eviction algorithm due to O(n) complexity, E.g.
             // maybe evict multiple entries at once.
-            auto it = std::min_element(cache_mapper().begin(),
-                    cache_mapper().end(),
-                    [&](const v_t &left, const v_t &right) {
-                // By default, load() and operator T use sequentially
-                // consistent memory ordering, which enforces writing
-                // the timestamps into registers in the same exact order
-                // they are read from the CPU cache line. Since eviction
-                // is performed under a write lock, this order is not
-                // important, therefore we can safely use the weakest
-                // memory ordering (relaxed). This brings about a few
-                // microseconds performance improvement for default
-                // cache capacity.
-                return left.second.timestamp_.load(std::memory_order_relaxed)
-                        < right.second.timestamp_.load(
-                                std::memory_order_relaxed);
-            });
+            auto it = cache_mapper().end();
+            if (partition < 0) {
+                it = std::min_element(
+                        cache_mapper().begin(), cache_mapper().end(), is_older);
+            } else {
+                for (auto cur = cache_mapper().begin();
+                        cur != cache_mapper().end(); ++cur) {
+                    if (partition_of(cur->first) != partition) continue;
+                    if (it == cache_mapper().end() || is_older(*cur, *it))
+                        it = cur;
+                }
+            }
+            if (it == cache_mapper().end()) return;
+
+            auto &part = partitions_[partition_of(it->first)];
+            part.size--;
+            part.evictions++;
             auto res = cache_mapper().erase(it->first);
             MAYBE_UNUSED(res);
             assert(res);
         }
     }
     void add(const key_t &key, const value_t &value) {
-        // std::list::size() method has linear complexity. Check the cache size
-        // using std::unordered_map::size();
-        if (get_size_no_lock() == capacity_) {
-            // Evict the least recently used entry
+        const int partition = partition_of(key);
+        auto &part = partitions_[partition];
+        if (part.capacity >= 0 && part.size >= part.capacity) {
+            // Evict the least recently used entry of the partition, this also
+            // makes room in the cache.
+            evict(1, partition);
+        } else if (get_size_no_lock() == capacity_) {
+            // std::list::size() method has linear complexity. Check the cache
+            // size using std::unordered_map::size(). Evict the least recently
+            // used entry.
             evict(1);
         }
 
@@ -322,6 +453,7 @@ private:
                 std::forward_as_tuple(value, timestamp));
         MAYBE_UNUSED(res);
         assert(res.second);
+        part.size++;
     }
     value_t get_future(const key_t &key) {
         auto it = cache_mapper().find(key);
@@ -334,6 +466,19 @@ private:
     }
 
     int capacity_;
+
+    struct partition_t {
+        std::atomic<size_t> hits {0};
+        std::atomic<size_t> misses {0};
+        // The fields below are modified under the write lock.
+        size_t evictions = 0;
+        int size = 0;
+        int capacity = -1;
+    };
+    int n_partitions_;
+    partition_func_t partition_func_;
+    std::unique_ptr<partition_t[]> partitions_;
+
     struct timed_entry_t {
         value_t value_;
         std::atomic<size_t> timestamp_;
@@ -0,0 +1,158 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+
+#include "primitive_desc.hpp"
+#include "utils.hpp"
+#include "verbose.hpp"
+
+#include "create_breakdown.hpp"
+#include "profiler.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace create_breakdown {
+
+namespace {
+
+std::atomic<bool> &enabled() {
+    static std::atomic<bool> enabled(false);
+    return enabled;
+}
+
+struct global_stats_t {
+    std::mutex mutex;
+    stats_t stats;
+    // Implementation names are string literals, but the same implementation
+    // may be instantiated in several translation units, so the names are
+    // compared by value.
+    std::map<std::string, rejection_stats_t> rejections;
+};
+
+global_stats_t &global_stats() {
+    // Leaked on purpose: creation may happen during the static destruction.
+    static auto *stats = new global_stats_t();
+    return *stats;
+}
+
+thread_local stats_t thread_stats;
+
+} // namespace
+
+const char *phase2str(phase_t phase) {
+    switch (phase) {
+        case phase_t::pd_iterate: return "pd_iterate";
+        case phase_t::pd_init_accepted: return "pd_init";
+        case phase_t::pd_init_rejected: return "pd_rejected";
+        case phase_t::hashing: return "hashing";
+        case phase_t::primitive_init: return "primitive_init";
+        case phase_t::jit_generate: return "jit";
+        default: assert(!"unknown phase");
+    }
+    return "unknown";
+}
+
+bool is_enabled() {
+    return enabled().load(std::memory_order_relaxed)
+            || get_verbose(verbose_t::create_profile);
+}
+
+void set_enabled(bool enabled_) {
+    enabled().store(enabled_, std::memory_order_relaxed);
+}
+
+stats_t get_stats() {
+    auto &g = global_stats();
+    std::lock_guard<std::mutex> guard(g.mutex);
+    return g.stats;
+}
+
+std::vector<rejection_stats_t> get_rejection_stats() {
+    std::vector<rejection_stats_t> ret;
+    {
+        auto &g = global_stats();
+        std::lock_guard<std::mutex> guard(g.mutex);
+        ret.reserve(g.rejections.size());
+        for (const auto &r : g.rejections)
+            ret.push_back(r.second);
+    }
+    std::sort(ret.begin(), ret.end(),
+            [](const rejection_stats_t &a, const rejection_stats_t &b) {
+                return a.time_ms > b.time_ms;
+            });
+    return ret;
+}
+
+void reset_stats() {
+    auto &g = global_stats();
+    std::lock_guard<std::mutex> guard(g.mutex);
+    g.stats = stats_t();
+    g.rejections.clear();
+}
+
+stats_t take_thread_stats() {
+    stats_t ret = thread_stats;
+    thread_stats = stats_t();
+    return ret;
+}
+
+void record(phase_t phase, double time_ms) {
+    auto &t = thread_stats[phase];
+    t.time_ms += time_ms;
+    t.count++;
+
+    auto &g = global_stats();
+    std::lock_guard<std::mutex> guard(g.mutex);
+    g.stats[phase].time_ms += time_ms;
+    g.stats[phase].count++;
+}
+
+void record_rejection(const char *impl_name, double time_ms) {
+    record(phase_t::pd_init_rejected, time_ms);
+    if (!impl_name) return;
+
+    auto &g = global_stats();
+    std::lock_guard<std::mutex> guard(g.mutex);
+    auto &r = g.rejections[impl_name];
+    if (r.impl_name.empty()) r.impl_name = impl_name;
+    r.count++;
+    r.time_ms += time_ms;
+}
+
+double start() {
+    return is_enabled() ? get_msec() : -1.0;
+}
+
+scope_t::~scope_t() {
+    if (start_ms_ >= 0) record(phase_, get_msec() - start_ms_);
+}
+
+pd_init_scope_t::~pd_init_scope_t() {
+    if (start_ms_ < 0) return;
+    const double time_ms = get_msec() - start_ms_;
+    if (accepted_)
+        record(phase_t::pd_init_accepted, time_ms);
+    else
+        record_rejection(pd_ ? pd_->name() : nullptr, time_ms);
+}
+
+} // namespace create_breakdown
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,141 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_CREATE_BREAKDOWN_HPP
+#define COMMON_CREATE_BREAKDOWN_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "c_types_map.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct primitive_desc_t;
+
+namespace create_breakdown {
+
+// Primitive creation latency breakdown. The time spent in the phases of
+// primitive creation is accumulated per thread, for the verbose summary
+// printed by primitive creation, and process-wide, for get_stats().
+//
+// Phases nest: `pd_iterate` includes the `pd_init_*` and `hashing` time spent
+// while walking the implementation list, and `primitive_init` includes the
+// `jit_generate` time of the kernels the primitive creates.
+enum class phase_t : int {
+    // Walking the implementation list, including primitive cache lookups.
+    pd_iterate = 0,
+    // pd_t::init() of implementations that accepted the problem, i.e. the
+    // dispatching checks and the blocking heuristics.
+    pd_init_accepted,
+    // pd_t::init() of implementations that rejected the problem.
+    pd_init_rejected,
+    // Hashing and comparison of primitive cache keys.
+    hashing,
+    // primitive_t::init() on a primitive cache miss.
+    primitive_init,
+    // JIT kernel code generation.
+    jit_generate,
+    n_phases,
+};
+
+const char *phase2str(phase_t phase);
+
+struct phase_stats_t {
+    double time_ms = 0;
+    size_t count = 0;
+};
+
+struct stats_t {
+    phase_stats_t &operator[](phase_t phase) {
+        return phases[static_cast<int>(phase)];
+    }
+    const phase_stats_t &operator[](phase_t phase) const {
+        return phases[static_cast<int>(phase)];
+    }
+
+    phase_stats_t phases[static_cast<int>(phase_t::n_phases)];
+};
+
+// Rejections of a single implementation.
+struct rejection_stats_t {
+    std::string impl_name;
+    size_t count = 0;
+    double time_ms = 0;
+};
+
+// Returns `true` if the phases are timed. Timing is enabled by
+// ONEDNN_VERBOSE=profile_create and by set_enabled().
+bool DNNL_API is_enabled();
+void DNNL_API set_enabled(bool enabled);
+
+// Returns the process-wide stats accumulated since the last reset_stats().
+stats_t DNNL_API get_stats();
+// Returns the rejections accumulated since the last reset_stats(), the most
+// expensive implementations first.
+std::vector<rejection_stats_t> DNNL_API get_rejection_stats();
+void DNNL_API reset_stats();
+
+// Returns the stats accumulated by the calling thread since the previous
+// call.
+stats_t take_thread_stats();
+
+void record(phase_t phase, double time_ms);
+void record_rejection(const char *impl_name, double time_ms);
+
+// Returns the current time in milliseconds if timing is enabled and a negative
+// value otherwise. Used together with record() for the phases whose kind is
+// known only at the end.
+double start();
+
+// Records the time from construction to destruction into @p phase.
+struct scope_t {
+    scope_t(phase_t phase) : phase_(phase), start_ms_(start()) {}
+    ~scope_t();
+
+private:
+    phase_t phase_;
+    double start_ms_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(scope_t);
+};
+
+// Records the time of a pd_t::init() call from construction to destruction.
+// The call counts as a rejection by the implementation of @p pd unless
+// accept() is called. @p pd may be null if the implementation is unknown.
+struct pd_init_scope_t {
+    pd_init_scope_t(const primitive_desc_t *pd)
+        : pd_(pd), start_ms_(start()) {}
+    ~pd_init_scope_t();
+
+    void accept() { accepted_ = true; }
+
+private:
+    const primitive_desc_t *pd_;
+    double start_ms_;
+    bool accepted_ = false;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(pd_init_scope_t);
+};
+
+} // namespace create_breakdown
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -100,6 +100,8 @@ const char *dnnl_sparse_encoding2str(dnnl_sparse_encoding_t v) {
     if (v == dnnl_csr) return "csr";
     if (v == dnnl_packed) return "packed";
     if (v == dnnl_coo) return "coo";
+    if (v == dnnl_bsr) return "bsr";
+    if (v == dnnl_structured_2_4) return "structured_2_4";
 #if DNNL_EXPERIMENTAL_GROUPED_MEMORY
     if (v == dnnl_grouped) return "grouped";
 #endif
@@ -1825,6 +1827,9 @@ const char *dnnl_prim_kind2str(dnnl_primitive_kind_t v) {
     if (v == dnnl_primitive_kind_max) return "primitive_kind_max";
     if (v == dnnl::impl::primitive_kind::sdpa) return "sdpa";
     if (v == dnnl::impl::primitive_kind::gated_mlp) return "gated_mlp";
+    if (v == dnnl::impl::primitive_kind::embedding_bag) return "embedding_bag";
+    if (v == dnnl::impl::primitive_kind::rope) return "rope";
+    if (v == dnnl::impl::primitive_kind::topk) return "topk";
     assert(!"unknown prim_kind");
     return "unknown prim_kind";
 }
@@ -1910,6 +1915,7 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
 const char *dnnl_rnn_flags2str(dnnl_rnn_flags_t v) {
     if (v == dnnl_rnn_flags_undef) return "undef";
     if (v == dnnl_rnn_flags_diff_weights_overwrite) return "rnn_flags_diff_weights_overwrite";
+    if (v == dnnl_rnn_flags_variable_length) return "rnn_flags_variable_length";
     assert(!"unknown rnn_flags");
     return "unknown rnn_flags";
 }
@@ -48,6 +48,10 @@
 #include "common/ittnotify.hpp"
 #endif
 
+#if defined(DNNL_ENABLE_TRACE)
+#include "common/trace.hpp"
+#endif
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
 #define DNNL_THR_SYNC 1
 inline int dnnl_get_max_threads() {
@@ -269,8 +273,19 @@ inline int adjust_num_threads(int nthr, dim_t work_amount) {
 
 static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
     nthr = adjust_num_threads(nthr, INT64_MAX);
+#if defined(DNNL_ENABLE_TRACE)
+    // The spans of the threads are named after the primitive of the calling
+    // thread.
+    const uint32_t trace_name_id
+            = trace::is_enabled() ? trace::current_name() : trace::no_info;
+#define DNNL_TRACE_PARALLEL_SCOPE() \
+    trace::scope_t trace_scope(trace::span_kind_t::parallel, trace_name_id)
+#else
+#define DNNL_TRACE_PARALLEL_SCOPE()
+#endif
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
     for (int i = 0; i < nthr; ++i) {
+        DNNL_TRACE_PARALLEL_SCOPE();
         f(i, nthr);
     }
 #else
@@ -285,6 +300,7 @@ static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
     // Tasks must be always submitted to a threadpool, it will handle them
     // properly.
     if (nthr == 1) {
+        DNNL_TRACE_PARALLEL_SCOPE();
         f(0, 1);
         return;
     }
@@ -303,7 +319,10 @@ static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
                     task_primitive_log_kind, task_primitive_itt_id);
         }
 #endif
-        f(ithr_, nthr_);
+        {
+            DNNL_TRACE_PARALLEL_SCOPE();
+            f(ithr_, nthr_);
+        }
 #if defined(DNNL_ENABLE_ITT_TASKS)
         if (ithr_ && itt_enable)
             itt::primitive_task_end(task_primitive_log_kind);
@@ -321,7 +340,10 @@ static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
                     task_primitive_log_kind, task_primitive_itt_id);
         }
 #endif
-        f(ithr, nthr);
+        {
+            DNNL_TRACE_PARALLEL_SCOPE();
+            f(ithr, nthr);
+        }
 #if defined(DNNL_ENABLE_ITT_TASKS)
         if (mark_task && itt_enable)
             itt::primitive_task_end(task_primitive_log_kind);
@@ -333,6 +355,7 @@ static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
     if (!tp || dnnl_in_parallel()) {
         threadpool_utils::deactivate_threadpool();
         for (int ithr = 0; ithr < nthr; ithr++) {
+            DNNL_TRACE_PARALLEL_SCOPE();
             f(ithr, nthr);
         }
         threadpool_utils::activate_threadpool(tp);
@@ -347,7 +370,10 @@ static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
                         task_primitive_log_kind, task_primitive_itt_id);
             }
 #endif
-            f(ithr, nthr);
+            {
+                DNNL_TRACE_PARALLEL_SCOPE();
+                f(ithr, nthr);
+            }
 #if defined(DNNL_ENABLE_ITT_TASKS)
             if (!is_master && itt_enable) {
                 itt::primitive_task_end(task_primitive_log_kind);
@@ -357,6 +383,7 @@ static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
     }
 #endif
 #endif
+#undef DNNL_TRACE_PARALLEL_SCOPE
 }
 
 // XXX: IMPORTANT!!!
@@ -0,0 +1,37 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/embedding_bag_iface.hpp"
+#include "common/embedding_bag_pd.hpp"
+#include "common/opdesc.hpp"
+#include "common/primitive_desc_iface.hpp"
+
+using namespace dnnl::impl;
+
+status_t dnnl_embedding_bag_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *indices_desc, const memory_desc_t *offsets_desc,
+        const memory_desc_t *weights_desc, const memory_desc_t *dst_desc,
+        const primitive_attr_t *attr) {
+    if (utils::any_null(src_desc, indices_desc, offsets_desc, dst_desc))
+        return status::invalid_arguments;
+
+    auto embedding_bag_desc = dnnl::impl::create_embedding_bag_desc(alg_kind,
+            src_desc, indices_desc, offsets_desc, weights_desc, dst_desc);
+    return dnnl::impl::primitive_desc_create(primitive_desc_iface, engine,
+            (const dnnl::impl::op_desc_t *)&embedding_bag_desc, nullptr, attr);
+}
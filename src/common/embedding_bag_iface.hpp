@@ -0,0 +1,60 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_EMBEDDING_BAG_IFACE_HPP
+#define COMMON_EMBEDDING_BAG_IFACE_HPP
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+#define DNNL_ARG_INDICES DNNL_ARG_SRC_1
+#define DNNL_ARG_OFFSETS DNNL_ARG_SRC_2
+
+/// Creates a primitive descriptor for an embedding bag primitive.
+///
+/// The primitive gathers rows of the embedding table addressed by @p indices
+/// and pools every bag (a contiguous range of indices starting at the
+/// corresponding @p offsets entry) into one row of the destination.
+///
+/// Quantized tables (#dnnl_s8, #dnnl_u8, #dnnl_s4, #dnnl_u4, #dnnl_f8_e5m2,
+/// #dnnl_f8_e4m3) are dequantized on the fly using per-row scales and
+/// zero-points passed as attributes for #DNNL_ARG_SRC with mask `1 << 0`.
+///
+/// Indices outside of `[0, rows)` are not looked up: the execution still
+/// pools the valid rows of every bag and then returns
+/// #dnnl_invalid_arguments.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind Pooling algorithm. Possible values are
+///     #dnnl_reduction_sum, #dnnl_reduction_mean, #dnnl_reduction_max.
+/// @param src_desc Embedding table memory descriptor ([rows, dim]).
+/// @param indices_desc Indices memory descriptor ([num_indices], #dnnl_s32).
+/// @param offsets_desc Bag offsets memory descriptor ([batch], #dnnl_s32).
+/// @param weights_desc Per-sample weights memory descriptor ([num_indices],
+///     #dnnl_f32). Can be NULL or a zero memory descriptor.
+/// @param dst_desc Destination memory descriptor ([batch, dim]).
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_embedding_bag_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t indices_desc,
+        const_dnnl_memory_desc_t offsets_desc,
+        const_dnnl_memory_desc_t weights_desc,
+        const_dnnl_memory_desc_t dst_desc, const_dnnl_primitive_attr_t attr);
+
+#endif
@@ -0,0 +1,193 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_EMBEDDING_BAG_PD_HPP
+#define COMMON_EMBEDDING_BAG_PD_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/embedding_bag_iface.hpp"
+#include "common/primitive_desc.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define VDISPATCH_EMBEDDING_BAG(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, embedding_bag, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+#define VDISPATCH_EMBEDDING_BAG_SC(f, msg, ...) \
+    VCHECK(primitive, create, dispatch, embedding_bag, (f), "%s," msg, \
+            this->info(engine), ##__VA_ARGS__)
+
+static inline embedding_bag_desc_t create_embedding_bag_desc(
+        alg_kind_t alg_kind, const memory_desc_t *src_md,
+        const memory_desc_t *indices_md, const memory_desc_t *offsets_md,
+        const memory_desc_t *weights_md, const memory_desc_t *dst_md) {
+    auto desc = embedding_bag_desc_t();
+    desc.primitive_kind = primitive_kind::embedding_bag;
+    desc.alg_kind = alg_kind;
+    desc.src_desc = *src_md;
+    desc.indices_desc = *indices_md;
+    desc.offsets_desc = *offsets_md;
+    desc.weights_desc = weights_md ? *weights_md : glob_zero_md;
+    desc.dst_desc = *dst_md;
+    return desc;
+}
+
+// NOLINTBEGIN(google-default-arguments)
+struct embedding_bag_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::embedding_bag;
+    using base_class = embedding_bag_pd_t;
+    using hint_class = embedding_bag_pd_t;
+
+    const embedding_bag_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::alg_kind:
+                *(alg_kind_t *)result = desc()->alg_kind;
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    // Number of rows in the embedding table.
+    dim_t R() const { return desc_.src_desc.dims[0]; }
+    // Embedding dimension.
+    dim_t D() const { return desc_.src_desc.dims[1]; }
+    // Total number of indices across all bags.
+    dim_t N() const { return desc_.indices_desc.dims[0]; }
+    // Number of bags.
+    dim_t B() const { return desc_.offsets_desc.dims[0]; }
+
+    alg_kind_t alg_kind() const { return desc_.alg_kind; }
+    bool with_weights() const {
+        return !memory_desc_wrapper(desc_.weights_desc).is_zero();
+    }
+
+    int n_inputs() const override {
+        return 3 + with_weights() + n_binary_po_inputs();
+    }
+    int n_outputs() const override { return 1; }
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (utils::one_of(
+                    arg, DNNL_ARG_SRC, DNNL_ARG_INDICES, DNNL_ARG_OFFSETS))
+            return arg_usage_t::input;
+        if (arg == DNNL_ARG_WEIGHTS && with_weights())
+            return arg_usage_t::input;
+        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0, user_input);
+            case DNNL_ARG_INDICES: return src_md(1, user_input);
+            case DNNL_ARG_OFFSETS: return src_md(2, user_input);
+            case DNNL_ARG_WEIGHTS: return weights_md(0, user_input);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            default: return primitive_desc_t::arg_md(arg, user_input);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return &desc_.src_desc;
+            case 1: return &desc_.indices_desc;
+            case 2: return &desc_.offsets_desc;
+            default: return &glob_zero_md;
+        }
+    }
+
+    const memory_desc_t *weights_md(
+            int index = 0, bool user_input = false) const override {
+        return index == 0 ? &desc_.weights_desc : &glob_zero_md;
+    }
+
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        return index == 0 ? &desc_.dst_desc : &glob_zero_md;
+    }
+
+protected:
+    embedding_bag_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd_pd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*op_desc_t::to_desc<embedding_bag_desc_t>(adesc)) {}
+
+    // Checks the shapes and data types that are common for all
+    // implementations.
+    bool pd_ok() const {
+        using namespace data_type;
+        if (!utils::one_of(alg_kind(), alg_kind::reduction_sum,
+                    alg_kind::reduction_mean, alg_kind::reduction_max))
+            return false;
+
+        const auto &src = desc_.src_desc;
+        const auto &idx = desc_.indices_desc;
+        const auto &off = desc_.offsets_desc;
+        const auto &wei = desc_.weights_desc;
+        const auto &dst = desc_.dst_desc;
+        if (src.ndims != 2 || idx.ndims != 1 || off.ndims != 1
+                || dst.ndims != 2)
+            return false;
+        if (dst.dims[0] != B() || dst.dims[1] != D()) return false;
+        if (idx.data_type != s32 || off.data_type != s32) return false;
+
+        if (with_weights()) {
+            // Per-sample weights are only defined for sum pooling.
+            if (alg_kind() != alg_kind::reduction_sum) return false;
+            if (wei.ndims != 1 || wei.dims[0] != N() || wei.data_type != f32)
+                return false;
+        }
+        return true;
+    }
+
+    bool set_default_formats() {
+        bool ok = true;
+        for (auto *md : {&desc_.src_desc, &desc_.indices_desc,
+                     &desc_.offsets_desc, &desc_.weights_desc,
+                     &desc_.dst_desc}) {
+            if (!memory_desc_wrapper(md).format_any()) continue;
+            ok = ok
+                    && memory_desc_init_by_strides(*md, nullptr)
+                            == status::success;
+        }
+        ok = ok
+                && attr_.post_ops_.set_default_formats(&desc_.dst_desc)
+                        == status::success;
+        return ok;
+    }
+
+private:
+    embedding_bag_desc_t desc_;
+};
+// NOLINTEND(google-default-arguments)
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
 #include <sstream>
 
 #include "oneapi/dnnl/dnnl.h"
@@ -25,6 +26,7 @@
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "cpu/gemm/gemm.hpp"
+#include "cpu/gemm/gemm_pack.hpp"
 #endif
 
 #include "common/bfloat16.hpp"
@@ -46,17 +48,66 @@ const char *c2f_offsetC(const char *offC) {
     return offC;
 }
 
-std::string get_descriptor(dim_t M, dim_t N, dim_t K) {
-    std::string s_ = std::to_string(M);
+std::string get_descriptor(dim_t M, dim_t N, dim_t K, dim_t batch = 1) {
+    const std::string b_ = batch != 1 ? std::to_string(batch) + "x" : "";
+    std::string s_ = b_ + std::to_string(M);
     s_ += "x";
     s_ += std::to_string(K);
     s_ += ":";
-    s_ += std::to_string(K);
+    s_ += b_ + std::to_string(K);
     s_ += "x";
     s_ += std::to_string(N);
     return s_;
 }
 
+// Maps the matrix identifier of the row-major pack API to the one of the
+// column-major implementation, where matrices A and B are swapped.
+status_t c2f_identifier(char identifier, char &identifier_f) {
+    if (utils::one_of(identifier, 'A', 'a'))
+        identifier_f = 'B';
+    else if (utils::one_of(identifier, 'B', 'b'))
+        identifier_f = 'A';
+    else
+        return status::invalid_arguments;
+    return status::success;
+}
+
+// Problems with at most this number of multiply-adds are too small to be
+// split between threads efficiently.
+constexpr dim_t small_gemm_work = 64 * 64 * 64;
+
+// Calls `gemm(i)` for every `i` in `[0, batch)`. The batch is distributed
+// across threads when there are enough problems to occupy all of them or
+// when the problems are too small to benefit from internal threading.
+// Otherwise the problems are processed one by one, each using all threads.
+template <typename F>
+status_t gemm_batch_driver(
+        dim_t M, dim_t N, dim_t K, dim_t batch, const F &gemm) {
+    if (batch < 0) return status::invalid_arguments;
+
+    const int nthr = dnnl_get_max_threads();
+    const bool parallel_batch
+            = batch >= nthr || M * N * K <= small_gemm_work;
+    if (!parallel_batch || batch == 1) {
+        for (dim_t i = 0; i < batch; ++i) {
+            const status_t st = gemm(i);
+            if (st != status::success) return st;
+        }
+        return status::success;
+    }
+
+    std::atomic<status_t> status(status::success);
+    parallel(nthr, [&](int ithr, int nthr) {
+        dim_t start {0}, end {0};
+        balance211(batch, nthr, ithr, start, end);
+        for (dim_t i = start; i < end; ++i) {
+            const status_t st = gemm(i);
+            if (st != status::success) status = st;
+        }
+    });
+    return status;
+}
+
 } // namespace
 #endif
 
@@ -68,6 +119,9 @@ std::string get_descriptor(dim_t M, dim_t N, dim_t K) {
 #endif
 
 #define MAYBE_VERBOSE(status, sdt_, wdt_, ddt_, ...) \
+    MAYBE_VERBOSE_BATCH(status, 1, sdt_, wdt_, ddt_, __VA_ARGS__)
+
+#define MAYBE_VERBOSE_BATCH(status, batch_, sdt_, wdt_, ddt_, ...) \
     if (get_verbose(verbose_t::exec_profile, component_t::gemm_api)) { \
         double start_ms = get_msec(); \
         status = __VA_ARGS__; \
@@ -87,7 +141,7 @@ std::string get_descriptor(dim_t M, dim_t N, dim_t K) {
         if (!is_wei_ab && ldb != K) ss << "ldb:" << ldb << " "; \
         if (alpha != 1.f) ss << "attr-scales:src:common:" << alpha << " "; \
         if (beta != 0.f) ss << "attr-post-ops:sum:" << beta << " "; \
-        ss << ",," << get_descriptor(M, N, K); \
+        ss << ",," << get_descriptor(M, N, K, batch_); \
         VPROF(start_ms, primitive, exec, VERBOSE_profile, ss.str().c_str(), \
                 duration_ms); \
     } else { \
@@ -141,22 +195,281 @@ dnnl_status_t dnnl_gemm_s8s8s32(char transa, char transb, char offsetc, dim_t M,
 #endif
 }
 
-extern "C" dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32(char transa,
-        char transb, dim_t M, dim_t N, dim_t K, float alpha,
-        const bfloat16_t *A, dim_t lda, const bfloat16_t *B, dim_t ldb,
-        float beta, float *C, dim_t ldc) {
+dnnl_status_t dnnl_gemm_bf16bf16f32(char transa, char transb, dim_t M,
+        dim_t N, dim_t K, float alpha, const uint16_t *A, dim_t lda,
+        const uint16_t *B, dim_t ldb, float beta, float *C, dim_t ldc) {
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    const auto A_bf16 = reinterpret_cast<const bfloat16_t *>(A);
+    const auto B_bf16 = reinterpret_cast<const bfloat16_t *>(B);
     status_t status = dnnl_success;
     MAYBE_VERBOSE(status, "bf16", "bf16", "f32",
             MAYBE_RUN_STACK_CHECKER(dnnl_gemm_bf16bf16f32,
                     cpu::gemm_bf16bf16f32, &transb, &transa, &N, &M, &K, &alpha,
-                    B, &ldb, A, &lda, &beta, C, &ldc));
+                    B_bf16, &ldb, A_bf16, &lda, &beta, C, &ldc));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_batch_strided(char transa, char transb, dim_t M,
+        dim_t N, dim_t K, float alpha, const float *A, dim_t lda,
+        dim_t stride_a, const float *B, dim_t ldb, dim_t stride_b, float beta,
+        float *C, dim_t ldc, dim_t stride_c, dim_t batch) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE_BATCH(status, batch, "f32", "f32", "f32",
+            gemm_batch_driver(M, N, K, batch, [&](dim_t i) {
+                return cpu::extended_sgemm(&transb, &transa, &N, &M, &K, &alpha,
+                        B + i * stride_b, &ldb, A + i * stride_a, &lda, &beta,
+                        C + i * stride_c, &ldc, nullptr, false);
+            }));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_batch(char transa, char transb, dim_t M, dim_t N,
+        dim_t K, float alpha, const float *const *A, dim_t lda,
+        const float *const *B, dim_t ldb, float beta, float *const *C,
+        dim_t ldc, dim_t batch) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (batch > 0 && utils::any_null(A, B, C)) return status::invalid_arguments;
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE_BATCH(status, batch, "f32", "f32", "f32",
+            gemm_batch_driver(M, N, K, batch, [&](dim_t i) {
+                return cpu::extended_sgemm(&transb, &transa, &N, &M, &K, &alpha,
+                        B[i], &ldb, A[i], &lda, &beta, C[i], &ldc, nullptr,
+                        false);
+            }));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, float alpha, const uint8_t *A,
+        dim_t lda, dim_t stride_a, uint8_t ao, const int8_t *B, dim_t ldb,
+        dim_t stride_b, int8_t bo, float beta, int32_t *C, dim_t ldc,
+        dim_t stride_c, const int32_t *co, dim_t batch) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE_BATCH(status, batch, "u8", "s8", "s32",
+            gemm_batch_driver(M, N, K, batch, [&](dim_t i) {
+                return cpu::gemm_s8u8s32(&transb, &transa,
+                        c2f_offsetC(&offsetc), &N, &M, &K, &alpha,
+                        B + i * stride_b, &ldb, &bo, A + i * stride_a, &lda,
+                        &ao, &beta, C + i * stride_c, &ldc, co);
+            }));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, float alpha, const int8_t *A,
+        dim_t lda, dim_t stride_a, int8_t ao, const int8_t *B, dim_t ldb,
+        dim_t stride_b, int8_t bo, float beta, int32_t *C, dim_t ldc,
+        dim_t stride_c, const int32_t *co, dim_t batch) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE_BATCH(status, batch, "s8", "s8", "s32",
+            gemm_batch_driver(M, N, K, batch, [&](dim_t i) {
+                return cpu::gemm_s8s8s32(&transb, &transa,
+                        c2f_offsetC(&offsetc), &N, &M, &K, &alpha,
+                        B + i * stride_b, &ldb, &bo, A + i * stride_a, &lda,
+                        &ao, &beta, C + i * stride_c, &ldc, co);
+            }));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_bf16bf16f32_batch_strided(char transa, char transb,
+        dim_t M, dim_t N, dim_t K, float alpha, const uint16_t *A, dim_t lda,
+        dim_t stride_a, const uint16_t *B, dim_t ldb, dim_t stride_b,
+        float beta, float *C, dim_t ldc, dim_t stride_c, dim_t batch) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    const auto A_bf16 = reinterpret_cast<const bfloat16_t *>(A);
+    const auto B_bf16 = reinterpret_cast<const bfloat16_t *>(B);
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE_BATCH(status, batch, "bf16", "bf16", "f32",
+            gemm_batch_driver(M, N, K, batch, [&](dim_t i) {
+                return cpu::gemm_bf16bf16f32(&transb, &transa, &N, &M, &K,
+                        &alpha, B_bf16 + i * stride_b, &ldb,
+                        A_bf16 + i * stride_a, &lda, &beta, C + i * stride_c,
+                        &ldc);
+            }));
     return status;
 #else
     return dnnl::impl::status::unimplemented;
 #endif
 }
 
+// The pack API below follows the row-major convention of the public GEMM
+// functions, while the underlying implementation is column-major. Hence
+// matrices A and B (and everything related to them) are swapped.
+
+dnnl_status_t dnnl_sgemm_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (size == nullptr) return status::invalid_arguments;
+    char identifier_f;
+    CHECK(c2f_identifier(identifier, identifier_f));
+    return cpu::sgemm_pack_get_size(&identifier_f, &transb, &transa, &N, &M,
+            &K, &ldb, &lda, size);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_pack(char identifier, char transa, char transb,
+        dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb, const float *src,
+        float *dst) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    char identifier_f;
+    CHECK(c2f_identifier(identifier, identifier_f));
+    return cpu::sgemm_pack(&identifier_f, &transb, &transa, &N, &M, &K, &ldb,
+            &lda, src, dst);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_compute(char transa, char transb, dim_t M, dim_t N,
+        dim_t K, const float *A, dim_t lda, const float *B, dim_t ldb,
+        float beta, float *C, dim_t ldc) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return cpu::sgemm_compute(
+            &transb, &transa, &N, &M, &K, B, &ldb, A, &lda, &beta, C, &ldc);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (size == nullptr) return status::invalid_arguments;
+    char identifier_f;
+    CHECK(c2f_identifier(identifier, identifier_f));
+    return cpu::gemm_s8u8s32_pack_get_size(&identifier_f, &transb, &transa, &N,
+            &M, &K, &ldb, &lda, size);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_pack(char identifier, char transa, char transb,
+        dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb, const void *src,
+        void *dst) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    char identifier_f;
+    CHECK(c2f_identifier(identifier, identifier_f));
+    return cpu::gemm_s8u8s32_pack(&identifier_f, &transb, &transa, &N, &M, &K,
+            &ldb, &lda, src, dst);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_compute(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, const uint8_t *A, dim_t lda,
+        const int8_t *B, dim_t ldb, float beta, int32_t *C, dim_t ldc,
+        const int32_t *co) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return cpu::gemm_s8u8s32_compute(&transb, &transa, c2f_offsetC(&offsetc),
+            &N, &M, &K, B, &ldb, A, &lda, &beta, C, &ldc, co);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (size == nullptr) return status::invalid_arguments;
+    char identifier_f;
+    CHECK(c2f_identifier(identifier, identifier_f));
+    return cpu::gemm_s8s8s32_pack_get_size(&identifier_f, &transb, &transa, &N,
+            &M, &K, &ldb, &lda, size);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_pack(char identifier, char transa, char transb,
+        dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb, const void *src,
+        void *dst) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    char identifier_f;
+    CHECK(c2f_identifier(identifier, identifier_f));
+    return cpu::gemm_s8s8s32_pack(&identifier_f, &transb, &transa, &N, &M, &K,
+            &ldb, &lda, src, dst);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_compute(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, const int8_t *A, dim_t lda,
+        const int8_t *B, dim_t ldb, float beta, int32_t *C, dim_t ldc,
+        const int32_t *co) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return cpu::gemm_s8s8s32_compute(&transb, &transa, c2f_offsetC(&offsetc),
+            &N, &M, &K, B, &ldb, A, &lda, &beta, C, &ldc, co);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_bf16bf16f32_pack_get_size(char identifier,
+        char transa, char transb, dim_t M, dim_t N, dim_t K, dim_t lda,
+        dim_t ldb, size_t *size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (size == nullptr) return status::invalid_arguments;
+    char identifier_f;
+    CHECK(c2f_identifier(identifier, identifier_f));
+    return cpu::gemm_bf16bf16f32_pack_get_size(&identifier_f, &transb, &transa,
+            &N, &M, &K, &ldb, &lda, size);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_bf16bf16f32_pack(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        const uint16_t *src, uint16_t *dst) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    char identifier_f;
+    CHECK(c2f_identifier(identifier, identifier_f));
+    return cpu::gemm_bf16bf16f32_pack(&identifier_f, &transb, &transa, &N, &M,
+            &K, &ldb, &lda, reinterpret_cast<const bfloat16_t *>(src),
+            reinterpret_cast<bfloat16_t *>(dst));
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_bf16bf16f32_compute(char transa, char transb, dim_t M,
+        dim_t N, dim_t K, const uint16_t *A, dim_t lda, const uint16_t *B,
+        dim_t ldb, float beta, float *C, dim_t ldc) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return cpu::gemm_bf16bf16f32_compute(&transb, &transa, &N, &M, &K,
+            reinterpret_cast<const bfloat16_t *>(B), &ldb,
+            reinterpret_cast<const bfloat16_t *>(A), &lda, &beta, C, &ldc);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
 dnnl_status_t dnnl_threadpool_interop_sgemm(char transa, char transb, dim_t M,
         dim_t N, dim_t K, float alpha, const float *A, dim_t lda,
@@ -220,6 +533,7 @@ extern "C" dnnl_status_t DNNL_API dnnl_threadpool_interop_gemm_bf16bf16f32(
     return status;
 }
 
-#undef MAYBE_VERBOSE
-
 #endif
+
+#undef MAYBE_VERBOSE
+#undef MAYBE_VERBOSE_BATCH
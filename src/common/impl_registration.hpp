@@ -96,6 +96,13 @@
     {}
 #endif
 
+#if BUILD_PRIMITIVE_ALL || BUILD_EMBEDDING_BAG
+#define REG_EMBEDDING_BAG_P(...) __VA_ARGS__
+#else
+#define REG_EMBEDDING_BAG_P(...) \
+    { nullptr }
+#endif
+
 #if BUILD_PRIMITIVE_ALL || BUILD_GATED_MLP
 #define REG_GATED_MLP_P(...) __VA_ARGS__
 #else
@@ -180,6 +187,20 @@
     {}
 #endif
 
+#if BUILD_PRIMITIVE_ALL || BUILD_ROPE
+#define REG_ROPE_P(...) __VA_ARGS__
+#else
+#define REG_ROPE_P(...) \
+    { nullptr }
+#endif
+
+#if BUILD_PRIMITIVE_ALL || BUILD_TOPK
+#define REG_TOPK_P(...) __VA_ARGS__
+#else
+#define REG_TOPK_P(...) \
+    { nullptr }
+#endif
+
 #if BUILD_PRIMITIVE_ALL || BUILD_SDPA
 #define REG_SDPA_P(...) __VA_ARGS__
 #else
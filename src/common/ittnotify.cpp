@@ -103,6 +103,9 @@ void primitive_task_start(primitive_kind_t kind, const char *log_kind) {
             CASE(group_normalization),
             CASE(sdpa),
             CASE(gated_mlp),
+            CASE(embedding_bag),
+            CASE(rope),
+            CASE(topk),
     };
 #undef CASE
     int kind_idx = (int)kind;
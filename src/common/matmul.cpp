@@ -293,6 +293,7 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
     // Check scales
     if (!attr->scales_.has_default_values()) {
         const auto &sc = attr->scales_;
+        const bool with_src_dynamic_scales = sc.get(DNNL_ARG_SRC).is_dynamic();
 
         dim_t src_scale_group_k = 1;
         if (!sc.has_default_values(DNNL_ARG_SRC)) {
@@ -316,6 +317,23 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
                     VERBOSE_UNSUPPORTED_SCALES_CFG);
         }
 
+        // Dynamic source scales quantize a floating-point source into the
+        // weights data type with a scale computed per row.
+        if (with_src_dynamic_scales) {
+            using namespace data_type;
+
+            VCHECK_MATMUL_UNIMPL(sc.get(DNNL_ARG_SRC).is_dynamic_fp(),
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
+            VCHECK_MATMUL_UNIMPL(utils::one_of(src_dt, f32, bf16, f16)
+                            && utils::one_of(wei_dt, s8, f8_e5m2, f8_e4m3),
+                    VERBOSE_UNSUPPORTED_DT_CFG);
+            VCHECK_MATMUL_UNIMPL(sc.get_data_type(DNNL_ARG_SRC) == f32
+                            && sc.get_mask(DNNL_ARG_SRC) == full_tensor_mask
+                            && sc.get_group(DNNL_ARG_SRC, -2) == 1
+                            && sc.get_group(DNNL_ARG_SRC, -1) == K,
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
+        }
+
         dim_t wei_scale_group_k = 1;
         dim_t wei_scale_group_n = 1;
         if (!sc.has_default_values(DNNL_ARG_WEIGHTS)) {
@@ -356,7 +374,8 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
         const bool groups_are_divisible = quant_groups_are_divisible(
                 src_scale_group_k, wei_scale_group_k);
         VCHECK_MATMUL_UNIMPL(IMPLICATION(src_scale_group_k > 1,
-                                     (src_is_int8 || src_is_fp8 || src_is_fp4)
+                                     (src_is_int8 || src_is_fp8 || src_is_fp4
+                                             || with_src_dynamic_scales)
                                              && groups_are_divisible),
                 VERBOSE_UNSUPPORTED_SCALES_CFG);
 
@@ -221,6 +221,87 @@ status_t memory_desc_init_by_coo_encoding(memory_desc_t &memory_desc, int ndims,
     return success;
 }
 
+status_t memory_desc_init_by_bsr_encoding(memory_desc_t &memory_desc, int ndims,
+        const dims_t dims, data_type_t data_type, dim_t nnz,
+        const dims_t block_dims, data_type_t indices_dt,
+        data_type_t pointers_dt) {
+    if (ndims == 0) {
+        memory_desc = types::zero_md();
+        return success;
+    }
+
+    // Blocks are defined for matrices only.
+    VCHECK_MEMORY(ndims == 2, unimplemented, VERBOSE_BAD_NDIMS, "", ndims);
+
+    CHECK(memory_desc_sanity_check(ndims, dims, data_type, format_kind::undef));
+    VCHECK_MEMORY(block_dims != nullptr, invalid_arguments, VERBOSE_NULL_ARG);
+
+    for (int d = 0; d < ndims; ++d) {
+        VCHECK_MEMORY(!is_runtime_value(dims[d]), invalid_arguments,
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        VCHECK_MEMORY(block_dims[d] > 0 && dims[d] % block_dims[d] == 0,
+                invalid_arguments, VERBOSE_BAD_DIM, "block_dims", d);
+    }
+    const dim_t block_size = block_dims[0] * block_dims[1];
+    VCHECK_MEMORY(nnz >= 0 && nnz % block_size == 0
+                    && nnz <= array_product(dims, ndims),
+            invalid_arguments, VERBOSE_BAD_PARAM, "nnz");
+
+    auto md = memory_desc_t();
+    md.ndims = ndims;
+    array_copy(md.dims, dims, ndims);
+    md.data_type = data_type;
+    array_copy(md.padded_dims, dims, ndims);
+    md.format_kind = format_kind::sparse;
+    md.format_desc.sparse_desc.encoding = sparse_encoding::bsr;
+    md.format_desc.sparse_desc.nnz = nnz;
+    md.format_desc.sparse_desc.metadata_types[0] = indices_dt;
+    md.format_desc.sparse_desc.metadata_types[1] = pointers_dt;
+    array_copy(md.format_desc.sparse_desc.bsr_desc.block_dims, block_dims,
+            ndims);
+
+    memory_desc = md;
+
+    return success;
+}
+
+status_t memory_desc_init_by_structured_2_4_encoding(
+        memory_desc_t &memory_desc, int ndims, const dims_t dims,
+        data_type_t data_type, data_type_t metadata_dt) {
+    if (ndims == 0) {
+        memory_desc = types::zero_md();
+        return success;
+    }
+
+    // The sparsity pattern is defined for matrices only.
+    VCHECK_MEMORY(ndims == 2, unimplemented, VERBOSE_BAD_NDIMS, "", ndims);
+
+    CHECK(memory_desc_sanity_check(ndims, dims, data_type, format_kind::undef));
+    VCHECK_MEMORY(metadata_dt == data_type::u8, unimplemented,
+            VERBOSE_INVALID_DATATYPE, "metadata");
+
+    for (int d = 0; d < ndims; ++d)
+        VCHECK_MEMORY(!is_runtime_value(dims[d]), invalid_arguments,
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    // Each group of 4 elements along the first dimension keeps 2 of them.
+    VCHECK_MEMORY(dims[0] % 4 == 0, invalid_arguments, VERBOSE_BAD_DIM,
+            "dims", 0);
+
+    auto md = memory_desc_t();
+    md.ndims = ndims;
+    array_copy(md.dims, dims, ndims);
+    md.data_type = data_type;
+    array_copy(md.padded_dims, dims, ndims);
+    md.format_kind = format_kind::sparse;
+    md.format_desc.sparse_desc.encoding = sparse_encoding::structured_2_4;
+    md.format_desc.sparse_desc.nnz = array_product(dims, ndims) / 2;
+    md.format_desc.sparse_desc.metadata_types[0] = metadata_dt;
+
+    memory_desc = md;
+
+    return success;
+}
+
 status_t memory_desc_init_by_packed_encoding(memory_desc_t &memory_desc,
         int ndims, const dims_t dims, data_type_t data_type, dim_t nnz) {
     if (ndims == 0) {
@@ -759,6 +840,33 @@ status_t dnnl_memory_desc_create_with_coo_encoding(memory_desc_t **memory_desc,
     return success;
 }
 
+status_t dnnl_memory_desc_create_with_bsr_encoding(memory_desc_t **memory_desc,
+        int ndims, const dims_t dims, data_type_t data_type, dim_t nnz,
+        const dims_t block_dims, data_type_t indices_dt,
+        data_type_t pointers_dt) {
+    if (any_null(memory_desc)) return invalid_arguments;
+
+    auto md = utils::make_unique<memory_desc_t>();
+    if (!md) return out_of_memory;
+    CHECK(memory_desc_init_by_bsr_encoding(*md, ndims, dims, data_type, nnz,
+            block_dims, indices_dt, pointers_dt));
+    (*memory_desc) = md.release();
+    return success;
+}
+
+status_t dnnl_memory_desc_create_with_structured_2_4_encoding(
+        memory_desc_t **memory_desc, int ndims, const dims_t dims,
+        data_type_t data_type, data_type_t metadata_dt) {
+    if (any_null(memory_desc)) return invalid_arguments;
+
+    auto md = utils::make_unique<memory_desc_t>();
+    if (!md) return out_of_memory;
+    CHECK(memory_desc_init_by_structured_2_4_encoding(
+            *md, ndims, dims, data_type, metadata_dt));
+    (*memory_desc) = md.release();
+    return success;
+}
+
 status_t dnnl_memory_desc_create_with_packed_encoding(
         memory_desc_t **memory_desc, int ndims, const dims_t dims,
         data_type_t data_type, dim_t nnz) {
@@ -936,7 +1044,11 @@ status_t dnnl_memory_desc_query_v2(
                     case sparse_encoding::coo:
                         *(int *)result = md->ndims + 1;
                         break;
-                    case sparse_encoding::packed: *(int *)result = 3; break;
+                    case sparse_encoding::packed:
+                    case sparse_encoding::bsr: *(int *)result = 3; break;
+                    case sparse_encoding::structured_2_4:
+                        *(int *)result = 2;
+                        break;
 #if DNNL_EXPERIMENTAL_GROUPED_MEMORY
                     case sparse_encoding::grouped: *(int *)result = 2; break;
 #endif
@@ -180,6 +180,15 @@ struct sparse_desc_t {
     //  - 0: values
     //  - 1: offsets
     //  - 2: bitmask
+    //
+    // BSR: Number of handles is 3:
+    //  - 0: values of non-zero blocks
+    //  - 1: block column indices
+    //  - 2: block row pointers
+    //
+    // 2:4 structured: Number of handles is 2:
+    //  - 0: values
+    //  - 1: metadata
     sparse_encoding_t encoding;
 
     // Number of non-zero entries.
@@ -188,6 +197,9 @@ struct sparse_desc_t {
     // Metadata types. Each encoding defines how to interpret these.
     // - CSR: 0th - index data type
     //        1st - pointer data type
+    // - BSR: 0th - block index data type
+    //        1st - block pointer data type
+    // - 2:4 structured: 0th - metadata data type
     // - packed: N/A
     dnnl_data_type_t metadata_types[max_metadata_types];
 
@@ -225,6 +237,12 @@ struct sparse_desc_t {
     // - Use the bitmask to unpack the packed data
     blocking_desc_t packed_desc;
 
+    // BSR encoding descriptor. The tensor is split into `block_dims` blocks
+    // and `nnz` is the number of stored values of all non-zero blocks.
+    struct bsr_desc_t {
+        dnnl_dim_t block_dims[2];
+    } bsr_desc;
+
 #if DNNL_EXPERIMENTAL_GROUPED_MEMORY
     // Grouped encoding descriptor
     // Uses format_kind::sparse because grouped layout is a form of multi-buffer
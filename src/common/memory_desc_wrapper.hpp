@@ -384,6 +384,40 @@ struct memory_desc_wrapper : public c_compatible {
                     assert(!"unknown index");
                     return 0;
                 }
+            } else if (sparse_desc().encoding == sparse_encoding::bsr) {
+                const auto &block_dims = sparse_desc().bsr_desc.block_dims;
+                switch (index) {
+                    // Return size for values.
+                    case 0: return nnz() * data_type_size();
+                    // Return size for block indices.
+                    case 1: {
+                        const auto idx_dt = metadata_type(0);
+                        const dim_t nblocks
+                                = nnz() / (block_dims[0] * block_dims[1]);
+                        return nblocks * types::data_type_size(idx_dt);
+                    }
+                    // Return size for block pointers.
+                    case 2: {
+                        const auto ptr_dt = metadata_type(1);
+                        return (dims()[0] / block_dims[0] + 1)
+                                * types::data_type_size(ptr_dt);
+                    }
+                    default: assert(!"unknown index"); return 0;
+                }
+            } else if (sparse_desc().encoding
+                    == sparse_encoding::structured_2_4) {
+                switch (index) {
+                    // Return size for values.
+                    case 0:
+                        return utils::div_up(nnz() * data_type_size(),
+                                sub_byte_data_type_multiplier());
+                    // Return size for metadata, one entry per group of 4.
+                    case 1: {
+                        const auto meta_dt = metadata_type(0);
+                        return (nelems() / 4) * types::data_type_size(meta_dt);
+                    }
+                    default: assert(!"unknown index"); return 0;
+                }
             } else if (sparse_desc().encoding == sparse_encoding::packed) {
                 // If the size if queried from a user-created memory descriptor.
                 if (blocking_desc().strides[0] == 0) return 0;
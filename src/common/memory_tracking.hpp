@@ -319,6 +319,7 @@ enum {
     key_rnn_diff_gates,
     key_rnn_src_layer_trans,
     key_rnn_src_iter_trans,
+    key_rnn_src_iter_copy,
     key_rnn_diff_ht,
     key_rnn_ptrs_bia,
     key_rnn_ptrs_wei_layer,
@@ -335,6 +336,8 @@ enum {
     key_softmax_interim_store,
     key_sum_reduction,
     key_sum_srcs_cvt,
+    key_topk_candidates,
+    key_topk_stats,
     key_wino_U,
     key_wino_V,
     key_wino_M,
@@ -371,6 +371,71 @@ struct batch_normalization_desc_t : public op_desc_t {
     unsigned flags {};
 };
 
+// A descriptor of an Embedding Bag operation.
+struct embedding_bag_desc_t : public op_desc_t {
+    embedding_bag_desc_t() : op_desc_t(primitive_kind::embedding_bag) {}
+
+    DECLARE_COMMON_OP_DESC_CLONE(embedding_bag_desc_t);
+
+    // The kind of pooling applied to every bag. Possible values:
+    // #dnnl_reduction_sum, #dnnl_reduction_mean, and #dnnl_reduction_max.
+    alg_kind_t alg_kind {};
+    // Embedding table memory descriptor.
+    memory_desc_t src_desc;
+    // Indices memory descriptor.
+    memory_desc_t indices_desc;
+    // Bag offsets memory descriptor.
+    memory_desc_t offsets_desc;
+    // Per-sample weights memory descriptor. Zero md if not used.
+    memory_desc_t weights_desc;
+    // Destination memory descriptor.
+    memory_desc_t dst_desc;
+};
+
+// A descriptor of a rotary position embedding (RoPE) operation.
+struct rope_desc_t : public op_desc_t {
+    rope_desc_t() : op_desc_t(primitive_kind::rope) {}
+
+    DECLARE_COMMON_OP_DESC_CLONE(rope_desc_t);
+
+    // The way rotation pairs are formed. Possible values:
+    // #alg_kind::rope_interleaved and #alg_kind::rope_half.
+    alg_kind_t alg_kind {};
+    // Source memory descriptor ([..., seq_len, head_size]).
+    memory_desc_t src_desc;
+    // Cosine table memory descriptor ([max_positions, head_size / 2]).
+    memory_desc_t cos_desc;
+    // Sine table memory descriptor ([max_positions, head_size / 2]).
+    memory_desc_t sin_desc;
+    // Position ids memory descriptor. Zero md if positions are implied by
+    // the sequence index.
+    memory_desc_t pos_desc;
+    // Destination memory descriptor.
+    memory_desc_t dst_desc;
+};
+
+// A descriptor of a top-k operation over the innermost dimension.
+struct topk_desc_t : public op_desc_t {
+    topk_desc_t() : op_desc_t(primitive_kind::topk) {}
+
+    DECLARE_COMMON_OP_DESC_CLONE(topk_desc_t);
+
+    // Normalization of the selected values. Possible values:
+    // #alg_kind::undef (raw values) and #alg_kind::softmax_accurate
+    // (probabilities of the softmax over the whole row).
+    alg_kind_t alg_kind {};
+    // Number of elements to select per row.
+    dim_t k {};
+    // Softmax temperature, the row is divided by it before normalization.
+    float temperature {};
+    // Source memory descriptor ([..., n]).
+    memory_desc_t src_desc;
+    // Selected values memory descriptor ([..., k]).
+    memory_desc_t dst_desc;
+    // Indices of the selected values memory descriptor ([..., k]).
+    memory_desc_t indices_desc;
+};
+
 // A descriptor for a Gated MLP (GLU) operation.
 struct gated_mlp_desc_t : public op_desc_t {
     gated_mlp_desc_t() : op_desc_t(primitive_kind::gated_mlp) {}
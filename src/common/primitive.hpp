@@ -20,6 +20,7 @@
 #include "common/c_types_map.hpp"
 #include "common/cache_blob.hpp"
 #include "common/cache_hit_types.hpp"
+#include "common/create_breakdown.hpp"
 #include "common/primitive_desc.hpp"
 #include "common/primitive_exec_types.hpp"
 
@@ -101,6 +102,8 @@ protected:
 
         primitive_cache_iface_t::create_func_ptr_t create = [](void *context) {
             auto &c = *static_cast<create_context_t *>(context);
+            create_breakdown::scope_t breakdown_scope(
+                    create_breakdown::phase_t::primitive_init);
             std::shared_ptr<primitive_t> p = std::make_shared<impl_type>(c.pd);
             status_t status
                     = p->init(c.engine, c.use_global_scratchpad, c.cache_blob);
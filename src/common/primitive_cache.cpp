@@ -33,7 +33,8 @@ struct primitive_cache_t {
     using result_t = primitive_cache_iface_t::result_t;
     using create_func_t = result_t (&)(void *);
 
-    primitive_cache_t(int capacity) : cache_(capacity) {};
+    primitive_cache_t(int capacity)
+        : cache_(capacity, n_kind_partitions, kind_partition) {};
 
     ~primitive_cache_t() = default;
 
@@ -43,17 +44,63 @@ struct primitive_cache_t {
     int get_capacity() const { return cache_.get_capacity(); }
     int get_size() const { return cache_.get_size(); }
 
+    // Public primitive kinds get a partition each, internal ones share the
+    // last partition.
+    static constexpr int n_kind_partitions = primitive_kind::group_normalization
+            + 2;
+    static int kind_partition(primitive_kind_t kind) {
+        if (kind < 0 || kind > primitive_kind::group_normalization)
+            return n_kind_partitions - 1;
+        return static_cast<int>(kind);
+    }
+
+    status_t set_kind_capacity(primitive_kind_t kind, int capacity) {
+        return cache_.set_partition_capacity(kind_partition(kind), capacity);
+    }
+
+    utils::cache_partition_stats_t get_stats(primitive_kind_t kind) const {
+        if (kind != primitive_kind::undefined)
+            return cache_.get_partition_stats(kind_partition(kind));
+
+        utils::cache_partition_stats_t total;
+        for (int p = 0; p < n_kind_partitions; p++) {
+            const auto stats = cache_.get_partition_stats(p);
+            total.hits += stats.hits;
+            total.misses += stats.misses;
+            total.evictions += stats.evictions;
+            total.size += stats.size;
+        }
+        total.capacity = cache_.get_capacity();
+        return total;
+    }
+
     std::shared_ptr<primitive_desc_t> get_pd(const key_t &key) {
         result_t result = cache_.get(key);
         return result.value != nullptr ? result.value->pd() : nullptr;
     }
 
+    std::vector<std::shared_ptr<primitive_t>> get_primitives(
+            const engine_id_t &engine_id) const {
+        auto results = cache_.get_objects([&](const key_t &key) {
+            return key.engine_id_ == engine_id;
+        });
+        std::vector<std::shared_ptr<primitive_t>> primitives;
+        for (auto &r : results) {
+            if (r.is_empty()) continue;
+            primitives.push_back(std::move(r.value));
+        }
+        return primitives;
+    }
+
     result_t get_or_create(const key_t &key, create_func_t create,
             void *create_context, bool force_create) {
         return cache_.get_or_create(key, create, create_context, force_create);
     }
 
 private:
+    static int kind_partition(const key_t &key) {
+        return kind_partition(key.primitive_kind_);
+    }
     static void update_key(const key_t &key, const primitive_t &p) {
         const primitive_desc_t *pd = p.pd().get();
         key.op_desc_ = pd->op_desc();
@@ -102,11 +149,26 @@ int primitive_cache_iface_t::get_size() const {
     return cache_.get_size();
 }
 
+status_t primitive_cache_iface_t::set_kind_capacity(
+        primitive_kind_t kind, int capacity) {
+    return cache_.set_kind_capacity(kind, capacity);
+}
+
+utils::cache_partition_stats_t primitive_cache_iface_t::get_stats(
+        primitive_kind_t kind) const {
+    return cache_.get_stats(kind);
+}
+
 std::shared_ptr<primitive_desc_t> primitive_cache_iface_t::get_pd(
         const key_t &key) {
     return cache_.get_pd(key);
 }
 
+std::vector<std::shared_ptr<primitive_t>>
+primitive_cache_iface_t::get_primitives(const engine_id_t &engine_id) const {
+    return cache_.get_primitives(engine_id);
+}
+
 primitive_cache_iface_t::result_t primitive_cache_iface_t::get_or_create(
         const key_t &key, create_func_t create, void *create_context,
         bool force_create) {
@@ -146,6 +208,37 @@ dnnl::impl::status_t dnnl_set_primitive_cache_capacity(int capacity) {
     return dnnl::impl::set_primitive_cache_capacity(capacity, capacity);
 }
 
+dnnl::impl::status_t dnnl_set_primitive_cache_kind_capacity(
+        dnnl::impl::primitive_kind_t kind, int capacity) {
+    using namespace dnnl::impl;
+    if (kind <= primitive_kind::undefined
+            || kind > primitive_kind::group_normalization || capacity < -1)
+        return status::invalid_arguments;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    return global_primitive_cache().set_kind_capacity(kind, capacity);
+#endif
+    return status::success;
+}
+
+dnnl::impl::status_t dnnl_get_primitive_cache_stats(
+        dnnl::impl::primitive_kind_t kind,
+        dnnl_primitive_cache_stats_t *stats) {
+    using namespace dnnl::impl;
+    if (stats == nullptr || kind < primitive_kind::undefined
+            || kind > primitive_kind::group_normalization)
+        return status::invalid_arguments;
+    *stats = dnnl_primitive_cache_stats_t();
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    const auto s = global_primitive_cache().get_stats(kind);
+    stats->hits = static_cast<int64_t>(s.hits);
+    stats->misses = static_cast<int64_t>(s.misses);
+    stats->evictions = static_cast<int64_t>(s.evictions);
+    stats->size = s.size;
+    stats->capacity = s.capacity;
+#endif
+    return status::success;
+}
+
 // Undocumented API declared in primitive_cache_test_api.hpp
 using namespace dnnl;
 using namespace dnnl::impl;
@@ -18,6 +18,7 @@
 #define COMMON_PRIMITIVE_CACHE_HPP
 
 #include "c_types_map.hpp"
+#include "cache_utils.hpp"
 #include "oneapi/dnnl/dnnl.h"
 #include "primitive_hashing.hpp"
 #include "type_helpers.hpp"
@@ -50,7 +51,18 @@ struct primitive_cache_iface_t {
     int get_capacity() const;
     int get_size() const;
 
+    // Sets the maximum number of cached primitives of the kind, -1 removes
+    // the limit.
+    status_t set_kind_capacity(primitive_kind_t kind, int capacity);
+    // Returns the statistics of the kind, or of the whole cache if the kind is
+    // undefined.
+    utils::cache_partition_stats_t get_stats(primitive_kind_t kind) const;
+
     std::shared_ptr<primitive_desc_t> get_pd(const key_t &key);
+    // Returns the primitives created for the engine, the least recently used
+    // first.
+    std::vector<std::shared_ptr<primitive_t>> get_primitives(
+            const engine_id_t &engine_id) const;
     result_t get_or_create(const key_t &key, create_func_t create,
             void *create_context, bool force_create);
 
@@ -0,0 +1,865 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+#include <type_traits>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "engine.hpp"
+#include "opdesc.hpp"
+#include "primitive.hpp"
+#include "primitive_attr.hpp"
+#include "primitive_cache.hpp"
+#include "primitive_desc.hpp"
+#include "primitive_desc_iterator.hpp"
+#include "reorder.hpp"
+#include "serialization.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+#include "verbose.hpp"
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+
+// The bundle is a binary file with the following layout:
+//     <magic> <format version> <library version> <library hash> <CPU ISA>
+//     <number of entries> { <entry size> <entry> <entry checksum> }...
+// An entry holds everything needed to create the primitive descriptor with the
+// implementation that was dispatched originally: the operation descriptor, the
+// attributes, the position of the implementation in the implementation list
+// and the state of the primitive descriptor iterator. Generated code is not
+// stored, the kernels are generated again when the primitive is created.
+constexpr char bundle_magic[8] = {'D', 'N', 'N', 'L', 'P', 'C', 'B', '\0'};
+constexpr uint32_t bundle_format_version = 2;
+
+// FNV-1a hash of an entry. A corrupted entry is rejected before it is parsed,
+// as the fields that are not checked (algorithm kinds, flags, ...) are
+// trusted by the implementations.
+uint64_t get_checksum(const std::vector<uint8_t> &data) {
+    uint64_t h = 14695981039346656037ull;
+    for (uint8_t b : data) {
+        h ^= b;
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+struct writer_t {
+    template <typename T>
+    void operator()(const T &t) {
+        static_assert(std::is_trivially_copyable<T>::value,
+                "T must be trivially copyable.");
+        const auto *p = reinterpret_cast<const uint8_t *>(&t);
+        data_.insert(data_.end(), p, p + sizeof(T));
+    }
+
+    void operator()(const std::vector<uint8_t> &v) {
+        (*this)(static_cast<uint64_t>(v.size()));
+        data_.insert(data_.end(), v.begin(), v.end());
+    }
+
+    void operator()(const std::string &s) {
+        (*this)(std::vector<uint8_t>(s.begin(), s.end()));
+    }
+
+    template <typename T1, typename T2, typename... Args>
+    void operator()(const T1 &a1, const T2 &a2, const Args &...args) {
+        (*this)(a1);
+        (*this)(a2, args...);
+    }
+
+    std::vector<uint8_t> data_;
+};
+
+// Reads the values written by `writer_t`. Reading past the end of the data
+// marks the reader as failed instead of reading garbage.
+struct reader_t {
+    reader_t(const uint8_t *data, size_t size) : data_(data), size_(size) {}
+
+    template <typename T>
+    void operator()(T &t) {
+        static_assert(std::is_trivially_copyable<T>::value,
+                "T must be trivially copyable.");
+        if (!take(sizeof(T))) return;
+        std::memcpy(&t, data_ + pos_ - sizeof(T), sizeof(T));
+    }
+
+    void operator()(std::vector<uint8_t> &v) {
+        uint64_t size = 0;
+        (*this)(size);
+        if (!take(size)) return;
+        v.assign(data_ + pos_ - size, data_ + pos_);
+    }
+
+    void operator()(std::string &s) {
+        std::vector<uint8_t> v;
+        (*this)(v);
+        s.assign(v.begin(), v.end());
+    }
+
+    template <typename T1, typename T2, typename... Args>
+    void operator()(T1 &a1, T2 &a2, Args &...args) {
+        (*this)(a1);
+        (*this)(a2, args...);
+    }
+
+    bool ok() const { return ok_; }
+    bool empty() const { return pos_ == size_; }
+
+private:
+    bool take(uint64_t size) {
+        ok_ = ok_ && size <= size_ - pos_;
+        if (ok_) pos_ += static_cast<size_t>(size);
+        return ok_;
+    }
+
+    const uint8_t *data_;
+    size_t size_;
+    size_t pos_ = 0;
+    bool ok_ = true;
+};
+
+bool is_valid_dt(data_type_t dt, bool allow_undef = true) {
+    using namespace data_type;
+    return (allow_undef && dt == undef)
+            || utils::one_of(dt, f4_e2m1, e8m0, f8_e5m2, f8_e4m3, f16, bf16,
+                    f32, f64, s64, s32, s8, u8, s4, u4);
+}
+
+// The descriptors are read as raw bytes, and the implementations trust them
+// as if they were built by the API. A memory descriptor is accepted only if
+// it is consistent enough for the size and offset computations.
+status_t check_md(const memory_desc_t &md) {
+    using namespace status;
+    if (md.ndims < 0 || md.ndims > DNNL_MAX_NDIMS) return invalid_arguments;
+    // A zero descriptor compares equal to any other one with no dimensions,
+    // so the fields used by hashing are checked on their own.
+    if (md.ndims == 0)
+        return md.format_kind == format_kind::undef
+                        && md.data_type == data_type::undef
+                        && md.offset0 == 0 && md.extra.flags == 0
+                ? success
+                : invalid_arguments;
+    if (memory_desc_sanity_check(md) != success) return invalid_arguments;
+
+    for (int d = 0; d < md.ndims; d++) {
+        if (is_runtime_value(md.dims[d])) continue;
+        if (md.padded_dims[d] < md.dims[d] || md.padded_offsets[d] < 0
+                || md.padded_offsets[d] > md.padded_dims[d] - md.dims[d])
+            return invalid_arguments;
+    }
+    if (md.offset0 < 0) return invalid_arguments;
+
+    switch ((int)md.format_kind) {
+        case format_kind::any: break;
+        case format_kind::blocked: {
+            const auto &bd = md.format_desc.blocking;
+            if (bd.inner_nblks < 0 || bd.inner_nblks > DNNL_MAX_NDIMS)
+                return invalid_arguments;
+            dims_t blocks;
+            utils::array_set(blocks, 1, md.ndims);
+            for (int i = 0; i < bd.inner_nblks; i++) {
+                if (bd.inner_idxs[i] < 0 || bd.inner_idxs[i] >= md.ndims
+                        || bd.inner_blks[i] <= 0)
+                    return invalid_arguments;
+                blocks[bd.inner_idxs[i]] *= bd.inner_blks[i];
+            }
+            for (int d = 0; d < md.ndims; d++)
+                if (!is_runtime_value(md.padded_dims[d])
+                        && md.padded_dims[d] % blocks[d] != 0)
+                    return invalid_arguments;
+            break;
+        }
+        // Sparse, opaque and other layouts are not recorded.
+        default: return invalid_arguments;
+    }
+
+    using namespace memory_extra_flags;
+    const uint64_t known_flags = compensation_conv_s8s8 | scale_adjust
+            | rnn_u8s8_compensation | rnn_s8s8_compensation
+            | compensation_conv_asymmetric_src;
+    const int max_mask = (1 << md.ndims) - 1;
+    if ((md.extra.flags & ~known_flags) != 0
+            || md.extra.compensation_mask < 0
+            || md.extra.compensation_mask > max_mask
+            || md.extra.asymm_compensation_mask < 0
+            || md.extra.asymm_compensation_mask > max_mask)
+        return invalid_arguments;
+    return success;
+}
+
+// Visits the fields of a descriptor like `reader_t` and checks the memory
+// descriptors and data types in it.
+struct checker_t {
+    template <typename T>
+    void operator()(const T &) {}
+
+    void operator()(const memory_desc_t &md) {
+        ok_ = ok_ && check_md(md) == status::success;
+    }
+
+    void operator()(const data_type_t &dt) { ok_ = ok_ && is_valid_dt(dt); }
+
+    template <size_t N>
+    void operator()(const memory_desc_t (&mds)[N]) {
+        for (const auto &md : mds)
+            (*this)(md);
+    }
+
+    template <typename T1, typename T2, typename... Args>
+    void operator()(const T1 &a1, const T2 &a2, const Args &...args) {
+        (*this)(a1);
+        (*this)(a2, args...);
+    }
+
+    bool ok() const { return ok_; }
+
+private:
+    bool ok_ = true;
+};
+
+// The operation descriptor fields are visited by the same functions for
+// writing, reading and checking. The last argument selects the descriptor
+// type.
+template <typename io_t, typename T>
+void io_desc(io_t &io, T &d, const batch_normalization_desc_t *) {
+    io(d.prop_kind, d.src_desc, d.dst_desc, d.diff_src_desc, d.diff_dst_desc,
+            d.scaleshift_desc, d.diff_scaleshift_desc, d.stat_desc,
+            d.batch_norm_epsilon, d.flags);
+}
+
+template <typename io_t, typename T>
+void io_desc(io_t &io, T &d, const binary_desc_t *) {
+    io(d.alg_kind, d.src_desc, d.dst_desc);
+}
+
+template <typename io_t, typename T>
+void io_desc(io_t &io, T &d, const convolution_desc_t *) {
+    io(d.prop_kind, d.alg_kind, d.src_desc, d.diff_src_desc, d.weights_desc,
+            d.diff_weights_desc, d.bias_desc, d.diff_bias_desc, d.dst_desc,
+            d.diff_dst_desc, d.strides, d.dilates, d.padding,
+            d.accum_data_type, d.use_inversion);
+}
+
+template <typename io_t, typename T>
+void io_desc(io_t &io, T &d, const eltwise_desc_t *) {
+    io(d.prop_kind, d.alg_kind, d.src_desc, d.dst_desc, d.diff_src_desc,
+            d.diff_dst_desc, d.alpha, d.beta);
+}
+
+template <typename io_t, typename T>
+void io_desc(io_t &io, T &d, const embedding_bag_desc_t *) {
+    io(d.alg_kind, d.src_desc, d.indices_desc, d.offsets_desc, d.weights_desc,
+            d.dst_desc);
+}
+
+template <typename io_t, typename T>
+void io_desc(io_t &io, T &d, const gated_mlp_desc_t *) {
+    io(d.src_desc, d.w_gate_desc, d.w_up_desc, d.w_down_desc, d.dst_desc,
+            d.activation);
+}
+
+template <typename io_t, typename T>
+void io_desc(io_t &io, T &d, const group_normalization_desc_t *) {
+    io(d.prop_kind, d.src_desc, d.diff_src_desc, d.scaleshift_desc,
+            d.diff_scaleshift_desc, d.stat_desc, d.groups,
+            d.group_norm_epsilon, d.flags, d.dst_desc, d.diff_dst_desc);
+}
+
+template <typename io_t, typename T>
+void io_desc(io_t &io, T &d, const inner_product_desc_t *) {
+    io(d.prop_kind, d.src_desc, d.diff_src_desc, d.weights_desc,
+            d.diff_weights_desc, d.bias_desc, d.diff_bias_desc, d.dst_desc,
+            d.diff_dst_desc, d.accum_data_type);
+}
+
+template <typename io_t, typename T>
+void io_desc(io_t &io, T &d, const layer_normalization_desc_t *) {
+    io(d.prop_kind, d.src_desc, d.diff_src_desc, d.data_scaleshift_desc,
+            d.diff_data_scaleshift_desc, d.stat_desc, d.layer_norm_epsilon,
+            d.flags, d.dst_desc, d.diff_dst_desc);
+}
+
+template <typename io_t, typename T>
+void io_desc(io_t &io, T &d, const lrn_desc_t *) {
+    io(d.prop_kind, d.alg_kind, d.src_desc, d.dst_desc, d.diff_src_desc,
+            d.diff_dst_desc, d.local_size, d.lrn_alpha, d.lrn_beta, d.lrn_k);
+}
+
+template <typename io_t, typename T>
+void io_desc(io_t &io, T &d, const matmul_desc_t *) {
+    io(d.src_desc, d.weights_desc, d.bias_desc, d.dst_desc, d.reduce_desc,
+            d.reduce_kind, d.accum_data_type);
+}
+
+template <typename io_t, typename T>
+void io_desc(io_t &io, T &d, const pooling_desc_t *) {
+    io(d.prop_kind, d.alg_kind, d.src_desc, d.diff_src_desc, d.dst_desc,
+            d.diff_dst_desc, d.strides, d.kernel, d.padding, d.accum_data_type,
+            d.dilation);
+}
+
+template <typename io_t, typename T>
+void io_desc(io_t &io, T &d, const prelu_desc_t *) {
+    io(d.prop_kind, d.src_desc, d.weights_desc, d.dst_desc, d.diff_src_desc,
+            d.diff_weights_desc, d.diff_dst_desc);
+}
+
+template <typename io_t, typename T>
+void io_desc(io_t &io, T &d, const reduction_desc_t *) {
+    io(d.alg_kind, d.src_desc, d.dst_desc, d.p, d.eps);
+}
+
+template <typename io_t, typename T>
+void io_desc(io_t &io, T &d, const resampling_desc_t *) {
+    io(d.prop_kind, d.alg_kind, d.src_desc, d.diff_src_desc, d.dst_desc,
+            d.diff_dst_desc, d.factors);
+}
+
+template <typename io_t, typename T>
+void io_desc(io_t &io, T &d, const rnn_desc_t *) {
+    io(d.prop_kind, d.cell_kind, d.direction, d.src_layer_desc,
+            d.src_iter_desc, d.src_iter_c_desc, d.weights_layer_desc,
+            d.weights_iter_desc, d.bias_desc, d.dst_layer_desc,
+            d.dst_iter_desc, d.dst_iter_c_desc, d.weights_peephole_desc,
+            d.weights_projection_desc);
+    io(d.diff_src_layer_desc, d.diff_src_iter_desc, d.diff_src_iter_c_desc,
+            d.diff_weights_layer_desc, d.diff_weights_iter_desc,
+            d.diff_bias_desc, d.diff_dst_layer_desc, d.diff_dst_iter_desc,
+            d.diff_dst_iter_c_desc, d.diff_weights_peephole_desc,
+            d.diff_weights_projection_desc);
+    io(d.flags, d.activation_kind, d.alpha, d.beta);
+}
+
+template <typename io_t, typename T>
+void io_desc(io_t &io, T &d, const rope_desc_t *) {
+    io(d.alg_kind, d.src_desc, d.cos_desc, d.sin_desc, d.pos_desc,
+            d.dst_desc);
+}
+
+template <typename io_t, typename T>
+void io_desc(io_t &io, T &d, const shuffle_desc_t *) {
+    io(d.prop_kind, d.src_desc, d.dst_desc, d.axis, d.group_size);
+}
+
+template <typename io_t, typename T>
+void io_desc(io_t &io, T &d, const softmax_desc_t *) {
+    io(d.prop_kind, d.src_desc, d.diff_src_desc, d.softmax_axis, d.alg_kind,
+            d.dst_desc, d.diff_dst_desc);
+}
+
+template <typename io_t, typename T>
+void io_desc(io_t &io, T &d, const topk_desc_t *) {
+    io(d.alg_kind, d.k, d.temperature, d.src_desc, d.dst_desc,
+            d.indices_desc);
+}
+
+// Primitive kinds created through the primitive descriptor iterator. Concat,
+// sum, gemm and sdpa descriptors hold pointers or are not created this way
+// and are not recorded.
+#define BUNDLE_FOR_EACH_KIND(CASE) \
+    CASE(batch_normalization) \
+    CASE(binary) \
+    CASE(convolution) \
+    CASE(deconvolution) \
+    CASE(eltwise) \
+    CASE(embedding_bag) \
+    CASE(gated_mlp) \
+    CASE(group_normalization) \
+    CASE(inner_product) \
+    CASE(layer_normalization) \
+    CASE(lrn) \
+    CASE(matmul) \
+    CASE(pooling) \
+    CASE(prelu) \
+    CASE(reduction) \
+    CASE(resampling) \
+    CASE(rnn) \
+    CASE(rope) \
+    CASE(shuffle) \
+    CASE(softmax) \
+    CASE(topk)
+
+status_t save_desc(writer_t &w, const op_desc_t *op_desc) {
+#define CASE(pkind) \
+    case primitive_kind::pkind: { \
+        const auto &d = *op_desc_t::to_desc<pkind##_desc_t>(op_desc); \
+        checker_t c; \
+        io_desc(c, d, &d); \
+        if (!c.ok()) return status::unimplemented; \
+        io_desc(w, d, &d); \
+        return status::success; \
+    }
+
+    switch ((int)op_desc->primitive_kind) {
+        BUNDLE_FOR_EACH_KIND(CASE)
+        default: return status::unimplemented;
+    }
+#undef CASE
+}
+
+status_t load_desc(reader_t &r, primitive_kind_t kind,
+        std::unique_ptr<op_desc_t> &op_desc) {
+#define CASE(pkind) \
+    case primitive_kind::pkind: { \
+        auto d = utils::make_unique<pkind##_desc_t>(); \
+        if (!d) return status::out_of_memory; \
+        io_desc(r, *d, d.get()); \
+        if (!r.ok()) return status::invalid_arguments; \
+        checker_t c; \
+        io_desc(c, *d, d.get()); \
+        if (!c.ok()) return status::invalid_arguments; \
+        d->primitive_kind = kind; \
+        op_desc = std::move(d); \
+        return status::success; \
+    }
+
+    switch ((int)kind) {
+        BUNDLE_FOR_EACH_KIND(CASE)
+        default: return status::invalid_arguments;
+    }
+#undef CASE
+}
+
+#undef BUNDLE_FOR_EACH_KIND
+
+template <typename T>
+std::vector<uint8_t> serialize_quant(const T &entries) {
+    serialization_stream_t sstream;
+    entries.serialize(sstream);
+    return sstream.get_data();
+}
+
+// Reads the entries written by `quant_entries_t::serialize()`. The data is
+// parsed with `reader_t` rather than `deserializer_t`, which trusts the array
+// sizes it reads. Every entry goes through the same checks as the API ones.
+template <typename T>
+status_t deserialize_quant(reader_t &r, T &entries) {
+    static_assert(sizeof(bool) == 1, "bool is serialized as a single byte.");
+    std::vector<uint8_t> data;
+    r(data);
+    if (!r.ok() || data.empty()) return status::invalid_arguments;
+
+    reader_t d(data.data(), data.size());
+    size_t n_entries = 0;
+    d(n_entries);
+    for (size_t i = 0; i < n_entries && d.ok(); i++) {
+        int arg = 0, mask = 0;
+        data_type_t dt = data_type::undef;
+        size_t group_ndims = 0;
+        d(arg, mask, dt, group_ndims);
+        if (!d.ok() || group_ndims > DNNL_MAX_NDIMS)
+            return status::invalid_arguments;
+        dims_t group_dims {};
+        for (size_t g = 0; g < group_ndims; g++)
+            d(group_dims[g]);
+        uint8_t is_host_scalar = 0;
+        quantization_mode_t qmode = quantization_mode::undef;
+        d(is_host_scalar, qmode);
+        if (!d.ok()) return status::invalid_arguments;
+
+        // Entries reset to the default values carry no information.
+        if (mask == INT_MIN && dt == data_type::undef && group_ndims == 0
+                && is_host_scalar == 0 && qmode == quantization_mode::undef)
+            continue;
+
+        bool ok = mask >= 0 && is_valid_dt(dt, false) && is_host_scalar <= 1
+                && utils::one_of(qmode, quantization_mode::static_sazp,
+                        quantization_mode::dynamic_mx,
+                        quantization_mode::dynamic_fp);
+        for (size_t g = 0; g < group_ndims; g++)
+            ok = ok && group_dims[g] > 0;
+        if (!ok
+                || entries.set(arg, mask, dt, static_cast<int>(group_ndims),
+                           group_dims, is_host_scalar == 1, qmode)
+                        != status::success)
+            return status::invalid_arguments;
+    }
+    return d.ok() && d.empty() ? status::success : status::invalid_arguments;
+}
+
+// Writes the attributes the way the user passed them. RNN quantization,
+// dropout and GPU specific attributes are not recorded.
+status_t save_attr(writer_t &w, const primitive_attr_t &pd_attr) {
+    primitive_attr_t attr;
+    CHECK(attr.copy_from_and_reset(pd_attr));
+    if (!attr.rnn_data_qparams_.has_default_values()
+            || !attr.rnn_weights_qparams_.has_default_values()
+            || !attr.rnn_weights_projection_qparams_.has_default_values()
+            || !attr.rnn_tparams_.has_default_values()
+            || !attr.dropout_.has_default_values() || attr.gpu_attr_)
+        return status::unimplemented;
+
+    w(attr.scratchpad_mode_, attr.fpmath_.mode_, attr.fpmath_.apply_to_int_,
+            attr.acc_mode_, attr.deterministic_);
+
+    const auto &rounding_modes = attr.rounding_mode_.rounding_modes_map_;
+    w(static_cast<uint64_t>(rounding_modes.size()));
+    for (const auto &e : rounding_modes)
+        w(e.first, e.second);
+
+    w(serialize_quant(attr.scales_), serialize_quant(attr.zero_points_),
+            serialize_quant(attr.precomputed_reductions_));
+
+    const auto &post_ops = attr.post_ops_;
+    w(post_ops.len());
+    for (const auto &e : post_ops.entry_) {
+        w(e.kind);
+        switch ((int)e.kind) {
+            case primitive_kind::sum: w(e.sum); break;
+            case primitive_kind::eltwise: w(e.eltwise); break;
+            case primitive_kind::convolution: w(e.depthwise_conv); break;
+            case primitive_kind::binary: w(e.binary); break;
+            case primitive_kind::prelu: w(e.prelu); break;
+            default: return status::unimplemented;
+        }
+    }
+    return status::success;
+}
+
+status_t load_attr(reader_t &r, primitive_attr_t &attr) {
+    // Booleans are read as bytes, as not every byte value is a valid `bool`.
+    scratchpad_mode_t scratchpad_mode = scratchpad_mode::library;
+    fpmath_mode_t fpmath_mode = fpmath_mode::strict;
+    accumulation_mode_t acc_mode = accumulation_mode::strict;
+    uint8_t apply_to_int = 0, deterministic = 0;
+    r(scratchpad_mode, fpmath_mode, apply_to_int, acc_mode, deterministic);
+    if (!r.ok() || apply_to_int > 1 || deterministic > 1
+            || attr.set_scratchpad_mode(scratchpad_mode) != status::success
+            || attr.set_fpmath_mode(fpmath_mode, apply_to_int == 1)
+                    != status::success
+            || attr.set_accumulation_mode(acc_mode) != status::success)
+        return status::invalid_arguments;
+    attr.deterministic_ = deterministic == 1;
+
+    uint64_t n_rounding_modes = 0;
+    r(n_rounding_modes);
+    for (uint64_t i = 0; i < n_rounding_modes && r.ok(); i++) {
+        int arg = 0;
+        rounding_mode_t mode = rounding_mode::environment;
+        r(arg, mode);
+        CHECK(attr.rounding_mode_.set(arg, mode));
+    }
+
+    CHECK(deserialize_quant(r, attr.scales_));
+    CHECK(deserialize_quant(r, attr.zero_points_));
+    CHECK(deserialize_quant(r, attr.precomputed_reductions_));
+
+    int len = 0;
+    r(len);
+    if (!r.ok() || len < 0 || len > post_ops_t::post_ops_limit)
+        return status::invalid_arguments;
+    // The entries are appended through the same checks as the API ones.
+    auto &po = attr.post_ops_;
+    for (int i = 0; i < len; i++) {
+        post_ops_t::entry_t e;
+        r(e.kind);
+        if (!r.ok()) return status::invalid_arguments;
+        status_t st = status::invalid_arguments;
+        switch ((int)e.kind) {
+            case primitive_kind::sum:
+                r(e.sum);
+                if (r.ok() && is_valid_dt(e.sum.dt))
+                    st = po.append_sum(
+                            e.sum.scale, e.sum.zero_point, e.sum.dt);
+                break;
+            case primitive_kind::eltwise:
+                r(e.eltwise);
+                if (r.ok())
+                    st = po.append_eltwise(e.eltwise.scale, e.eltwise.alg,
+                            e.eltwise.alpha, e.eltwise.beta);
+                break;
+            case primitive_kind::convolution: {
+                r(e.depthwise_conv);
+                const auto &dw = e.depthwise_conv;
+                if (r.ok() && is_valid_dt(dw.wei_dt, false)
+                        && is_valid_dt(dw.bias_dt)
+                        && is_valid_dt(dw.dst_dt, false))
+                    st = po.append_dw(dw.wei_dt, dw.bias_dt, dw.dst_dt,
+                            dw.kernel, dw.stride, dw.padding);
+                break;
+            }
+            case primitive_kind::binary: {
+                r(e.binary);
+                const auto &b = e.binary;
+                const bool is_ternary = b.alg == alg_kind::binary_select;
+                if (r.ok() && check_md(b.user_src1_desc) == status::success
+                        && IMPLICATION(is_ternary,
+                                check_md(b.user_src2_desc)
+                                        == status::success))
+                    st = po.append_binary(b.alg, &b.user_src1_desc,
+                            is_ternary ? &b.user_src2_desc : nullptr);
+                break;
+            }
+            case primitive_kind::prelu:
+                r(e.prelu);
+                if (r.ok()) st = po.append_prelu(e.prelu.mask);
+                break;
+            default: break;
+        }
+        if (st != status::success) return status::invalid_arguments;
+    }
+    return r.ok() ? status::success : status::invalid_arguments;
+}
+
+// A primitive recorded in the bundle.
+struct recipe_t {
+    primitive_kind_t kind = primitive_kind::undefined;
+    std::string impl_name;
+    int impl_idx = -1;
+    int pd_iterator_offset = 0;
+    int skip_idx = -1;
+    // Set for all primitive kinds except reorder.
+    std::unique_ptr<op_desc_t> op_desc;
+    // Set for reorder only.
+    memory_desc_t src_md, dst_md;
+    primitive_attr_t attr;
+};
+
+status_t save_recipe(writer_t &w, const primitive_desc_t *pd) {
+    // Backward primitive descriptors depend on the forward ones.
+    if (!pd->hint_mds(false /* is_hint */).empty())
+        return status::unimplemented;
+
+    const op_desc_t *op_desc = pd->op_desc();
+    const primitive_kind_t kind = op_desc->primitive_kind;
+    w(kind, pd->impl_idx(), pd->pd_iterator_offset(), pd->skip_idx());
+    w(std::string(pd->name()));
+
+    if (kind == primitive_kind::reorder) {
+        const auto *d = op_desc_t::to_desc<reorder_desc_t>(op_desc);
+        if (d->is_cross_engine
+                || !utils::everyone_is(engine_kind::cpu, d->src_engine_kind,
+                        d->dst_engine_kind))
+            return status::unimplemented;
+        if (check_md(*d->src_md) != status::success
+                || check_md(*d->dst_md) != status::success)
+            return status::unimplemented;
+        w(*d->src_md, *d->dst_md);
+    } else {
+        // Only the descriptors created by the iterator can be replayed.
+        if (pd->impl_idx() < 0) return status::unimplemented;
+        CHECK(save_desc(w, op_desc));
+    }
+    return save_attr(w, *pd->attr());
+}
+
+status_t load_recipe(reader_t &r, recipe_t &recipe) {
+    r(recipe.kind, recipe.impl_idx, recipe.pd_iterator_offset,
+            recipe.skip_idx);
+    r(recipe.impl_name);
+    if (!r.ok()) return status::invalid_arguments;
+
+    if (recipe.kind == primitive_kind::reorder) {
+        r(recipe.src_md, recipe.dst_md);
+        if (!r.ok() || check_md(recipe.src_md) != status::success
+                || check_md(recipe.dst_md) != status::success)
+            return status::invalid_arguments;
+    } else
+        CHECK(load_desc(r, recipe.kind, recipe.op_desc));
+    CHECK(load_attr(r, recipe.attr));
+    return r.empty() ? status::success : status::invalid_arguments;
+}
+
+status_t create_from_recipe(engine_t *engine, const recipe_t &recipe) {
+    std::shared_ptr<primitive_desc_t> pd;
+    if (recipe.kind == primitive_kind::reorder) {
+        CHECK(reorder_primitive_desc_create(
+                pd, engine, &recipe.src_md, &recipe.dst_md, &recipe.attr));
+    } else {
+        primitive_desc_iterator_t it(engine, recipe.op_desc.get(),
+                &recipe.attr, nullptr, recipe.skip_idx);
+        if (!it.is_initialized()) return status::out_of_memory;
+        if (!it.seek(recipe.impl_idx, recipe.pd_iterator_offset))
+            return status::unimplemented;
+        pd = *it;
+    }
+    // The implementation list is the same for the same library version and
+    // ISA, the check guards against an inconsistent bundle.
+    if (recipe.impl_name != pd->name()) return status::unimplemented;
+
+    std::pair<std::shared_ptr<primitive_t>, cache_state_t> p;
+    return pd->create_primitive(p, engine, cache_blob_t(), false);
+}
+
+void write_header(writer_t &w, uint32_t n_entries) {
+    const auto version = dnnl_version();
+    for (char c : bundle_magic)
+        w(c);
+    w(bundle_format_version, version->major, version->minor, version->patch);
+    w(std::string(version->hash));
+    w(static_cast<int>(dnnl_get_effective_cpu_isa()), n_entries);
+}
+
+status_t read_header(reader_t &r, uint32_t &n_entries) {
+    char magic[sizeof(bundle_magic)] = {};
+    uint32_t format_version = 0;
+    r(magic, format_version);
+    if (!r.ok() || std::memcmp(magic, bundle_magic, sizeof(magic)) != 0
+            || format_version != bundle_format_version) {
+        VERROR(common, common, "not a primitive cache bundle");
+        return status::invalid_arguments;
+    }
+
+    const auto version = dnnl_version();
+    int major = 0, minor = 0, patch = 0, isa = 0;
+    std::string hash;
+    r(major, minor, patch, hash, isa, n_entries);
+    if (!r.ok()) return status::invalid_arguments;
+
+    if (major != version->major || minor != version->minor
+            || patch != version->patch || hash != version->hash) {
+        VERROR(common, common,
+                "primitive cache bundle was saved by oneDNN v%d.%d.%d (%s)",
+                major, minor, patch, hash.c_str());
+        return status::invalid_arguments;
+    }
+    if (isa != static_cast<int>(dnnl_get_effective_cpu_isa())) {
+        VERROR(common, common,
+                "primitive cache bundle was saved for a different CPU ISA");
+        return status::invalid_arguments;
+    }
+    return status::success;
+}
+
+status_t save_bundle(engine_t *engine, const char *path, int &n_saved) {
+    n_saved = 0;
+    if (engine->kind() != engine_kind::cpu) return status::unimplemented;
+
+    const auto primitives
+            = primitive_cache().get_primitives(engine->engine_id());
+    std::vector<std::vector<uint8_t>> entries;
+    for (const auto &p : primitives) {
+        writer_t w;
+        if (save_recipe(w, p->pd().get()) != status::success) continue;
+        entries.push_back(std::move(w.data_));
+    }
+
+    writer_t w;
+    write_header(w, static_cast<uint32_t>(entries.size()));
+    for (const auto &e : entries)
+        w(e, get_checksum(e));
+
+    std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+    ofs.write(reinterpret_cast<const char *>(w.data_.data()),
+            static_cast<std::streamsize>(w.data_.size()));
+    if (!ofs) {
+        VERROR(common, common, "cannot write primitive cache bundle %s", path);
+        return status::runtime_error;
+    }
+    n_saved = static_cast<int>(entries.size());
+    return status::success;
+}
+
+status_t load_bundle(engine_t *engine, const char *path, int &n_loaded) {
+    n_loaded = 0;
+    if (engine->kind() != engine_kind::cpu) return status::unimplemented;
+
+    std::ifstream ifs(path, std::ios::binary);
+    if (!ifs) {
+        VERROR(common, common, "cannot read primitive cache bundle %s", path);
+        return status::invalid_arguments;
+    }
+    const std::vector<uint8_t> data((std::istreambuf_iterator<char>(ifs)),
+            std::istreambuf_iterator<char>());
+
+    reader_t r(data.data(), data.size());
+    uint32_t n_entries = 0;
+    CHECK(read_header(r, n_entries));
+    // Nothing to warm up when the primitive cache is disabled.
+    if (primitive_cache().get_capacity() == 0) return status::success;
+
+    std::vector<std::unique_ptr<recipe_t>> recipes;
+    for (uint32_t i = 0; i < n_entries; i++) {
+        std::vector<uint8_t> entry;
+        uint64_t checksum = 0;
+        r(entry, checksum);
+        if (!r.ok() || checksum != get_checksum(entry))
+            return status::invalid_arguments;
+
+        auto recipe = utils::make_unique<recipe_t>();
+        if (!recipe) return status::out_of_memory;
+        reader_t entry_r(entry.data(), entry.size());
+        CHECK(load_recipe(entry_r, *recipe));
+        recipes.push_back(std::move(recipe));
+    }
+    if (!r.empty()) return status::invalid_arguments;
+
+    // Primitives are independent from each other, so they are created in
+    // parallel. Entries are handed out dynamically as creation time varies a
+    // lot between primitives.
+    std::atomic<int> n_created {0};
+    std::atomic<size_t> next {0};
+    const auto create = [&](size_t i) {
+        const auto &recipe = *recipes[i];
+        if (create_from_recipe(engine, recipe) == status::success)
+            n_created++;
+        else
+            VWARN(common, common, "cannot re-create primitive %s",
+                    recipe.impl_name.c_str());
+    };
+    const int nthr = static_cast<int>(nstl::min<size_t>(
+            recipes.size(), dnnl_get_current_num_threads()));
+    if (nthr <= 1) {
+        for (size_t i = 0; i < recipes.size(); i++)
+            create(i);
+    } else {
+        parallel(nthr, [&](int, int) {
+            for (size_t i = next++; i < recipes.size(); i = next++)
+                create(i);
+        });
+    }
+
+    n_loaded = n_created;
+    return status::success;
+}
+
+} // namespace
+
+} // namespace impl
+} // namespace dnnl
+
+using namespace dnnl::impl;
+
+status_t dnnl_primitive_cache_save_bundle(
+        engine_t *engine, const char *path, int *n_saved) {
+    if (utils::any_null(engine, path)) return status::invalid_arguments;
+    int n = 0;
+    const status_t status = save_bundle(engine, path, n);
+    if (n_saved) *n_saved = n;
+    return status;
+}
+
+status_t dnnl_primitive_cache_load_bundle(
+        engine_t *engine, const char *path, int *n_loaded) {
+    if (utils::any_null(engine, path)) return status::invalid_arguments;
+    int n = 0;
+    const status_t status = load_bundle(engine, path, n);
+    if (n_loaded) *n_loaded = n;
+    return status;
+}
@@ -25,6 +25,7 @@
 #include "cache_blob.hpp"
 #include "cache_blob_id.hpp"
 #include "cache_hit_types.hpp"
+#include "create_breakdown.hpp"
 #include "memory_tracking.hpp"
 #include "nstl.hpp"
 #include "opdesc.hpp"
@@ -55,12 +56,16 @@ struct primitive_t;
 // NOLINTBEGIN(google-default-arguments)
 struct primitive_desc_t : public c_compatible {
     primitive_desc_t(const primitive_attr_t *attr, primitive_kind_t kind)
-        : attr_(*attr), kind_(kind), pd_iterator_offset_(0), skip_idx_(-1) {
+        : attr_(*attr)
+        , kind_(kind)
+        , pd_iterator_offset_(0)
+        , skip_idx_(-1)
+        , impl_idx_(-1) {
         is_initialized_ = is_initialized_ && attr_.is_initialized();
     }
 
     primitive_desc_t(primitive_kind_t kind)
-        : kind_(kind), pd_iterator_offset_(0), skip_idx_(-1) {}
+        : kind_(kind), pd_iterator_offset_(0), skip_idx_(-1), impl_idx_(-1) {}
 
     bool is_initialized() const { return is_initialized_; }
 
@@ -490,6 +495,9 @@ struct primitive_desc_t : public c_compatible {
 
     int pd_iterator_offset() const { return pd_iterator_offset_; }
     int skip_idx() const { return skip_idx_; }
+    // Position of the implementation in the engine implementation list, or -1
+    // when the primitive descriptor was not created by the iterator.
+    int impl_idx() const { return impl_idx_; }
 
     bool has_large_buffers() const {
         auto is_large = [](const memory_desc_t *md) {
@@ -518,6 +526,7 @@ protected:
     primitive_kind_t kind_;
     int pd_iterator_offset_;
     int skip_idx_;
+    int impl_idx_;
 
     memory_desc_t scratchpad_md_;
 
@@ -528,6 +537,7 @@ protected:
 
     void init_pd_iterator_offset(int offset) { pd_iterator_offset_ = offset; }
     void init_skip_idx(int skip_idx) { skip_idx_ = skip_idx; }
+    void init_impl_idx(int impl_idx) { impl_idx_ = impl_idx; }
 
     /** compares ws between fwd_pd and this (make sense to use for bwd_pd)
      * Expectation: this already set workspace, and this workspace should
@@ -566,8 +576,10 @@ protected:
         auto _pd = make_unique_pd<pd_t>(adesc, attr, hint);
         if (_pd == nullptr) return out_of_memory;
         if (!_pd->is_initialized()) return out_of_memory;
+        create_breakdown::pd_init_scope_t breakdown_scope(_pd.get());
         CHECK(_pd->init(engine));
         CHECK(_pd->init_scratchpad_md());
+        breakdown_scope.accept();
         return safe_ptr_assign(*pd, _pd.release());
     }
 
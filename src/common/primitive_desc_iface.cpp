@@ -18,6 +18,7 @@
 
 #include "c_types_map.hpp"
 
+#include "autotune.hpp"
 #include "engine.hpp"
 #include "primitive_desc_iface.hpp"
 #include "primitive_desc_iterator.hpp"
@@ -39,9 +40,9 @@ status_t primitive_desc_create(primitive_desc_iface_t **primitive_desc_iface,
 
     const bool known_primitive_kind = utils::one_of(op_desc->primitive_kind,
             batch_normalization, binary, convolution, deconvolution, eltwise,
-            gated_mlp, gemm, group_normalization, inner_product,
-            layer_normalization, lrn, matmul, pooling, prelu, reduction,
-            resampling, rnn, sdpa, shuffle, softmax);
+            embedding_bag, gated_mlp, gemm, group_normalization,
+            inner_product, layer_normalization, lrn, matmul, pooling, prelu,
+            reduction, resampling, rnn, rope, sdpa, shuffle, softmax, topk);
     if (!known_primitive_kind) return invalid_arguments;
 
     auto pd_iface = utils::make_unique<primitive_desc_iface_t>(engine, op_desc,
@@ -75,6 +76,7 @@ status_t dnnl_primitive_desc::init() {
 
     ++(*pd_iterator_);
     if (*pd_iterator_ == pd_iterator_->end()) return unimplemented;
+    CHECK(autotune::select_impl(pd_iterator_));
 
     pd_ = *(*pd_iterator_);
     engine_ = pd_iterator_->engine();
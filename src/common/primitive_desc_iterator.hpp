@@ -20,6 +20,7 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "create_breakdown.hpp"
 #include "engine.hpp"
 #include "impl_list_item.hpp"
 #include "primitive_attr.hpp"
@@ -69,6 +70,9 @@ struct primitive_desc_iterator_t : public c_compatible {
         // The state is equal to the state of the iterator that end() returns.
         if (idx_ == last_idx_) return *this;
 
+        create_breakdown::scope_t breakdown_scope(
+                create_breakdown::phase_t::pd_iterate);
+
         offset_++;
         pd_.reset();
 
@@ -84,7 +88,7 @@ struct primitive_desc_iterator_t : public c_compatible {
             if (idx_ == skip_idx_) continue;
             primitive_desc_t *candidate_pd = nullptr;
             auto s = impl_list_[idx_](&candidate_pd, op_desc_.get(), &attr_,
-                    engine_, hint_fwd_pd_, offset_, skip_idx_);
+                    engine_, hint_fwd_pd_, offset_, skip_idx_, idx_);
             if (s == status::success) {
                 pd_.reset(candidate_pd);
                 break;
@@ -93,9 +97,35 @@ struct primitive_desc_iterator_t : public c_compatible {
         return *this;
     }
 
+    // Creates the implementation at position `impl_idx` of the list right
+    // away, as if the iterator had been advanced to the `offset`-th candidate.
+    // Used to replay a dispatching decision made earlier, e.g. when loading a
+    // primitive cache bundle. The primitive cache is not looked up. Returns
+    // false if the implementation rejects the problem.
+    bool seek(int impl_idx, int offset) {
+        if (impl_idx < 0 || impl_idx >= last_idx_ || impl_idx == skip_idx_)
+            return false;
+
+        create_breakdown::scope_t breakdown_scope(
+                create_breakdown::phase_t::pd_iterate);
+
+        pd_.reset();
+        primitive_desc_t *candidate_pd = nullptr;
+        auto s = impl_list_[impl_idx](&candidate_pd, op_desc_.get(), &attr_,
+                engine_, hint_fwd_pd_, offset, skip_idx_, impl_idx);
+        if (s != status::success) return false;
+
+        idx_ = impl_idx;
+        offset_ = offset;
+        pd_.reset(candidate_pd);
+        return true;
+    }
+
     const std::shared_ptr<primitive_desc_t> &operator*() const { return pd_; }
 
     const primitive_attr_t &attr() const { return attr_; }
+    const op_desc_t *op_desc() const { return op_desc_.get(); }
+    const primitive_desc_t *hint_fwd_pd() const { return hint_fwd_pd_; }
 
     bool is_initialized() const { return is_initialized_; }
 
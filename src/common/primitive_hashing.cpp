@@ -47,6 +47,8 @@ key_t::key_t(const primitive_desc_t *pd, const engine_t *engine)
 
 bool key_t::operator==(const key_t &rhs) const {
     DNNL_SHORT_CIRCUIT_SELF_COMPARISON(rhs);
+    create_breakdown::scope_t breakdown_scope(
+            create_breakdown::phase_t::hashing);
     // clang-format off
     bool ret = true
         // Less expensive comparisons come first
@@ -83,6 +85,7 @@ bool key_t::operator==(const key_t &rhs) const {
             break;
             CASE(deconvolution)
             CASE(eltwise)
+            CASE(embedding_bag)
             CASE(gated_mlp)
             CASE(gemm)
             CASE(group_normalization)
@@ -94,12 +97,14 @@ bool key_t::operator==(const key_t &rhs) const {
             CASE(prelu)
             CASE(reduction)
             CASE(reorder)
+            CASE(rope)
             CASE(resampling)
             CASE(rnn)
             CASE(sdpa)
             CASE(shuffle)
             CASE(softmax)
             CASE(sum)
+            CASE(topk)
             CASE(zero_pad)
             default: assert(!"unknown primitive kind");
         }
@@ -183,6 +188,9 @@ size_t get_md_hash(const memory_desc_t &md) {
             seed = get_array_hash(seed,
                     md.format_desc.sparse_desc.metadata_types,
                     sparse_desc_t::max_metadata_types);
+            if (md.format_desc.sparse_desc.encoding == sparse_encoding::bsr)
+                seed = get_array_hash(seed,
+                        md.format_desc.sparse_desc.bsr_desc.block_dims, 2);
             // User cannot initialize `packed_desc` therefore `packed_desc`
             // is always zero initialized.
             break;
@@ -763,6 +771,52 @@ size_t get_desc_hash(const sdpa_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const rope_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.cos_desc));
+    seed = hash_combine(seed, get_md_hash(desc.sin_desc));
+    seed = hash_combine(seed, get_md_hash(desc.pos_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Combined hash for rope desc
+    return seed;
+}
+
+size_t get_desc_hash(const topk_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    seed = hash_combine(seed, get_md_hash(desc.indices_desc));
+    // Parameters
+    seed = hash_combine(seed, desc.k);
+    seed = hash_combine(seed, desc.temperature);
+    // Combined hash for topk desc
+    return seed;
+}
+
+size_t get_desc_hash(const embedding_bag_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.indices_desc));
+    seed = hash_combine(seed, get_md_hash(desc.offsets_desc));
+    seed = hash_combine(seed, get_md_hash(desc.weights_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Combined hash for embedding_bag desc
+    return seed;
+}
+
 size_t get_desc_hash(const gated_mlp_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -22,6 +22,7 @@
 #include <type_traits>
 
 #include "common/c_types_map.hpp"
+#include "common/create_breakdown.hpp"
 #include "common/engine_id.hpp"
 #include "common/type_helpers.hpp"
 #include "common/verbose.hpp"
@@ -73,6 +74,7 @@ size_t get_desc_hash(const batch_normalization_desc_t &desc);
 size_t get_desc_hash(const binary_desc_t &desc);
 size_t get_desc_hash(const convolution_desc_t &desc);
 size_t get_desc_hash(const eltwise_desc_t &desc);
+size_t get_desc_hash(const embedding_bag_desc_t &desc);
 size_t get_desc_hash(const gated_mlp_desc_t &desc);
 size_t get_desc_hash(const gemm_desc_t &desc);
 size_t get_desc_hash(const group_normalization_desc_t &desc);
@@ -84,12 +86,14 @@ size_t get_desc_hash(const pooling_desc_t &desc);
 size_t get_desc_hash(const prelu_desc_t &desc);
 size_t get_desc_hash(const reduction_desc_t &desc);
 size_t get_desc_hash(const reorder_desc_t &desc);
+size_t get_desc_hash(const rope_desc_t &desc);
 size_t get_desc_hash(const resampling_desc_t &desc);
 size_t get_desc_hash(const rnn_desc_t &desc);
 size_t get_desc_hash(const sdpa_desc_t &desc);
 size_t get_desc_hash(const shuffle_desc_t &desc);
 size_t get_desc_hash(const softmax_desc_t &desc);
 size_t get_desc_hash(const sum_desc_t &desc);
+size_t get_desc_hash(const topk_desc_t &desc);
 size_t get_desc_hash(const zero_pad_desc_t &desc);
 
 template <typename T>
@@ -138,6 +142,8 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
     result_type operator()(const argument_type &key) const {
         using namespace dnnl::impl;
         using namespace dnnl::impl::primitive_hashing;
+        create_breakdown::scope_t breakdown_scope(
+                create_breakdown::phase_t::hashing);
         size_t seed = 0;
         // Compute hash for primitive_kind_, attr_, impl_id_ and impl_nthr_
         seed = hash_combine(seed,
@@ -171,6 +177,7 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
             CASE(convolution)
             CASE(deconvolution)
             CASE(eltwise)
+            CASE(embedding_bag)
             CASE(gated_mlp)
             CASE(gemm)
             CASE(group_normalization)
@@ -182,12 +189,14 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
             CASE(prelu)
             CASE(reduction)
             CASE(reorder)
+            CASE(rope)
             CASE(resampling)
             CASE(rnn)
             CASE(sdpa)
             CASE(shuffle)
             CASE(softmax)
             CASE(sum)
+            CASE(topk)
             CASE(zero_pad)
             default: assert(!"unknown primitive_kind");
         }
@@ -17,6 +17,7 @@
 #include <string>
 
 #include "c_types_map.hpp"
+#include "create_breakdown.hpp"
 #include "engine.hpp"
 
 #if defined(DNNL_ENABLE_ITT_TASKS)
@@ -26,6 +27,7 @@
 #include "cache_hit_types.hpp"
 #include "primitive.hpp"
 #include "primitive_desc_iface.hpp"
+#include "primitive_cache.hpp"
 #include "primitive_exec_types.hpp"
 #include "primitive_iface.hpp"
 #include "profiler.hpp"
@@ -33,6 +35,7 @@
 #include "scratchpad_debug.hpp"
 #include "stack_checker.hpp"
 #include "stream.hpp"
+#include "trace.hpp"
 #include "utils.hpp"
 
 using namespace dnnl::impl;
@@ -54,6 +57,33 @@ void unpoison_outputs(const exec_args_t &args) {
         msan_unpoison(p, s);
     }
 }
+
+// Prints the time spent in the phases of the creation of the primitive,
+// including the creation of its primitive descriptor. The phases are
+// accumulated by the thread since its previous primitive creation.
+void print_create_breakdown(double stamp, const char *info) {
+    using namespace create_breakdown;
+    const stats_t stats = take_thread_stats();
+    ostringstream_t ss;
+    for (int i = 0; i < static_cast<int>(phase_t::n_phases); i++) {
+        const auto phase = static_cast<phase_t>(i);
+        if (i > 0) ss << ",";
+        ss << phase2str(phase) << ":" << stats[phase].time_ms << "/"
+           << stats[phase].count;
+    }
+    VFORMAT(stamp, verbose_t::create_profile, primitive, create,
+            VERBOSE_breakdown, "%s,%s", info, ss.str().c_str());
+}
+
+// Prints the primitive cache statistics of the primitive kind. Printed on
+// cache misses only, so that warm runs are not flooded.
+void print_cache_stats(double stamp, primitive_kind_t kind, const char *info) {
+    const auto stats = primitive_cache().get_stats(kind);
+    VFORMAT(stamp, verbose_t::create_profile, primitive, create,
+            VERBOSE_cache_stats, "%s,hits:%zu,misses:%zu,evictions:%zu,size:%d,"
+            "capacity:%d", info, stats.hits, stats.misses, stats.evictions,
+            stats.size, stats.capacity);
+}
 } // namespace
 
 namespace dnnl {
@@ -65,6 +95,11 @@ status_t primitive_create(primitive_iface_t **primitive_iface,
 
     std::pair<primitive_iface_t *, cache_state_t> p_iface;
 
+#if defined(DNNL_ENABLE_TRACE)
+    trace::scope_t trace_scope(
+            trace::span_kind_t::create, primitive_desc_iface);
+#endif
+
 #if defined(DNNL_ENABLE_ITT_TASKS)
     const bool enable_itt = itt::get_itt(itt::__itt_task_level_low);
     if (enable_itt) {
@@ -88,6 +123,10 @@ status_t primitive_create(primitive_iface_t **primitive_iface,
 
         VPROF(start_ms, primitive, create, str, p_iface.first->pd()->info(),
                 duration_ms);
+        print_create_breakdown(start_ms, p_iface.first->pd()->info());
+        if (p_iface.second == cache_state_t::miss)
+            print_cache_stats(start_ms, p_iface.first->pd()->impl()->kind(),
+                    p_iface.first->pd()->info());
     } else {
         CHECK(primitive_desc_iface->create_primitive_iface(
                 p_iface, cache_blob));
@@ -123,6 +162,10 @@ status_t primitive_execute(
     status_t status = success;
     auto pd = primitive_iface->pd();
 
+#if defined(DNNL_ENABLE_TRACE)
+    trace::scope_t trace_scope(trace::span_kind_t::exec, pd);
+#endif
+
 #if defined(DNNL_ENABLE_ITT_TASKS)
     const bool enable_itt = itt::get_itt(itt::__itt_task_level_low);
     if (enable_itt) {
@@ -343,7 +386,9 @@ status_t dnnl_primitive::init() {
         auto *scratchpad_ptr = create_scratchpad(
                 pd_->engine(), scratchpad_size, use_global_scratchpad);
         if (scratchpad_ptr == nullptr) return out_of_memory;
-        if (scratchpad_ptr->get_memory_storage() == nullptr) {
+        // Pooled scratchpads own no memory until an execution, an empty
+        // scratchpad means the allocation failed.
+        if (scratchpad_ptr->size() == 0) {
             delete scratchpad_ptr;
             return out_of_memory;
         }
@@ -373,7 +418,9 @@ status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
         mem_storage = scratchpad_memory ? scratchpad_memory->memory_storage()
                                         : nullptr;
     } else if (scratchpad_) {
-        mem_storage = scratchpad_->get_memory_storage();
+        mem_storage = scratchpad_->acquire();
+        if (mem_storage == nullptr && scratchpad_->size() > 0)
+            return out_of_memory;
     }
 
     // Obtain a scratchpad memory storage host ptr from the context.
@@ -391,6 +438,10 @@ status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
     ctx.set_resource_mapper(&resource_mapper_);
 
     auto status = primitive_->execute(ctx);
+    if (scratchpad_
+            && primitive_->pd()->attr()->scratchpad_mode_
+                    == scratchpad_mode::library)
+        scratchpad_->release(mem_storage);
     return status;
 }
 
@@ -35,6 +35,7 @@ status_t serialize_desc(
         CASE(convolution)
         CASE(deconvolution)
         CASE(eltwise)
+        CASE(embedding_bag)
         CASE(gemm)
         CASE(group_normalization)
         CASE(inner_product)
@@ -47,9 +48,11 @@ status_t serialize_desc(
         CASE(reorder)
         CASE(resampling)
         CASE(rnn)
+        CASE(rope)
         CASE(sdpa)
         CASE(shuffle)
         CASE(softmax)
+        CASE(topk)
         CASE(sum)
         default: return status::invalid_arguments;
     }
@@ -616,5 +619,43 @@ void serialize(serialization_stream_t &sstream, const gated_mlp_desc_t &desc) {
     sstream.append(desc.activation);
 }
 
+void serialize(serialization_stream_t &sstream, const rope_desc_t &desc) {
+    // Kinds
+    sstream.append(desc.primitive_kind);
+    sstream.append(desc.alg_kind);
+    // Memory descriptors
+    serialize(sstream, desc.src_desc);
+    serialize(sstream, desc.cos_desc);
+    serialize(sstream, desc.sin_desc);
+    serialize(sstream, desc.pos_desc);
+    serialize(sstream, desc.dst_desc);
+}
+
+void serialize(serialization_stream_t &sstream, const topk_desc_t &desc) {
+    // Kinds
+    sstream.append(desc.primitive_kind);
+    sstream.append(desc.alg_kind);
+    // Memory descriptors
+    serialize(sstream, desc.src_desc);
+    serialize(sstream, desc.dst_desc);
+    serialize(sstream, desc.indices_desc);
+    // Parameters
+    sstream.append(desc.k);
+    sstream.append(desc.temperature);
+}
+
+void serialize(
+        serialization_stream_t &sstream, const embedding_bag_desc_t &desc) {
+    // Kinds
+    sstream.append(desc.primitive_kind);
+    sstream.append(desc.alg_kind);
+    // Memory descriptors
+    serialize(sstream, desc.src_desc);
+    serialize(sstream, desc.indices_desc);
+    serialize(sstream, desc.offsets_desc);
+    serialize(sstream, desc.weights_desc);
+    serialize(sstream, desc.dst_desc);
+}
+
 } // namespace impl
 } // namespace dnnl
@@ -18,6 +18,7 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "create_breakdown.hpp"
 #include "engine.hpp"
 #include "impl_list_item.hpp"
 #include "primitive_cache.hpp"
@@ -140,8 +141,25 @@ status_t reorder_primitive_desc_create(std::shared_ptr<primitive_desc_t> &pd,
                     "mask is not consistent with groups");
         }
 
-        VCHECK_REORDER(sc.get(DNNL_ARG_DST).has_default_groups(),
+        // Destination groups are only supported when the scales are
+        // computed by the library from the source data.
+        const auto &sc_dst = sc.get(DNNL_ARG_DST);
+        VCHECK_REORDER(IMPLICATION(!sc_dst.has_default_groups(),
+                               sc_dst.is_dynamic()),
                 VERBOSE_UNSUPPORTED_SCALES_CFG);
+        if (sc_dst.is_dynamic()) {
+            const int dst_ndims = d_mdw.ndims();
+            VCHECK_REORDER(!sc_dst.has_default_groups() && dst_ndims >= 2
+                            && sc_dst.get_group(0) > 0
+                            && sc_dst.get_group(1) > 0,
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
+            const bool group_dims_are_consistent
+                    = dst_md->dims[dst_ndims - 2] % sc_dst.get_group(0) == 0
+                    && dst_md->dims[dst_ndims - 1] % sc_dst.get_group(1) == 0;
+            VCHECK_REORDER(group_dims_are_consistent,
+                    "groups dimensions are not consistent with reorder "
+                    "dimensions");
+        }
     }
 
     bool is_cross_engine = src_engine != dst_engine
@@ -150,6 +168,8 @@ status_t reorder_primitive_desc_create(std::shared_ptr<primitive_desc_t> &pd,
 
     reorder_desc_t desc = {primitive_kind::reorder, src_md, dst_md, s_ek, d_ek,
             is_cross_engine};
+    create_breakdown::scope_t breakdown_scope(
+            create_breakdown::phase_t::pd_iterate);
     primitive_hashing::key_t key(
             engine, reinterpret_cast<op_desc_t *>(&desc), attr, 0, {}, -1);
     pd = primitive_cache().get_pd(key);
@@ -158,9 +178,13 @@ status_t reorder_primitive_desc_create(std::shared_ptr<primitive_desc_t> &pd,
     for (auto r = engine->get_reorder_implementation_list(src_md, dst_md); *r;
             ++r) {
         reorder_pd_t *reorder_pd = nullptr;
+        // Reorder implementations do not expose their names before init, so
+        // the rejections are not attributed.
+        create_breakdown::pd_init_scope_t init_scope(nullptr);
         if ((*r)(&reorder_pd, engine, attr, src_engine, src_md, dst_engine,
                     dst_md)
                 == success) {
+            init_scope.accept();
             pd.reset(reorder_pd);
             return success;
         }
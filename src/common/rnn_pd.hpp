@@ -89,6 +89,11 @@ struct rnn_pd_t : public primitive_desc_t {
         return glob_zero_md;
     }
 
+    const memory_desc_t &seq_lengths_md() const {
+        if (with_seq_lengths()) return seq_lengths_md_;
+        return glob_zero_md;
+    }
+
     const memory_desc_t *weights_md(
             int index = 0, bool user_input = false) const override {
         if (index == 0)
@@ -211,6 +216,10 @@ struct rnn_pd_t : public primitive_desc_t {
         return desc_.flags & rnn_flags::diff_weights_overwrite;
     }
 
+    bool with_seq_lengths() const {
+        return desc_.flags & rnn_flags::variable_length;
+    }
+
     dnnl_rnn_direction_t direction() const { return desc_.direction; }
 
 protected:
@@ -228,6 +237,7 @@ protected:
     memory_desc_t dst_layer_md_;
     memory_desc_t dst_iter_md_;
     memory_desc_t dst_iter_c_md_;
+    memory_desc_t seq_lengths_md_;
 
     memory_desc_t ws_md_;
 
@@ -246,7 +256,16 @@ protected:
         , bias_md_(desc_.bias_desc)
         , dst_layer_md_(desc_.dst_layer_desc)
         , dst_iter_md_(desc_.dst_iter_desc)
-        , dst_iter_c_md_(desc_.dst_iter_c_desc) {}
+        , dst_iter_c_md_(desc_.dst_iter_c_desc)
+        , seq_lengths_md_() {
+        // Sequence lengths are a dense 1D s32 tensor with one entry per
+        // sample.
+        if (with_seq_lengths()) {
+            const dims_t seq_lengths_dims = {MB()};
+            memory_desc_init_by_tag(seq_lengths_md_, 1, seq_lengths_dims,
+                    data_type::s32, format_tag::a);
+        }
+    }
 };
 // NOLINTEND(google-default-arguments)
 
@@ -268,6 +287,10 @@ struct rnn_fwd_pd_t : public rnn_pd_t {
         if (arg == DNNL_ARG_SRC_ITER_C)
             return with_src_iter_c() ? arg_usage_t::input : arg_usage_t::unused;
 
+        if (arg == DNNL_ARG_SEQ_LENGTHS)
+            return with_seq_lengths() ? arg_usage_t::input
+                                      : arg_usage_t::unused;
+
         if (utils::one_of(arg, DNNL_ARG_WEIGHTS_LAYER, DNNL_ARG_WEIGHTS_ITER))
             return arg_usage_t::input;
 
@@ -304,6 +327,7 @@ struct rnn_fwd_pd_t : public rnn_pd_t {
             case DNNL_ARG_AUGRU_ATTENTION: return &const_augru_attention_md();
             case DNNL_ARG_SRC_ITER: return src_md(1);
             case DNNL_ARG_SRC_ITER_C: return src_md(2);
+            case DNNL_ARG_SEQ_LENGTHS: return &seq_lengths_md();
             case DNNL_ARG_WEIGHTS_LAYER: return weights_md(0);
             case DNNL_ARG_WEIGHTS_ITER: return weights_md(1);
             case DNNL_ARG_WEIGHTS_PEEPHOLE:
@@ -323,7 +347,8 @@ struct rnn_fwd_pd_t : public rnn_pd_t {
 
     int n_inputs() const override {
         return 3 + is_lstm_peephole() + is_lstm_projection() + with_bias()
-                + with_src_iter() + with_src_iter_c() + is_augru();
+                + with_src_iter() + with_src_iter_c() + is_augru()
+                + with_seq_lengths();
     }
     int n_outputs() const override {
         return 1 + with_dst_iter() + with_dst_iter_c() + is_training();
@@ -398,6 +423,10 @@ struct rnn_bwd_pd_t : public rnn_pd_t {
         if (arg == DNNL_ARG_DIFF_DST_ITER_C)
             return with_dst_iter_c() ? arg_usage_t::input : arg_usage_t::unused;
 
+        if (arg == DNNL_ARG_SEQ_LENGTHS)
+            return with_seq_lengths() ? arg_usage_t::input
+                                      : arg_usage_t::unused;
+
         if (arg == DNNL_ARG_WORKSPACE) return arg_usage_t::input;
 
         return primitive_desc_t::arg_usage(arg);
@@ -415,6 +444,7 @@ struct rnn_bwd_pd_t : public rnn_pd_t {
                 return &const_diff_augru_attention_md();
             case DNNL_ARG_DIFF_SRC_ITER: return diff_src_md(1);
             case DNNL_ARG_DIFF_SRC_ITER_C: return diff_src_md(2);
+            case DNNL_ARG_SEQ_LENGTHS: return &seq_lengths_md();
             case DNNL_ARG_WEIGHTS_LAYER: return weights_md(0);
             case DNNL_ARG_WEIGHTS_ITER: return weights_md(1);
             case DNNL_ARG_WEIGHTS_PEEPHOLE:
@@ -509,7 +539,8 @@ struct rnn_bwd_pd_t : public rnn_pd_t {
     int n_inputs() const override {
         return 6 + with_src_iter() + with_src_iter_c()
                 + 2 * (with_dst_iter() + with_dst_iter_c()) + is_lstm_peephole()
-                + is_lstm_projection() + with_bias() + is_augru();
+                + is_lstm_projection() + with_bias() + is_augru()
+                + with_seq_lengths();
     }
     int n_outputs() const override {
         return 3 + with_src_iter() + with_src_iter_c() + is_lstm_peephole()
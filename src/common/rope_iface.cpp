@@ -0,0 +1,39 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/opdesc.hpp"
+#include "common/primitive_desc_iface.hpp"
+#include "common/rope_iface.hpp"
+#include "common/rope_pd.hpp"
+
+using namespace dnnl::impl;
+
+status_t dnnl_rope_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        int interleaved, const memory_desc_t *src_desc,
+        const memory_desc_t *cos_desc, const memory_desc_t *sin_desc,
+        const memory_desc_t *pos_desc, const memory_desc_t *dst_desc,
+        const primitive_attr_t *attr) {
+    if (utils::any_null(src_desc, cos_desc, sin_desc, dst_desc))
+        return status::invalid_arguments;
+
+    const alg_kind_t alg = interleaved ? alg_kind::rope_interleaved
+                                       : alg_kind::rope_half;
+    auto rope_desc = dnnl::impl::create_rope_desc(
+            alg, src_desc, cos_desc, sin_desc, pos_desc, dst_desc);
+    return dnnl::impl::primitive_desc_create(primitive_desc_iface, engine,
+            (const dnnl::impl::op_desc_t *)&rope_desc, nullptr, attr);
+}
@@ -0,0 +1,58 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_ROPE_IFACE_HPP
+#define COMMON_ROPE_IFACE_HPP
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+#define DNNL_ARG_COS DNNL_ARG_SRC_1
+#define DNNL_ARG_SIN DNNL_ARG_SRC_2
+#define DNNL_ARG_POSITIONS DNNL_ARG_SRC_3
+
+/// Creates a primitive descriptor for a rotary position embedding (RoPE)
+/// primitive.
+///
+/// Every pair of elements of the innermost dimension of @p src_desc is
+/// rotated by the angle that corresponds to the pair index and the position
+/// of the row. The angles are passed as precomputed cosine and sine tables.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param interleaved Whether pairs are formed from adjacent elements
+///     (`x[2i], x[2i + 1]`) rather than from the two halves of the rotated
+///     dimension (`x[i], x[i + D / 2]`).
+/// @param src_desc Source memory descriptor ([..., seq_len, head_size]).
+/// @param cos_desc Cosine table memory descriptor
+///     ([max_positions, head_size / 2]).
+/// @param sin_desc Sine table memory descriptor
+///     ([max_positions, head_size / 2]).
+/// @param pos_desc Position ids memory descriptor (#dnnl_s32, the shape of
+///     @p src_desc without the innermost dimension, broadcast allowed). Can
+///     be NULL or a zero memory descriptor, in which case the position of a
+///     row is its index along the `seq_len` dimension.
+/// @param dst_desc Destination memory descriptor.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_rope_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        int interleaved, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t cos_desc, const_dnnl_memory_desc_t sin_desc,
+        const_dnnl_memory_desc_t pos_desc, const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_primitive_attr_t attr);
+
+#endif
@@ -0,0 +1,193 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_ROPE_PD_HPP
+#define COMMON_ROPE_PD_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_desc.hpp"
+#include "common/rope_iface.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define VDISPATCH_ROPE(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, rope, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+#define VDISPATCH_ROPE_SC(f, msg, ...) \
+    VCHECK(primitive, create, dispatch, rope, (f), "%s," msg, \
+            this->info(engine), ##__VA_ARGS__)
+
+static inline rope_desc_t create_rope_desc(alg_kind_t alg_kind,
+        const memory_desc_t *src_md, const memory_desc_t *cos_md,
+        const memory_desc_t *sin_md, const memory_desc_t *pos_md,
+        const memory_desc_t *dst_md) {
+    auto desc = rope_desc_t();
+    desc.primitive_kind = primitive_kind::rope;
+    desc.alg_kind = alg_kind;
+    desc.src_desc = *src_md;
+    desc.cos_desc = *cos_md;
+    desc.sin_desc = *sin_md;
+    desc.pos_desc = pos_md ? *pos_md : glob_zero_md;
+    desc.dst_desc = *dst_md;
+    return desc;
+}
+
+// NOLINTBEGIN(google-default-arguments)
+struct rope_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::rope;
+    using base_class = rope_pd_t;
+    using hint_class = rope_pd_t;
+
+    const rope_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::alg_kind:
+                *(alg_kind_t *)result = desc()->alg_kind;
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    int ndims() const { return desc_.src_desc.ndims; }
+    // Size of the rotated (innermost) dimension.
+    dim_t D() const { return desc_.src_desc.dims[ndims() - 1]; }
+    // Sequence length, the dimension positions are implied from.
+    dim_t S() const { return desc_.src_desc.dims[ndims() - 2]; }
+    // Number of rows in the sine and cosine tables.
+    dim_t P() const { return desc_.cos_desc.dims[0]; }
+
+    alg_kind_t alg_kind() const { return desc_.alg_kind; }
+    bool is_interleaved() const {
+        return alg_kind() == alg_kind::rope_interleaved;
+    }
+    bool with_positions() const {
+        return !memory_desc_wrapper(desc_.pos_desc).is_zero();
+    }
+
+    int n_inputs() const override { return 3 + with_positions(); }
+    int n_outputs() const override { return 1; }
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (utils::one_of(arg, DNNL_ARG_SRC, DNNL_ARG_COS, DNNL_ARG_SIN))
+            return arg_usage_t::input;
+        if (arg == DNNL_ARG_POSITIONS && with_positions())
+            return arg_usage_t::input;
+        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0, user_input);
+            case DNNL_ARG_COS: return src_md(1, user_input);
+            case DNNL_ARG_SIN: return src_md(2, user_input);
+            case DNNL_ARG_POSITIONS: return src_md(3, user_input);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            default: return primitive_desc_t::arg_md(arg, user_input);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return &desc_.src_desc;
+            case 1: return &desc_.cos_desc;
+            case 2: return &desc_.sin_desc;
+            case 3: return &desc_.pos_desc;
+            default: return &glob_zero_md;
+        }
+    }
+
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        return index == 0 ? &desc_.dst_desc : &glob_zero_md;
+    }
+
+protected:
+    rope_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd_pd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*op_desc_t::to_desc<rope_desc_t>(adesc)) {}
+
+    // Checks the shapes and data types that are common for all
+    // implementations.
+    bool pd_ok() const {
+        using namespace data_type;
+        if (!utils::one_of(alg_kind(), alg_kind::rope_interleaved,
+                    alg_kind::rope_half))
+            return false;
+
+        const auto &src = desc_.src_desc;
+        const auto &cos = desc_.cos_desc;
+        const auto &sin = desc_.sin_desc;
+        const auto &pos = desc_.pos_desc;
+        const auto &dst = desc_.dst_desc;
+        if (src.ndims < 2 || D() % 2 != 0) return false;
+        if (!utils::array_cmp(src.dims, dst.dims, src.ndims)
+                || src.ndims != dst.ndims)
+            return false;
+
+        // Tables hold one angle per rotation pair.
+        for (const auto *t : {&cos, &sin}) {
+            if (t->ndims != 2 || t->dims[1] != D() / 2 || t->dims[0] != P())
+                return false;
+        }
+
+        if (with_positions()) {
+            // Position ids cover all the dimensions but the rotated one and
+            // may be broadcast across any of them, e.g. across heads.
+            if (pos.ndims != ndims() - 1 || pos.data_type != s32)
+                return false;
+            for (int d = 0; d < pos.ndims; ++d)
+                if (!utils::one_of(pos.dims[d], 1, src.dims[d])) return false;
+        } else if (S() > P()) {
+            return false;
+        }
+        return true;
+    }
+
+    bool set_default_formats() {
+        bool ok = true;
+        for (auto *md : {&desc_.src_desc, &desc_.cos_desc, &desc_.sin_desc,
+                     &desc_.pos_desc, &desc_.dst_desc}) {
+            if (!memory_desc_wrapper(md).format_any()) continue;
+            ok = ok
+                    && memory_desc_init_by_strides(*md, nullptr)
+                            == status::success;
+        }
+        return ok;
+    }
+
+private:
+    rope_desc_t desc_;
+};
+// NOLINTEND(google-default-arguments)
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
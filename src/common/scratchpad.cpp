@@ -14,13 +14,21 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include "engine.hpp"
 #include "utils.hpp"
+#include "verbose.hpp"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "cpu/cpu_engine.hpp"
+#include "cpu/platform.hpp"
 #endif
 
 #include "scratchpad.hpp"
@@ -138,11 +146,220 @@ thread_local memory_storage_t *global_scratchpad_t::mem_storage_ = nullptr;
 thread_local size_t global_scratchpad_t::size_ = 0;
 thread_local unsigned int global_scratchpad_t::reference_count_ = 0;
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+/*
+  A process-wide pool of scratchpad buffers for CPU engines. Threads borrow a
+  buffer for the duration of an execution, so the resident memory depends on
+  the number of concurrent executions rather than on the number of threads
+  that ever executed a primitive.
+
+  Buffer sizes are rounded up to size classes with at most 25% of waste. Free
+  buffers are kept per NUMA node, and a thread borrows from the node it runs
+  on, so a buffer is reused on the node where its pages were first touched.
+*/
+struct scratchpad_pool_t {
+    static scratchpad_pool_t &get() {
+        static scratchpad_pool_t pool;
+        return pool;
+    }
+
+    // Controlled by the ONEDNN_SCRATCHPAD_POOL environment variable.
+    static bool is_enabled() {
+        static const bool enabled = getenv_int_user("SCRATCHPAD_POOL", 0) == 1;
+        return enabled;
+    }
+
+    memory_storage_t *borrow(size_t size) {
+        const size_t buf_size = class_size(size);
+        node_t &node = *nodes_[cpu::platform::get_numa_node()];
+        {
+            std::lock_guard<std::mutex> lock(node.mutex);
+            // Take the smallest free buffer that fits, but do not waste more
+            // than a half of a buffer on a small request.
+            auto it = node.free.lower_bound(buf_size);
+            if (it != node.free.end() && it->first <= 2 * buf_size) {
+                memory_storage_t *mem_storage = it->second.release();
+                node.lent[mem_storage] = {it->first, true};
+                node.free.erase(it);
+                hits_++;
+                return mem_storage;
+            }
+        }
+
+        const bool pooled = reserve(buf_size);
+        memory_storage_t *mem_storage = create_memory_storage(buf_size);
+        if (mem_storage == nullptr) {
+            if (pooled) pooled_bytes_ -= buf_size;
+            return nullptr;
+        }
+        (pooled ? allocations_ : unpooled_allocations_)++;
+
+        std::lock_guard<std::mutex> lock(node.mutex);
+        node.lent[mem_storage] = {buf_size, pooled};
+        return mem_storage;
+    }
+
+    void give_back(const memory_storage_t *mem_storage) {
+        // The buffer is looked up on the current node first, as the thread
+        // usually stays on the node it borrowed the buffer on.
+        const int cur = cpu::platform::get_numa_node();
+        for (int i = 0; i < (int)nodes_.size(); i++) {
+            node_t &node = *nodes_[(cur + i) % nodes_.size()];
+            std::lock_guard<std::mutex> lock(node.mutex);
+            const auto it = node.lent.find(mem_storage);
+            if (it == node.lent.end()) continue;
+            std::unique_ptr<memory_storage_t> buf(
+                    const_cast<memory_storage_t *>(mem_storage));
+            if (it->second.pooled)
+                node.free.emplace(it->second.size, std::move(buf));
+            node.lent.erase(it);
+            return;
+        }
+        assert(!"unknown scratchpad buffer");
+    }
+
+    scratchpad_pool_stats_t stats() const {
+        scratchpad_pool_stats_t s;
+        s.hits = hits_;
+        s.allocations = allocations_;
+        s.unpooled_allocations = unpooled_allocations_;
+        s.evictions = evictions_;
+        s.pooled_bytes = pooled_bytes_;
+        s.peak_pooled_bytes = peak_pooled_bytes_;
+        return s;
+    }
+
+private:
+    struct lent_t {
+        size_t size;
+        bool pooled;
+    };
+
+    struct node_t {
+        std::mutex mutex;
+        std::multimap<size_t, std::unique_ptr<memory_storage_t>> free;
+        std::unordered_map<const memory_storage_t *, lent_t> lent;
+    };
+
+    scratchpad_pool_t() {
+        const int limit_mb = getenv_int_user("SCRATCHPAD_POOL_LIMIT", 0);
+        limit_ = limit_mb > 0 ? static_cast<size_t>(limit_mb) << 20
+                              : SIZE_MAX;
+        for (int i = 0; i < cpu::platform::get_num_numa_nodes(); i++)
+            nodes_.emplace_back(new node_t);
+        // Make sure the service engine is destroyed after the pool buffers.
+        cpu::get_service_engine();
+    }
+
+    static size_t class_size(size_t size) {
+        constexpr size_t min_class_size = 64 * 1024;
+        if (size <= min_class_size) return min_class_size;
+        size_t pow2 = min_class_size;
+        while (2 * pow2 < size)
+            pow2 *= 2;
+        return utils::rnd_up(size, pow2 / 4);
+    }
+
+    static memory_storage_t *create_memory_storage(size_t size) {
+        // The service engine outlives user engines, so buffers may be kept
+        // after the engine that requested them is destroyed.
+        return create_scratchpad_memory_storage(
+                cpu::get_service_engine(), size);
+    }
+
+    // Accounts @p size bytes to the pool, releasing free buffers if the limit
+    // would be exceeded. Returns `false` if the bytes do not fit the limit.
+    bool reserve(size_t size) {
+        for (size_t i = 0; pooled_bytes_ + size > limit_ && i < nodes_.size();
+                i++) {
+            node_t &node = *nodes_[i];
+            std::lock_guard<std::mutex> lock(node.mutex);
+            while (!node.free.empty() && pooled_bytes_ + size > limit_) {
+                // Largest buffers first, as they are the least likely to be
+                // reused.
+                auto it = std::prev(node.free.end());
+                pooled_bytes_ -= it->first;
+                node.free.erase(it);
+                evictions_++;
+            }
+        }
+        size_t bytes = pooled_bytes_;
+        do {
+            if (bytes + size > limit_) return false;
+        } while (!pooled_bytes_.compare_exchange_weak(bytes, bytes + size));
+        bytes += size;
+
+        size_t peak = peak_pooled_bytes_;
+        while (bytes > peak
+                && !peak_pooled_bytes_.compare_exchange_weak(peak, bytes)) {}
+        VDEBUGINFO(1, primitive, scratchpad_pool,
+                "allocated %zu bytes, %zu bytes pooled", size, bytes);
+        return true;
+    }
+
+    size_t limit_;
+    std::vector<std::unique_ptr<node_t>> nodes_;
+
+    std::atomic<size_t> pooled_bytes_ {0};
+    std::atomic<size_t> peak_pooled_bytes_ {0};
+    std::atomic<size_t> hits_ {0};
+    std::atomic<size_t> allocations_ {0};
+    std::atomic<size_t> unpooled_allocations_ {0};
+    std::atomic<size_t> evictions_ {0};
+};
+
+/*
+  Implementation of the scratchpad_t interface that borrows the memory from
+  the scratchpad pool for each execution
+*/
+struct pooled_scratchpad_t : public scratchpad_t {
+    pooled_scratchpad_t(size_t size) : size_(size) {}
+
+    // The memory is only available between acquire() and release().
+    const memory_storage_t *get_memory_storage() const override {
+        return nullptr;
+    }
+
+    size_t size() const override { return size_; }
+
+    const memory_storage_t *acquire() override {
+        return scratchpad_pool_t::get().borrow(size_);
+    }
+
+    void release(const memory_storage_t *mem_storage) override {
+        if (mem_storage) scratchpad_pool_t::get().give_back(mem_storage);
+    }
+
+private:
+    size_t size_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(pooled_scratchpad_t);
+};
+#endif
+
+scratchpad_pool_stats_t get_scratchpad_pool_stats() {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (scratchpad_pool_t::is_enabled())
+        return scratchpad_pool_t::get().stats();
+#endif
+    return scratchpad_pool_stats_t();
+}
+
 /*
    Scratchpad creation routine
 */
 scratchpad_t *create_scratchpad(
         engine_t *engine, size_t size, bool use_global_scratchpad) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_THREADPOOL
+    // The memory is returned to the pool when the execution call returns, so
+    // the pool is not used with asynchronous runtimes, such as SYCL or a
+    // threadpool, which may still use the memory after that.
+    if (use_global_scratchpad && engine->kind() == engine_kind_t::dnnl_cpu
+            && is_native_runtime(engine->runtime_kind())
+            && scratchpad_pool_t::is_enabled())
+        return new pooled_scratchpad_t(size);
+#endif
 #ifndef DNNL_ENABLE_CONCURRENT_EXEC
     /*
      * TODO: global scratchpad should be able to handle memory
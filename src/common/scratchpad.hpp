@@ -28,11 +28,36 @@ struct scratchpad_t {
     virtual ~scratchpad_t() = default;
     virtual const memory_storage_t *get_memory_storage() const = 0;
     virtual size_t size() const = 0;
+
+    // Returns the memory for a single execution. It must be passed to
+    // release() once the execution is over. Scratchpads that own their memory
+    // return it as is, pooled scratchpads borrow it from the pool.
+    virtual const memory_storage_t *acquire() { return get_memory_storage(); }
+    virtual void release(const memory_storage_t *mem_storage) {
+        UNUSED(mem_storage);
+    }
 };
 
 scratchpad_t *create_scratchpad(
         engine_t *engine, size_t size, bool use_global_scratchpad);
 
+struct scratchpad_pool_stats_t {
+    // Borrows served with a free buffer of the pool.
+    size_t hits = 0;
+    // Buffers allocated and kept by the pool.
+    size_t allocations = 0;
+    // Buffers allocated for a single execution because keeping them would
+    // exceed the pool limit.
+    size_t unpooled_allocations = 0;
+    // Free buffers released to stay within the pool limit.
+    size_t evictions = 0;
+    // Bytes kept by the pool, both lent and free, and their peak value.
+    size_t pooled_bytes = 0;
+    size_t peak_pooled_bytes = 0;
+};
+
+scratchpad_pool_stats_t DNNL_API get_scratchpad_pool_stats();
+
 } // namespace impl
 } // namespace dnnl
 #endif
@@ -0,0 +1,50 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_TOPK_IFACE_HPP
+#define COMMON_TOPK_IFACE_HPP
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+/// Creates a primitive descriptor for a top-k primitive.
+///
+/// The primitive selects the @p k largest elements of every row of the
+/// innermost dimension of @p src_desc and returns them in descending order
+/// together with their indices. Equal values are ordered by their index.
+/// With @p with_softmax the selected values are replaced by their
+/// probabilities `softmax(src / temperature)` computed over the whole row.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param k Number of elements to select per row.
+/// @param with_softmax Whether to return softmax probabilities instead of
+///     the source values.
+/// @param temperature Softmax temperature. Ignored without @p with_softmax.
+/// @param src_desc Source memory descriptor ([..., n]).
+/// @param dst_desc Selected values memory descriptor ([..., k]).
+/// @param indices_desc Selected indices memory descriptor (#dnnl_s32,
+///     [..., k]).
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_topk_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_dim_t k, int with_softmax, float temperature,
+        const_dnnl_memory_desc_t src_desc, const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_memory_desc_t indices_desc,
+        const_dnnl_primitive_attr_t attr);
+
+#endif
@@ -0,0 +1,173 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_TOPK_PD_HPP
+#define COMMON_TOPK_PD_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_desc.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define DNNL_ARG_DST_INDICES DNNL_ARG_DST_1
+
+#define VDISPATCH_TOPK(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, topk, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+#define VDISPATCH_TOPK_SC(f, msg, ...) \
+    VCHECK(primitive, create, dispatch, topk, (f), "%s," msg, \
+            this->info(engine), ##__VA_ARGS__)
+
+static inline topk_desc_t create_topk_desc(alg_kind_t alg_kind, dim_t k,
+        float temperature, const memory_desc_t *src_md,
+        const memory_desc_t *dst_md, const memory_desc_t *indices_md) {
+    auto desc = topk_desc_t();
+    desc.primitive_kind = primitive_kind::topk;
+    desc.alg_kind = alg_kind;
+    desc.k = k;
+    desc.temperature = temperature;
+    desc.src_desc = *src_md;
+    desc.dst_desc = *dst_md;
+    desc.indices_desc = *indices_md;
+    return desc;
+}
+
+// NOLINTBEGIN(google-default-arguments)
+struct topk_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::topk;
+    using base_class = topk_pd_t;
+    using hint_class = topk_pd_t;
+
+    const topk_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::alg_kind:
+                *(alg_kind_t *)result = desc()->alg_kind;
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    int ndims() const { return desc_.src_desc.ndims; }
+    // Size of the reduced (innermost) dimension.
+    dim_t N() const { return desc_.src_desc.dims[ndims() - 1]; }
+    dim_t K() const { return desc_.k; }
+    // Number of independent rows.
+    dim_t nrows() const {
+        return memory_desc_wrapper(desc_.src_desc).nelems() / N();
+    }
+
+    bool with_softmax() const {
+        return desc_.alg_kind == alg_kind::softmax_accurate;
+    }
+    float temperature() const { return desc_.temperature; }
+
+    int n_inputs() const override { return 1; }
+    int n_outputs() const override { return 2; }
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (arg == DNNL_ARG_SRC) return arg_usage_t::input;
+        if (utils::one_of(arg, DNNL_ARG_DST, DNNL_ARG_DST_INDICES))
+            return arg_usage_t::output;
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0, user_input);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            case DNNL_ARG_DST_INDICES: return dst_md(1, user_input);
+            default: return primitive_desc_t::arg_md(arg, user_input);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        return index == 0 ? &desc_.src_desc : &glob_zero_md;
+    }
+
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return &desc_.dst_desc;
+            case 1: return &desc_.indices_desc;
+            default: return &glob_zero_md;
+        }
+    }
+
+protected:
+    topk_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd_pd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*op_desc_t::to_desc<topk_desc_t>(adesc)) {}
+
+    // Checks the shapes and data types that are common for all
+    // implementations.
+    bool pd_ok() const {
+        if (!utils::one_of(desc_.alg_kind, alg_kind::undef,
+                    alg_kind::softmax_accurate))
+            return false;
+        if (with_softmax() && !(temperature() > 0.f)) return false;
+
+        const auto &src = desc_.src_desc;
+        const auto &dst = desc_.dst_desc;
+        const auto &idx = desc_.indices_desc;
+        if (src.ndims < 1 || K() < 1 || K() > N()) return false;
+        if (idx.data_type != data_type::s32) return false;
+
+        // Outputs match the source in all the dimensions but the innermost
+        // one, which holds the selected elements.
+        for (const auto *md : {&dst, &idx}) {
+            if (md->ndims != src.ndims) return false;
+            if (!utils::array_cmp(md->dims, src.dims, src.ndims - 1))
+                return false;
+            if (md->dims[src.ndims - 1] != K()) return false;
+        }
+        return true;
+    }
+
+    bool set_default_formats() {
+        bool ok = true;
+        for (auto *md :
+                {&desc_.src_desc, &desc_.dst_desc, &desc_.indices_desc}) {
+            if (!memory_desc_wrapper(md).format_any()) continue;
+            ok = ok
+                    && memory_desc_init_by_strides(*md, nullptr)
+                            == status::success;
+        }
+        return ok;
+    }
+
+private:
+    topk_desc_t desc_;
+};
+// NOLINTEND(google-default-arguments)
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
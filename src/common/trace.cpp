@@ -0,0 +1,527 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "primitive_desc.hpp"
+#include "primitive_desc_iface.hpp"
+#include "trace.hpp"
+#include "utils.hpp"
+#include "verbose.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace trace {
+
+namespace {
+
+struct span_t {
+    uint64_t begin_ns;
+    uint64_t end_ns;
+    uint32_t name_id;
+    uint32_t info_id;
+    span_kind_t kind;
+    // Nesting level of the span on its thread. Spans at level 0 are used to
+    // compute the busy time of the thread.
+    uint8_t depth;
+};
+
+// A ring buffer written by a single thread. Old spans are overwritten when
+// the buffer is full.
+struct buffer_t {
+    buffer_t(int tid, size_t capacity) : tid(tid), spans(capacity) {}
+
+    void push(const span_t &span) {
+        const uint64_t n = count.load(std::memory_order_relaxed);
+        spans[n % spans.size()] = span;
+        count.store(n + 1, std::memory_order_release);
+    }
+
+    const int tid;
+    std::vector<span_t> spans;
+    // The total number of spans pushed to the buffer.
+    std::atomic<uint64_t> count {0};
+    // The number of spans already written by dump(). Guarded by the state
+    // mutex.
+    uint64_t dumped = 0;
+};
+
+const char *kind2str(span_kind_t kind) {
+    switch (kind) {
+        case span_kind_t::create: return "create";
+        case span_kind_t::exec: return "exec";
+        case span_kind_t::parallel: return "parallel";
+    }
+    return "unknown";
+}
+
+// Set while the state exists, so threads exiting during the library teardown
+// do not touch it.
+std::atomic<bool> state_alive {false};
+
+struct state_t {
+    static state_t &get() {
+        static state_t state;
+        return state;
+    }
+
+    uint64_t now_ns() const {
+        return static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - epoch_)
+                        .count());
+    }
+
+    buffer_t &thread_buffer() {
+        // Hands the buffer back when its thread exits.
+        struct owner_t {
+            ~owner_t() {
+                if (buffer && state_alive) state_t::get().release(buffer);
+            }
+            std::shared_ptr<buffer_t> buffer;
+        };
+        thread_local owner_t owner;
+        if (!owner.buffer) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            owner.buffer = std::make_shared<buffer_t>(next_tid_++, capacity_);
+            buffers_.push_back(owner.buffer);
+        }
+        return *owner.buffer;
+    }
+
+    // Frees the buffer of an exiting thread right away if all its spans are
+    // dumped. Otherwise the buffer is freed by the next dump().
+    void release(const std::shared_ptr<buffer_t> &buffer) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (buffer->dumped != buffer->count.load(std::memory_order_acquire))
+            return;
+        buffers_.erase(std::remove(buffers_.begin(), buffers_.end(), buffer),
+                buffers_.end());
+    }
+
+    uint32_t intern(const char *str) {
+        // Names of primitives usually come from a few long-living strings,
+        // so the lookup by address avoids taking the lock. The address may
+        // be reused for another string, hence the value is checked as well.
+        struct cached_t {
+            uint32_t id;
+            const std::string *value;
+        };
+        thread_local std::unordered_map<const char *, cached_t> cache;
+        const auto it = cache.find(str);
+        if (it != cache.end() && *it->second.value == str)
+            return it->second.id;
+        if (cache.size() > max_cached_strings) cache.clear();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto id_it = string_ids_.find(str);
+        if (id_it == string_ids_.end()) {
+            strings_.emplace_back(str);
+            id_it = string_ids_
+                            .emplace(strings_.back(),
+                                    static_cast<uint32_t>(strings_.size() - 1))
+                            .first;
+        }
+        cache[str] = {id_it->second, &strings_[id_it->second]};
+        return id_it->second;
+    }
+
+    status_t dump(const char *path, dnnl_trace_format_t format);
+
+private:
+    state_t() : epoch_(std::chrono::steady_clock::now()) {
+        state_alive = true;
+#if defined(DNNL_ENABLE_TRACE)
+        capacity_ = static_cast<size_t>(std::max(
+                getenv_int_user("TRACE_CAPACITY", default_capacity), 1));
+
+        const std::string trace = getenv_string_user("TRACE");
+        if (trace == "chrome" || trace == "1")
+            exit_format_ = dnnl_trace_format_chrome_json;
+        else if (trace == "perfetto")
+            exit_format_ = dnnl_trace_format_perfetto;
+        else
+            return;
+
+        // The path is case-sensitive, so it is not read with
+        // getenv_string_user().
+        char path[1024] = {0};
+        for (const char *name : {"ONEDNN_TRACE_FILE", "DNNL_TRACE_FILE"})
+            if (getenv(name, path, sizeof(path)) > 0) break;
+        exit_path_ = path[0] ? path
+                : exit_format_ == dnnl_trace_format_perfetto
+                ? "onednn_trace.pftrace"
+                : "onednn_trace.json";
+        dump_at_exit_ = true;
+        detail::enabled = 1;
+#endif
+    }
+
+    ~state_t() {
+        state_alive = false;
+        if (!dump_at_exit_) return;
+        detail::enabled = 0;
+        const status_t st = dump(exit_path_.c_str(), exit_format_);
+        if (st != status::success)
+            VWARN(common, trace, "cannot write trace file %s",
+                    exit_path_.c_str());
+    }
+
+    static constexpr int default_capacity = 1 << 16;
+    static constexpr size_t max_cached_strings = 4096;
+
+    const std::chrono::steady_clock::time_point epoch_;
+    size_t capacity_ = default_capacity;
+    bool dump_at_exit_ = false;
+    dnnl_trace_format_t exit_format_ = dnnl_trace_format_chrome_json;
+    std::string exit_path_;
+
+    std::mutex mutex_;
+    std::vector<std::shared_ptr<buffer_t>> buffers_;
+    int next_tid_ = 0;
+    // A deque keeps the addresses of the strings stable, so threads may read
+    // the strings they cached without the lock.
+    std::deque<std::string> strings_;
+    std::unordered_map<std::string, uint32_t> string_ids_;
+};
+
+thread_local int thread_depth = 0;
+thread_local uint32_t thread_name_id = no_info;
+
+// Spans of a single thread taken from its buffer.
+struct thread_spans_t {
+    int tid;
+    std::vector<span_t> spans;
+    uint64_t busy_ns;
+};
+
+std::string json_escape(const std::string &str) {
+    std::string res;
+    res.reserve(str.size());
+    for (const char c : str) {
+        if (c == '"' || c == '\\') {
+            res += '\\';
+            res += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            res += buf;
+        } else {
+            res += c;
+        }
+    }
+    return res;
+}
+
+std::string thread_name(const thread_spans_t &t, uint64_t window_ns) {
+    char buf[64];
+    const double busy = window_ns ? 100.0 * t.busy_ns / window_ns : 0.0;
+    snprintf(buf, sizeof(buf), "onednn thread %d (busy %.1f%%)", t.tid, busy);
+    return buf;
+}
+
+void write_chrome_json(FILE *f, const std::vector<thread_spans_t> &threads,
+        const std::deque<std::string> &strings, uint64_t window_ns) {
+    fprintf(f, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+    const char *sep = "\n";
+    for (const auto &t : threads) {
+        fprintf(f,
+                "%s{\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"name\":\"thread_name\","
+                "\"args\":{\"name\":\"%s\"}}",
+                sep, t.tid, thread_name(t, window_ns).c_str());
+        sep = ",\n";
+        for (const auto &s : t.spans) {
+            const std::string name = s.name_id == no_info
+                    ? kind2str(s.kind)
+                    : json_escape(strings[s.name_id]);
+            fprintf(f,
+                    "%s{\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"cat\":\"%s\","
+                    "\"name\":\"%s\",\"ts\":%.3f,\"dur\":%.3f",
+                    sep, t.tid, kind2str(s.kind), name.c_str(),
+                    s.begin_ns / 1e3, (s.end_ns - s.begin_ns) / 1e3);
+            if (s.info_id != no_info)
+                fprintf(f, ",\"args\":{\"info\":\"%s\"}",
+                        json_escape(strings[s.info_id]).c_str());
+            fprintf(f, "}");
+        }
+    }
+    fprintf(f, "\n]}\n");
+}
+
+// A minimal protobuf encoder for the subset of the Perfetto trace format
+// used below (protos/perfetto/trace/trace_packet.proto).
+struct proto_t {
+    void varint(uint64_t v) {
+        while (v >= 0x80) {
+            buf.push_back(static_cast<char>((v & 0x7f) | 0x80));
+            v >>= 7;
+        }
+        buf.push_back(static_cast<char>(v));
+    }
+    void add_uint(int field, uint64_t v) {
+        varint(static_cast<uint64_t>(field) << 3);
+        varint(v);
+    }
+    void add_bytes(int field, const std::string &v) {
+        varint((static_cast<uint64_t>(field) << 3) | 2);
+        varint(v.size());
+        buf += v;
+    }
+    void add_message(int field, const proto_t &m) { add_bytes(field, m.buf); }
+
+    std::string buf;
+};
+
+// Field numbers of the Perfetto protos.
+enum {
+    trace_packet = 1,
+    packet_timestamp = 8,
+    packet_sequence_id = 10,
+    packet_track_event = 11,
+    packet_track_descriptor = 60,
+    track_uuid = 1,
+    track_name = 2,
+    track_process = 3,
+    track_thread = 4,
+    process_pid = 1,
+    process_name = 6,
+    thread_pid = 1,
+    thread_tid = 2,
+    thread_thread_name = 5,
+    event_debug_annotations = 4,
+    event_type = 9,
+    event_track_uuid = 11,
+    event_categories = 22,
+    event_name = 23,
+    annotation_string_value = 6,
+    annotation_name = 10,
+    slice_begin = 1,
+    slice_end = 2,
+};
+
+void write_perfetto(FILE *f, const std::vector<thread_spans_t> &threads,
+        const std::deque<std::string> &strings, uint64_t window_ns) {
+    constexpr uint64_t pid = 1;
+    const auto write_packet = [&](const proto_t &packet) {
+        proto_t trace;
+        trace.add_message(trace_packet, packet);
+        fwrite(trace.buf.data(), 1, trace.buf.size(), f);
+    };
+
+    proto_t process, process_track, packet;
+    process.add_uint(process_pid, pid);
+    process.add_bytes(process_name, "oneDNN");
+    process_track.add_uint(track_uuid, pid);
+    process_track.add_message(track_process, process);
+    packet.add_message(packet_track_descriptor, process_track);
+    write_packet(packet);
+
+    for (const auto &t : threads) {
+        // Thread tracks are numbered after the process track.
+        const uint64_t uuid = pid + 1 + t.tid;
+        const uint64_t seq_id = uuid;
+        proto_t thread, thread_track, desc;
+        thread.add_uint(thread_pid, pid);
+        thread.add_uint(thread_tid, uuid);
+        thread.add_bytes(thread_thread_name, thread_name(t, window_ns));
+        thread_track.add_uint(track_uuid, uuid);
+        thread_track.add_message(track_thread, thread);
+        desc.add_message(packet_track_descriptor, thread_track);
+        write_packet(desc);
+
+        // Perfetto expects the events of a sequence ordered by time. At
+        // equal timestamps slices end before others begin, outer slices
+        // begin first and inner slices end first.
+        struct event_t {
+            uint64_t ts;
+            bool is_begin;
+            int order;
+            const span_t *span;
+        };
+        std::vector<event_t> events;
+        events.reserve(2 * t.spans.size());
+        for (const auto &s : t.spans) {
+            events.push_back({s.begin_ns, true, s.depth, &s});
+            events.push_back({s.end_ns, false, -s.depth, &s});
+        }
+        std::stable_sort(events.begin(), events.end(),
+                [](const event_t &a, const event_t &b) {
+                    if (a.ts != b.ts) return a.ts < b.ts;
+                    if (a.is_begin != b.is_begin) return !a.is_begin;
+                    return a.order < b.order;
+                });
+
+        for (const auto &e : events) {
+            const span_t &s = *e.span;
+            proto_t event, p;
+            event.add_uint(event_type, e.is_begin ? slice_begin : slice_end);
+            event.add_uint(event_track_uuid, uuid);
+            if (e.is_begin) {
+                event.add_bytes(event_categories, kind2str(s.kind));
+                event.add_bytes(event_name,
+                        s.name_id == no_info ? kind2str(s.kind)
+                                             : strings[s.name_id]);
+                if (s.info_id != no_info) {
+                    proto_t annotation;
+                    annotation.add_bytes(annotation_name, "info");
+                    annotation.add_bytes(
+                            annotation_string_value, strings[s.info_id]);
+                    event.add_message(event_debug_annotations, annotation);
+                }
+            }
+            p.add_uint(packet_timestamp, e.ts);
+            p.add_uint(packet_sequence_id, seq_id);
+            p.add_message(packet_track_event, event);
+            write_packet(p);
+        }
+    }
+}
+
+} // namespace
+
+status_t state_t::dump(const char *path, dnnl_trace_format_t format) {
+    std::vector<thread_spans_t> threads;
+    std::deque<std::string> strings;
+    uint64_t window_begin = UINT64_MAX, window_end = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto &b : buffers_) {
+            const uint64_t count = b->count.load(std::memory_order_acquire);
+            const uint64_t capacity = b->spans.size();
+            const uint64_t first = std::max(b->dumped,
+                    count > capacity ? count - capacity : uint64_t(0));
+            b->dumped = count;
+            if (first == count) continue;
+
+            thread_spans_t t {b->tid, {}, 0};
+            t.spans.reserve(count - first);
+            for (uint64_t i = first; i < count; i++) {
+                const span_t &s = b->spans[i % capacity];
+                t.spans.push_back(s);
+                if (s.depth == 0) t.busy_ns += s.end_ns - s.begin_ns;
+                window_begin = std::min(window_begin, s.begin_ns);
+                window_end = std::max(window_end, s.end_ns);
+            }
+            threads.push_back(std::move(t));
+        }
+        // The buffers of exited threads are not referenced by the threads
+        // anymore and are freed once dumped.
+        buffers_.erase(std::remove_if(buffers_.begin(), buffers_.end(),
+                               [](const std::shared_ptr<buffer_t> &b) {
+                                   return b.use_count() == 1;
+                               }),
+                buffers_.end());
+        strings = strings_;
+    }
+    const uint64_t window_ns
+            = window_end > window_begin ? window_end - window_begin : 0;
+
+    FILE *f = fopen(path, "wb");
+    if (!f) return status::runtime_error;
+    if (format == dnnl_trace_format_perfetto)
+        write_perfetto(f, threads, strings, window_ns);
+    else
+        write_chrome_json(f, threads, strings, window_ns);
+    return fclose(f) == 0 ? status::success : status::runtime_error;
+}
+
+namespace detail {
+std::atomic<int> enabled {-1};
+
+bool init_enabled() {
+    // The state reads the environment on construction.
+    state_t::get();
+    int expected = -1;
+    enabled.compare_exchange_strong(expected, 0);
+    return enabled.load(std::memory_order_relaxed) == 1;
+}
+} // namespace detail
+
+void set_enabled(bool enabled) {
+    state_t::get();
+    detail::enabled = enabled ? 1 : 0;
+}
+
+uint32_t intern(const char *str) {
+    return state_t::get().intern(str);
+}
+
+uint32_t current_name() {
+    return thread_name_id;
+}
+
+void scope_t::start(span_kind_t kind, const primitive_desc_iface_t *pd) {
+    const char *info = pd->info();
+    start(kind, intern(pd->impl()->name()),
+            info && *info ? intern(info) : no_info);
+}
+
+void scope_t::start(span_kind_t kind, uint32_t name_id, uint32_t info_id) {
+    kind_ = kind;
+    name_id_ = name_id;
+    info_id_ = info_id;
+    prev_name_id_ = thread_name_id;
+    thread_depth++;
+    thread_name_id = name_id;
+    begin_ns_ = state_t::get().now_ns();
+}
+
+void scope_t::finish() {
+    auto &state = state_t::get();
+    thread_depth--;
+    thread_name_id = prev_name_id_;
+    state.thread_buffer().push({begin_ns_, state.now_ns(), name_id_, info_id_,
+            kind_, static_cast<uint8_t>(std::min(thread_depth, 255))});
+}
+
+status_t dump(const char *path, dnnl_trace_format_t format) {
+    if (path == nullptr
+            || !utils::one_of(format, dnnl_trace_format_chrome_json,
+                    dnnl_trace_format_perfetto))
+        return status::invalid_arguments;
+    return state_t::get().dump(path, format);
+}
+
+} // namespace trace
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_set_trace(int enable) {
+    using namespace dnnl::impl;
+#if defined(DNNL_ENABLE_TRACE)
+    if (enable < 0 || enable > 1) return status::invalid_arguments;
+    trace::set_enabled(enable == 1);
+    return status::success;
+#else
+    return status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_dump_trace(const char *path, dnnl_trace_format_t format) {
+    return dnnl::impl::trace::dump(path, format);
+}
@@ -0,0 +1,108 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_TRACE_HPP
+#define COMMON_TRACE_HPP
+
+#include <atomic>
+#include <cstdint>
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+#include "c_types_map.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace trace {
+
+// Timeline tracer. Every thread records the spans it spends in primitive
+// creation, primitive execution and parallel regions into its own ring
+// buffer, so recording takes no locks. The buffers are converted into a
+// Chrome trace or a Perfetto trace on demand and at exit.
+
+enum class span_kind_t : uint8_t {
+    create = 0,
+    exec,
+    parallel,
+};
+
+constexpr uint32_t no_info = UINT32_MAX;
+
+namespace detail {
+// 1 if spans are recorded, 0 if not, and -1 until the ONEDNN_TRACE environment
+// variable is read.
+extern std::atomic<int> enabled;
+bool init_enabled();
+} // namespace detail
+
+// Returns `true` if spans are recorded. Controlled by the ONEDNN_TRACE
+// environment variable and dnnl_set_trace(). Inlined, as it is checked on
+// every primitive call and parallel region.
+inline bool is_enabled() {
+    const int enabled = detail::enabled.load(std::memory_order_relaxed);
+    return enabled < 0 ? detail::init_enabled() : enabled == 1;
+}
+void set_enabled(bool enabled);
+
+// Returns an identifier of the string that remains valid until exit. Strings
+// are compared by value, so @p str may be freed after the call.
+uint32_t intern(const char *str);
+
+// Returns the name identifier of the innermost span of the calling thread or
+// `no_info` if there is none. Used to label parallel regions on the threads
+// working for a primitive.
+uint32_t current_name();
+
+// Records a span of @p kind for the lifetime of the object. Does nothing if
+// tracing is disabled at construction.
+struct scope_t {
+    // The span is named after the implementation and carries the primitive
+    // descriptor info.
+    scope_t(span_kind_t kind, const primitive_desc_iface_t *pd)
+        : active_(is_enabled()) {
+        if (active_) start(kind, pd);
+    }
+    scope_t(span_kind_t kind, uint32_t name_id) : active_(is_enabled()) {
+        if (active_) start(kind, name_id, no_info);
+    }
+    ~scope_t() {
+        if (active_) finish();
+    }
+
+private:
+    void start(span_kind_t kind, const primitive_desc_iface_t *pd);
+    void start(span_kind_t kind, uint32_t name_id, uint32_t info_id);
+    void finish();
+
+    bool active_;
+    span_kind_t kind_;
+    uint32_t name_id_;
+    uint32_t info_id_;
+    uint32_t prev_name_id_;
+    uint64_t begin_ns_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(scope_t);
+};
+
+// Writes the spans recorded so far to @p path and clears the buffers.
+status_t dump(const char *path, dnnl_trace_format_t format);
+
+} // namespace trace
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -441,6 +441,13 @@ inline bool sparse_desc_is_equal(
     bool ok = lhs.encoding == rhs.encoding && lhs.nnz == rhs.nnz;
     if (!ok) return false;
 
+    if (lhs.encoding == sparse_encoding::bsr) {
+        ok = ok
+                && utils::array_cmp(lhs.bsr_desc.block_dims,
+                        rhs.bsr_desc.block_dims, 2);
+        if (!ok) return false;
+    }
+
 #if DNNL_EXPERIMENTAL_GROUPED_MEMORY
     if (lhs.encoding == sparse_encoding::grouped) {
         ok = ok && lhs.grouped_desc.group_count == rhs.grouped_desc.group_count
@@ -1048,6 +1055,38 @@ inline bool operator==(const sdpa_desc_t &lhs, const sdpa_desc_t &rhs) {
     return ret;
 }
 
+inline bool operator==(const rope_desc_t &lhs, const rope_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(cos_desc)
+            && COMPARE_DESC_MEMBERS(sin_desc)
+            && COMPARE_DESC_MEMBERS(pos_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc);
+    return ret;
+}
+
+inline bool operator==(const topk_desc_t &lhs, const topk_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind) && COMPARE_DESC_MEMBERS(k)
+            && COMPARE_FLOAT_DESC_MEMBERS(temperature)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(indices_desc);
+    return ret;
+}
+
+inline bool operator==(const embedding_bag_desc_t &lhs, const embedding_bag_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(indices_desc)
+            && COMPARE_DESC_MEMBERS(offsets_desc)
+            && COMPARE_DESC_MEMBERS(weights_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc);
+    return ret;
+}
+
 inline bool operator==(const gated_mlp_desc_t &lhs, const gated_mlp_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
             && COMPARE_DESC_MEMBERS(src_desc)
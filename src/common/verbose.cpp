@@ -41,6 +41,7 @@
 #include "convolution_pd.hpp"
 #include "deconvolution_pd.hpp"
 #include "eltwise_pd.hpp"
+#include "embedding_bag_pd.hpp"
 #include "gated_mlp_pd.hpp"
 #include "gemm_pd.hpp"
 #include "group_normalization_pd.hpp"
@@ -54,10 +55,12 @@
 #include "reorder_pd.hpp"
 #include "resampling_pd.hpp"
 #include "rnn_pd.hpp"
+#include "rope_pd.hpp"
 #include "sdpa_pd.hpp"
 #include "shuffle_pd.hpp"
 #include "softmax_pd.hpp"
 #include "sum_pd.hpp"
+#include "topk_pd.hpp"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "common/dnnl_thread.hpp"
@@ -376,6 +379,7 @@ std::string normalization_flags2str(unsigned flags) {
 std::string rnn_flags2str(unsigned flags) {
     std::string s;
     if (flags & rnn_flags::diff_weights_overwrite) s += "O";
+    if (flags & rnn_flags::variable_length) s += "V";
     return s;
 }
 
@@ -1052,6 +1056,78 @@ std::string init_info_eltwise(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+std::string init_info_embedding_bag(const engine_t *e, const pd_t *pd) {
+    stringstream_t ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    ss << md2fmt_str("src", pd->arg_md(DNNL_ARG_SRC), format_kind::undef)
+       << " ";
+    ss << md2fmt_str("idx", pd->arg_md(DNNL_ARG_INDICES), format_kind::undef)
+       << " ";
+    ss << md2fmt_str("off", pd->arg_md(DNNL_ARG_OFFSETS), format_kind::undef)
+       << " ";
+    if (pd->with_weights())
+        ss << md2fmt_str(
+                "wei", pd->arg_md(DNNL_ARG_WEIGHTS), format_kind::undef)
+           << " ";
+    ss << md2fmt_str("dst", pd->arg_md(DNNL_ARG_DST), format_kind::undef);
+
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << pd->alg_kind() << ",";
+    ss << "r" << pd->R() << "d" << pd->D() << "n" << pd->N() << "b"
+       << pd->B();
+
+    return ss.str();
+}
+
+template <typename pd_t>
+std::string init_info_rope(const engine_t *e, const pd_t *pd) {
+    stringstream_t ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    ss << md2fmt_str("src", pd->arg_md(DNNL_ARG_SRC), format_kind::undef)
+       << " ";
+    ss << md2fmt_str("cos", pd->arg_md(DNNL_ARG_COS), format_kind::undef)
+       << " ";
+    ss << md2fmt_str("sin", pd->arg_md(DNNL_ARG_SIN), format_kind::undef)
+       << " ";
+    if (pd->with_positions())
+        ss << md2fmt_str(
+                "pos", pd->arg_md(DNNL_ARG_POSITIONS), format_kind::undef)
+           << " ";
+    ss << md2fmt_str("dst", pd->arg_md(DNNL_ARG_DST), format_kind::undef);
+
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << (pd->is_interleaved() ? "interleaved" : "half") << ",";
+    ss << md2dim_str(pd->src_md()) << ":p" << pd->P();
+
+    return ss.str();
+}
+
+template <typename pd_t>
+std::string init_info_topk(const engine_t *e, const pd_t *pd) {
+    stringstream_t ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    ss << md2fmt_str("src", pd->arg_md(DNNL_ARG_SRC), format_kind::undef)
+       << " ";
+    ss << md2fmt_str("dst", pd->arg_md(DNNL_ARG_DST), format_kind::undef)
+       << " ";
+    ss << md2fmt_str(
+            "idx", pd->arg_md(DNNL_ARG_DST_INDICES), format_kind::undef);
+
+    ss << "," << pd->attr() << ",";
+    ss << "k:" << pd->K();
+    if (pd->with_softmax()) ss << " softmax t:" << pd->temperature();
+    ss << "," << md2dim_str(pd->src_md());
+
+    return ss.str();
+}
+
 template <typename pd_t>
 std::string init_info_gated_mlp(const engine_t *e, const pd_t *pd) {
     stringstream_t ss;
@@ -1832,6 +1908,7 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(embedding_bag);
             CASE(gated_mlp);
             CASE(gemm);
             CASE(group_normalization);
@@ -1845,10 +1922,12 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(reorder);
             CASE(resampling);
             CASE(rnn);
+            CASE(rope);
             CASE(shuffle);
             CASE(softmax);
             CASE(sum);
             CASE(sdpa);
+            CASE(topk);
             case primitive_kind::zero_pad:
               str_ = "zero_pad, unknown info";
               break;
@@ -39,6 +39,8 @@
 #define VERBOSE_debug ":debug"
 #define VERBOSE_profile ""
 #define VERBOSE_external ":external"
+#define VERBOSE_breakdown ":breakdown"
+#define VERBOSE_cache_stats ":cache_stats"
 
 // verbose messages
 #define VERBOSE_PROFILING_UNSUPPORTED "profiling capabilities are not supported"
@@ -22,6 +22,7 @@
 #include <limits.h>
 #include <vector>
 
+#include "common/create_breakdown.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
@@ -914,6 +915,8 @@ public:
     }
 
     virtual status_t create_kernel() {
+        create_breakdown::scope_t breakdown_scope(
+                create_breakdown::phase_t::jit_generate);
         generate();
         jit_ker_ = getCode();
         return (jit_ker_) ? status::success : status::runtime_error;
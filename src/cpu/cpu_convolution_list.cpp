@@ -49,6 +49,7 @@
 #include "cpu/x64/jit_brgemm_conv_bwd.hpp"
 #include "cpu/x64/jit_brgemm_conv_bwd_strided.hpp"
 #include "cpu/x64/jit_brgemm_conv_bwd_w.hpp"
+#include "cpu/x64/jit_brgemm_wino_conv.hpp"
 #include "cpu/x64/jit_sse41_1x1_convolution.hpp"
 #include "cpu/x64/jit_sse41_convolution.hpp"
 #include "cpu/x64/jit_uni_dw_convolution.hpp"
@@ -131,6 +132,8 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
         {{forward, f32, f32, f32}, {
             CPU_INSTANCE_AVX512(brdgmm_dw_convolution_fwd_t)
             CPU_INSTANCE_X64(ip_convolution_fwd_t)
+            CPU_INSTANCE_AVX512(brgemm_wino_convolution_fwd_t<avx512_core>)
+            CPU_INSTANCE_AVX2(brgemm_wino_convolution_fwd_t<avx2>)
             CPU_INSTANCE_AMX(brgemm_1x1_convolution_fwd_t<avx10_2_amx_2>)
             CPU_INSTANCE_AMX(brgemm_convolution_fwd_t<avx10_2_amx_2>)
             CPU_INSTANCE_AMX(brgemm_1x1_convolution_fwd_t<avx512_core_amx>)
@@ -203,6 +206,8 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
         {{forward, bf16, bf16, f32}, {
             CPU_INSTANCE_AVX512(brdgmm_dw_convolution_fwd_t)
             CPU_INSTANCE_X64(ip_convolution_fwd_t)
+            CPU_INSTANCE_AVX512(brgemm_wino_convolution_fwd_t<avx512_core>)
+            CPU_INSTANCE_AVX2(brgemm_wino_convolution_fwd_t<avx2>)
             CPU_INSTANCE_AMX(brgemm_1x1_convolution_fwd_t<avx512_core_amx>)
             CPU_INSTANCE_AMX(brgemm_convolution_fwd_t<avx512_core_amx>)
             CPU_INSTANCE_AMX(jit_avx512_core_amx_1x1_convolution_fwd_t)
@@ -228,6 +233,8 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
         {{forward, bf16, bf16, bf16}, {
             CPU_INSTANCE_AVX512(brdgmm_dw_convolution_fwd_t)
             CPU_INSTANCE_X64(ip_convolution_fwd_t)
+            CPU_INSTANCE_AVX512(brgemm_wino_convolution_fwd_t<avx512_core>)
+            CPU_INSTANCE_AVX2(brgemm_wino_convolution_fwd_t<avx2>)
             CPU_INSTANCE_AMX(brgemm_1x1_convolution_fwd_t<avx512_core_amx>)
             CPU_INSTANCE_AMX(brgemm_convolution_fwd_t<avx512_core_amx>)
             CPU_INSTANCE_AMX(jit_avx512_core_amx_1x1_convolution_fwd_t)
@@ -460,11 +467,12 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
         {{backward_weights, f32, f32, f32}, REG_BWD_PK({
             CPU_INSTANCE_X64(ip_convolution_bwd_weights_t)
             CPU_INSTANCE_AVX512(jit_avx512_common_dw_convolution_bwd_weights_t)
+            CPU_INSTANCE_AVX2(jit_avx2_dw_convolution_bwd_weights_t)
+            CPU_INSTANCE_SSE41(jit_sse41_dw_convolution_bwd_weights_t)
+            CPU_INSTANCE_AVX2(brgemm_convolution_bwd_weights_t)
             CPU_INSTANCE_AVX512(jit_avx512_common_1x1_convolution_bwd_weights_t)
             CPU_INSTANCE_AVX512(jit_avx512_common_convolution_bwd_weights_t<f32>)
-            CPU_INSTANCE_AVX2(jit_avx2_dw_convolution_bwd_weights_t)
             CPU_INSTANCE_AVX2(jit_avx2_1x1_convolution_bwd_weights_t)
-            CPU_INSTANCE_SSE41(jit_sse41_dw_convolution_bwd_weights_t)
             CPU_INSTANCE_AVX2(jit_avx2_convolution_bwd_weights_t)
             CPU_INSTANCE_AARCH64(jit_uni_dw_convolution_bwd_weights_t<sve_512,data_type::f32>)
             CPU_INSTANCE_AARCH64(jit_sve_1x1_convolution_bwd_weights_t<f32,f32,f32,sve_512>)
@@ -480,7 +488,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
         {{backward_weights, bf16, f32, bf16}, REG_BWD_PK({
             CPU_INSTANCE_X64(ip_convolution_bwd_weights_t)
             CPU_INSTANCE_AVX512(jit_uni_dw_convolution_bwd_weights_t<avx512_core, bf16, f32>)
-            CPU_INSTANCE_AMX(brgemm_convolution_bwd_weights_t)
+            CPU_INSTANCE_AVX512(brgemm_convolution_bwd_weights_t)
             CPU_INSTANCE_AMX(jit_avx512_core_amx_convolution_bwd_weights_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_bf16_1x1_convolution_bwd_weights_t<f32>)
             CPU_INSTANCE_AVX512(jit_avx512_core_bf16_convolution_bwd_weights_t)
@@ -492,7 +500,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
         {{backward_weights, bf16, bf16, bf16}, REG_BWD_PK({
             CPU_INSTANCE_X64(ip_convolution_bwd_weights_t)
             CPU_INSTANCE_AVX512(jit_uni_dw_convolution_bwd_weights_t<avx512_core, bf16, bf16>)
-            CPU_INSTANCE_AMX(brgemm_convolution_bwd_weights_t)
+            CPU_INSTANCE_AVX512(brgemm_convolution_bwd_weights_t)
             CPU_INSTANCE_AMX(jit_avx512_core_amx_convolution_bwd_weights_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_bf16_1x1_convolution_bwd_weights_t<bf16>)
             CPU_INSTANCE_AVX512(jit_avx512_core_bf16_convolution_bwd_weights_t)
@@ -67,6 +67,7 @@ DECLARE_IMPL_LIST(binary);
 DECLARE_IMPL_LIST(convolution);
 DECLARE_IMPL_LIST(deconvolution);
 DECLARE_IMPL_LIST(eltwise);
+DECLARE_IMPL_LIST(embedding_bag);
 DECLARE_IMPL_LIST(group_normalization);
 DECLARE_IMPL_LIST(inner_product);
 DECLARE_IMPL_LIST(layer_normalization);
@@ -77,8 +78,10 @@ DECLARE_IMPL_LIST(prelu);
 DECLARE_IMPL_LIST(reduction);
 DECLARE_IMPL_LIST(resampling);
 DECLARE_IMPL_LIST(rnn);
+DECLARE_IMPL_LIST(rope);
 DECLARE_IMPL_LIST(shuffle);
 DECLARE_IMPL_LIST(softmax);
+DECLARE_IMPL_LIST(topk);
 
 #undef DECLARE_IMPL_LIST
 
@@ -103,6 +106,7 @@ public:
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(embedding_bag);
             CASE(group_normalization);
             CASE(inner_product);
             CASE(layer_normalization);
@@ -113,8 +117,10 @@ public:
             CASE(reduction);
             CASE(resampling);
             CASE(rnn);
+            CASE(rope);
             CASE(shuffle);
             CASE(softmax);
+            CASE(topk);
             case primitive_kind::sdpa: return empty_list;
             case primitive_kind::gated_mlp: return empty_list;
             default: assert(!"unknown primitive kind"); return empty_list;
@@ -30,6 +30,7 @@
 
 #if DNNL_X64
 #include "cpu/x64/matmul/brgemm_matmul.hpp"
+#include "cpu/x64/matmul/brgemm_sparse_matmul.hpp"
 #include "cpu/x64/matmul/jit_uni_sparse_matmul.hpp"
 using namespace dnnl::impl::cpu::x64::matmul;
 using namespace dnnl::impl::cpu::x64;
@@ -90,6 +91,10 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         CPU_INSTANCE(gemm_x8s8s32x_matmul_t)
         CPU_INSTANCE(ref_matmul_t)
         CPU_INSTANCE(ref_matmul_int8_t)
+        CPU_INSTANCE_AVX512(brgemm_sparse_matmul_t<avx512_core_bf16>)
+        CPU_INSTANCE_AVX512(brgemm_sparse_matmul_t<avx512_core_vnni>)
+        CPU_INSTANCE_AVX512(brgemm_sparse_matmul_t<avx512_core>)
+        CPU_INSTANCE_AVX2(brgemm_sparse_matmul_t<avx2>)
         CPU_INSTANCE_X64(jit_uni_sparse_matmul_t)
         CPU_INSTANCE(ref_sparse_matmul_t)
         CPU_INSTANCE_GROUPED(ref_grouped_t)
@@ -40,9 +40,15 @@ void ref_matmul_t::pd_t::init_scratchpad() {
     using namespace memory_tracking::names;
     nthr_ = dnnl_get_max_threads();
     ntasks_ = nthr_;
+    auto scratchpad = scratchpad_registry().registrar();
+    if (attr()->scales_.get(DNNL_ARG_SRC).is_dynamic()) {
+        // A scale per source row.
+        const memory_desc_wrapper src_d(src_md());
+        scratchpad.template book<float>(
+                key_matmul_dyn_scale_space, src_d.nelems() / K());
+    }
     auto dst_scales = attr()->scales_.get(DNNL_ARG_DST);
     if (dst_scales.is_dynamic()) {
-        auto scratchpad = scratchpad_registry().registrar();
         const memory_desc_wrapper dst_d(dst_md());
         dim_t group_size = dst_scales.get_group_size();
         dim_t work_amount = dst_d.nelems() / group_size;
@@ -103,11 +109,17 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     const dim_t K = helper.K();
     const dim_t batch = helper.batch();
 
+    const auto &attr_scales = pd()->attr()->scales_;
+    // Dynamic source quantization: the source is quantized into the weights
+    // data type with a scale computed per row.
+    const bool with_src_dynamic_scales
+            = attr_scales.get(DNNL_ARG_SRC).is_dynamic();
+
     // Weights decompression
     const bool with_wei_decompression
             = utils::one_of(weights_d.data_type(), data_type::s8, data_type::u8,
                       data_type::s4, data_type::u4)
-            && pd()->attr()->fpmath_.apply_to_int_;
+            && pd()->attr()->fpmath_.apply_to_int_ && !with_src_dynamic_scales;
     const auto &attr_zps = pd()->attr()->zero_points_;
     const bool with_wei_zero_points
             = !attr_zps.has_default_values(DNNL_ARG_WEIGHTS);
@@ -127,8 +139,6 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
             = utils::get_dims_mask(dst_d.dims(), bia_d.dims(), ndims);
 
     // Scales section
-    const auto &attr_scales = pd()->attr()->scales_;
-
     const bool with_src_scales = !attr_scales.has_default_values(DNNL_ARG_SRC);
     const auto src_scale_mask = attr_scales.get_mask(DNNL_ARG_SRC);
     const auto src_scale_dt = attr_scales.get_data_type(DNNL_ARG_SRC);
@@ -165,6 +175,32 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
 
     auto dst_rnd_mode = pd()->attr()->rounding_mode_.get(DNNL_ARG_DST);
 
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    float *src_dynamic_scales = nullptr;
+    if (with_src_dynamic_scales) {
+        src_dynamic_scales = scratchpad.template get<float>(
+                memory_tracking::names::key_matmul_dyn_scale_space);
+        auto src_dynamic_scales_out
+                = CTX_OUT_MEM(float *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
+        const float q_max
+                = types::max_value<float>(weights_d.data_type());
+        parallel_nd(src_d.nelems() / K, [&](dim_t row) {
+            dims_t src_dims_idx;
+            utils::l_dims_by_l_offset(
+                    src_dims_idx, row * K, src_d.dims(), ndims);
+            float amax = 0.f;
+            for (dim_t k = 0; k < K; k++) {
+                src_dims_idx[ndims - 1] = k;
+                amax = std::max(amax,
+                        ::fabsf(io::load_float_value(src_d.data_type(), src,
+                                src_d.off_v(src_dims_idx))));
+            }
+            const float scale = amax == 0.f ? 1.f : amax / q_max;
+            src_dynamic_scales[row] = scale;
+            if (src_dynamic_scales_out) src_dynamic_scales_out[row] = scale;
+        });
+    }
+
     // mm kernel
     auto ker = [=](const dims_t dst_dims_idx, dim_t m, dim_t n) {
         dims_t src_dims_idx, weights_dims_idx;
@@ -175,6 +211,15 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
         weights_dims_idx[ndims - 1] = n;
         auto &src_k_dim = src_dims_idx[ndims - 1];
         auto &wei_k_dim = weights_dims_idx[ndims - 2];
+        float src_dynamic_scale = 1.f;
+        if (with_src_dynamic_scales) {
+            src_k_dim = 0;
+            src_dynamic_scale
+                    = src_dynamic_scales[matmul_helper_t::get_quant_off(
+                            src_dims_idx, ndims, src_scale_mask,
+                            src_scale_group_m, src_scale_group_k,
+                            src_scale_md)];
+        }
         float res = 0.0f;
         for (dim_t i_group = 0; i_group < ngroups_k; i_group++) {
             float acc = 0.0f;
@@ -184,8 +229,15 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
 
                 const auto src_off = src_d.off_v(src_dims_idx);
                 const auto weights_off = weights_d.off_v(weights_dims_idx);
-                const float s
-                        = io::load_float_value(src_d.data_type(), src, src_off);
+                float s = io::load_float_value(src_d.data_type(), src, src_off);
+                if (with_src_dynamic_scales) {
+                    // Quantize the value the same way the optimized
+                    // implementations do.
+                    uint8_t q;
+                    io::store_float_value(weights_d.data_type(),
+                            s / src_dynamic_scale, &q, 0);
+                    s = io::load_float_value(weights_d.data_type(), &q, 0);
+                }
                 float w = io::load_float_value(
                         weights_d.data_type(), weights, weights_off);
 
@@ -215,7 +267,9 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
                 acc += s * w;
             }
             // apply scales after computing a group along K
-            if (with_src_scales) {
+            if (with_src_dynamic_scales) {
+                acc *= src_dynamic_scale;
+            } else if (with_src_scales) {
                 const dim_t src_scale_offset = matmul_helper_t::get_quant_off(
                         src_dims_idx, ndims, src_scale_mask, src_scale_group_m,
                         src_scale_group_k, src_scale_md);
@@ -247,7 +301,6 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     auto sum_dt = pd()->attr()->post_ops_.get_sum_dt(dst_d.data_type());
     bool with_dropout = !pd()->attr()->dropout_.has_default_values();
 
-    const auto &scratchpad = ctx.get_scratchpad_grantor();
     float *temp_dst = scratchpad.template get<float>(
             memory_tracking::names::key_matmul_dst_in_acc_dt);
 
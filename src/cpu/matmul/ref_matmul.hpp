@@ -48,6 +48,9 @@ struct ref_matmul_t : public primitive_t {
             const auto wei_type = weights_md(0)->data_type;
             const auto bia_type = weights_md(1)->data_type;
             const auto dst_type = dst_md(0)->data_type;
+            // The source is quantized into the weights data type.
+            const bool with_src_dynamic_scales
+                    = attr()->scales_.get(DNNL_ARG_SRC).is_dynamic();
 
             VDISPATCH_MATMUL(
                     is_dense_format_kind(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
@@ -60,13 +63,14 @@ struct ref_matmul_t : public primitive_t {
             VDISPATCH_MATMUL(utils::one_of(dst_type, f32, bf16, f16, f8_e5m2,
                                      f8_e4m3, f4_e2m1, f4_e3m0, u8, s8),
                     VERBOSE_UNSUPPORTED_DT);
-            VDISPATCH_MATMUL((src_type == wei_type
+            VDISPATCH_MATMUL((src_type == wei_type || with_src_dynamic_scales
                                      || utils::one_of(wei_type, bf16, f16, u8,
                                              s8, u4, s4, f4_e3m0)),
                     VERBOSE_UNSUPPORTED_DT);
             /* int weights decompression support */
             VDISPATCH_MATMUL(
-                    IMPLICATION(utils::one_of(wei_type, u8, s8, u4, s4),
+                    IMPLICATION(utils::one_of(wei_type, u8, s8, u4, s4)
+                                    && !with_src_dynamic_scales,
                             attr_.mayiconvert(wei_type, src_type)),
                     VERBOSE_UNSUPPORTED_DT);
             VDISPATCH_MATMUL(IMPLICATION(src_type == f16,
@@ -48,7 +48,26 @@ status_t ref_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
         io::store_float_value(dst_d.data_type(), 0.0f, dst, dst_idx);
     });
 
-    if (weights_d.is_sparse_desc()) {
+    const auto wei_encoding = weights_d.is_sparse_desc()
+            ? weights_d.encoding()
+            : sparse_encoding::undef;
+
+    if (wei_encoding == sparse_encoding::bsr) {
+        const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+        const auto wei_values = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS, 0);
+        auto wei_indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 1);
+        auto wei_pointers = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 2);
+
+        run_bsr_kernel(src, wei_values, wei_indices, wei_pointers, dst, M, N,
+                K, weights_d.sparse_desc().bsr_desc.block_dims, mm_dt);
+    } else if (wei_encoding == sparse_encoding::structured_2_4) {
+        const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+        const auto wei_values = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS, 0);
+        auto wei_metadata = CTX_IN_MEM(const uint8_t *, DNNL_ARG_WEIGHTS, 1);
+
+        run_structured_2_4_kernel(
+                src, wei_values, wei_metadata, dst, M, N, K, mm_dt);
+    } else if (weights_d.is_sparse_desc()) {
 
         const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
         const auto wei_values = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS, 0);
@@ -199,6 +218,61 @@ void ref_sparse_matmul_t::run_csr_kernel(const void *dmat, const void *values,
     }
 }
 
+void ref_sparse_matmul_t::run_bsr_kernel(const void *src, const void *values,
+        const int32_t *indices, const int32_t *pointers, void *res,
+        const dim_t M, const dim_t N, const dim_t K, const dim_t *block_dims,
+        const data_type_t mm_dt) const {
+    const dim_t BK = block_dims[0];
+    const dim_t BN = block_dims[1];
+    const dim_t KB = K / BK;
+
+    // Each row of the result is computed independently by walking the
+    // non-zero blocks of the weights in the block row order.
+    parallel_nd(M, [=](dim_t m) {
+        for (dim_t kb = 0; kb < KB; kb++) {
+            for (dim_t p = pointers[kb]; p < pointers[kb + 1]; p++) {
+                const dim_t nb = indices[p];
+                const dim_t blk_off = p * BK * BN;
+                for (dim_t n = 0; n < BN; n++) {
+                    const dim_t c_idx = m * N + nb * BN + n;
+                    float c_val = io::load_float_value(mm_dt, res, c_idx);
+                    for (dim_t k = 0; k < BK; k++) {
+                        const dim_t a_idx = m * K + kb * BK + k;
+                        const float a_val
+                                = io::load_float_value(mm_dt, src, a_idx);
+                        const float b_val = io::load_float_value(
+                                mm_dt, values, blk_off + k * BN + n);
+                        c_val += a_val * b_val;
+                    }
+                    io::store_float_value(mm_dt, c_val, res, c_idx);
+                }
+            }
+        }
+    });
+}
+
+void ref_sparse_matmul_t::run_structured_2_4_kernel(const void *src,
+        const void *values, const uint8_t *metadata, void *res, const dim_t M,
+        const dim_t N, const dim_t K, const data_type_t mm_dt) const {
+    const dim_t G = K / 4;
+
+    parallel_nd(M, N, [=](dim_t m, dim_t n) {
+        float c_val = 0.f;
+        for (dim_t g = 0; g < G; g++) {
+            const uint8_t meta = metadata[g * N + n];
+            for (int j = 0; j < 2; j++) {
+                const dim_t k = 4 * g + ((meta >> (2 * j)) & 0x3);
+                const float a_val
+                        = io::load_float_value(mm_dt, src, m * K + k);
+                const float b_val = io::load_float_value(
+                        mm_dt, values, (2 * g + j) * N + n);
+                c_val += a_val * b_val;
+            }
+        }
+        io::store_float_value(mm_dt, c_val, res, m * N + n);
+    });
+}
+
 } // namespace matmul
 } // namespace cpu
 } // namespace impl
@@ -57,7 +57,9 @@ struct ref_sparse_matmul_t : public primitive_t {
             VDISPATCH_MATMUL(IMPLICATION(wei_d.is_sparse_desc(),
                                      utils::one_of(wei_d.encoding(),
                                              sparse_encoding::csr,
-                                             sparse_encoding::coo)),
+                                             sparse_encoding::coo,
+                                             sparse_encoding::bsr,
+                                             sparse_encoding::structured_2_4)),
                     VERBOSE_UNSUPPORTED_SPARSE_CFG);
 
             VDISPATCH_MATMUL(
@@ -86,10 +88,17 @@ struct ref_sparse_matmul_t : public primitive_t {
                         VERBOSE_UNSUPPORTED_SPARSE_CFG);
 
                 VDISPATCH_MATMUL(
-                        IMPLICATION(sparse_mem_encoding == sparse_encoding::csr,
+                        IMPLICATION(utils::one_of(sparse_mem_encoding,
+                                            sparse_encoding::csr,
+                                            sparse_encoding::bsr),
                                 utils::everyone_is(s32, wei_d.metadata_type(0),
                                         wei_d.metadata_type(1))),
                         VERBOSE_UNSUPPORTED_SPARSE_CFG);
+                VDISPATCH_MATMUL(IMPLICATION(sparse_mem_encoding
+                                                 == sparse_encoding::
+                                                         structured_2_4,
+                                         u8 == wei_d.metadata_type(0)),
+                        VERBOSE_UNSUPPORTED_SPARSE_CFG);
             }
 
             VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
@@ -148,6 +157,19 @@ struct ref_sparse_matmul_t : public primitive_t {
             const dim_t M, const dim_t N, const dim_t K,
             const data_type_t mm_dt, bool is_src_sparse) const;
 
+    // Executes the matrix multiplication with BSR encoded weights. Only
+    // the non-zero blocks of the weights are visited.
+    void run_bsr_kernel(const void *src, const void *values,
+            const int32_t *indices, const int32_t *pointers, void *res,
+            const dim_t M, const dim_t N, const dim_t K,
+            const dim_t *block_dims, const data_type_t mm_dt) const;
+
+    // Executes the matrix multiplication with 2:4 structured sparse
+    // weights. Metadata selects the source element for each kept value.
+    void run_structured_2_4_kernel(const void *src, const void *values,
+            const uint8_t *metadata, void *res, const dim_t M, const dim_t N,
+            const dim_t K, const data_type_t mm_dt) const;
+
     status_t execute(const exec_ctx_t &ctx) const override;
 
 private:
@@ -16,13 +16,14 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <cstdlib>
+#include <string>
 #include <thread>
 
 #include "cpu/platform.hpp"
 
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
-#include <algorithm>
-
 #if defined(_WIN32)
 #include <windows.h>
 #elif defined(__GLIBC__)
@@ -42,6 +43,12 @@
 #include "cpu/rv64/cpu_isa_traits.hpp"
 #endif
 
+#if defined(__linux__)
+#include <fstream>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 // For DNNL_X64 build we compute the timestamp using rdtsc. Use std::chrono for
 // other builds.
 #if !DNNL_X64
@@ -63,6 +70,26 @@ const char *get_isa_info() {
 #endif
 }
 
+const char *get_cpu_model() {
+#if DNNL_X64
+    static const std::string model = []() {
+        using namespace Xbyak::util;
+        const auto &c = x64::cpu();
+        const char *vendor = c.has(Cpu::tINTEL) ? "intel"
+                : c.has(Cpu::tAMD)              ? "amd"
+                                                : "x64";
+        return std::string(vendor) + "-" + std::to_string(c.displayFamily)
+                + "-" + std::to_string(c.displayModel) + "-"
+                + std::to_string(c.stepping);
+    }();
+    return model.c_str();
+#elif DNNL_AARCH64
+    return "aarch64";
+#else
+    return "generic";
+#endif
+}
+
 dnnl_cpu_isa_t get_effective_cpu_isa() {
 #if DNNL_X64
     return x64::get_effective_cpu_isa();
@@ -380,6 +407,34 @@ size_t get_timestamp() {
 #endif
 }
 
+int get_num_numa_nodes() {
+#if defined(__linux__)
+    static const int num_nodes = []() {
+        // The file holds a range of node ids, e.g. `0-3`.
+        std::ifstream ifs("/sys/devices/system/node/possible");
+        std::string range;
+        if (!(ifs >> range)) return 1;
+        const auto pos = range.find_last_of("-,");
+        const int last = std::atoi(
+                range.c_str() + (pos == std::string::npos ? 0 : pos + 1));
+        return std::max(last + 1, 1);
+    }();
+    return num_nodes;
+#else
+    return 1;
+#endif
+}
+
+int get_numa_node() {
+#if defined(__linux__) && defined(SYS_getcpu)
+    unsigned cpu = 0, node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) return 0;
+    return std::min(static_cast<int>(node), get_num_numa_nodes() - 1);
+#else
+    return 0;
+#endif
+}
+
 } // namespace platform
 } // namespace cpu
 } // namespace impl
@@ -162,6 +162,10 @@ namespace cpu {
 namespace platform {
 
 const char *get_isa_info();
+// Returns a string identifying the CPU model (vendor, family, model and
+// stepping where available). Used to key data that is only valid for the
+// machine it was collected on.
+const char *get_cpu_model();
 dnnl_cpu_isa_t get_effective_cpu_isa();
 status_t set_max_cpu_isa(dnnl_cpu_isa_t isa);
 status_t set_cpu_isa_hints(dnnl_cpu_isa_hints_t isa_hints);
@@ -200,6 +204,11 @@ static constexpr bool is_ppc64() {
 
 size_t get_timestamp();
 
+// Returns the number of NUMA nodes in the system and the node of the CPU the
+// calling thread runs on. Systems without NUMA information report one node.
+int get_num_numa_nodes();
+int get_numa_node();
+
 } // namespace platform
 
 // XXX: find a better place for these values?
@@ -33,6 +33,7 @@
 
 #if DNNL_X64
 #include "cpu/x64/jit_uni_reorder.hpp"
+#include "cpu/x64/jit_uni_reorder_4bit.hpp"
 #include "cpu/x64/jit_uni_reorder_direct_copy.hpp"
 #include "cpu/x64/matmul/brgemm_matmul_reorders.hpp"
 #elif DNNL_AARCH64
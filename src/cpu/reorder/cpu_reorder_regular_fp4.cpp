@@ -25,18 +25,22 @@ namespace cpu {
 const impl_list_map_t &regular_fp4_impl_list_map() {
     static const impl_list_map_t the_map = REG_REORDER_P({
         {{f32, f4_e2m1, 0}, {
+            DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_4bit_t))
             REG_SR(f32, any, f4_e2m1, any, fmt_order::any, spec::reference)
             nullptr,
         }},
         {{f4_e2m1, data_type::undef, 0}, {
+            DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_4bit_t))
             REG_SR(f4_e2m1, any, f32, any, fmt_order::any, spec::reference)
             nullptr,
         }},
         {{f32, f4_e3m0, 0}, {
+            DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_4bit_t))
             REG_SR(f32, any, f4_e3m0, any, fmt_order::any, spec::reference)
             nullptr,
         }},
         {{f4_e3m0, data_type::undef, 0}, {
+            DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_4bit_t))
             REG_SR(f4_e3m0, any, f32, any, fmt_order::any, spec::reference)
             nullptr,
         }},
@@ -25,11 +25,13 @@ namespace cpu {
 const impl_list_map_t &regular_u4_impl_list_map() {
     static const impl_list_map_t the_map = REG_REORDER_P({
         {{f32, u4, 0}, {
+            DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_4bit_t))
             REG_SR(f32, any, u4, any, fmt_order::any, spec::reference)
             nullptr,
         }},
         {{u4, data_type::undef, 0}, {
             DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::brgemm_matmul_copy_reorder_t))
+            DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_4bit_t))
             REG_SR(u4, any, f32, any, fmt_order::any, spec::reference)
             REG_SR(u4, any, bf16, any, fmt_order::any, spec::reference)
             REG_SR(u4, any, f16, any, fmt_order::any, spec::reference)
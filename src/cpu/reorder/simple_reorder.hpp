@@ -2176,8 +2176,10 @@ struct simple_reorder_impl_t<SIMPLE_REORDER_TEMPL_CALL,
         VDISPATCH_REORDER_IC(!input_d.has_runtime_dims_or_strides(),
                 VERBOSE_RUNTIMEDIM_UNSUPPORTED);
 
+        // Common scales are applied, a sum post-op would need the packed
+        // destination to be unpacked and is not supported.
         VDISPATCH_REORDER_IC(
-                simple_attr_check(attr, false, true), VERBOSE_UNSUPPORTED_ATTR);
+                simple_attr_check(attr, false, false), VERBOSE_UNSUPPORTED_ATTR);
         VDISPATCH_REORDER_IC(
                 input_d.is_dense(), VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "src");
         VDISPATCH_REORDER_IC(
@@ -2263,11 +2265,13 @@ struct simple_reorder_impl_t<SIMPLE_REORDER_TEMPL_CALL,
                 const auto idx = 2 * j;
 
                 const auto i0_off = need_transform ? idx : input_d.off_l(idx);
-                auto val0 = _qz_a1b0<data_type::f32, type_o>()(wspace[i0_off]);
+                auto val0 = _qz_a1b0<data_type::f32, type_o>()(
+                        alpha * wspace[i0_off]);
 
                 const auto i1_off
                         = need_transform ? idx + 1 : input_d.off_l(idx + 1);
-                auto val1 = _qz_a1b0<data_type::f32, type_o>()(wspace[i1_off]);
+                auto val1 = _qz_a1b0<data_type::f32, type_o>()(
+                        alpha * wspace[i1_off]);
 
                 const auto o_off = need_transform ? idx : output_d.off_l(idx);
                 nibble2_t o_val(val0.raw_bits_, val1.raw_bits_);
@@ -29,6 +29,8 @@
 
  */
 
+#include <atomic>
+
 #include "common/dnnl_thread.hpp"
 #include "common/matmul_pd.hpp"
 #include "common/primitive.hpp"
@@ -343,6 +345,10 @@ ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::pd_t::init_brgemm(
     VDISPATCH_RNN(IMPLICATION(aprop == backward,
                           this->diff_weights_overwrite() == false),
             VERBOSE_BAD_PROPKIND);
+    // Backward brgemm kernels reduce diff weights over the whole minibatch,
+    // the gemm-based cells shrink the reduction to the active samples instead.
+    VDISPATCH_RNN(IMPLICATION(aprop == backward, !this->with_seq_lengths()),
+            VERBOSE_UNSUPPORTED_FEATURE, "variable-length backward");
     // cell_type (or src_type) and primitive data type should
     // match, except for the bf32 case.
     VDISPATCH_RNN(IMPLICATION(!allow_down_conversion_to_bf16,
@@ -548,6 +554,7 @@ status_t ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::pd_t::init(
         st = init_ref(engine);
     }
     if (st == status::success) {
+        rnn_.cell_kind = this->desc()->cell_kind;
         size_t scratchpad_sz {0}, ws_sz {0};
         get_scratchpad_and_workspace_sizes(rnn_, scratchpad_sz, ws_sz);
 
@@ -558,7 +565,6 @@ status_t ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::pd_t::init(
             CHECK(memory_desc_init_by_tag(
                     this->ws_md_, 1, ws_dims, data_type::u8, format_tag::x));
         }
-        rnn_.cell_kind = this->desc()->cell_kind;
     }
     return st;
 }
@@ -601,6 +607,10 @@ void ref_rnn_common_t<aprop, src_type, weights_type,
                 rnn_, scratchpad, sizeof(gemm_acc_t), alignof(gemm_acc_t));
 #endif
 
+    if (rnn_.in_place_states_need_copy())
+        scratchpad.template book<char>(key_rnn_src_iter_copy,
+                memory_desc_wrapper(this->src_md(1)).size());
+
     // Below primitives may be run as part of execution.Fortunately, none of
     // them run simulataneously. So, we can re-use the same scratchpad across
     // all primitives. Iterate through them to find the largest scratchpad
@@ -999,6 +1009,9 @@ rnn_grid_execution_sig((ref_rnn_common_t<aprop, src_type, weights_type,
             diff_bias_, rnn.n_layer, rnn.n_dir, rnn.n_bias * rnn.dhc);
     const AOC<gates_t, 4> ws_grid(
             ws_grid_, rnn.n_layer, rnn.n_dir, rnn.n_iter, (int)rnn.ws_per_cell);
+    const int32_t *seq_lengths = rnn.is_varlen
+            ? CTX_IN_MEM(const int32_t *, DNNL_ARG_SEQ_LENGTHS)
+            : nullptr;
 
     /* Raw inputs/outputs coming from the user */
     // Here we cannot use AOC as user's input can have arbitrary strides, so we use desc_wrapper.
@@ -1039,6 +1052,205 @@ rnn_grid_execution_sig((ref_rnn_common_t<aprop, src_type, weights_type,
         return dnnl_success;
     };
 
+    // Executes the cell (dir, j, i) of the grid. Cells of a wavefront that run
+    // concurrently use their own `slot` of the scratch buffers.
+    const auto execute_cell
+            = [&](int dir, int j, int i, int slot) -> status_t {
+        const int lay = (aprop == prop_kind::forward) ? j : rnn.n_layer - j - 1;
+        const int iter = (aprop == prop_kind::forward) ? i : rnn.n_iter - i - 1;
+
+        // Samples are sorted by non-increasing sequence length, so the
+        // finished ones are dropped from the tail of the minibatch.
+        const int mb_active = rnn.active_mb(seq_lengths, iter);
+        if (mb_active == 0) return dnnl_success;
+        const bool shrink_mb = mb_active < rnn.mb;
+        const rnn_conf_t varlen_rnn
+                = shrink_mb ? rnn.active_conf(mb_active) : rnn_conf_t();
+        const rnn_conf_t &cell_rnn = shrink_mb ? varlen_rnn : rnn;
+
+        // We set parameters to the cell execution call
+
+        // dst_layer is equal to dst_iter. To avoid
+        // duplication of memory access we hence use only
+        // dst_layer and set dst_iter to nullptr, unless we
+        // cannot for one of the following condition:
+        // - in the last layer and last iteration, we need to
+        //   copy ht in two tensors (dst_layer and dst_iter)
+        dst_layer_t *cell_dst_layer
+                = &(ws_states_layer(lay + 1, dir, iter + 1, 0));
+        dst_iter_t *cell_dst_iter = nullptr;
+        const src_layer_t *cell_src_layer
+                = &(ws_states_layer(lay, dir, iter + 1, 0));
+        const src_iter_t *cell_src_iter
+                = &(ws_states_iter(lay + 1, dir, iter, 0));
+
+        void *cell_dst_iter_c = const_cast<void *>(
+                ws_states_iter_c(lay + 1, dir, iter + 1, 0));
+        const void *cell_src_iter_c
+                = ws_states_iter_c(lay + 1, dir, iter, 0);
+
+        // the cell_position is used only when skip_data_copy is
+        // supported currently supported only for forward
+        cell_position_t cell_position = middle_cell;
+        if (iter == 0) cell_position |= first_iter;
+        if (lay == 0) cell_position |= first_layer;
+        if (iter == rnn.n_iter - 1) cell_position |= last_iter;
+        if (lay == rnn.n_layer - 1) cell_position |= last_layer;
+
+        // The dst_* paths should be before the src_* paths as
+        // the later will override cell_src_layer and
+        // cell_src_iter appropriately for 1st layer and 1st
+        // iter.
+        const bool last_iter_skip_copy
+                = rnn.skip_dst_iter_copy() && (cell_position & last_iter);
+        if (last_iter_skip_copy) {
+            cell_dst_layer = dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0);
+            cell_src_layer
+                    = dst_iter_ + dst_iter_mdw.off(lay - 1, dir, 0, 0);
+        }
+
+        if (rnn.skip_dst_layer_copy() && (cell_position & last_layer)) {
+            // Note: for last layer and last iter, the output is in dst_layer
+            // and still need to be copied to dst_iter
+            cell_dst_layer = dst_layer_ + dst_layer_mdw.off(iter, 0, 0);
+            cell_dst_iter = last_iter_skip_copy
+                    ? dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0)
+                    : nullptr;
+            cell_src_iter = (iter != 0)
+                    ? dst_layer_ + dst_layer_mdw.off(iter - 1, 0, 0)
+                    : cell_src_iter;
+        }
+        if (rnn.skip_src_iter_copy() && (cell_position & first_iter))
+            cell_src_iter = src_iter_ + src_iter_mdw.off(lay, dir, 0, 0);
+
+        if (rnn.skip_src_layer_copy() && (cell_position & first_layer))
+            cell_src_layer = src_layer_ + src_layer_mdw.off(iter, 0, 0);
+
+        // because the c state is always f32 and require no
+        // conversion, we can always skip to copy for the 1st
+        // and last iteration
+        if (iter == 0 && src_iter_c_) {
+            cell_src_iter_c = inc_ptr(src_iter_c_, rnn.src_iter_c_dt,
+                    src_iter_c_mdw.off(lay, dir, 0, 0));
+            cell_position |= c_state_first_iter;
+        }
+        if (iter == rnn.n_iter - 1 && dst_iter_c_) {
+            cell_dst_iter_c = inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
+                    dst_iter_c_mdw.off(lay, dir, 0, 0));
+            cell_position |= c_state_last_iter;
+        }
+        const size_t sg_start_idx = rnn.n_iter_scratch_gates == 1
+                ? static_cast<size_t>(0)
+                : static_cast<size_t>(iter) * rnn.scratch_gates_nld
+                        * rnn.scratch_gates_ld;
+        const auto cell_scratch_gates = &scratch_gates_[sg_start_idx
+                + static_cast<size_t>(slot) * rnn.scratch_gates_nld
+                        * rnn.scratch_gates_ld];
+        scratch_t *cell_scratch_cell = rnn.scratch_cell_size
+                ? scratch_cell_
+                        + static_cast<size_t>(slot) * rnn.scratch_gates_nld
+                                * rnn.scratch_gates_ld
+                : scratch_cell_;
+
+        dst_iter_t *proj_ht = nullptr;
+        if (rnn.is_lstm_projection) {
+            if (rnn.is_training)
+                proj_ht = &(ws_ht(lay, dir, iter, 0));
+            else
+                proj_ht = scratch_ht_;
+        }
+
+#if DNNL_X64
+        CHECK((this->*cell_func)(ctx, cell_rnn, cell_position,
+                cell_dst_layer, cell_dst_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
+                SAFE_PTR(diff_augru_attention, iter, 0, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
+                SAFE_PTR(weights_layer, lay, dir, 0),
+                SAFE_PTR(weights_iter, lay, dir, 0),
+                SAFE_PTR(weights_projection, lay, dir),
+                SAFE_PTR(weights_peephole, lay, dir, 0),
+                w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
+                            : nullptr,
+                bias(lay, dir), cell_src_layer,
+                SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
+                cell_src_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
+                SAFE_PTR(diff_weights_layer, lay, dir, 0),
+                SAFE_PTR(diff_weights_iter, lay, dir, 0),
+                SAFE_PTR(diff_weights_projection, lay, dir, 0),
+                SAFE_PTR(diff_weights_peephole, lay, dir, 0),
+                SAFE_PTR(diff_bias, lay, dir, 0),
+                SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
+                proj_ht, scratch_diff_ht_,
+                SAFE_PTR(ws_grid, lay, dir, iter, 0), cell_scratch_cell,
+                scratch_gates_blocked_, scratch_src_layer_,
+                scratch_src_iter_, cell_dst_iter, amx_scratchpad,
+                addr_batch_global));
+#else
+        CHECK((this->*cell_func)(ctx, cell_rnn, cell_position,
+                cell_dst_layer, cell_dst_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
+                SAFE_PTR(diff_augru_attention, iter, 0, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
+                SAFE_PTR(weights_layer, lay, dir, 0),
+                SAFE_PTR(weights_iter, lay, dir, 0),
+                SAFE_PTR(weights_projection, lay, dir),
+                SAFE_PTR(weights_peephole, lay, dir, 0),
+                w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
+                            : nullptr,
+                bias(lay, dir), cell_src_layer,
+                SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
+                cell_src_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
+                SAFE_PTR(diff_weights_layer, lay, dir, 0),
+                SAFE_PTR(diff_weights_iter, lay, dir, 0),
+                SAFE_PTR(diff_weights_projection, lay, dir, 0),
+                SAFE_PTR(diff_weights_peephole, lay, dir, 0),
+                SAFE_PTR(diff_bias, lay, dir, 0),
+                SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
+                proj_ht, scratch_diff_ht_,
+                SAFE_PTR(ws_grid, lay, dir, iter, 0), cell_scratch_cell,
+                cell_dst_iter, amx_scratchpad));
+#endif
+        return dnnl_success;
+    };
+
+    if (rnn.n_wavefront_cells > 1) {
+        // Cell (lay, iter) only depends on (lay - 1, iter) and (lay, iter - 1),
+        // and the directions do not depend on each other. Hence, all the cells
+        // of an anti-diagonal lay + iter = w are independent and are executed
+        // concurrently, each of them on a single thread.
+        assert(aprop == prop_kind::forward && !rnn.merge_gemm_layer);
+        for (int w = 0; w < rnn.n_layer + rnn.n_iter - 1; w++) {
+            const int lay_beg = nstl::max(0, w - rnn.n_iter + 1);
+            const int n_lay = nstl::min(rnn.n_layer, w + 1) - lay_beg;
+            const int n_cells = rnn.n_dir * n_lay;
+            assert(n_cells <= rnn.n_wavefront_cells);
+
+            std::atomic<status_t> st(status::success);
+            parallel(nstl::min(n_cells, dnnl_get_current_num_threads()),
+                    [&](int ithr, int nthr) {
+                int start {0}, end {0};
+                balance211(n_cells, nthr, ithr, start, end);
+                for (int c = start; c < end; c++) {
+                    const int lay = lay_beg + c % n_lay;
+                    const status_t st_cell
+                            = execute_cell(c / n_lay, lay, w - lay, c);
+                    if (st_cell != status::success) st = st_cell;
+                }
+            });
+            CHECK(st);
+        }
+        return dnnl_success;
+    }
+
     // We run the grid of computation
     for_(int dir = 0; dir < rnn.n_dir; dir++)
     for (int j = 0; j < rnn.n_layer; j++) {
@@ -1049,155 +1261,8 @@ rnn_grid_execution_sig((ref_rnn_common_t<aprop, src_type, weights_type,
 
         // TODO: enable merging projection gemm in bwd lstm projection
 
-        for (int i = 0; i < rnn.n_iter; i++) {
-            const int iter
-                    = (aprop == prop_kind::forward) ? i : rnn.n_iter - i - 1;
-
-            // We set parameters to the cell execution call
-
-            // dst_layer is equal to dst_iter. To avoid
-            // duplication of memory access we hence use only
-            // dst_layer and set dst_iter to nullptr, unless we
-            // cannot for one of the following condition:
-            // - in the last layer and last iteration, we need to
-            //   copy ht in two tensors (dst_layer and dst_iter)
-            dst_layer_t *cell_dst_layer
-                    = &(ws_states_layer(lay + 1, dir, iter + 1, 0));
-            dst_iter_t *cell_dst_iter = nullptr;
-            const src_layer_t *cell_src_layer
-                    = &(ws_states_layer(lay, dir, iter + 1, 0));
-            const src_iter_t *cell_src_iter
-                    = &(ws_states_iter(lay + 1, dir, iter, 0));
-
-            void *cell_dst_iter_c = const_cast<void *>(
-                    ws_states_iter_c(lay + 1, dir, iter + 1, 0));
-            const void *cell_src_iter_c
-                    = ws_states_iter_c(lay + 1, dir, iter, 0);
-
-            // the cell_position is used only when skip_data_copy is
-            // supported currently supported only for forward
-            cell_position_t cell_position = middle_cell;
-            if (iter == 0) cell_position |= first_iter;
-            if (lay == 0) cell_position |= first_layer;
-            if (iter == rnn.n_iter - 1) cell_position |= last_iter;
-            if (lay == rnn.n_layer - 1) cell_position |= last_layer;
-
-            // The dst_* paths should be before the src_* paths as
-            // the later will override cell_src_layer and
-            // cell_src_iter appropriately for 1st layer and 1st
-            // iter.
-            const bool last_iter_skip_copy
-                    = rnn.skip_dst_iter_copy() && (cell_position & last_iter);
-            if (last_iter_skip_copy) {
-                cell_dst_layer = dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0);
-                cell_src_layer
-                        = dst_iter_ + dst_iter_mdw.off(lay - 1, dir, 0, 0);
-            }
-
-            if (rnn.skip_dst_layer_copy() && (cell_position & last_layer)) {
-                // Note: for last layer and last iter, the output is in dst_layer
-                // and still need to be copied to dst_iter
-                cell_dst_layer = dst_layer_ + dst_layer_mdw.off(iter, 0, 0);
-                cell_dst_iter = last_iter_skip_copy
-                        ? dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0)
-                        : nullptr;
-                cell_src_iter = (iter != 0)
-                        ? dst_layer_ + dst_layer_mdw.off(iter - 1, 0, 0)
-                        : cell_src_iter;
-            }
-            if (rnn.skip_src_iter_copy() && (cell_position & first_iter))
-                cell_src_iter = src_iter_ + src_iter_mdw.off(lay, dir, 0, 0);
-
-            if (rnn.skip_src_layer_copy() && (cell_position & first_layer))
-                cell_src_layer = src_layer_ + src_layer_mdw.off(iter, 0, 0);
-
-            // because the c state is always f32 and require no
-            // conversion, we can always skip to copy for the 1st
-            // and last iteration
-            if (iter == 0 && src_iter_c_) {
-                cell_src_iter_c = inc_ptr(src_iter_c_, rnn.src_iter_c_dt,
-                        src_iter_c_mdw.off(lay, dir, 0, 0));
-                cell_position |= c_state_first_iter;
-            }
-            if (iter == rnn.n_iter - 1 && dst_iter_c_) {
-                cell_dst_iter_c = inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
-                        dst_iter_c_mdw.off(lay, dir, 0, 0));
-                cell_position |= c_state_last_iter;
-            }
-            const size_t sg_start_idx = rnn.n_iter_scratch_gates == 1
-                    ? static_cast<size_t>(0)
-                    : static_cast<size_t>(iter) * rnn.scratch_gates_nld
-                            * rnn.scratch_gates_ld;
-            const auto cell_scratch_gates = &scratch_gates_[sg_start_idx];
-
-            dst_iter_t *proj_ht = nullptr;
-            if (rnn.is_lstm_projection) {
-                if (rnn.is_training)
-                    proj_ht = &(ws_ht(lay, dir, iter, 0));
-                else
-                    proj_ht = scratch_ht_;
-            }
-
-#if DNNL_X64
-            CHECK((this->*cell_func)(ctx, rnn, cell_position, cell_dst_layer,
-                    cell_dst_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
-                    SAFE_PTR(diff_augru_attention, iter, 0, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
-                    SAFE_PTR(weights_layer, lay, dir, 0),
-                    SAFE_PTR(weights_iter, lay, dir, 0),
-                    SAFE_PTR(weights_projection, lay, dir),
-                    SAFE_PTR(weights_peephole, lay, dir, 0),
-                    w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
-                                : nullptr,
-                    bias(lay, dir), cell_src_layer,
-                    SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
-                    cell_src_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
-                    SAFE_PTR(diff_weights_layer, lay, dir, 0),
-                    SAFE_PTR(diff_weights_iter, lay, dir, 0),
-                    SAFE_PTR(diff_weights_projection, lay, dir, 0),
-                    SAFE_PTR(diff_weights_peephole, lay, dir, 0),
-                    SAFE_PTR(diff_bias, lay, dir, 0),
-                    SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
-                    proj_ht, scratch_diff_ht_,
-                    SAFE_PTR(ws_grid, lay, dir, iter, 0), scratch_cell_,
-                    scratch_gates_blocked_, scratch_src_layer_,
-                    scratch_src_iter_, cell_dst_iter, amx_scratchpad,
-                    addr_batch_global));
-#else
-            CHECK((this->*cell_func)(ctx, rnn, cell_position, cell_dst_layer,
-                    cell_dst_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
-                    SAFE_PTR(diff_augru_attention, iter, 0, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
-                    SAFE_PTR(weights_layer, lay, dir, 0),
-                    SAFE_PTR(weights_iter, lay, dir, 0),
-                    SAFE_PTR(weights_projection, lay, dir),
-                    SAFE_PTR(weights_peephole, lay, dir, 0),
-                    w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
-                                : nullptr,
-                    bias(lay, dir), cell_src_layer,
-                    SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
-                    cell_src_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
-                    SAFE_PTR(diff_weights_layer, lay, dir, 0),
-                    SAFE_PTR(diff_weights_iter, lay, dir, 0),
-                    SAFE_PTR(diff_weights_projection, lay, dir, 0),
-                    SAFE_PTR(diff_weights_peephole, lay, dir, 0),
-                    SAFE_PTR(diff_bias, lay, dir, 0),
-                    SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
-                    proj_ht, scratch_diff_ht_,
-                    SAFE_PTR(ws_grid, lay, dir, iter, 0), scratch_cell_,
-                    cell_dst_iter, amx_scratchpad));
-#endif
-        }
+        for (int i = 0; i < rnn.n_iter; i++)
+            CHECK(execute_cell(dir, j, i, 0));
 
         CHECK(compute_merged_layer_part_if_applicable(
                 prop_kind::backward, dir, lay));
@@ -1258,16 +1323,20 @@ rnn_grid_execution_sig((ref_rnn_common_t<aprop, src_type, weights_type,
 template <typename src_data_t, typename input_data_t>
 void copy_init_layer_fwd_template(const rnn_conf_t &rnn,
         src_data_t *__restrict ws_states_layer_,
-        const input_data_t *__restrict xt_, const memory_desc_wrapper &xt_d) {
+        const input_data_t *__restrict xt_, const memory_desc_wrapper &xt_d,
+        const int32_t *seq_lengths) {
 
     const AOC<src_data_t, 4> ws_states_layer(ws_states_layer_, rnn.n_dir,
             rnn.n_iter + 1, rnn.mb, rnn.ws_states_layer_ld);
 
     parallel_nd(rnn.n_iter, rnn.mb, [&](dim_t it, dim_t b) {
+        // Reverse direction traverses each sequence within its own length
+        const int seq_len = rnn.seq_length(seq_lengths, b);
+        if (it >= seq_len) return;
         auto xxt = xt_ + xt_d.blk_off(it, b);
         src_data_t *ws_l2r_ptr = &(ws_states_layer(0, it + 1, b, 0));
         src_data_t *ws_r2l_ptr
-                = &(ws_states_layer(rnn.n_dir - 1, rnn.n_iter - it, b, 0));
+                = &(ws_states_layer(rnn.n_dir - 1, seq_len - it, b, 0));
         if (rnn.exec_dir != r2l) {
             if (rnn.is_bf32()) {
                 cvt_float_to_bfloat16(
@@ -1294,7 +1363,8 @@ void copy_init_layer_fwd_template(const rnn_conf_t &rnn,
 template <typename acc_data_t>
 void copy_init_layer_bwd_template(const rnn_conf_t &rnn,
         acc_data_t *ws_diff_states_layer_, const acc_data_t *diff_dst_layer_,
-        const memory_desc_wrapper &diff_dst_layer_d) {
+        const memory_desc_wrapper &diff_dst_layer_d,
+        const int32_t *seq_lengths) {
     const AOC<acc_data_t, 5> ws_diff_states_layer(ws_diff_states_layer_,
             rnn.n_layer + 1, rnn.n_dir, rnn.n_iter + 1, rnn.mb,
             rnn.ws_diff_states_layer_ld);
@@ -1302,32 +1372,36 @@ void copy_init_layer_bwd_template(const rnn_conf_t &rnn,
     switch (rnn.exec_dir) {
         case bi_concat:
             parallel_nd(rnn.n_iter, rnn.mb, [&](dim_t it, dim_t b) {
+                const int seq_len = rnn.seq_length(seq_lengths, b);
+                if (it >= seq_len) return;
                 const auto diff_dst_layer_x
                         = diff_dst_layer_ + diff_dst_layer_d.blk_off(it, b);
                 for (int s = 0; s < rnn.dlc; s++) {
                     ws_diff_states_layer(rnn.n_layer, 0, it, b, s)
                             = diff_dst_layer_x[s];
-                    ws_diff_states_layer(
-                            rnn.n_layer, 1, rnn.n_iter - it - 1, b, s)
+                    ws_diff_states_layer(rnn.n_layer, 1, seq_len - it - 1, b, s)
                             = diff_dst_layer_x[rnn.dlc + s];
                 }
             });
             break;
         case bi_sum:
             parallel_nd(rnn.n_iter, rnn.mb, [&](dim_t it, dim_t b) {
+                const int seq_len = rnn.seq_length(seq_lengths, b);
+                if (it >= seq_len) return;
                 const auto diff_dst_layer_x
                         = diff_dst_layer_ + diff_dst_layer_d.blk_off(it, b);
                 for (int s = 0; s < rnn.dlc; s++) {
                     ws_diff_states_layer(rnn.n_layer, 0, it, b, s)
                             = diff_dst_layer_x[s];
-                    ws_diff_states_layer(
-                            rnn.n_layer, 1, rnn.n_iter - it - 1, b, s)
+                    ws_diff_states_layer(rnn.n_layer, 1, seq_len - it - 1, b, s)
                             = diff_dst_layer_x[s];
                 }
             });
             break;
         case l2r:
             parallel_nd(rnn.n_iter, rnn.mb, [&](dim_t it, dim_t b) {
+                const int seq_len = rnn.seq_length(seq_lengths, b);
+                if (it >= seq_len) return;
                 const auto diff_dst_layer_x
                         = diff_dst_layer_ + diff_dst_layer_d.blk_off(it, b);
                 for (int s = 0; s < rnn.dlc; s++) {
@@ -1338,8 +1412,10 @@ void copy_init_layer_bwd_template(const rnn_conf_t &rnn,
             break;
         case r2l:
             parallel_nd(rnn.n_iter, rnn.mb, [&](dim_t it, dim_t b) {
+                const int seq_len = rnn.seq_length(seq_lengths, b);
+                if (it >= seq_len) return;
                 const auto diff_dst_layer_x = diff_dst_layer_
-                        + diff_dst_layer_d.blk_off(rnn.n_iter - it - 1, b);
+                        + diff_dst_layer_d.blk_off(seq_len - it - 1, b);
                 for (int s = 0; s < rnn.dlc; s++) {
                     ws_diff_states_layer(rnn.n_layer, 0, it, b, s)
                             = diff_dst_layer_x[s];
@@ -1355,10 +1431,10 @@ void copy_init_layer_bwd_template(const rnn_conf_t &rnn,
     template <typename input_data_t> \
     void cname::copy_init_layer(const rnn_conf_t &rnn, \
             src_layer_t *ws_states_layer_, gemm_acc_t *ws_diff_states_layer_, \
-            const input_data_t *xt_, const gemm_acc_t *diff_dst_layer_) \
-            const { \
+            const input_data_t *xt_, const gemm_acc_t *diff_dst_layer_, \
+            const int32_t *seq_lengths) const { \
         copy_init_layer_fwd_template(rnn, ws_states_layer_, xt_, \
-                memory_desc_wrapper(pd()->src_md(0))); \
+                memory_desc_wrapper(pd()->src_md(0)), seq_lengths); \
     }
 
 RNN_DECL_COPY_INIT_LAYER_FWD(ref_rnn_common_fwd_f32_t)
@@ -1372,10 +1448,11 @@ RNN_DECL_COPY_INIT_LAYER_FWD(ref_rnn_common_fwd_s8s8_t)
     template <typename input_data_t> \
     void cname::copy_init_layer(const rnn_conf_t &rnn, \
             src_layer_t *ws_states_layer_, gemm_acc_t *ws_diff_states_layer_, \
-            const input_data_t *xt_, const gemm_acc_t *diff_dst_layer_) \
-            const { \
+            const input_data_t *xt_, const gemm_acc_t *diff_dst_layer_, \
+            const int32_t *seq_lengths) const { \
         copy_init_layer_bwd_template(rnn, ws_diff_states_layer_, \
-                diff_dst_layer_, memory_desc_wrapper(pd()->diff_dst_md(0))); \
+                diff_dst_layer_, memory_desc_wrapper(pd()->diff_dst_md(0)), \
+                seq_lengths); \
     }
 
 RNN_DECL_COPY_INIT_LAYER_BWD(ref_rnn_common_bwd_f32_t)
@@ -1453,21 +1530,25 @@ void copy_init_iter_bwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
         const acc_data_t *diff_dst_iter_,
         const memory_desc_wrapper diff_dst_iter_d,
         const float *diff_dst_iter_c_,
-        const memory_desc_wrapper diff_dst_iter_c_d) {
+        const memory_desc_wrapper diff_dst_iter_c_d,
+        const int32_t *seq_lengths) {
     const AOC<acc_data_t, 5> ws_diff_states_iter(ws_diff_states_iter_,
             rnn.n_layer + 1, rnn.n_dir, rnn.n_iter + 1, rnn.mb,
             rnn.ws_diff_states_iter_ld);
     const AOC<acc_data_t, 5> ws_diff_states_iter_c(ws_diff_states_iter_c_,
             rnn.n_layer + 1, rnn.n_dir, rnn.n_iter + 1, rnn.mb,
             rnn.ws_diff_states_iter_c_ld);
+    // The gradient w.r.t. the final states of a sample enters the
+    // recurrence at the last time step of its own sequence.
     if (diff_dst_iter_) {
         parallel_nd(rnn.n_layer, rnn.n_dir, rnn.mb,
                 [&](dim_t lay, dim_t dir, dim_t b) {
-            array_copy(&(ws_diff_states_iter(lay, dir, rnn.n_iter, b, 0)),
+            const int seq_len = rnn.seq_length(seq_lengths, b);
+            array_copy(&(ws_diff_states_iter(lay, dir, seq_len, b, 0)),
                     diff_dst_iter_ + diff_dst_iter_d.blk_off(lay, dir, b),
                     rnn.dic);
             if (pd->cell_kind() == alg_kind::vanilla_lstm)
-                array_copy(&(ws_diff_states_iter_c(lay, dir, rnn.n_iter, b, 0)),
+                array_copy(&(ws_diff_states_iter_c(lay, dir, seq_len, b, 0)),
                         diff_dst_iter_c_
                                 + diff_dst_iter_c_d.blk_off(lay, dir, b),
                         rnn.dhc);
@@ -1475,11 +1556,12 @@ void copy_init_iter_bwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
     } else {
         parallel_nd(rnn.n_layer, rnn.n_dir, rnn.mb,
                 [&](dim_t lay, dim_t dir, dim_t i) {
+            const int seq_len = rnn.seq_length(seq_lengths, i);
             for (int j = 0; j < rnn.dic; j++)
-                ws_diff_states_iter(lay, dir, rnn.n_iter, i, j) = 0.0f;
+                ws_diff_states_iter(lay, dir, seq_len, i, j) = 0.0f;
             if (pd->cell_kind() == alg_kind::vanilla_lstm)
                 for (int j = 0; j < rnn.dhc; j++)
-                    ws_diff_states_iter_c(lay, dir, rnn.n_iter, i, j) = 0.0f;
+                    ws_diff_states_iter_c(lay, dir, seq_len, i, j) = 0.0f;
         });
     }
 }
@@ -1495,7 +1577,8 @@ void copy_init_iter_bwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
             const input_data_t *__restrict src_iter_, \
             const void *__restrict src_iter_c_, \
             const gemm_acc_t *__restrict diff_dst_iter_, \
-            const float *__restrict diff_dst_iter_c_) const { \
+            const float *__restrict diff_dst_iter_c_, \
+            const int32_t *seq_lengths) const { \
         auto src_iter_d = memory_desc_wrapper(pd()->src_md(1)); \
         auto src_iter_c_d = memory_desc_wrapper(pd()->src_md(2)); \
         copy_init_iter_fwd_template(rnn, pd(), ws_states_iter_, \
@@ -1517,12 +1600,12 @@ RNN_DECL_COPY_INIT_ITER_FWD(ref_rnn_common_fwd_s8s8_t)
             gemm_acc_t *ws_diff_states_iter_, \
             gemm_acc_t *ws_diff_states_iter_c_, const input_data_t *src_iter_, \
             const void *src_iter_c_, const gemm_acc_t *diff_dst_iter_, \
-            const float *diff_dst_iter_c_) const { \
+            const float *diff_dst_iter_c_, const int32_t *seq_lengths) const { \
         auto diff_dst_iter_d = memory_desc_wrapper(pd()->diff_dst_md(1)); \
         auto diff_dst_iter_c_d = memory_desc_wrapper(pd()->diff_dst_md(2)); \
         copy_init_iter_bwd_template(rnn, pd(), ws_diff_states_iter_, \
                 ws_diff_states_iter_c_, diff_dst_iter_, diff_dst_iter_d, \
-                diff_dst_iter_c_, diff_dst_iter_c_d); \
+                diff_dst_iter_c_, diff_dst_iter_c_d, seq_lengths); \
     }
 
 RNN_DECL_COPY_INIT_ITER_BWD(ref_rnn_common_bwd_f32_t)
@@ -1533,7 +1616,7 @@ template <typename src_data_t, typename dst_layer_dt, typename dst_iter_dt>
 void copy_res_layer_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
         dst_layer_dt *dst_layer_, memory_desc_wrapper &dst_layer_d,
         const dst_iter_dt *dst_iter_, const memory_desc_wrapper &dst_iter_d,
-        const src_data_t *ws_states_layer_) {
+        const src_data_t *ws_states_layer_, const int32_t *seq_lengths) {
 
     const AOC<const src_data_t, 5> ws_states_layer(ws_states_layer_,
             rnn.n_layer + 1, rnn.n_dir, rnn.n_iter + 1, rnn.mb,
@@ -1586,10 +1669,24 @@ void copy_res_layer_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
         }
     };
 
+    // Padded time steps of variable-length sequences are set to zero
+    const bool quantized_dst = rnn.is_int8_conf() && !dequantize;
+    const dst_layer_dt zero = quantized_dst
+            ? q10n::qz_a1b0_t<float, dst_layer_dt>()(shift)
+            : dst_layer_dt(0);
+    const dim_t dst_layer_c = dst_layer_d.dims()[2];
+
     // if skip_dst_iter_copy, then the data for the last iteration is
     // in dst_iter, not in workspace
     parallel_nd(rnn.n_iter - (rnn.skip_dst_iter_copy() ? 1 : 0), rnn.mb,
             [&](dim_t it, dim_t b) {
+        const int seq_len = rnn.seq_length(seq_lengths, b);
+        if (it >= seq_len) {
+            auto *dd = &dst_layer_[dst_layer_d.blk_off(it, b, 0)];
+            for (dim_t s = 0; s < dst_layer_c; s++)
+                dd[s] = zero;
+            return;
+        }
         int dir = 0;
         if (rnn.exec_dir != r2l) {
             const auto *ss = &ws_states_layer(rnn.n_layer, dir, it + 1, b, 0);
@@ -1599,7 +1696,7 @@ void copy_res_layer_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
         }
         if (rnn.exec_dir != l2r) {
             const auto *ss
-                    = &ws_states_layer(rnn.n_layer, dir, rnn.n_iter - it, b, 0);
+                    = &ws_states_layer(rnn.n_layer, dir, seq_len - it, b, 0);
             if (rnn.exec_dir == bi_sum) {
                 auto *dd = &dst_layer_[dst_layer_d.blk_off(it, b, 0)];
                 acc_vec(dd, ss);
@@ -1641,21 +1738,30 @@ void copy_res_layer_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
 template <typename acc_data_t>
 void copy_res_layer_bwd_template(const rnn_conf_t &rnn,
         acc_data_t *diff_src_layer_, memory_desc_wrapper &diff_src_layer_d,
-        const acc_data_t *ws_diff_states_layer_) {
+        const acc_data_t *ws_diff_states_layer_, const int32_t *seq_lengths) {
     const AOC<const acc_data_t, 5> ws_diff_states_layer(ws_diff_states_layer_,
             rnn.n_layer + 1, rnn.n_dir, rnn.n_iter + 1, rnn.mb,
             rnn.ws_diff_states_layer_ld);
 
     parallel_nd(rnn.n_iter, rnn.mb, [&](dim_t it, dim_t b) {
         int dir = 0;
+        const int seq_len = rnn.seq_length(seq_lengths, b);
+        if (it >= seq_len) {
+            // Padded time steps of variable-length sequences
+            for (int s = 0; s < rnn.slc; s++)
+                diff_src_layer_[diff_src_layer_d.blk_off(
+                        it, b, dir * rnn.slc + s)]
+                        = 0;
+            return;
+        }
         for (int s = 0; s < rnn.slc; s++) {
             acc_data_t *dst_addr = diff_src_layer_
                     + diff_src_layer_d.blk_off(
-                            (rnn.exec_dir == r2l) ? rnn.n_iter - 1 - it : it, b,
+                            (rnn.exec_dir == r2l) ? seq_len - 1 - it : it, b,
                             dir * rnn.slc + s);
             acc_data_t res = ws_diff_states_layer(0, 0, it, b, s);
             if (rnn.n_dir - 1)
-                res += ws_diff_states_layer(0, 1, rnn.n_iter - 1 - it, b, s);
+                res += ws_diff_states_layer(0, 1, seq_len - 1 - it, b, s);
             dst_addr[0] = res;
         }
     });
@@ -1667,11 +1773,12 @@ void copy_res_layer_bwd_template(const rnn_conf_t &rnn,
     void cname::copy_res_layer(const rnn_conf_t &rnn, \
             dst_layer_dt *dst_layer_, gemm_acc_t *diff_src_layer, \
             const dst_iter_dt *dst_iter_, const src_layer_t *ws_states_layer_, \
-            const gemm_acc_t *ws_diff_states_layer_) const { \
+            const gemm_acc_t *ws_diff_states_layer_, \
+            const int32_t *seq_lengths) const { \
         auto dst_layer_d = memory_desc_wrapper(pd()->dst_md(0)); \
         auto dst_iter_d = memory_desc_wrapper(pd()->dst_md(1)); \
         copy_res_layer_fwd_template(rnn, pd(), dst_layer_, dst_layer_d, \
-                dst_iter_, dst_iter_d, ws_states_layer_); \
+                dst_iter_, dst_iter_d, ws_states_layer_, seq_lengths); \
     }
 
 RNN_DECL_COPY_RES_LAYER_FWD(ref_rnn_common_fwd_f32_t)
@@ -1686,10 +1793,11 @@ RNN_DECL_COPY_RES_LAYER_FWD(ref_rnn_common_fwd_s8s8_t)
     void cname::copy_res_layer(const rnn_conf_t &rnn, \
             dst_layer_dt *dst_layer_, gemm_acc_t *diff_src_layer_, \
             const dst_iter_dt *dst_iter_, const src_layer_t *ws_states_layer_, \
-            const gemm_acc_t *ws_diff_states_layer_) const { \
+            const gemm_acc_t *ws_diff_states_layer_, \
+            const int32_t *seq_lengths) const { \
         auto diff_src_layer_d = memory_desc_wrapper(pd()->diff_src_md(0)); \
         copy_res_layer_bwd_template(rnn, diff_src_layer_, diff_src_layer_d, \
-                ws_diff_states_layer_); \
+                ws_diff_states_layer_, seq_lengths); \
     }
 
 RNN_DECL_COPY_RES_LAYER_BWD(ref_rnn_common_bwd_f32_t)
@@ -1701,7 +1809,26 @@ void copy_res_iter_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
         dst_iter_dt *dst_iter_, memory_desc_wrapper &dst_iter_d,
         void *dst_iter_c_, memory_desc_wrapper dst_iter_c_d,
         const dst_layer_dt *dst_layer_, memory_desc_wrapper dst_layer_d,
-        const src_data_t *ws_states_iter_, const void *ws_states_iter_c_) {
+        const src_data_t *ws_states_iter_, const void *ws_states_iter_c_,
+        const int32_t *seq_lengths) {
+    // The cell writes the c state of the last iteration directly into
+    // dst_iter_c, the samples finishing earlier keep it in the workspace.
+    if (rnn.is_varlen && dst_iter_c_) {
+        const auto ws_states_iter_c = rnn_utils::make_raw_aoc(ws_states_iter_c_,
+                types::data_type_size(rnn.src_iter_c_dt), rnn.n_layer + 1,
+                rnn.n_dir, rnn.n_iter + 1, rnn.mb, rnn.ws_states_iter_c_ld);
+        const size_t c_dt_size = types::data_type_size(rnn.dst_iter_c_dt);
+        parallel_nd(rnn.n_layer, rnn.n_dir, rnn.mb,
+                [&](dim_t lay, dim_t dir, dim_t b) {
+            const int seq_len = seq_lengths[b];
+            if (seq_len == rnn.n_iter) return;
+            void *dd = inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
+                    dst_iter_c_d.blk_off(lay, dir, b, 0));
+            std::memcpy(dd, ws_states_iter_c(lay + 1, dir, seq_len, b, 0),
+                    rnn.dhc * c_dt_size);
+        });
+    }
+
     if (dst_iter_ == nullptr) return;
 
     const AOC<const src_data_t, 5> ws_states_iter(ws_states_iter_,
@@ -1731,7 +1858,8 @@ void copy_res_iter_fwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
 
     parallel_nd(n_layer_in_ws, rnn.n_dir, rnn.mb,
             [&](dim_t lay, dim_t dir, dim_t b) {
-        const auto *ss = &ws_states_iter(lay + 1, dir, rnn.n_iter, b, 0);
+        const int seq_len = rnn.seq_length(seq_lengths, b);
+        const auto *ss = &ws_states_iter(lay + 1, dir, seq_len, b, 0);
         auto *dd = dst_iter_ + dst_iter_d.blk_off(lay, dir, b, 0);
         copy_vec(dd, ss);
     });
@@ -1784,13 +1912,14 @@ void copy_res_iter_bwd_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
             const src_layer_t *ws_states_layer_, \
             const void *ws_states_iter_c_, \
             const gemm_acc_t *ws_diff_states_iter_, \
-            const gemm_acc_t *ws_diff_states_iter_c_) const { \
+            const gemm_acc_t *ws_diff_states_iter_c_, \
+            const int32_t *seq_lengths) const { \
         auto dst_layer_d = memory_desc_wrapper(pd()->dst_md(0)); \
         auto dst_iter_d = memory_desc_wrapper(pd()->dst_md(1)); \
         auto dst_iter_c_d = memory_desc_wrapper(pd()->dst_md(2)); \
         copy_res_iter_fwd_template(rnn, pd(), dst_iter_, dst_iter_d, \
                 dst_iter_c_, dst_iter_c_d, dst_layer_, dst_layer_d, \
-                ws_states_layer_, ws_states_iter_c_); \
+                ws_states_layer_, ws_states_iter_c_, seq_lengths); \
     }
 
 RNN_DECL_COPY_RES_ITER_FWD(ref_rnn_common_fwd_f32_t)
@@ -1808,7 +1937,8 @@ RNN_DECL_COPY_RES_ITER_FWD(ref_rnn_common_fwd_s8s8_t)
             const src_layer_t *ws_states_layer_, \
             const void *ws_states_iter_c_, \
             const gemm_acc_t *ws_diff_states_iter_, \
-            const gemm_acc_t *ws_diff_states_iter_c_) const { \
+            const gemm_acc_t *ws_diff_states_iter_c_, \
+            const int32_t *seq_lengths) const { \
         auto diff_src_iter_d = memory_desc_wrapper(pd()->diff_src_md(1)); \
         auto diff_src_iter_c_d = memory_desc_wrapper(pd()->diff_src_md(2)); \
         copy_res_iter_bwd_template(rnn, pd(), diff_src_iter_, diff_src_iter_d, \
@@ -2026,6 +2156,15 @@ status_t ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
     auto diff_dst_iter = CTX_IN_MEM(const gemm_acc_t *, DNNL_ARG_DIFF_DST_ITER);
     auto diff_dst_iter_c = CTX_IN_MEM(const float *, DNNL_ARG_DIFF_DST_ITER_C);
 
+    const int32_t *seq_lengths = rnn.is_varlen
+            ? CTX_IN_MEM(const int32_t *, DNNL_ARG_SEQ_LENGTHS)
+            : nullptr;
+    VCONDCHECK(primitive, exec, check, rnn,
+            IMPLICATION(rnn.is_varlen,
+                    rnn_utils::seq_lengths_ok(rnn, seq_lengths)),
+            status::invalid_arguments,
+            "sequence lengths must be in [1, n_iter] and non-increasing");
+
     auto w_layer = reinterpret_cast<const weights_t *>(layer_weights_n_comp);
     auto w_iter = reinterpret_cast<const weights_t *>(iter_weights_n_comp);
     auto w_projection
@@ -2038,6 +2177,17 @@ status_t ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
             projection_weights_n_comp + rnn.weights_projection_comp_offset);
     const auto &scratchpad = ctx.get_scratchpad_grantor();
 
+    // The states may be updated in place across successive calls, e.g. when a
+    // sequence is streamed chunk by chunk.
+    if (rnn.in_place_states_need_copy() && src_iter != nullptr
+            && static_cast<const void *>(src_iter) == dst_iter) {
+        char *src_iter_copy
+                = scratchpad.template get<char>(key_rnn_src_iter_copy);
+        std::memcpy(src_iter_copy, src_iter,
+                memory_desc_wrapper(pd()->src_md(1)).size());
+        src_iter = src_iter_copy;
+    }
+
     auto ptr_wei_layer
             = scratchpad.template get<weights_t *>(key_rnn_ptrs_wei_layer);
     auto ptr_wei_iter
@@ -2216,10 +2366,10 @@ status_t ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
     if (!(rnn.skip_src_layer_copy() && rnn.is_fwd)) {
         if (pd()->src_md(0)->data_type == data_type::f32)
             copy_init_layer(rnn, ws_states_layer, ws_diff_states_layer,
-                    (const float *)src_layer, diff_dst_layer);
+                    (const float *)src_layer, diff_dst_layer, seq_lengths);
         else
             copy_init_layer(rnn, ws_states_layer, ws_diff_states_layer,
-                    src_layer, diff_dst_layer);
+                    src_layer, diff_dst_layer, seq_lengths);
     }
 
     if (!(rnn.skip_src_iter_copy() && rnn.is_fwd)) {
@@ -2227,12 +2377,12 @@ status_t ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
             copy_init_iter(rnn, ws_states_iter,
                     static_cast<void *>(ws_states_iter_c), ws_diff_states_iter,
                     ws_diff_states_iter_c, (const float *)src_iter, src_iter_c,
-                    diff_dst_iter, diff_dst_iter_c);
+                    diff_dst_iter, diff_dst_iter_c, seq_lengths);
         else
             copy_init_iter(rnn, ws_states_iter, ws_states_iter_c,
                     ws_diff_states_iter, ws_diff_states_iter_c,
                     (const src_iter_t *)src_iter, src_iter_c, diff_dst_iter,
-                    diff_dst_iter_c);
+                    diff_dst_iter_c, seq_lengths);
     }
 
     // run the execution on the grid
@@ -2266,10 +2416,11 @@ status_t ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
     if (!(rnn.skip_dst_layer_copy() && rnn.is_fwd)) {
         if (pd()->dst_md(0)->data_type == data_type::f32)
             copy_res_layer(rnn, (float *)dst_layer, diff_src_layer, dst_iter,
-                    ws_states_layer, ws_diff_states_layer);
+                    ws_states_layer, ws_diff_states_layer, seq_lengths);
         else
             copy_res_layer(rnn, (dst_layer_t *)dst_layer, diff_src_layer,
-                    dst_iter, ws_states_layer, ws_diff_states_layer);
+                    dst_iter, ws_states_layer, ws_diff_states_layer,
+                    seq_lengths);
     }
 
     if (!(rnn.skip_dst_iter_copy() && rnn.is_fwd)) {
@@ -2277,12 +2428,12 @@ status_t ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute(
             copy_res_iter(rnn, (float *)dst_iter, dst_iter_c, diff_src_iter,
                     diff_src_iter_c, dst_layer, ws_states_iter,
                     ws_states_iter_c, ws_diff_states_iter,
-                    ws_diff_states_iter_c);
+                    ws_diff_states_iter_c, seq_lengths);
         else
             copy_res_iter(rnn, (dst_iter_t *)dst_iter, dst_iter_c,
                     diff_src_iter, diff_src_iter_c, dst_layer, ws_states_iter,
                     ws_states_iter_c, ws_diff_states_iter,
-                    ws_diff_states_iter_c);
+                    ws_diff_states_iter_c, seq_lengths);
     }
 
     return status::success;
@@ -100,6 +100,17 @@ int rnn_utils::get_good_ld(int dim, int sizeof_dt) {
     return (ld % 256 == 0) ? ld + 64 / sizeof_dt : ld;
 }
 
+bool rnn_utils::seq_lengths_ok(
+        const rnn_conf_t &rnn, const int32_t *seq_lengths) {
+    if (seq_lengths == nullptr) return false;
+    for (int b = 0; b < rnn.mb; b++) {
+        const int32_t len = seq_lengths[b];
+        if (len < 1 || len > rnn.n_iter) return false;
+        if (b > 0 && len > seq_lengths[b - 1]) return false;
+    }
+    return true;
+}
+
 void rnn_utils::set_offsets(const rnn_conf_t &rnn, size_t &ws_gates_offset,
         size_t &ws_ht_offset, size_t &ws_states_layer_offset,
         size_t &ws_states_iter_offset, size_t &ws_states_iter_c_offset,
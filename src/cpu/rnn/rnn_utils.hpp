@@ -21,6 +21,7 @@
 #include <type_traits>
 
 #include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
 #include "common/memory_desc_wrapper.hpp"
 #include "common/primitive.hpp"
 #include "common/utils.hpp"
@@ -410,6 +411,11 @@ struct rnn_conf_t {
 
     bool diff_weights_overwrite = false;
     bool use_matmul = false;
+    // Per-sample sequence lengths are passed at execution time
+    bool is_varlen = false;
+    // Number of cells executed concurrently along the wavefronts of the
+    // (layer, iteration) grid, 1 means cells are executed one after another
+    int n_wavefront_cells = 1;
 
     inline bool is_int8_conf() const {
         return is_signed_int8_conf() || is_unsigned_int8_conf();
@@ -478,6 +484,42 @@ struct rnn_conf_t {
 
     inline bool is_bf32() const { return is_cell_bf16_amx() && is_f32_conf(); }
 
+    // Returns the number of samples still active at time step `iter`. The
+    // samples are sorted by non-increasing sequence length, hence the active
+    // ones always form a prefix of the minibatch.
+    inline int active_mb(const int32_t *seq_lengths, int iter) const {
+        if (!is_varlen) return mb;
+        int lo = 0, hi = mb;
+        while (lo < hi) {
+            const int mid = (lo + hi) / 2;
+            if (seq_lengths[mid] > iter)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    }
+
+    // Returns the number of valid time steps of sample `b`.
+    inline int seq_length(const int32_t *seq_lengths, dim_t b) const {
+        return is_varlen ? seq_lengths[b] : n_iter;
+    }
+
+    // Returns a copy of the configuration restricted to the first `mb_active`
+    // samples. The brgemm kernels are generated for a fixed m_block, so the
+    // minibatch is only shrunk by whole blocks there; the extra rows belong to
+    // finished samples and their results are never read.
+    inline rnn_conf_t active_conf(int mb_active) const {
+        rnn_conf_t conf = *this;
+        if (is_brgemm) {
+            conf.M_blocks = utils::div_up(mb_active, m_block);
+            conf.M = conf.M_blocks * m_block;
+            conf.mb = static_cast<int>(conf.M);
+        } else
+            conf.mb = mb_active;
+        return conf;
+    }
+
     inline bool skip_src_layer_copy() const {
         return (exec_dir == l2r) && !is_bf32()
                 && utils::one_of(dt_conf, s8s8s8f32, f32s8f32f32, s8s8s8s8,
@@ -489,13 +531,29 @@ struct rnn_conf_t {
                 && utils::one_of(dt_conf, s8s8s8s8, s8s8s8f32, u8u8u8u8,
                         u8u8u8f32, all_f32, all_bf16, all_f16);
     }
+    // When the states are updated in place (dst_iter aliasing src_iter), a
+    // single-iteration cell skipping both copies writes dst_iter while it
+    // still reads src_iter. The brgemm cells interleave these reads and
+    // writes block by block, and the GRU cells read h_prev again after the
+    // first part has written r * h_prev to the output, so src_iter has to be
+    // copied first.
+    inline bool in_place_states_need_copy() const {
+        return n_iter == 1 && skip_src_iter_copy() && skip_dst_iter_copy()
+                && (is_brgemm
+                        || utils::one_of(cell_kind, alg_kind::vanilla_gru,
+                                alg_kind::vanilla_augru));
+    }
+    // With variable-length sequences the final states of a sample are located
+    // at its own last time step, so the results are always gathered from the
+    // workspace.
     inline bool skip_dst_layer_copy() const {
-        return (exec_dir == l2r) && !is_bf32()
+        return (exec_dir == l2r) && !is_bf32() && !is_varlen
                 && utils::one_of(dt_conf, s8s8s8s8, f32s8f32s8, u8u8u8u8,
                         f32u8f32u8, all_f32, all_bf16, all_f16);
     }
     inline bool skip_dst_iter_copy() const {
         return (exec_dir == l2r) && (dst_iter_ld_ > 0) && !is_bf32()
+                && !is_varlen
                 && utils::one_of(dt_conf, s8s8s8s8, s8s8s8f32, u8u8u8u8,
                         u8u8u8f32, all_f32, all_bf16, all_f16);
     }
@@ -679,6 +737,10 @@ bool is_ldoi_blocked(const memory_desc_wrapper &md);
 
 int get_good_ld(int dim, int sizeof_dt);
 
+// Checks that the user-provided sequence lengths are in [1, n_iter] and sorted
+// in non-increasing order.
+bool seq_lengths_ok(const rnn_conf_t &rnn, const int32_t *seq_lengths);
+
 template <typename T>
 bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
         const primitive_attr_t &attr, const memory_desc_wrapper &src_layer_d,
@@ -702,6 +764,7 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
             && !memory_desc_wrapper(rd.weights_projection_desc).is_zero();
     rnn.is_augru
             = utils::one_of(rd.cell_kind, dnnl_lbr_augru, dnnl_vanilla_augru);
+    rnn.is_varlen = rd.flags & rnn_flags::variable_length;
     rnn.bias_dt = bias_d.is_zero() ? data_type::f32 : bias_d.data_type();
     rnn.src_iter_c_dt = src_iter_c_d.is_zero() ? data_type::f32
                                                : src_iter_c_d.data_type();
@@ -881,6 +944,7 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
     rnn.parts_bias[1] = 0;
 
     rnn.use_matmul = !rnn.is_brgemm && rnn.is_fwd // TODO: Enable BWD
+            && !rnn.is_varlen
     // TODO: Below checks are for legacy and a performance study is
     // required to avoid regressions.
 #if DNNL_X64
@@ -910,14 +974,34 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
     rnn.dst_layer_is_trivial_stride = dst_layer_d.blocking_desc().strides[0]
             == (rnn.dst_layer_ld_ * rnn.mb);
 
-    rnn.merge_gemm_layer = !(rnn.is_brgemm || rnn.use_matmul)
+    // A small cell cannot keep all the threads busy. In that case the
+    // independent forward cells of a wavefront of the (layer, iteration) grid
+    // are executed concurrently instead, see linear_execution().
+    constexpr dim_t wavefront_max_cell_work = 1 << 18;
+    const dim_t cell_work = static_cast<dim_t>(rnn.mb) * rnn.n_gates * rnn.dhc
+            * (rnn.slc + rnn.sic);
+    const int max_wavefront_cells
+            = rnn.n_dir * nstl::min(rnn.n_layer, rnn.n_iter);
+    rnn.n_wavefront_cells = rnn.is_fwd && !(rnn.is_brgemm || rnn.use_matmul)
+                    && !rnn.is_lstm_projection && max_wavefront_cells > 1
+                    && cell_work <= wavefront_max_cell_work
+                    && dnnl_get_max_threads() > 1
+            ? max_wavefront_cells
+            : 1;
+
+    // Merged gemms run over the whole n_iter x mb grid and would compute
+    // (or accumulate) the padded positions of variable-length sequences.
+    // They also make each layer depend on all iterations of the previous one,
+    // which defeats the wavefront execution.
+    rnn.merge_gemm_layer = !(rnn.is_brgemm || rnn.use_matmul || rnn.is_varlen
+                                   || rnn.n_wavefront_cells > 1)
             ? ((rnn.is_fwd && rnn.src_layer_is_trivial_stride)
                       || ((rd.prop_kind == prop_kind::backward)
                               && rnn.dst_layer_is_trivial_stride))
                     && (((rnn.is_fwd && rnn.mb < 128) || !rnn.is_fwd)
                             || rnn.is_int8_conf())
             : false;
-    rnn.merge_gemm_iter = !(rnn.is_brgemm || rnn.use_matmul)
+    rnn.merge_gemm_iter = !(rnn.is_brgemm || rnn.use_matmul || rnn.is_varlen)
             ? rnn.dst_layer_is_trivial_stride && !(rnn.is_fwd || is_gru)
             : false;
     rnn.force_nocopy = false;
@@ -1166,9 +1250,10 @@ void set_workspace_sizes(rnn_conf_t &rnn, const rnn_desc_t &rd) {
             : (size_t)0;
     rnn.n_iter_scratch_gates
             = (rnn.merge_gemm_layer || rnn.merge_gemm_iter) ? rnn.n_iter : 1;
+    // Each concurrent cell of a wavefront needs its own scratch buffers
     rnn.scratch_gates_size = sizeof(typename T::scratch_t)
-            * rnn.n_iter_scratch_gates * rnn.scratch_gates_nld
-            * rnn.scratch_gates_ld;
+            * nstl::max(rnn.n_iter_scratch_gates, rnn.n_wavefront_cells)
+            * rnn.scratch_gates_nld * rnn.scratch_gates_ld;
     rnn.scratch_ht_size
             = sizeof(typename T::ht_t) * rnn.scratch_ht_nld * rnn.scratch_ht_ld;
     rnn.scratch_diff_ht_size = rnn.is_training ? sizeof(typename T::gemm_acc_t)
@@ -1180,8 +1265,8 @@ void set_workspace_sizes(rnn_conf_t &rnn, const rnn_desc_t &rd) {
     rnn.scratch_cell_size = (utils::one_of(rd.cell_kind, alg_kind::vanilla_gru,
                                      alg_kind::vanilla_augru, alg_kind::lbr_gru,
                                      alg_kind::lbr_augru)
-                    ? sizeof(typename T::scratch_t) * rnn.scratch_gates_nld
-                            * rnn.scratch_gates_ld
+                    ? sizeof(typename T::scratch_t) * rnn.n_wavefront_cells
+                            * rnn.scratch_gates_nld * rnn.scratch_gates_ld
                     : 0);
     /// workspace needed for lbr GRU
     rnn.ws_per_cell = (size_t)rnn.is_lbr * rnn.mb * rnn.dhc
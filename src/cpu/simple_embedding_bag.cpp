@@ -0,0 +1,242 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <float.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/simple_embedding_bag.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+// How many indices ahead of the current one the rows are prefetched. Every
+// lookup is a cache miss most of the time, so the distance only has to
+// cover the latency of a single row reduction.
+constexpr dim_t prefetch_distance = 8;
+
+inline void prefetch_row(const char *row, dim_t row_bytes) {
+#if defined(__GNUC__) || defined(__clang__)
+    const dim_t cl = platform::get_cache_line_size();
+    for (dim_t off = 0; off < row_bytes; off += cl)
+        __builtin_prefetch(row + off, 0, 3);
+#else
+    UNUSED(row);
+    UNUSED(row_bytes);
+#endif
+}
+
+template <data_type_t dt>
+inline float load_row_value(const char *row, dim_t d) {
+    using data_t = typename prec_traits_t<dt>::type;
+    return static_cast<float>(reinterpret_cast<const data_t *>(row)[d]);
+}
+
+template <>
+inline float load_row_value<data_type::s4>(const char *row, dim_t d) {
+    return io::load_float_value(data_type::s4, row, d);
+}
+
+template <>
+inline float load_row_value<data_type::u4>(const char *row, dim_t d) {
+    return io::load_float_value(data_type::u4, row, d);
+}
+
+void store_row(data_type_t dt, char *dst, const float *acc, dim_t D) {
+    switch (dt) {
+        case data_type::bf16:
+            cvt_float_to_bfloat16(reinterpret_cast<bfloat16_t *>(dst), acc, D);
+            break;
+        case data_type::f16:
+            cvt_float_to_float16(reinterpret_cast<float16_t *>(dst), acc, D);
+            break;
+        default: assert(!"unexpected data type");
+    }
+}
+
+} // namespace
+
+status_t simple_embedding_bag_t::execute(const exec_ctx_t &ctx) const {
+    using namespace data_type;
+    switch (pd()->src_md(0)->data_type) {
+        case f32: return execute_forward<f32>(ctx);
+        case bf16: return execute_forward<bf16>(ctx);
+        case f16: return execute_forward<f16>(ctx);
+        case s8: return execute_forward<s8>(ctx);
+        case u8: return execute_forward<u8>(ctx);
+        case s4: return execute_forward<s4>(ctx);
+        case u4: return execute_forward<u4>(ctx);
+        case f8_e5m2: return execute_forward<f8_e5m2>(ctx);
+        case f8_e4m3: return execute_forward<f8_e4m3>(ctx);
+        default: assert(!"unexpected data type");
+    }
+    return status::runtime_error;
+}
+
+template <data_type_t src_dt>
+status_t simple_embedding_bag_t::execute_forward(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_INDICES);
+    const auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_OFFSETS);
+    const auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const auto scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
+    const auto zero_points = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_SRC);
+
+    const auto &sc = pd()->attr()->scales_;
+    const auto &zp = pd()->attr()->zero_points_;
+    const data_type_t sc_dt = sc.get_data_type(DNNL_ARG_SRC);
+    const data_type_t zp_dt = zp.get_data_type(DNNL_ARG_SRC);
+    const bool per_row_sc = sc.get_mask(DNNL_ARG_SRC) > 0;
+    const bool per_row_zp = zp.get_mask(DNNL_ARG_SRC) > 0;
+
+    const memory_desc_wrapper src_d(pd()->src_md(0));
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+    const data_type_t dst_dt = dst_d.data_type();
+
+    const dim_t R = pd()->R();
+    const dim_t D = pd()->D();
+    const dim_t N = pd()->N();
+    const dim_t B = pd()->B();
+    const alg_kind_t alg = pd()->alg_kind();
+    const bool is_max = alg == alg_kind::reduction_max;
+    const bool is_mean = alg == alg_kind::reduction_mean;
+
+    // Row sizes in bytes. 4-bit rows are byte aligned, see pd_t::layouts_ok().
+    const dim_t src_bits = types::data_type_bits(src_dt);
+    const dim_t src_row_stride
+            = src_d.blocking_desc().strides[0] * src_bits / 8;
+    const dim_t src_row_bytes = D * src_bits / 8;
+    const dim_t dst_row_stride
+            = dst_d.blocking_desc().strides[0] * dst_d.data_type_size();
+    src += src_d.offset0() * src_bits / 8;
+    dst += dst_d.offset0() * dst_d.data_type_size();
+
+    float *acc_base = dst_dt == data_type::f32
+            ? nullptr
+            : ctx.get_scratchpad_grantor().template get<float>(
+                    key_generic_acc);
+
+    // Bags are described by their starting positions, the last one ends with
+    // the indices tensor. Invalid offsets collapse the bag into an empty one.
+    auto bag_begin = [&](dim_t b) {
+        return nstl::min(nstl::max(dim_t(offsets[b]), dim_t(0)), N);
+    };
+    auto bag_end = [&](dim_t b) {
+        const dim_t e = b + 1 < B ? dim_t(offsets[b + 1]) : N;
+        return nstl::min(nstl::max(e, bag_begin(b)), N);
+    };
+
+    // Out-of-range indices are not looked up and make the execution fail.
+    std::atomic<bool> indices_ok(true);
+
+    parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
+        dim_t b_start {0}, b_end {0};
+        balance211(B, nthr, ithr, b_start, b_end);
+        if (b_start == b_end) return;
+
+        // All the indices this thread touches, used to keep prefetching
+        // across bag boundaries.
+        const dim_t i_last = bag_end(b_end - 1);
+        float *tmp_acc = acc_base ? acc_base + ithr * D : nullptr;
+
+        for (dim_t b = b_start; b < b_end; ++b) {
+            char *dst_row = dst + b * dst_row_stride;
+            float *acc = tmp_acc ? tmp_acc : reinterpret_cast<float *>(dst_row);
+
+            const float init = is_max ? -FLT_MAX : 0.f;
+            PRAGMA_OMP_SIMD()
+            for (dim_t d = 0; d < D; ++d)
+                acc[d] = init;
+
+            dim_t count = 0;
+            for (dim_t i = bag_begin(b), e = bag_end(b); i < e; ++i) {
+                const dim_t i_pf = i + prefetch_distance;
+                if (i_pf < i_last) {
+                    const dim_t r_pf = indices[i_pf];
+                    if (r_pf >= 0 && r_pf < R)
+                        prefetch_row(
+                                src + r_pf * src_row_stride, src_row_bytes);
+                }
+
+                const dim_t r = indices[i];
+                if (r < 0 || r >= R) {
+                    indices_ok.store(false, std::memory_order_relaxed);
+                    continue;
+                }
+                ++count;
+
+                float s = scales ? io::load_float_value(
+                                  sc_dt, scales, per_row_sc ? r : 0)
+                                 : 1.f;
+                if (weights) s *= weights[i];
+                const float z = zero_points ? static_cast<float>(
+                                        io::load_int_value(zp_dt, zero_points,
+                                                per_row_zp ? r : 0))
+                                            : 0.f;
+
+                const char *row = src + r * src_row_stride;
+                if (is_max) {
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t d = 0; d < D; ++d)
+                        acc[d] = nstl::max(acc[d],
+                                s * (load_row_value<src_dt>(row, d) - z));
+                } else {
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t d = 0; d < D; ++d)
+                        acc[d] += s * (load_row_value<src_dt>(row, d) - z);
+                }
+            }
+
+            // Empty bags produce zeros for every algorithm.
+            if (count == 0 && is_max) {
+                PRAGMA_OMP_SIMD()
+                for (dim_t d = 0; d < D; ++d)
+                    acc[d] = 0.f;
+            } else if (count > 0 && is_mean) {
+                const float inv_count = 1.f / count;
+                PRAGMA_OMP_SIMD()
+                for (dim_t d = 0; d < D; ++d)
+                    acc[d] *= inv_count;
+            }
+
+            if (tmp_acc) store_row(dst_dt, dst_row, acc, D);
+        }
+    });
+
+    VCONDCHECK(primitive, exec, check, embedding_bag, indices_ok.load(),
+            status::invalid_arguments, "indices are out of range [0, %ld)",
+            (long)R);
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
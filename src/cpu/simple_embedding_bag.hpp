@@ -0,0 +1,160 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_EMBEDDING_BAG_HPP
+#define CPU_SIMPLE_EMBEDDING_BAG_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/cpu_embedding_bag_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Embedding bag for plain row-major tables.
+//
+// Bags are split between threads in contiguous chunks, so every thread walks
+// a contiguous range of indices. The rows addressed by the upcoming indices
+// of that range are prefetched while the current row is being pooled: the
+// lookups are bound by memory latency, and having several row misses in
+// flight at once hides most of it.
+struct simple_embedding_bag_t : public primitive_t {
+    struct pd_t : public cpu_embedding_bag_pd_t {
+        using cpu_embedding_bag_pd_t::cpu_embedding_bag_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_embedding_bag_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+            const auto src_dt = src_md(0)->data_type;
+            const auto dst_dt = dst_md(0)->data_type;
+
+            VDISPATCH_EMBEDDING_BAG(pd_ok(), VERBOSE_INCONSISTENT_PRB);
+            VDISPATCH_EMBEDDING_BAG(utils::one_of(src_dt, f32, bf16, f16, s8,
+                                            u8, s4, u4, f8_e5m2, f8_e4m3),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_EMBEDDING_BAG(utils::one_of(dst_dt, f32, bf16, f16),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_EMBEDDING_BAG(platform::has_data_type_support(src_dt),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_EMBEDDING_BAG(platform::has_data_type_support(dst_dt),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_EMBEDDING_BAG(
+                    attr()->has_default_values(skip_mask_t::scales_data_type
+                            | skip_mask_t::zero_points_data_type),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_EMBEDDING_BAG(
+                    scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
+            VDISPATCH_EMBEDDING_BAG(
+                    zero_points_ok(), VERBOSE_UNSUPPORTED_ZP_CFG);
+            VDISPATCH_EMBEDDING_BAG(
+                    set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_EMBEDDING_BAG(layouts_ok(), VERBOSE_UNSUPPORTED_TAG);
+
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        int nthr_; // To not exceed the limit in execute used for set up.
+
+    private:
+        // Scales are either common or per table row, the latter is what
+        // quantized tables usually come with.
+        bool scales_ok() const {
+            const auto &sc = attr()->scales_;
+            const std::vector<int> supported_args = {DNNL_ARG_SRC};
+            if (!sc.has_default_values(supported_args)) return false;
+            if (sc.has_default_values(DNNL_ARG_SRC)) return true;
+            return utils::one_of(sc.get_mask(DNNL_ARG_SRC), 0, 1 << 0)
+                    && sc.has_default_groups(DNNL_ARG_SRC)
+                    && utils::one_of(sc.get_data_type(DNNL_ARG_SRC),
+                            data_type::f32, data_type::bf16, data_type::f16);
+        }
+
+        bool zero_points_ok() const {
+            const auto &zp = attr()->zero_points_;
+            const std::vector<int> supported_args = {DNNL_ARG_SRC};
+            if (!zp.has_default_values(supported_args)) return false;
+            if (zp.has_default_values(DNNL_ARG_SRC)) return true;
+            return types::is_integral_dt(src_md(0)->data_type)
+                    && utils::one_of(zp.get_mask(DNNL_ARG_SRC), 0, 1 << 0)
+                    && zp.has_default_groups(DNNL_ARG_SRC)
+                    && utils::one_of(zp.get_data_type(DNNL_ARG_SRC),
+                            data_type::s32, data_type::s8, data_type::u8);
+        }
+
+        // The table and the destination must have unit stride along the
+        // embedding dimension, the rest must be dense.
+        bool layouts_ok() const {
+            const memory_desc_wrapper src_d(src_md(0));
+            const memory_desc_wrapper dst_d(dst_md(0));
+            const bool rows_ok = src_d.is_blocking_desc()
+                    && src_d.blocking_desc().inner_nblks == 0
+                    && src_d.blocking_desc().strides[1] == 1
+                    && dst_d.is_blocking_desc()
+                    && dst_d.blocking_desc().inner_nblks == 0
+                    && dst_d.blocking_desc().strides[1] == 1;
+            // Rows of 4-bit tables must start at a byte boundary.
+            const bool subbyte_ok = IMPLICATION(
+                    utils::one_of(src_d.data_type(), data_type::s4,
+                            data_type::u4),
+                    src_d.blocking_desc().strides[0] % 2 == 0);
+            bool dense_ok = memory_desc_wrapper(src_md(1)).is_dense()
+                    && memory_desc_wrapper(src_md(2)).is_dense();
+            if (with_weights())
+                dense_ok = dense_ok
+                        && memory_desc_wrapper(weights_md(0)).is_dense();
+            return rows_ok && subbyte_ok && dense_ok;
+        }
+
+        void init_scratchpad() {
+            nthr_ = dnnl_get_max_threads();
+            // f32 destination is used as an accumulator directly.
+            if (dst_md(0)->data_type == data_type::f32) return;
+
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<float>(
+                    memory_tracking::names::key_generic_acc, D() * nthr_);
+        }
+    };
+
+    simple_embedding_bag_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    template <data_type_t src_dt>
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/simple_rope.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t simple_rope_t::execute(const exec_ctx_t &ctx) const {
+    switch (pd()->src_md(0)->data_type) {
+        case data_type::f32: return execute_forward<data_type::f32>(ctx);
+        case data_type::bf16: return execute_forward<data_type::bf16>(ctx);
+        case data_type::f16: return execute_forward<data_type::f16>(ctx);
+        default: assert(!"unsupported data type");
+    }
+    return status::unimplemented;
+}
+
+template <data_type_t dt>
+status_t simple_rope_t::execute_forward(const exec_ctx_t &ctx) const {
+    using data_t = typename prec_traits_t<dt>::type;
+
+    const auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    const auto cos = CTX_IN_MEM(const float *, DNNL_ARG_COS);
+    const auto sin = CTX_IN_MEM(const float *, DNNL_ARG_SIN);
+    const auto pos = CTX_IN_MEM(const int32_t *, DNNL_ARG_POSITIONS);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md(0));
+    const memory_desc_wrapper cos_d(pd()->src_md(1));
+    const memory_desc_wrapper sin_d(pd()->src_md(2));
+    const memory_desc_wrapper pos_d(pd()->src_md(3));
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+
+    const int ndims = pd()->ndims();
+    const dim_t D = pd()->D();
+    const dim_t H = D / 2;
+    const dim_t P = pd()->P();
+    const dim_t nrows = src_d.nelems() / D;
+    const bool with_positions = pd()->with_positions();
+    const bool interleaved = pd()->is_interleaved();
+
+    const dim_t cos_stride = cos_d.blocking_desc().strides[0];
+    const dim_t sin_stride = sin_d.blocking_desc().strides[0];
+    // Elements of a pair are `pair_stride` apart, pair `i` starts at element
+    // `i * pair_step`.
+    const dim_t pair_stride = interleaved ? 1 : H;
+    const dim_t pair_step = interleaved ? 2 : 1;
+
+    parallel_nd(nrows, [&](dim_t row) {
+        // Logical coordinates of the row, the rotated dimension is 0.
+        dims_t idx {};
+        utils::l_dims_by_l_offset(idx, row * D, src_d.dims(), ndims);
+
+        dim_t p = idx[ndims - 2];
+        if (with_positions) {
+            dims_t pos_idx {};
+            for (int d = 0; d < ndims - 1; ++d)
+                pos_idx[d] = pos_d.dims()[d] == 1 ? 0 : idx[d];
+            p = pos[pos_d.off_v(pos_idx)];
+        }
+        // Out of range positions leave the row untouched.
+        const bool p_ok = p >= 0 && p < P;
+
+        const data_t *src_row = src + src_d.off_v(idx);
+        data_t *dst_row = dst + dst_d.off_v(idx);
+        if (!p_ok) {
+            if (src_row != dst_row)
+                for (dim_t i = 0; i < D; ++i)
+                    dst_row[i] = src_row[i];
+            return;
+        }
+
+        const float *cos_row = cos + cos_d.offset0() + p * cos_stride;
+        const float *sin_row = sin + sin_d.offset0() + p * sin_stride;
+
+        PRAGMA_OMP_SIMD()
+        for (dim_t i = 0; i < H; ++i) {
+            const dim_t i0 = i * pair_step;
+            const dim_t i1 = i0 + pair_stride;
+            const float x0 = static_cast<float>(src_row[i0]);
+            const float x1 = static_cast<float>(src_row[i1]);
+            dst_row[i0]
+                    = static_cast<data_t>(x0 * cos_row[i] - x1 * sin_row[i]);
+            dst_row[i1]
+                    = static_cast<data_t>(x1 * cos_row[i] + x0 * sin_row[i]);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,113 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_ROPE_HPP
+#define CPU_SIMPLE_ROPE_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/cpu_rope_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Rotary position embedding for tensors with a unit-stride innermost
+// dimension.
+//
+// Rows (all dimensions but the rotated one) are distributed between threads
+// and every row is rotated with the angles of its position. Both elements of
+// a pair are read before either is written, so the primitive can be executed
+// in place.
+struct simple_rope_t : public primitive_t {
+    struct pd_t : public cpu_rope_pd_t {
+        using cpu_rope_pd_t::cpu_rope_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_rope_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+
+            const auto src_dt = src_md(0)->data_type;
+
+            VDISPATCH_ROPE(pd_ok(), VERBOSE_INCONSISTENT_PRB);
+            VDISPATCH_ROPE(utils::one_of(src_dt, f32, bf16, f16),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_ROPE(dst_md(0)->data_type == src_dt,
+                    VERBOSE_INCONSISTENT_DT, "src", "dst");
+            VDISPATCH_ROPE(src_md(1)->data_type == f32
+                            && src_md(2)->data_type == f32,
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_ROPE(platform::has_data_type_support(src_dt),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_ROPE(
+                    attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_ROPE(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_ROPE(layouts_ok(), VERBOSE_UNSUPPORTED_TAG);
+
+            return status::success;
+        }
+
+    private:
+        // The rotated dimension must have unit stride in the source and the
+        // destination, any strides are allowed for the rest. The tables are
+        // plain row-major matrices.
+        bool layouts_ok() const {
+            const int last = ndims() - 1;
+            const memory_desc_wrapper src_d(src_md(0));
+            const memory_desc_wrapper dst_d(dst_md(0));
+            bool ok = src_d.is_blocking_desc()
+                    && src_d.blocking_desc().inner_nblks == 0
+                    && src_d.blocking_desc().strides[last] == 1
+                    && dst_d.is_blocking_desc()
+                    && dst_d.blocking_desc().inner_nblks == 0
+                    && dst_d.blocking_desc().strides[last] == 1;
+            for (int i : {1, 2}) {
+                const memory_desc_wrapper t_d(src_md(i));
+                ok = ok && t_d.is_blocking_desc()
+                        && t_d.blocking_desc().inner_nblks == 0
+                        && t_d.blocking_desc().strides[1] == 1;
+            }
+            if (with_positions()) {
+                const memory_desc_wrapper pos_d(src_md(3));
+                ok = ok && pos_d.is_blocking_desc()
+                        && pos_d.blocking_desc().inner_nblks == 0;
+            }
+            return ok;
+        }
+    };
+
+    simple_rope_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    template <data_type_t dt>
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,183 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/simple_topk.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+using candidate_t = simple_topk_t::candidate_t;
+
+// Candidates are ordered by value, ties are broken by the smaller index.
+bool is_better(const candidate_t &a, const candidate_t &b) {
+    return a.value > b.value || (a.value == b.value && a.index < b.index);
+}
+
+// Number of elements the softmax statistics are updated for at once. The
+// tile is re-read from L1 for the second pass.
+constexpr dim_t stats_tile = 1024;
+} // namespace
+
+status_t simple_topk_t::execute(const exec_ctx_t &ctx) const {
+    switch (pd()->src_md(0)->data_type) {
+        case data_type::f32: return execute_forward<data_type::f32>(ctx);
+        case data_type::bf16: return execute_forward<data_type::bf16>(ctx);
+        case data_type::f16: return execute_forward<data_type::f16>(ctx);
+        default: assert(!"unsupported data type");
+    }
+    return status::unimplemented;
+}
+
+template <data_type_t dt>
+status_t simple_topk_t::execute_forward(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+    using data_t = typename prec_traits_t<dt>::type;
+
+    const auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    auto indices = CTX_OUT_MEM(int32_t *, DNNL_ARG_DST_INDICES);
+
+    const memory_desc_wrapper src_d(pd()->src_md(0));
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+    const memory_desc_wrapper idx_d(pd()->dst_md(1));
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto cand = scratchpad.template get<candidate_t>(key_topk_candidates);
+    auto stats = scratchpad.template get<float>(key_topk_stats);
+
+    const int ndims = pd()->ndims();
+    const dim_t N = pd()->N();
+    const dim_t K = pd()->K();
+    const dim_t nrows = pd()->nrows();
+    const dim_t nchunks = pd()->nchunks_;
+    const dim_t chunk_size = pd()->chunk_size_;
+    const bool with_softmax = pd()->with_softmax();
+    const float inv_t = with_softmax ? 1.f / pd()->temperature() : 1.f;
+    const float neg_inf = -std::numeric_limits<float>::infinity();
+
+    // Logical coordinates of a row, the innermost dimension is 0.
+    auto row_idx = [&](dim_t row, dims_t idx) {
+        utils::l_dims_by_l_offset(idx, row * N, src_d.dims(), ndims);
+    };
+
+    parallel_nd(nrows, nchunks, [&](dim_t row, dim_t c) {
+        dims_t idx {};
+        row_idx(row, idx);
+        const data_t *src_row = src + src_d.off_v(idx);
+
+        const dim_t beg = c * chunk_size;
+        const dim_t end = nstl::min(N, beg + chunk_size);
+        candidate_t *heap = cand + (row * nchunks + c) * K;
+        dim_t size = 0;
+        float max = neg_inf, sum = 0.f;
+
+        for (dim_t tile_beg = beg; tile_beg < end; tile_beg += stats_tile) {
+            const dim_t tile_end = nstl::min(end, tile_beg + stats_tile);
+
+            // The worst of the k best candidates is on the top of the heap.
+            // Elements are visited in the order of their indices, so an
+            // element equal to the top never replaces it.
+            for (dim_t i = tile_beg; i < tile_end; ++i) {
+                const float v = static_cast<float>(src_row[i]);
+                if (size < K) {
+                    heap[size++] = {v, static_cast<int32_t>(i)};
+                    if (size == K) std::make_heap(heap, heap + K, is_better);
+                } else if (v > heap[0].value) {
+                    std::pop_heap(heap, heap + K, is_better);
+                    heap[K - 1] = {v, static_cast<int32_t>(i)};
+                    std::push_heap(heap, heap + K, is_better);
+                }
+            }
+
+            if (!with_softmax) continue;
+
+            float tile_max = neg_inf;
+            PRAGMA_OMP_SIMD(reduction(max : tile_max))
+            for (dim_t i = tile_beg; i < tile_end; ++i)
+                tile_max = nstl::max(tile_max, static_cast<float>(src_row[i]));
+            const float new_max = nstl::max(max, tile_max);
+            if (new_max == neg_inf) continue;
+
+            float tile_sum = 0.f;
+            PRAGMA_OMP_SIMD(reduction(+ : tile_sum))
+            for (dim_t i = tile_beg; i < tile_end; ++i)
+                tile_sum += ::expf(
+                        (static_cast<float>(src_row[i]) - new_max) * inv_t);
+            sum = sum * ::expf((max - new_max) * inv_t) + tile_sum;
+            max = new_max;
+        }
+
+        // The last chunk may be shorter than k. The padding loses to any
+        // element, including -inf.
+        for (; size < K; ++size)
+            heap[size] = {neg_inf, std::numeric_limits<int32_t>::max()};
+
+        if (with_softmax) {
+            stats[2 * (row * nchunks + c) + 0] = max;
+            stats[2 * (row * nchunks + c) + 1] = sum;
+        }
+    });
+
+    parallel_nd(nrows, [&](dim_t row) {
+        candidate_t *row_cand = cand + row * nchunks * K;
+        std::partial_sort(
+                row_cand, row_cand + K, row_cand + nchunks * K, is_better);
+
+        float max = neg_inf, sum = 0.f;
+        if (with_softmax) {
+            const float *row_stats = stats + 2 * row * nchunks;
+            for (dim_t c = 0; c < nchunks; ++c)
+                max = nstl::max(max, row_stats[2 * c]);
+            for (dim_t c = 0; c < nchunks; ++c) {
+                if (row_stats[2 * c] == neg_inf) continue;
+                sum += row_stats[2 * c + 1]
+                        * ::expf((row_stats[2 * c] - max) * inv_t);
+            }
+        }
+
+        dims_t idx {};
+        row_idx(row, idx);
+        const dim_t dst_off = dst_d.off_v(idx);
+        int32_t *idx_row = indices + idx_d.off_v(idx);
+        for (dim_t j = 0; j < K; ++j) {
+            float v = row_cand[j].value;
+            if (with_softmax)
+                v = sum > 0.f ? ::expf((v - max) * inv_t) / sum : 0.f;
+            io::store_float_value(dst_d.data_type(), v, dst, dst_off + j);
+            idx_row[j] = row_cand[j].index;
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,141 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_TOPK_HPP
+#define CPU_SIMPLE_TOPK_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/cpu_topk_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Top-k selection over a unit-stride innermost dimension.
+//
+// Every row is split into chunks so that a single long row (e.g. the logits
+// of a large vocabulary at batch 1) still keeps all the threads busy. Each
+// chunk keeps its k best candidates in a heap and, if softmax is requested,
+// the running maximum and sum of exponents. The candidates and statistics of
+// all chunks of a row are merged at the end, so the source is read only
+// once.
+struct simple_topk_t : public primitive_t {
+    struct candidate_t {
+        float value;
+        int32_t index;
+    };
+
+    struct pd_t : public cpu_topk_pd_t {
+        using cpu_topk_pd_t::cpu_topk_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_topk_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+
+            const auto src_dt = src_md(0)->data_type;
+            const auto dst_dt = dst_md(0)->data_type;
+
+            VDISPATCH_TOPK(pd_ok(), VERBOSE_INCONSISTENT_PRB);
+            VDISPATCH_TOPK(utils::one_of(src_dt, f32, bf16, f16),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_TOPK(utils::one_of(dst_dt, f32, bf16, f16),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_TOPK(platform::has_data_type_support(src_dt)
+                            && platform::has_data_type_support(dst_dt),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_TOPK(
+                    attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_TOPK(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_TOPK(layouts_ok(), VERBOSE_UNSUPPORTED_TAG);
+
+            init_conf();
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        // Number of chunks every row is split into.
+        dim_t nchunks_ = 1;
+        // Number of elements in a chunk, the last one may be shorter.
+        dim_t chunk_size_ = 0;
+
+    private:
+        void init_conf() {
+            // Chunks shorter than this don't pay for the merge.
+            const dim_t min_chunk_size = nstl::max<dim_t>(4096, 4 * K());
+            const dim_t nthr = dnnl_get_max_threads();
+            const dim_t rows = nrows();
+
+            nchunks_ = 1;
+            if (rows < nthr)
+                nchunks_ = nstl::min(utils::div_up(nthr, rows),
+                        utils::div_up(N(), min_chunk_size));
+            nchunks_ = nstl::max<dim_t>(nchunks_, 1);
+            chunk_size_ = utils::div_up(N(), nchunks_);
+            nchunks_ = utils::div_up(N(), chunk_size_);
+        }
+
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<candidate_t>(
+                    key_topk_candidates, nrows() * nchunks_ * K());
+            // Maximum and sum of exponents per chunk.
+            if (with_softmax())
+                scratchpad.template book<float>(
+                        key_topk_stats, 2 * nrows() * nchunks_);
+        }
+
+        // The innermost dimension must have unit stride, any strides are
+        // allowed for the rest.
+        bool layouts_ok() const {
+            const int last = ndims() - 1;
+            bool ok = true;
+            for (const auto *md : {src_md(0), dst_md(0), dst_md(1)}) {
+                const memory_desc_wrapper mdw(md);
+                ok = ok && mdw.is_blocking_desc()
+                        && mdw.blocking_desc().inner_nblks == 0
+                        && mdw.blocking_desc().strides[last] == 1;
+            }
+            return ok;
+        }
+    };
+
+    simple_topk_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    template <data_type_t dt>
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -308,6 +308,11 @@ struct brgemm_desc_t {
     bool skip_wei_scales = false;
     int is_oc_scale = 0;
     bool with_src_scales = false;
+    // `is_bcast_src_scale` is controlled by the implementation and not by
+    // kernel API. It makes src scales hold a value per row of the bcast
+    // dimension instead of a single one. Supported by the post-ops kernel
+    // only.
+    bool is_bcast_src_scale = false;
     bool with_wei_scales = false;
     // `dst_scales` passed as a bare pointer making kernel change multiplication
     // to division was proved to be significantly slower, both for pure divps
@@ -692,7 +692,7 @@ dnnl_status_t jump_to_gemm_smalln_tn(
     if ((arg->n < 16 && arg->n > 1 && arg->transa == do_trans
                 && arg->transb != do_trans)
             && mayiuse(avx512_core) && __BUILD_GEMM_AVX512
-            && arg->co == nullptr) {
+            && arg->co == nullptr && arg->packing == pack_type::none) {
         auto transa_char = (arg->transa != do_trans) ? "N" : "T";
         auto transb_char = (arg->transb != do_trans) ? "N" : "T";
         return jit_avx512_core_gemm_smalln_tn_f32(transa_char, transb_char,
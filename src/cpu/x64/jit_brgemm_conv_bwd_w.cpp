@@ -45,9 +45,14 @@ status_t brgemm_convolution_bwd_weights_t::pd_t::init(engine_t *engine) {
     const auto diff_bia_type = diff_weights_md(1)->data_type;
     const auto diff_dst_type = diff_dst_md(0)->data_type;
     VDISPATCH_CONV(is_bwd_w(), VERBOSE_BAD_PROPKIND);
-    VDISPATCH_CONV(utils::one_of(src_type, bf16, f16, f8_e5m2, f8_e4m3),
+    VDISPATCH_CONV(utils::one_of(src_type, f32, bf16, f16, f8_e5m2, f8_e4m3),
             VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_CONV(diff_dst_type == src_type, VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_CONV(IMPLICATION(src_type == f32,
+                           diff_wei_type == f32
+                                   && utils::one_of(diff_bia_type,
+                                           data_type::undef, f32)),
+            VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_CONV(
             utils::one_of(diff_wei_type, f32, f8_e5m2, f8_e4m3, src_type),
             VERBOSE_UNSUPPORTED_DT);
@@ -252,6 +257,99 @@ status_t brgemm_convolution_bwd_weights_t::add_brg_kernel(
     return status::success;
 }
 
+namespace {
+// Sums up the rows of transposed f32 diff_dst into the diff bias of an oc
+// block. f32 data has no vnni interleaving, so AVX2 instructions suffice and
+// the kernel runs on Intel AVX-512 as well.
+struct jit_brgemm_conv_bwd_bias_f32_kernel_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_conv_bwd_bias_f32_kernel_t)
+
+    jit_brgemm_conv_bwd_bias_f32_kernel_t(const jit_conv_conf_t &ajcp)
+        : jit_generator_t(jit_name(), avx2), jcp(ajcp) {}
+
+private:
+    static constexpr int simd_w = 8;
+    static constexpr int typesize = sizeof(float);
+    // Number of rows summed up per loop iteration.
+    static constexpr int unroll = 2;
+
+    const jit_conv_conf_t &jcp;
+
+    const Xbyak::Reg64 reg_ddst = r8;
+    const Xbyak::Reg64 reg_bias = r9;
+    const Xbyak::Reg64 reg_nrows = r10;
+    const Xbyak::Reg64 reg_tmp = r11;
+
+    Xbyak::Ymm vreg_acc(int u, int g) const {
+        return Xbyak::Ymm(u * (jcp.oc_block / simd_w) + g);
+    }
+
+    void generate() override;
+};
+
+#define GET_OFF(field) offsetof(jit_conv_args_t, field)
+void jit_brgemm_conv_bwd_bias_f32_kernel_t::generate() {
+    assert(jcp.oc_block % simd_w == 0 && jcp.nb_oc_blocking == 1);
+    const int nvregs = jcp.oc_block / simd_w;
+    const size_t row_size = jcp.oc_block * typesize;
+
+    preamble();
+
+    Xbyak::Label row_loop, row_tail, store, end;
+    mov(reg_nrows, ptr[param1 + GET_OFF(os_index_end)]);
+    sub(reg_nrows, ptr[param1 + GET_OFF(os_index_begin)]);
+    cmp(reg_nrows, 0);
+    jle(end, T_NEAR); // nothing to do
+    imul(reg_nrows, reg_nrows, jcp.tr_ow);
+
+    mov(reg_ddst, ptr[param1 + GET_OFF(dst)]);
+    mov(reg_bias, ptr[param1 + GET_OFF(bias)]);
+
+    for (int u = 0; u < unroll; u++)
+        for (int g = 0; g < nvregs; g++)
+            uni_vpxor(vreg_acc(u, g), vreg_acc(u, g), vreg_acc(u, g));
+    // the diff bias is initialized by the first spatial block of a channel
+    Xbyak::Label skip_bias_load;
+    mov(reg_tmp, ptr[param1 + GET_OFF(channel)]);
+    cmp(reg_tmp, 0);
+    jne(skip_bias_load, T_NEAR);
+    for (int g = 0; g < nvregs; g++)
+        vmovups(vreg_acc(0, g), ptr[reg_bias + g * simd_w * typesize]);
+    L(skip_bias_load);
+
+    L(row_loop);
+    {
+        cmp(reg_nrows, unroll);
+        jl(row_tail, T_NEAR);
+        for (int u = 0; u < unroll; u++)
+            for (int g = 0; g < nvregs; g++)
+                vaddps(vreg_acc(u, g), vreg_acc(u, g),
+                        ptr[reg_ddst + u * row_size + g * simd_w * typesize]);
+        add(reg_ddst, unroll * row_size);
+        sub(reg_nrows, unroll);
+        jmp(row_loop, T_NEAR);
+    }
+    L(row_tail);
+    {
+        cmp(reg_nrows, 0);
+        je(store, T_NEAR);
+        for (int g = 0; g < nvregs; g++)
+            vaddps(vreg_acc(0, g), vreg_acc(0, g),
+                    ptr[reg_ddst + g * simd_w * typesize]);
+    }
+    L(store);
+    for (int g = 0; g < nvregs; g++) {
+        for (int u = 1; u < unroll; u++)
+            vaddps(vreg_acc(0, g), vreg_acc(0, g), vreg_acc(u, g));
+        vmovups(ptr[reg_bias + g * simd_w * typesize], vreg_acc(0, g));
+    }
+
+    L(end);
+    postamble();
+}
+#undef GET_OFF
+} // namespace
+
 status_t brgemm_convolution_bwd_weights_t::init(engine_t *engine) {
     const auto _pd = pd();
     const auto &jcp = _pd->jcp_;
@@ -263,8 +361,12 @@ status_t brgemm_convolution_bwd_weights_t::init(engine_t *engine) {
     CHECK(trans_dst_kernel_->create_kernel());
 
     if (jcp.with_bias) {
-        CHECK(safe_ptr_assign(diff_bias_kernel_,
-                new jit_avx512_core_amx_bwd_bias_kernel_t(jit_jcp)));
+        if (jcp.src_dt == f32)
+            CHECK(safe_ptr_assign(diff_bias_kernel_,
+                    new jit_brgemm_conv_bwd_bias_f32_kernel_t(jit_jcp)));
+        else
+            CHECK(safe_ptr_assign(diff_bias_kernel_,
+                    new jit_avx512_core_amx_bwd_bias_kernel_t(jit_jcp)));
         CHECK(diff_bias_kernel_->create_kernel());
     }
 
@@ -445,7 +547,9 @@ struct brgemm_convolution_bwd_weights_t::thread_info_t {
 
         auto wsp_tile_global
                 = scratchpad.template get<char>(key_conv_amx_tile_buffer);
-        wsp_tile = wsp_tile_global + ithr * 2 * brgemm_convolution_utils::P4K;
+        wsp_tile = wsp_tile_global
+                ? wsp_tile_global + ithr * 2 * brgemm_convolution_utils::P4K
+                : nullptr;
     }
 
     const pd_t *pd() const { return self->pd(); }
@@ -848,12 +952,29 @@ void brgemm_convolution_bwd_weights_t::call_brgemm_kernel(
     const auto brg_ker = brg_kernels_[brg_idx];
     assert(brg_ker != nullptr);
 
-    brgemm_palettes_.maybe_tile_configure(true, btc.cur_brg_idx, brg_idx);
+    const bool is_amx = brgemm_convolution_utils::is_amx(pd()->jcp_.isa);
+    if (!is_amx && batch_size == 0) {
+        // Only the AMX kernel supports an empty batch, here the output is
+        // initialized explicitly
+        const auto brg = (*pd()->brgs_)[brg_idx];
+        if (brg->beta != 0.f) return;
+        for (dim_t m = 0; m < brg->bcast_dim; m++)
+            std::memset(static_cast<float *>(ptr_C) + m * brg->LDC, 0,
+                    brg->load_dim * sizeof(float));
+        return;
+    }
+
+    brgemm_palettes_.maybe_tile_configure(is_amx, btc.cur_brg_idx, brg_idx);
 
     brgemm_kernel_execute(brg_ker, batch_size, btc.brg_batch, ptr_C,
             static_cast<void *>(btc.wsp_tile));
 }
 
+void brgemm_convolution_bwd_weights_t::compute_diff_bias(
+        const jit_conv_args_t &p) const {
+    (*diff_bias_kernel_)(&p);
+}
+
 void brgemm_convolution_bwd_weights_t::compute_diff_weights_2d(
         thread_info_t *ti) const {
 
@@ -997,7 +1118,7 @@ void brgemm_convolution_bwd_weights_t::compute_diff_weights_2d(
 
                         bp.dst = p_dst;
 
-                        (*diff_bias_kernel_)(&bp);
+                        compute_diff_bias(bp);
                     }
 
                     if (ti->g_start == ti->g_end
@@ -1193,7 +1314,7 @@ void brgemm_convolution_bwd_weights_t::compute_diff_weights_3d(
                                                   + (ohb_s - oh_s))
                                         * jcp.tr_ow * jcp.oc_block;
                                 bp.dst = p_dst + dst_idx * jcp.dst_dsz;
-                                (*diff_bias_kernel_)(&bp);
+                                compute_diff_bias(bp);
                             }
                         }
 
@@ -1555,7 +1676,7 @@ void brgemm_convolution_bwd_weights_t::execute_backward_weights(
             default: assert(!"Invalid harness type");
         }
 
-        amx_tile_release();
+        if (brgemm_convolution_utils::is_amx(jcp.isa)) amx_tile_release();
     });
 
     if (!jcp.global_transpose) {
@@ -134,6 +134,7 @@ private:
 
     void execute_backward_weights(const exec_ctx_t &ctx) const;
     void prepare_scratchpad_data(const exec_ctx_t &ctx) const;
+    void compute_diff_bias(const jit_conv_args_t &p) const;
     void compute_diff_weights_2d(thread_info_t *) const;
     void compute_diff_weights_3d(thread_info_t *) const;
     void reduce_and_convert_diff_weights_and_bias(thread_info_t *) const;
@@ -146,7 +147,7 @@ private:
     std::unique_ptr<jit_diff_wei_trans_to_vnni_t> diff_wei_trans_kernel_;
     std::unique_ptr<jit_trans_src_t> trans_kernel_;
     std::unique_ptr<jit_trans_dst_t> trans_dst_kernel_;
-    std::unique_ptr<jit_avx512_core_amx_bwd_bias_kernel_t> diff_bias_kernel_;
+    std::unique_ptr<jit_generator_t> diff_bias_kernel_;
 
     brgemm_containers::brgemm_kernel_container_t brg_kernels_;
     brgemm_containers::brgemm_palette_container_t brgemm_palettes_;
@@ -3139,15 +3139,26 @@ status_t init_conf_bwd_w(jit_brgemm_conv_conf_t &jcp,
     const memory_desc_wrapper diff_dst_d(&diff_dst_md);
     const memory_desc_wrapper diff_bias_d(&diff_bias_md);
 
+    const bool is_f32 = src_d.data_type() == data_type::f32;
+    const bool is_bf16 = src_d.data_type() == data_type::bf16;
     const bool is_f16 = src_d.data_type() == data_type::f16;
 
     const auto is_fp8 = one_of(src_d.data_type(), f8_e5m2, f8_e4m3)
             && one_of(diff_weights_d.data_type(), f32, f16, f8_e5m2, f8_e4m3)
             && one_of(diff_dst_d.data_type(), f8_e5m2, f8_e4m3);
 
-    jcp.isa = is_fp8
-            ? (mayiuse(avx10_2_amx_2) ? avx10_2_amx_2 : avx512_core_amx_fp16)
-            : (is_f16 ? avx512_core_amx_fp16 : avx512_core_amx);
+    // f32 and bf16 fall back to the non-AMX brgemm kernels when the tiles
+    // are not available
+    if (is_fp8)
+        jcp.isa = mayiuse(avx10_2_amx_2) ? avx10_2_amx_2 : avx512_core_amx_fp16;
+    else if (is_f16)
+        jcp.isa = avx512_core_amx_fp16;
+    else if (is_bf16)
+        jcp.isa = mayiuse(avx512_core_amx) ? avx512_core_amx : avx512_core_bf16;
+    else if (is_f32)
+        jcp.isa = mayiuse(avx512_core) ? avx512_core : avx2;
+    else
+        return status::unimplemented;
 
     // disabling verbose dispatch messages for unsupported isa for better readability
     if (!mayiuse(jcp.isa)) return status::unimplemented;
@@ -3160,8 +3171,10 @@ status_t init_conf_bwd_w(jit_brgemm_conv_conf_t &jcp,
 
     jcp.max_batch = jcp.od * jcp.oh;
     jcp.brg_type = brgemm_addr; // TODO: Choose right type of BRGEMM
-    jcp.use_uker = true;
-    jcp.var_bs = true;
+    // The unrolled kernel with variable batch size is AMX-only, the regular
+    // kernels take the batch size at execution time
+    jcp.use_uker = is_amx(jcp.isa);
+    jcp.var_bs = is_amx(jcp.isa);
 
     // Process some 1x1 convolutions with small iw as 1d (h=1, w = h*w)
     // convolutions to make brgemm K dimension bigger for better utilization of
@@ -3214,6 +3227,14 @@ status_t init_conf_bwd_w(jit_brgemm_conv_conf_t &jcp,
             format_tag::nhwc, format_tag::ndhwc);
     format_tag_t dat_tag_opt = dat_tag_nspc;
 
+    // Without AMX the blocked layouts stay with the direct kernels, so only
+    // explicitly requested channels-last activations are taken here
+    VDISPATCH_CONV_IC(IMPLICATION(!is_amx(jcp.isa),
+                              src_d.format_kind() != format_kind::any
+                                      && diff_dst_d.format_kind()
+                                              != format_kind::any),
+            VERBOSE_UNSUPPORTED_TAG);
+
     if (src_d.format_kind() == format_kind::any) {
         CHECK(memory_desc_init_by_tag(src_md, dat_tag_opt));
         jcp.src_tag = dat_tag_opt;
@@ -3282,8 +3303,10 @@ status_t init_conf_bwd_w(jit_brgemm_conv_conf_t &jcp,
     jcp.ic_tail = jcp.ic % jcp.ic_block;
     jcp.oc_tail = jcp.oc % jcp.oc_block;
 
-    jcp.nb_oc_blocking = (jcp.nb_oc > 1) ? 2 : 1;
-    jcp.nb_ic_blocking = (jcp.nb_ic > 1) ? 2 : 1;
+    // Only the AMX kernel can write two discontiguous weights blocks per call
+    // (see LDC2_M and LDC2_N brgemm attributes)
+    jcp.nb_oc_blocking = (is_amx(jcp.isa) && jcp.nb_oc > 1) ? 2 : 1;
+    jcp.nb_ic_blocking = (is_amx(jcp.isa) && jcp.nb_ic > 1) ? 2 : 1;
 
     const bool is_2d = (ndims == 4);
     const bool is_3d = (ndims == 5);
@@ -3306,7 +3329,7 @@ status_t init_conf_bwd_w(jit_brgemm_conv_conf_t &jcp,
     const auto rnd_val = jcp.vnni_block;
     jcp.tr_src_num_guard_elems = tr_pad; // upper bound
     jcp.tr_ow = rnd_up(jcp.ow, rnd_val);
-    if (jcp.tr_ow > tr_round) {
+    if (is_amx(jcp.isa) && jcp.tr_ow > tr_round) {
         // we may increase tr_ow to have better bd_block in brgemm kernel
         int best_bdb = jcp.tr_ow / rnd_val;
         int best_tr_ow = jcp.tr_ow;
@@ -3528,7 +3551,8 @@ status_t init_scratchpad_bwd_w(memory_tracking::registrar_t &scratchpad,
         scratchpad.book(key_conv_padded_bias,
                 jcp.ngroups * jcp.nb_oc * jcp.oc_block, jcp.bia_dsz);
     }
-    scratchpad.book(key_conv_amx_tilecfg, 1, 64); // 1 whole cacheline
+    if (is_amx(jcp.isa))
+        scratchpad.book(key_conv_amx_tilecfg, 1, 64); // 1 whole cacheline
 
     constexpr size_t scratchpad_limit_by_absolute_value = (size_t)32
             << 30; // 32Gb - TODO: may it's too large?
@@ -3542,8 +3566,9 @@ status_t init_scratchpad_bwd_w(memory_tracking::registrar_t &scratchpad,
             static_cast<size_t>(jcp.nthr) * jcp.adjusted_batch_size,
             sizeof(brgemm_batch_element_t), 64, P4K);
 
-    scratchpad.book(
-            key_conv_amx_tile_buffer, jcp.nthr * 2 * P4K, sizeof(char), 0, P4K);
+    if (is_amx(jcp.isa))
+        scratchpad.book(key_conv_amx_tile_buffer, jcp.nthr * 2 * P4K,
+                sizeof(char), 0, P4K);
 
     VDISPATCH_CONV_IC(
             scratchpad.size() <= scratchpad_limit, VERBOSE_SCRATCHPAD_LIMIT);
@@ -803,16 +803,23 @@ void dnnl::impl::cpu::x64::jit_brgemm_kernel_post_ops_t<Vmm>::apply_post_ops(
     if (brg_.beta != 0 && brg_.with_src_scales) {
         mov(aux_reg_src_scales, ptr[rsp + reg_src_scales_offs_]);
         auto vmm_src_scales = vmm_tmp(0);
-        if (!has_ptr_b_support)
-            vbroadcastss(vmm_src_scales, ptr[aux_reg_src_scales]);
+        const int src_scales_m_stride
+                = brg_.is_bcast_src_scale * sizeof(float);
 
-        for_(int m = 0; m < m_block; m++)
-        for (int n = 0; n < n_block; n++) {
-            auto vmm = vector(m, n);
-            if (has_ptr_b_support) {
-                vmulps(vmm, vmm, ptr_b[aux_reg_src_scales]);
-            } else {
-                vmulps(vmm, vmm, vmm_src_scales);
+        for (int m = 0; m < m_block; m++) {
+            const auto src_scales_off = m * src_scales_m_stride;
+            if (!has_ptr_b_support && (m == 0 || brg_.is_bcast_src_scale))
+                vbroadcastss(vmm_src_scales,
+                        ptr[aux_reg_src_scales + src_scales_off]);
+
+            for (int n = 0; n < n_block; n++) {
+                auto vmm = vector(m, n);
+                if (has_ptr_b_support) {
+                    vmulps(vmm, vmm,
+                            ptr_b[aux_reg_src_scales + src_scales_off]);
+                } else {
+                    vmulps(vmm, vmm, vmm_src_scales);
+                }
             }
         }
     }
@@ -1203,6 +1210,11 @@ void dnnl::impl::cpu::x64::jit_brgemm_kernel_post_ops_t<Vmm>::generate() {
                 add(reg_s8s8_comp, mb_compensation_offset(m_block));
                 mov(ptr[rsp + reg_s8s8_comp_offs_], reg_s8s8_comp);
             }
+            if (brg_.with_src_scales && brg_.is_bcast_src_scale) {
+                mov(reg_src_scales, ptr[rsp + reg_src_scales_offs_]);
+                add(reg_src_scales, sizeof(float) * m_block);
+                mov(ptr[rsp + reg_src_scales_offs_], reg_src_scales);
+            }
         }
         add(reg_out, out_typesize_ * (m_block * brg_.LDD));
     }
@@ -0,0 +1,632 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/injectors/jit_uni_binary_injector.hpp"
+#include "cpu/x64/jit_brgemm_wino_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+
+namespace {
+constexpr int max_alpha = 8;
+// Number of channels transformed at once.
+constexpr int simd_w = 16;
+
+// Transform matrices of F(4x4, 3x3) built from the interpolation points
+// 0, 1, -1, 2, -2 and infinity.
+constexpr float AT_4x4[4 * 6] = {
+        1.f, 1.f, 1.f, 1.f, 1.f, 0.f, //
+        0.f, 1.f, -1.f, 2.f, -2.f, 0.f, //
+        0.f, 1.f, 1.f, 4.f, 4.f, 0.f, //
+        0.f, 1.f, -1.f, 8.f, -8.f, 1.f, //
+};
+constexpr float G_4x4[6 * 3] = {
+        1.f / 4, 0.f, 0.f, //
+        -1.f / 6, -1.f / 6, -1.f / 6, //
+        -1.f / 6, 1.f / 6, -1.f / 6, //
+        1.f / 24, 1.f / 12, 1.f / 6, //
+        1.f / 24, -1.f / 12, 1.f / 6, //
+        0.f, 0.f, 1.f, //
+};
+constexpr float BT_4x4[6 * 6] = {
+        4.f, 0.f, -5.f, 0.f, 1.f, 0.f, //
+        0.f, -4.f, -4.f, 1.f, 1.f, 0.f, //
+        0.f, 4.f, -4.f, -1.f, 1.f, 0.f, //
+        0.f, -2.f, -1.f, 2.f, 1.f, 0.f, //
+        0.f, 2.f, -1.f, -2.f, 1.f, 0.f, //
+        0.f, 4.f, 0.f, -5.f, 0.f, 1.f, //
+};
+
+// Transform matrices of F(6x6, 3x3) built from the interpolation points
+// 0, 1, -1, 2, -2, 1/2, -1/2 and infinity.
+constexpr float AT_6x6[6 * 8] = {
+        1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 0.f, //
+        0.f, 1.f, -1.f, 2.f, -2.f, 1.f / 2, -1.f / 2, 0.f, //
+        0.f, 1.f, 1.f, 4.f, 4.f, 1.f / 4, 1.f / 4, 0.f, //
+        0.f, 1.f, -1.f, 8.f, -8.f, 1.f / 8, -1.f / 8, 0.f, //
+        0.f, 1.f, 1.f, 16.f, 16.f, 1.f / 16, 1.f / 16, 0.f, //
+        0.f, 1.f, -1.f, 32.f, -32.f, 1.f / 32, -1.f / 32, 1.f, //
+};
+constexpr float G_6x6[8 * 3] = {
+        -1.f, 0.f, 0.f, //
+        -2.f / 9, -2.f / 9, -2.f / 9, //
+        -2.f / 9, 2.f / 9, -2.f / 9, //
+        1.f / 90, 1.f / 45, 2.f / 45, //
+        1.f / 90, -1.f / 45, 2.f / 45, //
+        32.f / 45, 16.f / 45, 8.f / 45, //
+        32.f / 45, -16.f / 45, 8.f / 45, //
+        0.f, 0.f, 1.f, //
+};
+constexpr float BT_6x6[8 * 8] = {
+        -1.f, 0.f, 21.f / 4, 0.f, -21.f / 4, 0.f, 1.f, 0.f, //
+        0.f, 1.f, 1.f, -17.f / 4, -17.f / 4, 1.f, 1.f, 0.f, //
+        0.f, -1.f, 1.f, 17.f / 4, -17.f / 4, -1.f, 1.f, 0.f, //
+        0.f, 1.f / 2, 1.f / 4, -5.f / 2, -5.f / 4, 2.f, 1.f, 0.f, //
+        0.f, -1.f / 2, 1.f / 4, 5.f / 2, -5.f / 4, -2.f, 1.f, 0.f, //
+        0.f, 2.f, 4.f, -5.f / 2, -5.f, 1.f / 2, 1.f, 0.f, //
+        0.f, -2.f, 4.f, 5.f / 2, -5.f, -1.f / 2, 1.f, 0.f, //
+        0.f, -1.f, 0.f, 21.f / 4, 0.f, -21.f / 4, 0.f, 1.f, //
+};
+
+struct wino_matrices_t {
+    const float *AT; // m x alpha
+    const float *G; // alpha x 3
+    const float *BT; // alpha x alpha
+};
+
+wino_matrices_t get_wino_matrices(int m) {
+    assert(utils::one_of(m, 4, 6));
+    if (m == 4) return {AT_4x4, G_4x4, BT_4x4};
+    return {AT_6x6, G_6x6, BT_6x6};
+}
+
+// Computes U = G * g * G^T for the input channel @p ic and the output channels
+// [oc, oc + simd_w) of the padded output channels. The result is stored as
+// alpha * alpha matrices of ic x oc_pad elements, the padded output channels
+// are zeroed. @p strides are the strides of the plain weights dimensions.
+template <typename wei_data_t>
+void transform_weights_block(const jit_brgemm_wino_conv_conf_t &jcp,
+        const wei_data_t *weights, const dim_t *strides, dim_t ic, dim_t oc,
+        float *U) {
+    const float *G = get_wino_matrices(jcp.m).G;
+    const int alpha = jcp.alpha;
+    const dim_t point_stride = jcp.ic * jcp.oc_pad;
+    const int len = static_cast<int>(nstl::min<dim_t>(simd_w, jcp.oc_pad - oc));
+    const int oc_len = static_cast<int>(
+            nstl::max<dim_t>(0, nstl::min<dim_t>(len, jcp.oc - oc)));
+
+    float g[3][3][simd_w];
+    float tmp[max_alpha][3][simd_w];
+
+    for (int kh = 0; kh < 3; ++kh)
+        for (int kw = 0; kw < 3; ++kw) {
+            const wei_data_t *w = weights + oc * strides[0] + ic * strides[1]
+                    + kh * strides[2] + kw * strides[3];
+            PRAGMA_OMP_SIMD()
+            for (int c = 0; c < simd_w; ++c)
+                g[kh][kw][c] = 0.f;
+            PRAGMA_OMP_SIMD()
+            for (int c = 0; c < oc_len; ++c)
+                g[kh][kw][c] = static_cast<float>(w[c * strides[0]]);
+        }
+
+    // tmp = G * g
+    for (int a = 0; a < alpha; ++a)
+        for (int kw = 0; kw < 3; ++kw) {
+            PRAGMA_OMP_SIMD()
+            for (int c = 0; c < simd_w; ++c)
+                tmp[a][kw][c] = 0.f;
+            for (int kh = 0; kh < 3; ++kh) {
+                const float gc = G[a * 3 + kh];
+                if (gc == 0.f) continue;
+                PRAGMA_OMP_SIMD()
+                for (int c = 0; c < simd_w; ++c)
+                    tmp[a][kw][c] += gc * g[kh][kw][c];
+            }
+        }
+
+    // U = tmp * G^T
+    float *U_block = U + ic * jcp.oc_pad + oc;
+    for (int a = 0; a < alpha; ++a)
+        for (int b = 0; b < alpha; ++b) {
+            float u[simd_w] = {0.f};
+            for (int kw = 0; kw < 3; ++kw) {
+                const float gc = G[b * 3 + kw];
+                if (gc == 0.f) continue;
+                PRAGMA_OMP_SIMD()
+                for (int c = 0; c < simd_w; ++c)
+                    u[c] += gc * tmp[a][kw][c];
+            }
+            float *U_ptr = U_block + (a * alpha + b) * point_stride;
+            PRAGMA_OMP_SIMD()
+            for (int c = 0; c < len; ++c)
+                U_ptr[c] = u[c];
+        }
+}
+
+// Computes V = B^T * d * B for the tiles [tile_start, tile_start + tile_block)
+// of the source. The result is stored as alpha * alpha matrices of
+// tile_block x ic_pad elements, one per point of the Winograd domain. The rows
+// of the tiles beyond the minibatch are zeroed.
+template <typename src_data_t>
+void transform_input_tiles(const jit_brgemm_wino_conv_conf_t &jcp,
+        const src_data_t *src, dim_t tile_start, float *V) {
+    const float *BT = get_wino_matrices(jcp.m).BT;
+    const int alpha = jcp.alpha;
+    const dim_t point_stride = jcp.tile_block * jcp.ic_pad;
+
+    float d[max_alpha][max_alpha][simd_w];
+    float tmp[max_alpha][max_alpha][simd_w];
+
+    for (int t = 0; t < jcp.tile_block; ++t) {
+        const dim_t tile = tile_start + t;
+        float *V_tile = V + t * jcp.ic_pad;
+        if (tile >= jcp.nb_tiles) {
+            for (int p = 0; p < alpha * alpha; ++p)
+                std::memset(
+                        V_tile + p * point_stride, 0, jcp.ic * sizeof(float));
+            continue;
+        }
+
+        const dim_t n = tile / (jcp.nb_th * jcp.nb_tw);
+        const int th = static_cast<int>((tile / jcp.nb_tw) % jcp.nb_th);
+        const int tw = static_cast<int>(tile % jcp.nb_tw);
+        const int ih0 = th * jcp.m - jcp.t_pad;
+        const int iw0 = tw * jcp.m - jcp.l_pad;
+
+        for (int ic = 0; ic < jcp.ic; ic += simd_w) {
+            const int len = nstl::min(simd_w, jcp.ic - ic);
+
+            for (int i = 0; i < alpha; ++i) {
+                const int ih = ih0 + i;
+                for (int j = 0; j < alpha; ++j) {
+                    const int iw = iw0 + j;
+                    if (ih < 0 || ih >= jcp.ih || iw < 0 || iw >= jcp.iw) {
+                        PRAGMA_OMP_SIMD()
+                        for (int c = 0; c < simd_w; ++c)
+                            d[i][j][c] = 0.f;
+                        continue;
+                    }
+                    const src_data_t *s = src
+                            + ((n * jcp.ih + ih) * jcp.iw + iw) * jcp.ic + ic;
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < len; ++c)
+                        d[i][j][c] = static_cast<float>(s[c]);
+                }
+            }
+
+            // tmp = B^T * d
+            for (int a = 0; a < alpha; ++a)
+                for (int j = 0; j < alpha; ++j) {
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < simd_w; ++c)
+                        tmp[a][j][c] = 0.f;
+                    for (int i = 0; i < alpha; ++i) {
+                        const float b = BT[a * alpha + i];
+                        if (b == 0.f) continue;
+                        PRAGMA_OMP_SIMD()
+                        for (int c = 0; c < simd_w; ++c)
+                            tmp[a][j][c] += b * d[i][j][c];
+                    }
+                }
+
+            // V = tmp * B
+            for (int a = 0; a < alpha; ++a)
+                for (int b = 0; b < alpha; ++b) {
+                    float v[simd_w] = {0.f};
+                    for (int j = 0; j < alpha; ++j) {
+                        const float bt = BT[b * alpha + j];
+                        if (bt == 0.f) continue;
+                        PRAGMA_OMP_SIMD()
+                        for (int c = 0; c < simd_w; ++c)
+                            v[c] += bt * tmp[a][j][c];
+                    }
+                    float *V_ptr = V_tile + (a * alpha + b) * point_stride + ic;
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < len; ++c)
+                        V_ptr[c] = v[c];
+                }
+        }
+    }
+}
+
+// Computes Y = A^T * M * A for the tile @p t of a block and the output
+// channels [0, oc_len) of an output channel block. The result is stored as
+// m x m points of oc_block elements.
+void transform_output_tile(const jit_brgemm_wino_conv_conf_t &jcp,
+        const float *M, int t, int oc_len, float *Y) {
+    const float *AT = get_wino_matrices(jcp.m).AT;
+    const int alpha = jcp.alpha;
+    const int m = jcp.m;
+    const dim_t point_stride = jcp.tile_block * jcp.oc_block;
+    const float *M_tile = M + t * jcp.oc_block;
+
+    float tmp[max_alpha][max_alpha][simd_w];
+
+    for (int oc = 0; oc < oc_len; oc += simd_w) {
+        // tmp = A^T * M
+        for (int i = 0; i < m; ++i)
+            for (int b = 0; b < alpha; ++b) {
+                PRAGMA_OMP_SIMD()
+                for (int c = 0; c < simd_w; ++c)
+                    tmp[i][b][c] = 0.f;
+                for (int a = 0; a < alpha; ++a) {
+                    const float at = AT[i * alpha + a];
+                    if (at == 0.f) continue;
+                    const float *M_ptr
+                            = M_tile + (a * alpha + b) * point_stride + oc;
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < simd_w; ++c)
+                        tmp[i][b][c] += at * M_ptr[c];
+                }
+            }
+
+        // Y = tmp * A
+        for (int i = 0; i < m; ++i)
+            for (int j = 0; j < m; ++j) {
+                float *y = Y + (i * m + j) * jcp.oc_block + oc;
+                PRAGMA_OMP_SIMD()
+                for (int c = 0; c < simd_w; ++c)
+                    y[c] = 0.f;
+                for (int b = 0; b < alpha; ++b) {
+                    const float at = AT[j * alpha + b];
+                    if (at == 0.f) continue;
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < simd_w; ++c)
+                        y[c] += at * tmp[i][b][c];
+                }
+            }
+    }
+}
+} // namespace
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+    const auto src_dt = src_md(0)->data_type;
+    const auto wei_dt = weights_md(0)->data_type;
+    const auto bia_dt = weights_md(1)->data_type;
+    const auto dst_dt = dst_md(0)->data_type;
+
+    VDISPATCH_CONV(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    // Winograd changes the rounding of the results, so the auto algorithm
+    // selects it only when the user allows reduced accuracy.
+    const bool is_auto = desc()->alg_kind == alg_kind::convolution_auto;
+    VDISPATCH_CONV(IMPLICATION(is_auto,
+                           attr()->fpmath_.mode_ != fpmath_mode::strict),
+            VERBOSE_UNSUPPORTED_FEATURE,
+            "auto algorithm selects winograd only with non-strict fpmath mode");
+    VDISPATCH_CONV(set_default_alg_kind(alg_kind::convolution_winograd),
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_CONV(utils::one_of(src_dt, f32, bf16) && wei_dt == src_dt
+                    && utils::one_of(dst_dt, src_dt, f32),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_CONV(utils::one_of(bia_dt, data_type::undef, f32, src_dt),
+            VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_CONV(ndims() == 4, VERBOSE_BAD_NDIMS, "src", ndims());
+    VDISPATCH_CONV(!with_groups(), VERBOSE_UNSUPPORTED_FEATURE, "groups");
+    VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_CONV(attr()->has_default_values(smask_t::post_ops, dst_dt),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_CONV(attr()->post_ops_.check_sum_consistency(
+                           dst_dt, /* is_int8 */ false),
+            VERBOSE_UNSUPPORTED_POSTOP);
+    // The post-ops kernels store bf16 values with native instructions.
+    VDISPATCH_CONV(IMPLICATION(dst_dt == bf16,
+                           mayiuse(avx512_core_bf16) || mayiuse(avx2_vnni_2)),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_CONV(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(attr_.set_default_formats(dst_md(0)) == status::success,
+            VERBOSE_UNSUPPORTED_POSTOP);
+
+    CHECK(init_conf());
+    VDISPATCH_CONV(IMPLICATION(is_auto, is_auto_profitable()),
+            VERBOSE_UNSUPPORTED_FEATURE,
+            "shape is not profitable for auto winograd");
+
+    const auto &jcp = jcp_;
+    CHECK(brgemm_desc_init(&brg_, isa, brgemm_addr, f32, f32, false, false,
+            brgemm_row_major, 1.f, 0.f, jcp.ic_pad, jcp.oc_pad, jcp.oc_block,
+            jcp.tile_block, jcp.oc_block, jcp.ic));
+    brgemm_attr_t brgattr;
+    brgattr.max_bs = 1;
+    brgattr.hint_expected_A_size = jcp.tile_block * jcp.ic;
+    brgattr.hint_expected_B_size = jcp.ic * jcp.oc_block;
+    brgattr.hint_expected_C_size = jcp.tile_block * jcp.oc_block;
+    CHECK(brgemm_desc_set_attr(&brg_, brgattr));
+    CHECK(brgemm_desc_finalize(&brg_));
+
+    // The post-ops kernels read rows of m points of an output tile and store
+    // them into the destination, M and N are adjusted at kernel creation.
+    CHECK(brgemm_desc_init(&brg_po_, isa, brgemm_addr, f32, f32, false, false,
+            brgemm_row_major, 1.f, 0.f, jcp.ic_pad, jcp.oc_pad, jcp.oc_block,
+            jcp.m, jcp.oc_block, jcp.ic));
+    VDISPATCH_CONV(brgemm_desc_set_postops(&brg_po_, attr(), dst_md(0), jcp.oc,
+                           jcp.bia_dt)
+                    == status::success,
+            VERBOSE_UNSUPPORTED_POSTOP);
+    CHECK(brgemm_desc_finalize(&brg_po_));
+
+    init_scratchpad();
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+bool brgemm_wino_convolution_fwd_t<isa>::pd_t::set_default_formats() {
+    using namespace format_tag;
+    if (!set_default_formats_common(nhwc, oihw, nhwc)) return false;
+    const memory_desc_wrapper weights_d(weights_md(0));
+    return memory_desc_matches_tag(*src_md(0), nhwc)
+            && memory_desc_matches_tag(*dst_md(0), nhwc)
+            && weights_d.is_blocking_desc()
+            && weights_d.blocking_desc().inner_nblks == 0
+            && !weights_d.is_additional_buffer();
+}
+
+template <cpu_isa_t isa>
+bool brgemm_wino_convolution_fwd_t<isa>::pd_t::is_auto_profitable() const {
+    const auto &jcp = jcp_;
+    // The direct implementations are faster for the low precision data
+    // types on AMX.
+    if (jcp.src_dt != f32 && mayiuse(avx512_core_amx)) return false;
+    return jcp.ic >= 64 && jcp.oc >= 64
+            && jcp.nb_tile_blocks >= dnnl_get_max_threads();
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::pd_t::init_conf() {
+    const auto &cd = *desc();
+    auto &jcp = jcp_;
+
+    VDISPATCH_CONV_IC(KH() == 3 && KW() == 3, VERBOSE_UNSUPPORTED_FEATURE,
+            "only 3x3 kernel is supported for winograd");
+    VDISPATCH_CONV_IC(KSH() == 1 && KSW() == 1, VERBOSE_UNSUPPORTED_FEATURE,
+            "only stride 1 is supported for winograd");
+    VDISPATCH_CONV_IC(KDH() == 0 && KDW() == 0, VERBOSE_UNSUPPORTED_FEATURE,
+            "dilation is not supported for winograd");
+
+    jcp.isa = isa;
+    jcp.mb = MB();
+    jcp.ic = IC();
+    jcp.oc = OC();
+    jcp.ih = IH();
+    jcp.iw = IW();
+    jcp.oh = OH();
+    jcp.ow = OW();
+    jcp.t_pad = padT();
+    jcp.l_pad = padL();
+
+    jcp.src_dt = cd.src_desc.data_type;
+    jcp.wei_dt = cd.weights_desc.data_type;
+    jcp.bia_dt = with_bias() ? cd.bias_desc.data_type : data_type::undef;
+    jcp.dst_dt = cd.dst_desc.data_type;
+    jcp.with_bias = with_bias();
+
+    // The larger tiles reduce the number of multiplications further but the
+    // transforms amplify the rounding errors, so they are only used when the
+    // user allows reduced accuracy.
+    jcp.m = attr()->fpmath_.mode_ == fpmath_mode::strict ? 4 : 6;
+    jcp.alpha = jcp.m + 2;
+    jcp.nb_th = div_up(jcp.oh, jcp.m);
+    jcp.nb_tw = div_up(jcp.ow, jcp.m);
+    jcp.nb_tiles = static_cast<dim_t>(jcp.mb) * jcp.nb_th * jcp.nb_tw;
+
+    const int simd = isa_max_vlen(isa) / static_cast<int>(sizeof(float));
+    jcp.tile_block = 16;
+    jcp.nb_tile_blocks
+            = static_cast<int>(div_up(jcp.nb_tiles, (dim_t)jcp.tile_block));
+    jcp.oc_block = nstl::min(4 * simd, rnd_up(jcp.oc, simd));
+    jcp.nb_oc_blocks = div_up(jcp.oc, jcp.oc_block);
+    jcp.ic_pad = rnd_up(jcp.ic, simd);
+    jcp.oc_pad = static_cast<dim_t>(jcp.nb_oc_blocks) * jcp.oc_block;
+
+    jcp.nthr = nstl::min(dnnl_get_max_threads(), jcp.nb_tile_blocks);
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_wino_convolution_fwd_t<isa>::pd_t::init_scratchpad() {
+    const auto &jcp = jcp_;
+    auto scratchpad = scratchpad_registry().registrar();
+    const size_t npoints = static_cast<size_t>(jcp.alpha) * jcp.alpha;
+
+    scratchpad.book<float>(
+            key_wino_U, npoints * static_cast<size_t>(jcp.ic) * jcp.oc_pad);
+    scratchpad.book<float>(key_wino_V,
+            static_cast<size_t>(jcp.nthr) * npoints * jcp.tile_block
+                    * jcp.ic_pad);
+    scratchpad.book<float>(key_wino_M,
+            static_cast<size_t>(jcp.nthr) * npoints * jcp.tile_block
+                    * jcp.oc_block);
+    scratchpad.book<float>(key_conv_brgemm_out_buffer,
+            static_cast<size_t>(jcp.nthr) * jcp.m * jcp.m * jcp.oc_block);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::init(engine_t *engine) {
+    brgemm_kernel_t *brg_kernel = nullptr;
+    CHECK(brgemm_kernel_create(&brg_kernel, pd()->brg_));
+    CHECK(safe_ptr_assign(brg_kernel_, brg_kernel));
+
+    const auto &jcp = pd()->jcp_;
+    assert(jcp.m <= max_m);
+    for (int i_N = 0; i_N < 2; ++i_N) {
+        const int N = i_N ? jcp.oc % jcp.oc_block : jcp.oc_block;
+        if (N == 0) continue;
+        for (int bd = 1; bd <= jcp.m; ++bd) {
+            brgemm_desc_t po_cfg = pd()->brg_po_;
+            po_cfg.load_dim = N;
+            po_cfg.bcast_dim = bd;
+            po_cfg.LDC = jcp.oc_block;
+            po_cfg.dt_c = f32;
+            po_cfg.typesize_C = types::data_type_size(f32);
+            po_cfg.alpha = 1;
+            po_cfg.beta = 1;
+            CHECK(safe_ptr_assign(kernels_po_[i_N][bd - 1],
+                    jit_brgemm_kernel_post_ops_base_t::create(
+                            isa, po_cfg, *pd()->attr())));
+            CHECK(kernels_po_[i_N][bd - 1]->generate_kernel());
+        }
+    }
+    return status::success;
+}
+
+// Transforms the weights into alpha * alpha matrices of ic x oc_pad elements.
+template <cpu_isa_t isa>
+void brgemm_wino_convolution_fwd_t<isa>::transform_weights(
+        const char *weights, float *U) const {
+    const auto &jcp = pd()->jcp_;
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+    const dim_t *strides = weights_d.blocking_desc().strides;
+    const dim_t wei_off
+            = weights_d.offset0() * types::data_type_size(jcp.wei_dt);
+
+    parallel_nd(jcp.ic, div_up(jcp.oc_pad, simd_w), [&](dim_t ic, dim_t ocb) {
+        if (jcp.wei_dt == bf16)
+            transform_weights_block(jcp,
+                    reinterpret_cast<const bfloat16_t *>(weights + wei_off),
+                    strides, ic, ocb * simd_w, U);
+        else
+            transform_weights_block(jcp,
+                    reinterpret_cast<const float *>(weights + wei_off),
+                    strides, ic, ocb * simd_w, U);
+    });
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::execute(
+        const exec_ctx_t &ctx) const {
+    const auto &jcp = pd()->jcp_;
+
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    const auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    float *V_base = scratchpad.template get<float>(key_wino_V);
+    float *M_base = scratchpad.template get<float>(key_wino_M);
+    float *Y_base = scratchpad.template get<float>(key_conv_brgemm_out_buffer);
+    float *U = scratchpad.template get<float>(key_wino_U);
+
+    transform_weights(weights, U);
+
+    const auto post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(
+                    pd()->attr()->post_ops_, ctx);
+
+    const dim_t npoints = jcp.alpha * jcp.alpha;
+    const dim_t V_size = npoints * jcp.tile_block * jcp.ic_pad;
+    const dim_t M_size = npoints * jcp.tile_block * jcp.oc_block;
+    const dim_t Y_size = jcp.m * jcp.m * jcp.oc_block;
+    const size_t dst_dt_sz = types::data_type_size(jcp.dst_dt);
+    const size_t bia_dt_sz
+            = jcp.with_bias ? types::data_type_size(jcp.bia_dt) : 0;
+
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        int start = 0, end = 0;
+        balance211(jcp.nb_tile_blocks, nthr, ithr, start, end);
+
+        float *V = V_base + ithr * V_size;
+        float *M = M_base + ithr * M_size;
+        float *Y = Y_base + ithr * Y_size;
+        brgemm_batch_element_t batch;
+
+        brgemm_kernel_post_ops_args_t p;
+        p.ptr_binary_post_ops_rhs = post_ops_binary_rhs_arg_vec.data();
+        p.dst_orig = dst;
+
+        for (int tb = start; tb < end; ++tb) {
+            const dim_t tile_start = static_cast<dim_t>(tb) * jcp.tile_block;
+            if (jcp.src_dt == bf16)
+                transform_input_tiles(jcp,
+                        reinterpret_cast<const bfloat16_t *>(src), tile_start,
+                        V);
+            else
+                transform_input_tiles(jcp,
+                        reinterpret_cast<const float *>(src), tile_start, V);
+
+            for (int ocb = 0; ocb < jcp.nb_oc_blocks; ++ocb) {
+                const int oc_start = ocb * jcp.oc_block;
+                const int oc_len = nstl::min(jcp.oc_block, jcp.oc - oc_start);
+                for (dim_t pt = 0; pt < npoints; ++pt) {
+                    batch.ptr.A = V + pt * jcp.tile_block * jcp.ic_pad;
+                    batch.ptr.B = U + pt * jcp.ic * jcp.oc_pad + oc_start;
+                    brgemm_kernel_execute(brg_kernel_.get(), 1, &batch,
+                            M + pt * jcp.tile_block * jcp.oc_block);
+                }
+
+                const auto &kernels_po = kernels_po_[oc_len < jcp.oc_block];
+                p.ptr_bias = jcp.with_bias
+                        ? const_cast<char *>(bias) + oc_start * bia_dt_sz
+                        : nullptr;
+
+                for (int t = 0; t < jcp.tile_block; ++t) {
+                    const dim_t tile = tile_start + t;
+                    if (tile >= jcp.nb_tiles) break;
+
+                    transform_output_tile(jcp, M, t, oc_len, Y);
+
+                    const dim_t n = tile / (jcp.nb_th * jcp.nb_tw);
+                    const int th
+                            = static_cast<int>((tile / jcp.nb_tw) % jcp.nb_th);
+                    const int tw = static_cast<int>(tile % jcp.nb_tw);
+                    const int ow_start = tw * jcp.m;
+                    const int ow_len = nstl::min(jcp.m, jcp.ow - ow_start);
+                    for (int i = 0; i < jcp.m; ++i) {
+                        const int oh = th * jcp.m + i;
+                        if (oh >= jcp.oh) break;
+                        p.ptr_in = Y + i * jcp.m * jcp.oc_block;
+                        p.ptr_out = dst
+                                + (((n * jcp.oh + oh) * jcp.ow + ow_start)
+                                                  * jcp.oc
+                                          + oc_start)
+                                        * dst_dt_sz;
+                        (*kernels_po[ow_len - 1])(&p);
+                    }
+                }
+            }
+        }
+    });
+
+    return status::success;
+}
+
+template struct brgemm_wino_convolution_fwd_t<avx2>;
+template struct brgemm_wino_convolution_fwd_t<avx512_core>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,95 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_WINO_CONV_HPP
+#define CPU_X64_JIT_BRGEMM_WINO_CONV_HPP
+
+#include <memory>
+
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_brgemm_post_ops.hpp"
+#include "cpu/x64/jit_primitive_conf.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Winograd F(4x4, 3x3) and F(6x6, 3x3) forward convolution for 3x3 stride 1
+// kernels on plain nhwc tensors. The computations in the Winograd domain are
+// done in f32 with brgemm kernels regardless of the input data type.
+//
+// The implementation is opt-in: it is used with the convolution_winograd
+// algorithm, or with convolution_auto when the floating-point math mode of the
+// primitive allows reduced accuracy and the shape is large enough. The larger
+// F(6x6, 3x3) tiles are used only when the floating-point math mode is not
+// strict.
+//
+// The weights are transformed into the scratchpad on every execution. Bias,
+// post-ops and the conversion to the destination data type are applied by
+// brgemm post-ops kernels to the output tiles.
+template <cpu_isa_t isa>
+struct brgemm_wino_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_wino:", isa, ""),
+                brgemm_wino_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        jit_brgemm_wino_conv_conf_t jcp_ = utils::zero<decltype(jcp_)>();
+        brgemm_desc_t brg_;
+        // Descriptor of the post-ops kernels storing a row of an output tile.
+        brgemm_desc_t brg_po_;
+
+    private:
+        bool set_default_formats();
+        bool is_auto_profitable() const;
+        status_t init_conf();
+        void init_scratchpad();
+    };
+
+    brgemm_wino_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    void transform_weights(const char *weights, float *U) const;
+
+    // Post-ops kernels indexed by the output channel tail and the number of
+    // output points in a tile row minus one.
+    static constexpr int max_m = 6;
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernel_;
+    std::unique_ptr<jit_brgemm_kernel_post_ops_base_t> kernels_po_[2][max_m];
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,430 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "common/utils.hpp"
+#include "common/verbose.hpp"
+
+#include "cpu/x64/jit_code_arena.hpp"
+
+#if defined(__linux__) && defined(SYS_memfd_create)
+#define DNNL_JIT_CODE_ARENA_SUPPORTED 1
+#else
+#define DNNL_JIT_CODE_ARENA_SUPPORTED 0
+#endif
+
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001U
+#endif
+#ifndef MFD_HUGETLB
+#define MFD_HUGETLB 0x0004U
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace {
+
+enum class arena_mode_t { disabled = 0, enabled = 1, huge_pages = 2 };
+
+arena_mode_t get_arena_mode() {
+    static const arena_mode_t mode = []() {
+        if (!DNNL_JIT_CODE_ARENA_SUPPORTED) return arena_mode_t::disabled;
+        const int value = getenv_int_user("JIT_CODE_ARENA", 0);
+        if (value == static_cast<int>(arena_mode_t::enabled))
+            return arena_mode_t::enabled;
+        if (value == static_cast<int>(arena_mode_t::huge_pages))
+            return arena_mode_t::huge_pages;
+        return arena_mode_t::disabled;
+    }();
+    return mode;
+}
+
+// Chunks are a multiple of the 2 MB huge page size. Larger kernels get a
+// chunk of their own.
+constexpr size_t chunk_size = 2 * 1024 * 1024;
+// Kernels start at a cache line boundary.
+constexpr size_t code_alignment = 64;
+
+struct chunk_t {
+    int fd = -1;
+    uint8_t *rw = nullptr;
+    uint8_t *rx = nullptr;
+    size_t size = 0;
+    size_t used = 0;
+    size_t live_kernels = 0;
+};
+
+// Field of the finalized code that depends on the code address.
+struct jit_code_reloc_t {
+    enum kind_t {
+        // 8-byte absolute address of a location in the code, stored as the
+        // offset of the location.
+        code_address,
+        // 4-byte displacement from the end of the field to the target address
+        // outside the code, the field is stored as zero.
+        external_rel32,
+    };
+    size_t offset;
+    kind_t kind;
+    uint64_t target;
+};
+
+struct kernel_t {
+    chunk_t *chunk;
+    uint8_t *code;
+    size_t size;
+    uint64_t hash;
+    size_t refs;
+};
+
+// 64-bit FNV-1a over the position-independent image and its relocations.
+uint64_t hash_image(const uint8_t *image, size_t size,
+        const std::vector<jit_code_reloc_t> &relocs) {
+    uint64_t h = 14695981039346656037ULL;
+    const auto mix = [&](uint8_t b) {
+        h ^= b;
+        h *= 1099511628211ULL;
+    };
+    for (size_t i = 0; i < size; ++i)
+        mix(image[i]);
+    for (const auto &r : relocs) {
+        for (size_t i = 0; i < sizeof(r.offset); ++i)
+            mix(static_cast<uint8_t>(r.offset >> (8 * i)));
+        for (size_t i = 0; i < sizeof(r.target); ++i)
+            mix(static_cast<uint8_t>(r.target >> (8 * i)));
+        mix(static_cast<uint8_t>(r.kind));
+    }
+    return h;
+}
+
+// Builds the position-independent image of the finalized `code` and the list of
+// its fields that depend on the code address.
+//
+// Xbyak emits every field it resolves in ready() as zero and the byte before
+// such a field is the nonzero opcode or ModRM byte of its instruction, so the
+// field a changed byte belongs to starts right after the closest nonzero byte
+// of the unresolved code. The exception are tables of label addresses, whose
+// entries are adjacent and are recognized by their value. Returns false when
+// a changed byte cannot be attributed to a known kind of field.
+bool make_image(const uint8_t *code, const uint8_t *unresolved, size_t size,
+        std::vector<uint8_t> &image, std::vector<jit_code_reloc_t> &relocs) {
+    const uint64_t base = reinterpret_cast<uint64_t>(code);
+    const auto is_zero = [&](size_t start, size_t len) {
+        if (start + len > size) return false;
+        for (size_t k = start; k < start + len; ++k)
+            if (unresolved[k] != 0) return false;
+        return true;
+    };
+    // Fields addressing the code relative to the end of the instruction may
+    // be followed by an immediate of up to 4 bytes.
+    const auto is_inside = [&](uint64_t addr, uint64_t margin) {
+        return addr + margin >= base && addr <= base + size;
+    };
+
+    image.assign(code, code + size);
+    relocs.clear();
+    size_t covered = 0;
+    for (size_t j = 0; j < size; ++j) {
+        if (code[j] == unresolved[j]) continue;
+
+        const size_t lo = nstl::max(covered, j >= 7 ? j - 7 : 0);
+        size_t i = j;
+        while (i > lo && unresolved[i - 1] == 0)
+            --i;
+        if (unresolved[i] != 0) return false;
+
+        uint64_t addr = 0;
+        if (i + sizeof(addr) <= size)
+            std::memcpy(&addr, code + i, sizeof(addr));
+        if (is_zero(i, sizeof(addr)) && is_inside(addr, 0)) {
+            addr -= base;
+            std::memcpy(image.data() + i, &addr, sizeof(addr));
+            relocs.push_back({i, jit_code_reloc_t::code_address, 0});
+            covered = i + sizeof(addr);
+            j = covered - 1;
+            continue;
+        }
+        if (i == 0 || unresolved[i - 1] == 0) return false;
+
+        const uint8_t op = code[i - 1];
+        const bool is_branch32 = op == 0xe8 || op == 0xe9
+                || (i >= 2 && code[i - 2] == 0x0f && (op & 0xf0) == 0x80);
+        const bool is_branch8 = op == 0xeb || (op & 0xf0) == 0x70
+                || (op >= 0xe0 && op <= 0xe3);
+        int32_t disp32 = 0;
+        if (i + sizeof(disp32) <= size)
+            std::memcpy(&disp32, code + i, sizeof(disp32));
+        const uint64_t target32 = base + i + sizeof(disp32) + disp32;
+        if (is_branch32 && is_zero(i, sizeof(disp32))) {
+            // Branches to the code itself do not depend on its address.
+            if (!is_inside(target32, 0)) {
+                std::memset(image.data() + i, 0, sizeof(disp32));
+                relocs.push_back(
+                        {i, jit_code_reloc_t::external_rel32, target32});
+            }
+            covered = i + sizeof(disp32);
+        } else if (is_branch8 && is_zero(i, 1)) {
+            const uint64_t target8
+                    = base + i + 1 + static_cast<int8_t>(code[i]);
+            if (!is_inside(target8, 0)) return false;
+            covered = i + 1;
+        } else if (is_zero(i, sizeof(disp32)) && is_inside(target32, 4)) {
+            covered = i + sizeof(disp32);
+        } else {
+            return false;
+        }
+        j = covered - 1;
+    }
+    return true;
+}
+
+// Writes the image relocated for address `code` into `dst`.
+bool relocate(uint8_t *dst, const uint8_t *image, size_t size,
+        const std::vector<jit_code_reloc_t> &relocs, const uint8_t *code) {
+    std::memcpy(dst, image, size);
+    for (const auto &r : relocs) {
+        if (r.kind == jit_code_reloc_t::code_address) {
+            uint64_t value;
+            std::memcpy(&value, image + r.offset, sizeof(value));
+            value += reinterpret_cast<uint64_t>(code);
+            std::memcpy(dst + r.offset, &value, sizeof(value));
+        } else {
+            const int64_t disp = static_cast<int64_t>(r.target)
+                    - static_cast<int64_t>(
+                            reinterpret_cast<uint64_t>(code) + r.offset + 4);
+            if (disp != static_cast<int32_t>(disp)) return false;
+            const int32_t disp32 = static_cast<int32_t>(disp);
+            std::memcpy(dst + r.offset, &disp32, sizeof(disp32));
+        }
+    }
+    return true;
+}
+
+class arena_t {
+public:
+    static arena_t &get() {
+        // The arena is never destroyed: kernels owned by static objects may
+        // be released after the static objects of this file are gone.
+        static arena_t *arena = new arena_t();
+        return *arena;
+    }
+
+    const uint8_t *acquire(
+            const uint8_t *code, const uint8_t *unresolved, size_t size) {
+        std::vector<uint8_t> image;
+        std::vector<jit_code_reloc_t> relocs;
+        if (!make_image(code, unresolved, size, image, relocs)) return nullptr;
+        // The image relocated back to the original address must reproduce
+        // the code, which catches a misread field.
+        std::vector<uint8_t> relocated(size);
+        if (!relocate(relocated.data(), image.data(), size, relocs, code)
+                || std::memcmp(relocated.data(), code, size) != 0)
+            return nullptr;
+
+        const uint64_t hash = hash_image(image.data(), size, relocs);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        const auto range = by_hash_.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            kernel_t *k = it->second;
+            if (k->size != size) continue;
+            if (!relocate(
+                        relocated.data(), image.data(), size, relocs, k->code))
+                continue;
+            if (std::memcmp(relocated.data(), k->code, size) != 0) continue;
+            k->refs++;
+            stats_.shared_kernels++;
+            return k->code;
+        }
+
+        chunk_t *chunk = get_chunk(size);
+        if (!chunk) return nullptr;
+        uint8_t *placed = chunk->rx + chunk->used;
+        if (!relocate(relocated.data(), image.data(), size, relocs, placed)) {
+            if (chunk != current_) unmap(chunk);
+            return nullptr;
+        }
+        std::memcpy(chunk->rw + chunk->used, relocated.data(), size);
+        chunk->used = utils::rnd_up(chunk->used + size, code_alignment);
+        chunk->live_kernels++;
+
+        kernel_t *k = new kernel_t {chunk, placed, size, hash, 1};
+        by_hash_.emplace(hash, k);
+        by_code_.emplace(placed, k);
+        stats_.code_bytes += size;
+        stats_.kernels++;
+        return placed;
+    }
+
+    void release(const uint8_t *code) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto it = by_code_.find(code);
+        if (it == by_code_.end()) return;
+        kernel_t *k = it->second;
+        if (--k->refs > 0) return;
+
+        by_code_.erase(it);
+        const auto range = by_hash_.equal_range(k->hash);
+        for (auto h = range.first; h != range.second; ++h) {
+            if (h->second != k) continue;
+            by_hash_.erase(h);
+            break;
+        }
+        stats_.code_bytes -= k->size;
+        stats_.kernels--;
+
+        chunk_t *chunk = k->chunk;
+        delete k;
+        // The space of released kernels is not reused, a chunk is unmapped
+        // once all its kernels are released and no new kernel can go there.
+        if (--chunk->live_kernels == 0 && chunk != current_) unmap(chunk);
+    }
+
+    jit_code_arena_stats_t stats() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+
+    bool is_usable() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!current_) current_ = map(chunk_size);
+        return current_ != nullptr;
+    }
+
+private:
+    arena_t() = default;
+
+    chunk_t *get_chunk(size_t size) {
+        if (current_ && current_->used + size <= current_->size)
+            return current_;
+        if (size > chunk_size) return map(utils::rnd_up(size, chunk_size));
+
+        chunk_t *chunk = map(chunk_size);
+        if (!chunk) return nullptr;
+        if (current_ && current_->live_kernels == 0) unmap(current_);
+        current_ = chunk;
+        return chunk;
+    }
+
+    chunk_t *map(size_t size) {
+#if DNNL_JIT_CODE_ARENA_SUPPORTED
+        const bool try_huge = get_arena_mode() == arena_mode_t::huge_pages
+                && huge_pages_available_;
+        int fd = static_cast<int>(syscall(SYS_memfd_create, "dnnl_jit_code",
+                MFD_CLOEXEC | (try_huge ? MFD_HUGETLB : 0U)));
+        if (fd >= 0 && ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            close(fd);
+            fd = -1;
+        }
+        if (fd < 0 && try_huge) {
+            // Fall back to regular pages when no huge pages are reserved.
+            huge_pages_available_ = false;
+            return map(size);
+        }
+        if (fd < 0) return nullptr;
+
+        void *rw = mmap(
+                nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        void *rx = mmap(
+                nullptr, size, PROT_READ | PROT_EXEC, MAP_SHARED, fd, 0);
+        if (rw == MAP_FAILED || rx == MAP_FAILED) {
+            if (rw != MAP_FAILED) munmap(rw, size);
+            if (rx != MAP_FAILED) munmap(rx, size);
+            close(fd);
+            if (try_huge) {
+                huge_pages_available_ = false;
+                return map(size);
+            }
+            return nullptr;
+        }
+
+        chunk_t *chunk = new chunk_t();
+        chunk->fd = fd;
+        chunk->rw = static_cast<uint8_t *>(rw);
+        chunk->rx = static_cast<uint8_t *>(rx);
+        chunk->size = size;
+        stats_.mapped_bytes += size;
+        VDEBUGINFO(1, primitive, jit_code_arena,
+                "mapped %zu bytes%s, mapped total %zu bytes, code %zu bytes "
+                "in %zu kernels",
+                size, try_huge ? " of huge pages" : "", stats_.mapped_bytes,
+                stats_.code_bytes, stats_.kernels);
+        return chunk;
+#else
+        return nullptr;
+#endif
+    }
+
+    void unmap(chunk_t *chunk) {
+#if DNNL_JIT_CODE_ARENA_SUPPORTED
+        munmap(chunk->rw, chunk->size);
+        munmap(chunk->rx, chunk->size);
+        close(chunk->fd);
+        stats_.mapped_bytes -= chunk->size;
+#endif
+        delete chunk;
+    }
+
+    std::mutex mutex_;
+    chunk_t *current_ = nullptr;
+    bool huge_pages_available_ = true;
+    std::unordered_multimap<uint64_t, kernel_t *> by_hash_;
+    std::unordered_map<const uint8_t *, kernel_t *> by_code_;
+    jit_code_arena_stats_t stats_;
+};
+
+} // namespace
+
+jit_code_arena_stats_t get_jit_code_arena_stats() {
+    if (!jit_code_arena_t::is_enabled()) return jit_code_arena_stats_t();
+    return arena_t::get().stats();
+}
+
+bool jit_code_arena_t::is_enabled() {
+    // The first chunk is mapped eagerly so that a system without memory file
+    // support falls back to the regular allocation for every kernel.
+    static const bool enabled = get_arena_mode() != arena_mode_t::disabled
+            && arena_t::get().is_usable();
+    return enabled;
+}
+
+const uint8_t *jit_code_arena_t::acquire(
+        const uint8_t *code, const uint8_t *unresolved, size_t size) {
+    return arena_t::get().acquire(code, unresolved, size);
+}
+
+void jit_code_arena_t::release(const uint8_t *code) {
+    arena_t::get().release(code);
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
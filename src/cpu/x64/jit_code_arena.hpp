@@ -0,0 +1,98 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_CODE_ARENA_HPP
+#define CPU_X64_JIT_CODE_ARENA_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/c_types_map.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_code_arena_stats_t {
+    // Bytes of executable memory mapped by the arena.
+    size_t mapped_bytes = 0;
+    // Bytes of distinct kernels alive in the arena.
+    size_t code_bytes = 0;
+    // Number of distinct kernels alive in the arena.
+    size_t kernels = 0;
+    // Number of generated kernels that reuse an identical kernel alive in the
+    // arena instead of taking more space, counted over the process lifetime.
+    size_t shared_kernels = 0;
+};
+
+jit_code_arena_stats_t DNNL_API get_jit_code_arena_stats();
+
+// Process-wide executable memory for the generated kernels.
+//
+// Kernels are packed contiguously into large chunks instead of getting an mmap
+// region each, and a kernel whose code is identical to a kernel already in the
+// arena shares it. Every chunk is mapped twice from a memory file: a writable
+// view the code is copied through and an executable view the code runs from,
+// so no mapping is ever writable and executable at the same time.
+//
+// The arena is enabled by the ONEDNN_JIT_CODE_ARENA environment variable:
+// 0 - disabled (default), 1 - enabled, 2 - enabled and backed by huge pages
+// when the system has them reserved. It is supported on Linux only.
+struct jit_code_arena_t {
+    static bool is_enabled();
+
+    // Returns a copy of the finalized `code` placed in the arena, or nullptr
+    // when the code cannot be moved: the fields that depend on the code
+    // address are not recognized, a displacement does not fit at the new
+    // address, or the arena is out of memory. `unresolved` is the code before
+    // Xbyak resolved its label and address fields, which are zero there.
+    static const uint8_t *acquire(
+            const uint8_t *code, const uint8_t *unresolved, size_t size);
+    static void release(const uint8_t *code);
+};
+
+// Allocator of the buffers Xbyak generates code into. Once the finalized code
+// is moved into the arena, its buffer is freed right away and Xbyak's own
+// cleanup of the buffer becomes a no-op.
+class jit_code_allocator_t : public Xbyak::MmapAllocator {
+public:
+    jit_code_allocator_t(const char *name) : Xbyak::MmapAllocator(name) {}
+
+    void free(Xbyak::uint8 *p) override {
+        if (p != nullptr && p == released_) return;
+        Xbyak::MmapAllocator::free(p);
+    }
+    bool useProtect() const override { return released_ == nullptr; }
+
+protected:
+    void release_buffer(Xbyak::uint8 *p) {
+        Xbyak::MmapAllocator::free(p);
+        released_ = p;
+    }
+
+private:
+    Xbyak::uint8 *released_ = nullptr;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -21,6 +21,16 @@ namespace impl {
 namespace cpu {
 namespace x64 {
 
+const Xbyak::uint8 *jit_generator_t::move_to_code_arena(
+        const std::vector<Xbyak::uint8> &unresolved) {
+    const Xbyak::uint8 *code = CodeGenerator::getCode();
+    arena_code_ = jit_code_arena_t::acquire(code, unresolved.data(), getSize());
+    if (!arena_code_) return code;
+
+    release_buffer(const_cast<Xbyak::uint8 *>(code));
+    return arena_code_;
+}
+
 void jit_generator_t::transpose(const Xbyak::Reg64 &reg_src,
         const Xbyak::Reg64 &reg_dst, dim_t src_stride, dim_t dst_stride,
         int nrows, int ncolumns, data_type_t dt, Xbyak::Ymm &ymm_tmp,
@@ -22,10 +22,12 @@
 
 #include "common/bit_cast.hpp"
 #include "common/compiler_workarounds.hpp"
+#include "common/create_breakdown.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
 #include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_code_arena.hpp"
 
 #include "cpu/jit_utils/jit_utils.hpp"
 
@@ -149,7 +151,7 @@ constexpr Xbyak::Operand::Code abi_not_param_reg =
 
 #endif
 
-class jit_generator_t : public Xbyak::MmapAllocator,
+class jit_generator_t : public jit_code_allocator_t,
                         public Xbyak::CodeGenerator,
                         public c_compatible {
 public:
@@ -2758,12 +2760,14 @@ public:
     /* All uni_ instructions -- apart from uni_vzeroupper() -- will comply with
      * the max_cpu_isa argument */
     jit_generator_t(const char *name, cpu_isa_t max_cpu_isa = get_max_cpu_isa())
-        : Xbyak::MmapAllocator(name)
+        : jit_code_allocator_t(name)
         , Xbyak::CodeGenerator(max_code_size, Xbyak::AutoGrow,
                   /*allocator=*/this)
         , max_cpu_isa_(max_cpu_isa) {}
 
-    ~jit_generator_t() override = default;
+    ~jit_generator_t() override {
+        if (arena_code_) jit_code_arena_t::release(arena_code_);
+    }
 
     virtual const char *name() const = 0;
     virtual const char *source_file() const = 0;
@@ -2785,6 +2789,8 @@ public:
         int err_code = Xbyak::GetError();
         if (err_code == Xbyak::ERR_CANT_ALLOC) return status::out_of_memory;
         if (err_code != Xbyak::ERR_NONE) return status::runtime_error;
+        create_breakdown::scope_t breakdown_scope(
+                create_breakdown::phase_t::jit_generate);
         generate();
         jit_ker_ = getCode();
         return (jit_ker_) ? status::success : status::runtime_error;
@@ -2798,14 +2804,29 @@ public:
 
 private:
     const cpu_isa_t max_cpu_isa_;
+    const Xbyak::uint8 *arena_code_ = nullptr;
     const Xbyak::uint8 *getCode() {
+        // Xbyak fills the label and address fields in ready(), the arena
+        // compares the code before and after to find the ones that depend on
+        // the code address.
+        std::vector<Xbyak::uint8> unresolved;
+        if (jit_code_arena_t::is_enabled())
+            unresolved.assign(CodeGenerator::getCode(),
+                    CodeGenerator::getCode() + getSize());
         this->ready();
         if (!is_initialized()) return nullptr;
         const Xbyak::uint8 *code = CodeGenerator::getCode();
+        if (!unresolved.empty()) code = move_to_code_arena(unresolved);
         register_jit_code(code, getSize());
         return code;
     }
 
+    // Moves the finalized code into the JIT code arena and frees the buffer it
+    // was generated in. Returns the code in its own buffer when the arena
+    // cannot take it.
+    const Xbyak::uint8 *move_to_code_arena(
+            const std::vector<Xbyak::uint8> &unresolved);
+
     static inline bool is_initialized() {
         return Xbyak::GetError() == Xbyak::ERR_NONE;
     }
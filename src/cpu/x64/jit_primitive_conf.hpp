@@ -897,6 +897,34 @@ struct jit_brgemm_conv_conf_t {
     brgemm_kernel_loop_order_t brgemm_kernel_loop_order {brgemm_lo_default};
 };
 
+// Winograd F(m x m, 3 x 3) convolution. The transformed input of a block of
+// tiles and the transformed weights are multiplied with one brgemm call per
+// point of the alpha x alpha Winograd domain, alpha = m + 2.
+struct jit_brgemm_wino_conv_conf_t {
+    int nthr;
+    int mb, ic, oc;
+    int ih, iw, oh, ow;
+    int t_pad, l_pad;
+
+    int m, alpha;
+    int nb_th, nb_tw; // number of tiles per image
+    dim_t nb_tiles; // number of tiles in the minibatch
+    int tile_block, nb_tile_blocks;
+    int oc_block, nb_oc_blocks;
+
+    // leading dimensions of the transformed input, weights and output
+    dim_t ic_pad, oc_pad;
+
+    bool with_bias;
+
+    data_type_t src_dt;
+    data_type_t wei_dt;
+    data_type_t bia_dt;
+    data_type_t dst_dt;
+
+    cpu_isa_t isa;
+};
+
 struct jit_shuffle_conf_t {
     unsigned ndims = 0;
 
@@ -1067,6 +1067,290 @@ void jit_trans_ow_oc_t::generate() {
     postamble();
 }
 
+// f32 data needs no vnni interleaving, so the kernels below only use AVX2
+// instructions and run on Intel AVX-512 as well. They follow the layouts of
+// jit_trans_iw_ic_t and jit_trans_ow_oc_t, channels are processed by groups of
+// 8 and the channels past ch_work are masked out on load.
+// Loading 8 elements at offset 8 - n gives the mask of the first n lanes.
+static const int32_t f32_tail_mask_table[16]
+        = {-1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0};
+// Lane indices of the two 8-channel groups of a 16-channel block.
+static const int32_t f32_lane_idx_table[16]
+        = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+
+struct jit_trans_iw_ic_f32_t : public jit_trans_src_t, public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_trans_iw_ic_f32_t)
+    jit_trans_iw_ic_f32_t(const jit_conv_conf_t *conf)
+        : jit_trans_src_t(conf), jit_generator_t(jit_name(), avx2) {}
+
+    void operator()(ctx_t *ctx) override { jit_generator_t::operator()(ctx); }
+
+    status_t create_kernel() override {
+        return jit_generator_t::create_kernel();
+    }
+
+private:
+    static constexpr int simd_w = 8;
+    static constexpr int typesize = sizeof(float);
+    size_t src_stride = 0, tr_src_stride = 0;
+
+    Reg64 reg_src = r8;
+    Reg64 reg_tr_src = r9;
+    Reg64 reg_loop = r10;
+    Reg64 reg_tmp = r11;
+    Reg64 imm_addr64 = rbx;
+
+    // The load masks of the two channel groups are kept on the stack.
+    static constexpr int stack_space_needed = 2 * simd_w * typesize;
+
+    void store_zeros(const Reg64 &reg_base, int nrows, int ncols);
+    void transpose(int nrows, int g);
+    void generate() override;
+};
+
+// Zeroes @p ncols columns of @p nrows transposed rows.
+void jit_trans_iw_ic_f32_t::store_zeros(
+        const Reg64 &reg_base, int nrows, int ncols) {
+    if (ncols <= 0) return;
+    const Ymm ymm_zero = Ymm(0), ymm_mask = Ymm(1);
+    vxorps(ymm_zero, ymm_zero, ymm_zero);
+    const int tail = ncols % simd_w;
+    if (tail) {
+        mov(imm_addr64,
+                reinterpret_cast<size_t>(f32_tail_mask_table + simd_w - tail));
+        vmovups(ymm_mask, ptr[imm_addr64]);
+    }
+    for (int r = 0; r < nrows; r++)
+        for (int c = 0; c < ncols; c += simd_w) {
+            const auto addr = ptr[reg_base + r * tr_src_stride + c * typesize];
+            if (c + simd_w <= ncols)
+                vmovups(addr, ymm_zero);
+            else
+                vmaskmovps(addr, ymm_mask, ymm_zero);
+        }
+}
+
+// Transposes @p nrows spatial points of the channel group @p g, the rows past
+// nrows are zeroed.
+void jit_trans_iw_ic_f32_t::transpose(int nrows, int g) {
+    assert(nrows >= 0 && nrows <= simd_w);
+    if (nrows == 0) return;
+
+    const Ymm ymm_mask = Ymm(8);
+    vmovups(ymm_mask, ptr[rsp + g * simd_w * typesize]);
+    for (int r = 0; r < simd_w; r++) {
+        if (r < nrows)
+            vmaskmovps(Ymm(r), ymm_mask,
+                    ptr[reg_src + r * src_stride + g * simd_w * typesize]);
+        else
+            vxorps(Ymm(r), Ymm(r), Ymm(r));
+    }
+
+    // 8x8 transposition: rows are interleaved by pairs, then by quads and
+    // the 128-bit lanes are exchanged last.
+    for (int i = 0; i < simd_w / 2; i++) {
+        vunpcklps(Ymm(8 + 2 * i), Ymm(2 * i), Ymm(2 * i + 1));
+        vunpckhps(Ymm(9 + 2 * i), Ymm(2 * i), Ymm(2 * i + 1));
+    }
+    for (int i = 0; i < 2; i++) {
+        const int t = 8 + 4 * i;
+        vshufps(Ymm(4 * i + 0), Ymm(t + 0), Ymm(t + 2), 0x44);
+        vshufps(Ymm(4 * i + 1), Ymm(t + 0), Ymm(t + 2), 0xee);
+        vshufps(Ymm(4 * i + 2), Ymm(t + 1), Ymm(t + 3), 0x44);
+        vshufps(Ymm(4 * i + 3), Ymm(t + 1), Ymm(t + 3), 0xee);
+    }
+    for (int c = 0; c < simd_w / 2; c++) {
+        vperm2f128(Ymm(8 + c), Ymm(c), Ymm(c + 4), 0x20);
+        vperm2f128(Ymm(12 + c), Ymm(c), Ymm(c + 4), 0x31);
+    }
+
+    const Ymm ymm_store_mask = Ymm(0);
+    if (nrows < simd_w) {
+        mov(imm_addr64,
+                reinterpret_cast<size_t>(f32_tail_mask_table + simd_w - nrows));
+        vmovups(ymm_store_mask, ptr[imm_addr64]);
+    }
+    for (int c = 0; c < simd_w; c++) {
+        const auto addr = ptr[reg_tr_src + (g * simd_w + c) * tr_src_stride];
+        if (nrows == simd_w)
+            vmovups(addr, Ymm(8 + c));
+        else
+            vmaskmovps(addr, ymm_store_mask, Ymm(8 + c));
+    }
+}
+
+void jit_trans_iw_ic_f32_t::generate() {
+    preamble();
+    sub(rsp, stack_space_needed);
+
+    const int ic_block = conf_->ic_block;
+    const int ngroups = utils::div_up(ic_block, simd_w);
+    assert(ic_block % simd_w == 0 && ngroups <= 2);
+
+    // lane i of group g is loaded when g * simd_w + i < ch_work
+    const Ymm ymm_ch_work = Ymm(0), ymm_idx = Ymm(1);
+    mov(reg_tmp.cvt32(), dword[param1 + GET_OFF(ch_work)]);
+    vmovd(Xmm(ymm_ch_work.getIdx()), reg_tmp.cvt32());
+    vpbroadcastd(ymm_ch_work, Xmm(ymm_ch_work.getIdx()));
+    for (int g = 0; g < ngroups; g++) {
+        mov(imm_addr64,
+                reinterpret_cast<size_t>(f32_lane_idx_table + g * simd_w));
+        vmovups(ymm_idx, ptr[imm_addr64]);
+        vpcmpgtd(ymm_idx, ymm_ch_work, ymm_idx);
+        vmovups(ptr[rsp + g * simd_w * typesize], ymm_idx);
+    }
+
+    const bool is_layout_nxc = utils::one_of(conf_->src_tag,
+            format_tag::ndhwc, format_tag::nhwc, format_tag::nwc);
+    const size_t src_mult
+            = is_layout_nxc ? conf_->ngroups * conf_->ic : ic_block;
+    const int str_w = conf_->stride_w;
+    assert(conf_->tr_iw % str_w == 0);
+    const int tr_iw_s = conf_->tr_iw / str_w;
+    src_stride = src_mult * str_w * typesize;
+    tr_src_stride = conf_->tr_iw * typesize;
+
+    // Data for every strided case is placed consecutively
+    // For 1x1 convolutions with strides we transpose only needed elements
+    const int str_w_end = (conf_->kw == 1) ? 1 : str_w;
+    for (int s = 0; s < str_w_end; s++) {
+        const int left_pad = div_up(nstl::max(0, conf_->l_pad - s), str_w);
+        const int iw1 = conf_->iw + conf_->l_pad;
+        const int iw_s = nstl::max(0,
+                (s < (iw1 % str_w) ? div_up(nstl::max(0, iw1), str_w)
+                                   : iw1 / str_w)
+                        - left_pad);
+        const int right_pad = tr_iw_s - iw_s - left_pad;
+        const int src_shift = (str_w - (conf_->l_pad % str_w) + s) % str_w;
+
+        mov(reg_tr_src, ptr[param1 + GET_OFF(tr_src)]);
+        add(reg_tr_src, s * tr_iw_s * typesize);
+        store_zeros(reg_tr_src, ic_block, left_pad);
+        add(reg_tr_src, (left_pad + iw_s) * typesize);
+        store_zeros(reg_tr_src, ic_block, right_pad);
+        sub(reg_tr_src, iw_s * typesize);
+
+        mov(reg_src, ptr[param1 + GET_OFF(src)]);
+        add(reg_src, src_shift * src_mult * typesize);
+
+        const int nblocks = iw_s / simd_w;
+        if (nblocks > 0) {
+            Label block_loop;
+            mov(reg_loop, nblocks);
+            L(block_loop);
+            {
+                for (int g = 0; g < ngroups; g++)
+                    transpose(simd_w, g);
+                add(reg_src, simd_w * src_stride);
+                add(reg_tr_src, simd_w * typesize);
+                sub(reg_loop, 1);
+                jnz(block_loop, T_NEAR);
+            }
+        }
+        for (int g = 0; g < ngroups; g++)
+            transpose(iw_s % simd_w, g);
+    }
+
+    add(rsp, stack_space_needed);
+    postamble();
+}
+
+struct jit_trans_ow_oc_f32_t : public jit_trans_dst_t, public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_trans_ow_oc_f32_t)
+    jit_trans_ow_oc_f32_t(const jit_conv_conf_t *conf)
+        : jit_trans_dst_t(conf), jit_generator_t(jit_name(), avx2) {}
+
+    void operator()(ctx_t *ctx) override { jit_generator_t::operator()(ctx); }
+
+    status_t create_kernel() override {
+        return jit_generator_t::create_kernel();
+    }
+
+private:
+    static constexpr int simd_w = 8;
+    static constexpr int typesize = sizeof(float);
+    // Number of rows copied per loop iteration.
+    static constexpr int unroll = 4;
+
+    Reg64 reg_src = r8;
+    Reg64 reg_tr_src = r9;
+    Reg64 reg_loop = r10;
+    Reg64 reg_tmp = r11;
+    Reg64 imm_addr64 = rbx;
+
+    Ymm ymm_zero = Ymm(15);
+    Ymm ymm_mask(int g) { return Ymm(13 + g); }
+
+    void generate() override;
+};
+
+void jit_trans_ow_oc_f32_t::generate() {
+    preamble();
+
+    const int oc_block = conf_->oc_block;
+    const int ngroups = utils::div_up(oc_block, simd_w);
+    assert(oc_block % simd_w == 0 && ngroups <= 2);
+
+    // lane i of group g is loaded when g * simd_w + i < ch_work
+    mov(reg_tmp.cvt32(), dword[param1 + GET_OFF(ch_work)]);
+    vmovd(Xmm(ymm_zero.getIdx()), reg_tmp.cvt32());
+    vpbroadcastd(ymm_zero, Xmm(ymm_zero.getIdx()));
+    for (int g = 0; g < ngroups; g++) {
+        mov(imm_addr64,
+                reinterpret_cast<size_t>(f32_lane_idx_table + g * simd_w));
+        vmovups(ymm_mask(g), ptr[imm_addr64]);
+        vpcmpgtd(ymm_mask(g), ymm_zero, ymm_mask(g));
+    }
+    vxorps(ymm_zero, ymm_zero, ymm_zero);
+
+    const bool is_layout_nxc = utils::one_of(conf_->dst_tag,
+            format_tag::ndhwc, format_tag::nhwc, format_tag::nwc);
+    const size_t src_stride
+            = (is_layout_nxc ? conf_->ngroups * conf_->oc : oc_block)
+            * typesize;
+    const size_t tr_src_stride = oc_block * typesize;
+
+    mov(reg_src, ptr[param1 + GET_OFF(src)]);
+    mov(reg_tr_src, ptr[param1 + GET_OFF(tr_src)]);
+
+    auto copy_rows = [&](int nrows) {
+        for (int r = 0; r < nrows; r++)
+            for (int g = 0; g < ngroups; g++)
+                vmaskmovps(Ymm(r * ngroups + g), ymm_mask(g),
+                        ptr[reg_src + r * src_stride + g * simd_w * typesize]);
+        for (int r = 0; r < nrows; r++)
+            for (int g = 0; g < ngroups; g++)
+                vmovups(ptr[reg_tr_src + r * tr_src_stride
+                                + g * simd_w * typesize],
+                        Ymm(r * ngroups + g));
+    };
+
+    const int ow = conf_->ow;
+    if (ow / unroll > 0) {
+        Label row_loop;
+        mov(reg_loop, ow / unroll);
+        L(row_loop);
+        {
+            copy_rows(unroll);
+            add(reg_src, unroll * src_stride);
+            add(reg_tr_src, unroll * tr_src_stride);
+            sub(reg_loop, 1);
+            jnz(row_loop, T_NEAR);
+        }
+    }
+    copy_rows(ow % unroll);
+
+    // The rows past ow are zeroed as the brgemm reduces over the whole tr_ow
+    const int zero_rows = conf_->tr_ow - ow;
+    for (int r = 0; r < zero_rows; r++)
+        for (int g = 0; g < ngroups; g++)
+            vmovups(ptr[reg_tr_src + ((ow % unroll) + r) * tr_src_stride
+                            + g * simd_w * typesize],
+                    ymm_zero);
+
+    postamble();
+}
+
 /*
 // -------------------------------------------------
 // jit_transpose4x16_src_t
@@ -1502,6 +1786,7 @@ void jit_diff_wei_trans_to_vnni_t::generate() {
 #undef GET_OFF
 
 jit_trans_src_t *create_trans_src(const jit_conv_conf_t *conf) {
+    if (conf->src_dt == data_type::f32) return new jit_trans_iw_ic_f32_t(conf);
     if (conf->has_vnni && IMPLICATION(conf->is_1stconv, conf->transpose_src))
         return new jit_trans_iw_ic_t(conf);
     assert(!"unsupported configuration");
@@ -1509,7 +1794,7 @@ jit_trans_src_t *create_trans_src(const jit_conv_conf_t *conf) {
 }
 
 jit_trans_dst_t *create_trans_dst(const jit_conv_conf_t *conf) {
-
+    if (conf->dst_dt == data_type::f32) return new jit_trans_ow_oc_f32_t(conf);
     if (conf->has_vnni) return new jit_trans_ow_oc_t(conf);
     assert(!"unsupported configuration");
     return nullptr;
@@ -0,0 +1,854 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/float4.hpp"
+#include "common/float8.hpp"
+#include "common/int4.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/x64/jit_uni_reorder_4bit.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+
+using namespace Xbyak;
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace {
+
+// Returns the f32 value of a 4-bit `code` of a data type `dt`.
+float decode_4bit(data_type_t dt, uint8_t code) {
+    switch (dt) {
+        case data_type::s4: return static_cast<float>(int4_t(code));
+        case data_type::u4: return static_cast<float>(uint4_t(code));
+        case data_type::f4_e2m1:
+            return static_cast<float>(float4_e2m1_t(code, true));
+        case data_type::f4_e3m0:
+            return static_cast<float>(float4_e3m0_t(code, true));
+        default: assert(!"unexpected data type");
+    }
+    return 0.f;
+}
+
+// Returns a 4-bit code of an f32 value `f` for floating-point data type `dt`.
+uint8_t encode_fp4(data_type_t dt, float f) {
+    switch (dt) {
+        case data_type::f4_e2m1: return float4_e2m1_t(f).raw_bits_;
+        case data_type::f4_e3m0: return float4_e3m0_t(f).raw_bits_;
+        default: assert(!"unexpected data type");
+    }
+    return 0;
+}
+
+} // namespace
+
+template <typename Vmm>
+struct jit_4bit_reorder_kernel_t : public jit_uni_reorder_4bit_t::kernel_base_t,
+                                   public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_4bit_reorder_kernel_t)
+
+    using call_params_t = jit_uni_reorder_4bit_t::call_params_t;
+
+    jit_4bit_reorder_kernel_t(const jit_reorder_4bit_conf_t &conf)
+        : jit_generator_t(jit_name(), conf.isa)
+        , conf_(conf)
+        , dt_4bit_(conf.is_quantization ? conf.dst_dt : conf.src_dt) {
+        assert(simd_w_ == conf_.simd_w);
+    }
+
+    void operator()(const call_params_t *p) const override {
+        jit_generator_t::operator()(p);
+    }
+
+    status_t create_kernel() override {
+        return jit_generator_t::create_kernel();
+    }
+
+private:
+    static constexpr bool is_zmm_ = std::is_same<Vmm, Zmm>::value;
+    static constexpr int vlen_ = vreg_traits_t<Vmm>::vlen;
+    static constexpr int simd_w_ = vlen_ / sizeof(float);
+    // Number of thresholds separating 8 magnitudes of a floating-point 4-bit
+    // data type.
+    static constexpr int n_thresholds_ = 7;
+
+    // Constants of the table. Each constant but the lookup table is
+    // broadcasted over a full vector.
+    enum table_entry_t {
+        nibble_mask = 0,
+        abs_mask,
+        f32_one,
+        s32_minus_one,
+        qz_lbound,
+        qz_ubound,
+        dst_max,
+        e8m0_shift,
+        s32_253,
+        s32_254,
+        pack_shuffle,
+        threshold,
+    };
+
+    // The lookup table from a 4-bit code to f32 occupies first 64 bytes.
+    Address table_ptr(int entry, int idx = 0) {
+        return ptr[reg_table + 16 * sizeof(float) + (entry + idx) * vlen_];
+    }
+    Address lut_ptr(int idx = 0) { return ptr[reg_table + idx * vlen_]; }
+
+    void uni_vpor(const Vmm &x1, const Vmm &x2, const Operand &op) {
+        if (is_zmm_)
+            vpord(x1, x2, op);
+        else
+            vpor(x1, x2, op);
+    }
+
+    // Leaves the maximum of `v` values in every lane.
+    void reduce_max(const Vmm &v) {
+        if (is_zmm_) {
+            const Zmm z(v.getIdx()), z_tmp(vmm_tmp.getIdx());
+            vshuff32x4(z_tmp, z, z, 0x4E);
+            vmaxps(z, z, z_tmp);
+            vshuff32x4(z_tmp, z, z, 0xB1);
+            vmaxps(z, z, z_tmp);
+        } else {
+            const Ymm y(v.getIdx()), y_tmp(vmm_tmp.getIdx());
+            vperm2f128(y_tmp, y, y, 0x01);
+            vmaxps(y, y, y_tmp);
+        }
+        vpermilps(vmm_tmp, v, 0x4E);
+        vmaxps(v, v, vmm_tmp);
+        vpermilps(vmm_tmp, v, 0xB1);
+        vmaxps(v, v, vmm_tmp);
+    }
+
+    // Loads `simd_w_` packed nibbles and expands them into dword codes.
+    void load_codes(const Vmm &v) {
+        vpmovzxbq(v, ptr[reg_src]);
+        // Moves the high nibble of each byte into the upper dword of a qword.
+        vpsllq(vmm_tmp, v, 28);
+        uni_vpor(v, v, vmm_tmp);
+        uni_vpand(v, v, table_ptr(nibble_mask));
+    }
+
+    // Packs dword codes of `v` by two into bytes and stores them.
+    void store_codes(const Vmm &v) {
+        vpsrlq(vmm_tmp, v, 28);
+        uni_vpor(v, v, vmm_tmp);
+        if (is_zmm_) {
+            vpmovqb(ptr[reg_dst], Zmm(v.getIdx()));
+        } else {
+            const Xmm x(v.getIdx()), x_tmp(vmm_tmp.getIdx());
+            vpshufb(v, v, table_ptr(pack_shuffle));
+            vextracti128(x_tmp, Ymm(v.getIdx()), 1);
+            vpunpcklwd(x, x, x_tmp);
+            vmovd(ptr[reg_dst], x);
+        }
+    }
+
+    // Converts dword codes of `v` into f32 values.
+    void lookup(const Vmm &v) {
+        if (is_zmm_) {
+            vpermps(v, v, lut_ptr());
+        } else {
+            // Ymm permutation covers 8 entries only, the 4th bit of a code
+            // selects the half of the table.
+            vpslld(vmm_mask, v, 28);
+            vpermps(vmm_tmp, v, lut_ptr(1));
+            vpermps(v, v, lut_ptr(0));
+            vblendvps(v, v, vmm_tmp, vmm_mask);
+        }
+    }
+
+    // Converts f32 values of `v` into dword codes of `dt_4bit_`.
+    void encode(const Vmm &v) {
+        if (utils::one_of(dt_4bit_, data_type::s4, data_type::u4)) {
+            vmaxps(v, v, table_ptr(qz_lbound));
+            vminps(v, v, table_ptr(qz_ubound));
+            vcvtps2dq(v, v);
+            uni_vpand(v, v, table_ptr(nibble_mask));
+            return;
+        }
+
+        // Floating-point codes are ordered by magnitude, so a code is the
+        // number of midpoints between neighbouring magnitudes the absolute
+        // value passes. A tie follows the reference conversion, and NaN and
+        // infinity saturate to the largest magnitude.
+        vpsrld(vmm_sign, v, 31);
+        vpslld(vmm_sign, vmm_sign, 3);
+        uni_vpand(v, v, table_ptr(abs_mask));
+        uni_vpxor(vmm_code, vmm_code, vmm_code);
+        for (int i = 0; i < n_thresholds_; i++) {
+            const int pred = thr_ties_up_[i] ? _cmp_nlt_us : _cmp_nle_us;
+            if (is_zmm_) {
+                vcmpps(k_cmp, v, table_ptr(threshold, i), pred);
+                vpsubd(vmm_code | k_cmp, vmm_code, table_ptr(s32_minus_one));
+            } else {
+                vcmpps(vmm_tmp, v, table_ptr(threshold, i), pred);
+                vpsubd(vmm_code, vmm_code, vmm_tmp);
+            }
+        }
+        uni_vpor(v, vmm_code, vmm_sign);
+    }
+
+    // Loads (or broadcasts) quantization entries of data type `dt` located
+    // at `reg` and converts them to f32.
+    void load_qparam(const Vmm &v, data_type_t dt, const Reg64 &reg,
+            bool bcast) {
+        using namespace data_type;
+        using Vmm_lower_t = typename vreg_traits_t<Vmm>::Vmm_lower_t;
+        const Xmm x(v.getIdx());
+        switch (dt) {
+            case f32:
+                if (bcast)
+                    vbroadcastss(v, ptr[reg]);
+                else
+                    vmovups(v, ptr[reg]);
+                break;
+            case bf16:
+                if (bcast)
+                    vpbroadcastw(v, ptr[reg]);
+                else
+                    vpmovzxwd(v, ptr[reg]);
+                vpslld(v, v, 16);
+                break;
+            case f16:
+                if (bcast) {
+                    vpbroadcastw(Vmm_lower_t(v.getIdx()), ptr[reg]);
+                    vcvtph2ps(v, Vmm_lower_t(v.getIdx()));
+                } else
+                    vcvtph2ps(v, ptr[reg]);
+                break;
+            case s32:
+                if (bcast)
+                    vpbroadcastd(v, ptr[reg]);
+                else
+                    vmovups(v, ptr[reg]);
+                vcvtdq2ps(v, v);
+                break;
+            case s8:
+            case u8:
+                if (bcast) {
+                    if (dt == s8)
+                        movsx(reg_tmp.cvt32(), byte[reg]);
+                    else
+                        movzx(reg_tmp.cvt32(), byte[reg]);
+                    vmovd(x, reg_tmp.cvt32());
+                    vpbroadcastd(v, x);
+                } else if (dt == s8)
+                    vpmovsxbd(v, ptr[reg]);
+                else
+                    vpmovzxbd(v, ptr[reg]);
+                vcvtdq2ps(v, v);
+                break;
+            default: assert(!"unexpected data type");
+        }
+    }
+
+    void store_dst(const Vmm &v) {
+        using namespace data_type;
+        switch (conf_.dst_dt) {
+            case f32: vmovups(ptr[reg_dst], v); break;
+            case f16: vcvtps2ph(ptr[reg_dst], v, _op_mxcsr); break;
+            case bf16:
+                if (is_zmm_) {
+                    const Ymm y_tmp(vmm_tmp.getIdx());
+                    vcvtneps2bf16(y_tmp, v);
+                    vmovdqu(ptr[reg_dst], y_tmp);
+                } else {
+                    const Xmm x_tmp(vmm_tmp.getIdx());
+                    vcvtneps2bf16(x_tmp, v, Xbyak::VexEncoding);
+                    vmovdqu(ptr[reg_dst], x_tmp);
+                }
+                break;
+            default: assert(!"unexpected data type");
+        }
+    }
+
+    void dequantize_vec(bool bcast_qparams) {
+        load_codes(vmm_val);
+        lookup(vmm_val);
+        if (conf_.with_zps) {
+            if (!bcast_qparams)
+                load_qparam(vmm_zp, conf_.zps_dt, reg_zps, false);
+            vsubps(vmm_val, vmm_val, vmm_zp);
+        }
+        if (conf_.with_scales) {
+            if (!bcast_qparams)
+                load_qparam(vmm_scale, conf_.scales_dt, reg_scales, false);
+            vmulps(vmm_val, vmm_val, vmm_scale);
+        }
+        store_dst(vmm_val);
+
+        add(reg_src, simd_w_ / 2);
+        add(reg_dst, simd_w_ * types::data_type_size(conf_.dst_dt));
+        if (bcast_qparams) return;
+        if (conf_.with_scales)
+            add(reg_scales, simd_w_ * types::data_type_size(conf_.scales_dt));
+        if (conf_.with_zps)
+            add(reg_zps, simd_w_ * types::data_type_size(conf_.zps_dt));
+    }
+
+    void dequantize() {
+        Label l_group, l_vec, l_end;
+
+        if (conf_.qpattern != jit_4bit_qpattern_t::grouped) {
+            L(l_vec);
+            cmp(reg_len, 0);
+            jle(l_end, T_NEAR);
+            dequantize_vec(false);
+            sub(reg_len, simd_w_);
+            jmp(l_vec, T_NEAR);
+            L(l_end);
+            return;
+        }
+
+        L(l_group);
+        {
+            cmp(reg_len, 0);
+            jle(l_end, T_NEAR);
+            if (conf_.with_scales)
+                load_qparam(vmm_scale, conf_.scales_dt, reg_scales, true);
+            if (conf_.with_zps)
+                load_qparam(vmm_zp, conf_.zps_dt, reg_zps, true);
+            mov(reg_cnt, reg_group);
+            L(l_vec);
+            {
+                dequantize_vec(true);
+                sub(reg_cnt, simd_w_);
+                jg(l_vec, T_NEAR);
+            }
+            if (conf_.with_scales)
+                add(reg_scales, types::data_type_size(conf_.scales_dt));
+            if (conf_.with_zps)
+                add(reg_zps, types::data_type_size(conf_.zps_dt));
+            sub(reg_len, reg_group);
+            jmp(l_group, T_NEAR);
+        }
+        L(l_end);
+    }
+
+    void quantize_vec() {
+        vmulps(vmm_val, vmm_mul, ptr[reg_src]);
+        encode(vmm_val);
+        store_codes(vmm_val);
+        add(reg_src, vlen_);
+        add(reg_dst, simd_w_ / 2);
+    }
+
+    // Computes a destination scale from the group maximum `vmm_amax`, stores
+    // it and sets `vmm_mul` to the factor quantizing the group.
+    void compute_dyn_scale() {
+        if (conf_.dyn_qmode == quantization_mode::dynamic_mx) {
+            // The e8m0 scale is `round_down_pow2(amax) /
+            // round_down_pow2(dst_max)`, clamped from below at 2^-127
+            // encoded as `0`.
+            vpsrld(vmm_tmp, vmm_amax, 23);
+            vpsubd(vmm_tmp, vmm_tmp, table_ptr(e8m0_shift));
+            vpmaxsd(vmm_tmp, vmm_tmp, vmm_zero);
+            vmovd(reg_tmp.cvt32(), Xmm(vmm_tmp.getIdx()));
+            mov(ptr[reg_dyn_scales], reg_tmp.cvt8());
+            add(reg_dyn_scales, sizeof(uint8_t));
+            // The inverse of 2^(e - 127) is 2^(127 - e), or the biased
+            // exponent `254 - e`.
+            vpminsd(vmm_tmp, vmm_tmp, table_ptr(s32_253));
+            vmovups(vmm_mul, table_ptr(s32_254));
+            vpsubd(vmm_mul, vmm_mul, vmm_tmp);
+            vpslld(vmm_mul, vmm_mul, 23);
+        } else {
+            // A zero group gets a unit scale.
+            vdivps(vmm_tmp, vmm_amax, table_ptr(dst_max));
+            if (is_zmm_) {
+                vcmpps(k_cmp, vmm_amax, vmm_zero, _cmp_eq_oq);
+                vmovups(vmm_tmp | k_cmp, table_ptr(f32_one));
+            } else {
+                vcmpps(vmm_mask, vmm_amax, vmm_zero, _cmp_eq_oq);
+                vblendvps(vmm_tmp, vmm_tmp, table_ptr(f32_one), vmm_mask);
+            }
+            vmovss(ptr[reg_dyn_scales], Xmm(vmm_tmp.getIdx()));
+            add(reg_dyn_scales, sizeof(float));
+            vmovups(vmm_mul, table_ptr(f32_one));
+            vdivps(vmm_mul, vmm_mul, vmm_tmp);
+        }
+        vmulps(vmm_mul, vmm_mul, vmm_alpha);
+    }
+
+    void quantize() {
+        Label l_group, l_amax, l_vec, l_end;
+
+        if (conf_.dyn_qmode == quantization_mode::undef) {
+            vmovups(vmm_mul, vmm_alpha);
+            L(l_vec);
+            cmp(reg_len, 0);
+            jle(l_end, T_NEAR);
+            quantize_vec();
+            sub(reg_len, simd_w_);
+            jmp(l_vec, T_NEAR);
+            L(l_end);
+            return;
+        }
+
+        // A group is read twice: to find its maximum and to quantize it. The
+        // second read hits the cache as groups are small.
+        L(l_group);
+        {
+            cmp(reg_len, 0);
+            jle(l_end, T_NEAR);
+            mov(reg_src_group, reg_src);
+            uni_vpxor(vmm_amax, vmm_amax, vmm_amax);
+            mov(reg_cnt, reg_group);
+            L(l_amax);
+            {
+                vmulps(vmm_val, vmm_alpha, ptr[reg_src]);
+                uni_vpand(vmm_val, vmm_val, table_ptr(abs_mask));
+                vmaxps(vmm_amax, vmm_amax, vmm_val);
+                add(reg_src, vlen_);
+                sub(reg_cnt, simd_w_);
+                jg(l_amax, T_NEAR);
+            }
+            reduce_max(vmm_amax);
+            compute_dyn_scale();
+
+            mov(reg_src, reg_src_group);
+            mov(reg_cnt, reg_group);
+            L(l_vec);
+            {
+                quantize_vec();
+                sub(reg_cnt, simd_w_);
+                jg(l_vec, T_NEAR);
+            }
+            sub(reg_len, reg_group);
+            jmp(l_group, T_NEAR);
+        }
+        L(l_end);
+    }
+
+    void init_thresholds() {
+        if (!utils::one_of(dt_4bit_, data_type::f4_e2m1, data_type::f4_e3m0))
+            return;
+        for (int i = 0; i < n_thresholds_; i++) {
+            const float lo = decode_4bit(dt_4bit_, i);
+            const float hi = decode_4bit(dt_4bit_, i + 1);
+            thr_[i] = (lo + hi) / 2.f;
+            thr_ties_up_[i] = encode_fp4(dt_4bit_, thr_[i]) == i + 1;
+        }
+    }
+
+    void emit_table() {
+        auto bcast = [&](uint32_t v) {
+            for (int i = 0; i < simd_w_; i++)
+                dd(v);
+        };
+
+        align(64);
+        L(l_table_);
+        for (int c = 0; c < 16; c++)
+            dd(float2int(decode_4bit(dt_4bit_, c)));
+
+        const data_type_t dt_f32 = data_type::f32;
+        const float lbound = conf_.is_quantization
+                ? types::lowest_value<float>(dt_4bit_)
+                : 0.f;
+        const float ubound = conf_.is_quantization
+                ? types::max_value<float>(dt_4bit_)
+                : 0.f;
+        // Unbiased exponent of the largest destination value rounded down to
+        // a power of two.
+        const int dst_max_exp = conf_.is_quantization
+                ? float8_e8m0_t(ubound).raw_bits_ - 127
+                : 0;
+        bcast(0x0f);
+        bcast(0x7fffffff);
+        bcast(float2int(1.f));
+        bcast(0xffffffff);
+        bcast(float2int(lbound));
+        bcast(float2int(ubound));
+        bcast(float2int(types::max_value<float>(
+                conf_.is_quantization ? dt_4bit_ : dt_f32)));
+        bcast(dst_max_exp);
+        bcast(253);
+        bcast(254);
+        // Picks the first byte of every qword within 128-bit lanes.
+        for (int l = 0; l < vlen_ / 16; l++) {
+            db(0);
+            db(8);
+            for (int b = 2; b < 16; b++)
+                db(0x80);
+        }
+        for (int i = 0; i < n_thresholds_; i++)
+            bcast(float2int(thr_[i]));
+    }
+
+    void generate() override {
+        preamble();
+
+        init_thresholds();
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        mov(reg_src, ptr[abi_param1 + PARAM_OFF(src)]);
+        mov(reg_dst, ptr[abi_param1 + PARAM_OFF(dst)]);
+        mov(reg_scales, ptr[abi_param1 + PARAM_OFF(scales)]);
+        mov(reg_zps, ptr[abi_param1 + PARAM_OFF(zero_points)]);
+        mov(reg_dyn_scales, ptr[abi_param1 + PARAM_OFF(dyn_scales)]);
+        mov(reg_len, ptr[abi_param1 + PARAM_OFF(len)]);
+        mov(reg_group, ptr[abi_param1 + PARAM_OFF(group)]);
+        vbroadcastss(vmm_alpha, ptr[abi_param1 + PARAM_OFF(alpha)]);
+#undef PARAM_OFF
+        mov(reg_table, l_table_);
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+
+        if (conf_.is_quantization)
+            quantize();
+        else
+            dequantize();
+
+        postamble();
+
+        emit_table();
+    }
+
+    const jit_reorder_4bit_conf_t conf_;
+    const data_type_t dt_4bit_;
+    float thr_[n_thresholds_] = {};
+    bool thr_ties_up_[n_thresholds_] = {};
+
+    Label l_table_;
+
+    const Reg64 reg_tmp = rax;
+    const Reg64 reg_src = r8;
+    const Reg64 reg_dst = r9;
+    const Reg64 reg_len = r10;
+    const Reg64 reg_scales = r11;
+    const Reg64 reg_zps = r12;
+    const Reg64 reg_group = r13;
+    const Reg64 reg_cnt = r14;
+    const Reg64 reg_table = r15;
+    const Reg64 reg_dyn_scales = rbx;
+    const Reg64 reg_src_group = rbp;
+
+    const Opmask k_cmp = k1;
+
+    // `vmm_mask` must be the 0th register for blending on Ymm.
+    const Vmm vmm_mask = Vmm(0);
+    const Vmm vmm_val = Vmm(1);
+    const Vmm vmm_tmp = Vmm(2);
+    const Vmm vmm_code = Vmm(3);
+    const Vmm vmm_sign = Vmm(4);
+    const Vmm vmm_scale = Vmm(5);
+    const Vmm vmm_zp = Vmm(6);
+    const Vmm vmm_alpha = Vmm(7);
+    const Vmm vmm_mul = Vmm(8);
+    const Vmm vmm_amax = Vmm(9);
+    const Vmm vmm_zero = Vmm(10);
+};
+
+status_t jit_uni_reorder_4bit_t::pd_t::create(reorder_pd_t **reorder_pd,
+        engine_t *engine, const primitive_attr_t *attr, engine_t *src_engine,
+        const memory_desc_t *src_md, engine_t *dst_engine,
+        const memory_desc_t *dst_md) {
+    auto _pd = make_unique_pd<pd_t>(
+            attr, src_engine->kind(), src_md, dst_engine->kind(), dst_md);
+    if (_pd == nullptr) return status::out_of_memory;
+
+    CHECK(_pd->init(engine, src_engine, dst_engine));
+
+    return safe_ptr_assign(*reorder_pd, _pd.release());
+}
+
+status_t jit_uni_reorder_4bit_t::pd_t::init(
+        engine_t *engine, engine_t *src_engine, engine_t *dst_engine) {
+    using namespace data_type;
+    using namespace utils;
+
+    CHECK(cpu_reorder_pd_t::init(engine, src_engine, dst_engine));
+
+    VDISPATCH_REORDER(is_dense_format_kind({src_md(), dst_md()}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    const int ndims = src_d.ndims();
+
+    VDISPATCH_REORDER(!src_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_REORDER(!dst_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_REORDER(!src_d.has_zero_dim(), VERBOSE_EMPTY_TENSOR, "src");
+
+    auto &conf = conf_;
+    conf.src_dt = src_d.data_type();
+    conf.dst_dt = dst_d.data_type();
+    conf.is_quantization = conf.src_dt == f32
+            && one_of(conf.dst_dt, s4, u4, f4_e2m1, f4_e3m0);
+    const bool is_dequantization
+            = one_of(conf.src_dt, s4, u4, f4_e2m1, f4_e3m0)
+            && one_of(conf.dst_dt, f32, bf16, f16);
+    VDISPATCH_REORDER(conf.is_quantization || is_dequantization,
+            VERBOSE_UNSUPPORTED_DT);
+
+    if (mayiuse(avx512_core))
+        conf.isa = avx512_core;
+    else if (mayiuse(avx2))
+        conf.isa = avx2;
+    VDISPATCH_REORDER(conf.isa != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+    conf.simd_w = isa_max_vlen(conf.isa) / sizeof(float);
+    VDISPATCH_REORDER(IMPLICATION(conf.dst_dt == bf16,
+                              conf.isa == avx512_core
+                                      ? mayiuse(avx512_core_bf16)
+                                      : mayiuse(avx2_vnni_2)),
+            VERBOSE_ISA_DT_MISMATCH);
+
+    // Both tensors must share a plain dense layout with the last dimension
+    // being the innermost one, so every row is a contiguous run of nibbles.
+    VDISPATCH_REORDER(src_d.is_plain() && src_d.is_dense(),
+            VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "src");
+    VDISPATCH_REORDER(dst_d.is_plain() && dst_d.is_dense(),
+            VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "dst");
+    VDISPATCH_REORDER(src_d.similar_to(dst_d, true, false, 0),
+            VERBOSE_TENSOR_FORMAT_MISMATCH, "src", "dst");
+    VDISPATCH_REORDER(src_d.blocking_desc().strides[ndims - 1] == 1,
+            VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "src");
+    VDISPATCH_REORDER(src_d.offset0() % 2 == 0 && dst_d.offset0() % 2 == 0,
+            VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "src or dst");
+    VDISPATCH_REORDER(src_d.extra().flags == 0 && dst_d.extra().flags == 0,
+            VERBOSE_UNSUPPORTED_MD_FLAG, "src or dst");
+
+    using smask_t = primitive_attr_t::skip_mask_t;
+    VDISPATCH_REORDER(
+            attr()->has_default_values(smask_t::scales_data_type
+                    | smask_t::scales_groups | smask_t::zero_points_data_type
+                    | smask_t::zero_points_groups),
+            VERBOSE_UNSUPPORTED_ATTR);
+
+    const auto &scales = attr()->scales_;
+    const auto &zps = attr()->zero_points_;
+    conf.row_len = src_d.dims()[ndims - 1];
+    conf.unit = conf.simd_w;
+
+    // A static scale is supported as a single f32 value.
+    auto is_static_scalar = [](const quant_entry_t &e) {
+        return e.has_default_values()
+                || (e.get_mask() == 0 && e.has_default_groups()
+                        && e.get_data_type() == f32 && !e.is_host_scalar()
+                        && !e.is_dynamic());
+    };
+
+    if (conf.is_quantization) {
+        VDISPATCH_REORDER(zps.has_default_values(), VERBOSE_UNSUPPORTED_ZP_CFG);
+        VDISPATCH_REORDER(is_static_scalar(scales.get(DNNL_ARG_SRC)),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+
+        const auto &sc_dst = scales.get(DNNL_ARG_DST);
+        if (sc_dst.is_dynamic()) {
+            conf.dyn_qmode = sc_dst.get_quantization_mode();
+            conf.group = sc_dst.get_group(1);
+            VDISPATCH_REORDER(ndims >= 2 && sc_dst.get_group(0) == 1
+                            && (sc_dst.get_mask() & (1 << (ndims - 1))),
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
+            VDISPATCH_REORDER(conf.group % conf.simd_w == 0,
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
+            VDISPATCH_REORDER(sc_dst.get_data_type()
+                            == (sc_dst.is_mx() ? e8m0 : f32),
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
+            VDISPATCH_REORDER(
+                    !sc_dst.is_host_scalar(), VERBOSE_UNSUPPORTED_SCALES_CFG);
+            conf.unit = conf.group;
+        } else {
+            VDISPATCH_REORDER(
+                    is_static_scalar(sc_dst), VERBOSE_UNSUPPORTED_SCALES_CFG);
+        }
+    } else {
+        VDISPATCH_REORDER(scales.has_default_values(DNNL_ARG_DST),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        VDISPATCH_REORDER(zps.has_default_values(DNNL_ARG_DST),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+
+        const auto &sc = scales.get(DNNL_ARG_SRC);
+        conf.with_scales = !sc.has_default_values();
+        conf.scales_dt = sc.get_data_type();
+        VDISPATCH_REORDER(IMPLICATION(conf.with_scales,
+                                  one_of(conf.scales_dt, f32, bf16, f16)
+                                          && !sc.is_host_scalar()
+                                          && !sc.is_dynamic()),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+
+        const auto &zp = zps.get(DNNL_ARG_SRC);
+        conf.with_zps = !zp.has_default_values();
+        conf.zps_dt = zp.get_data_type();
+        VDISPATCH_REORDER(IMPLICATION(conf.with_zps,
+                                  one_of(conf.zps_dt, s32, s8, u8)
+                                          && !zp.is_host_scalar()),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+
+        // Number of consecutive row points sharing an entry.
+        auto row_group = [&](const quant_entry_t &e) {
+            if (!(e.get_mask() & (1 << (ndims - 1)))) return conf.row_len;
+            return e.get_group(1);
+        };
+        const dim_t sc_group = conf.with_scales ? row_group(sc) : 0;
+        const dim_t zp_group = conf.with_zps ? row_group(zp) : 0;
+        // Scales and zero-points share the kernel loop structure.
+        VDISPATCH_REORDER(IMPLICATION(conf.with_scales && conf.with_zps,
+                                  sc_group == zp_group),
+                VERBOSE_UNSUPPORTED_ATTR);
+        conf.group = nstl::max(sc_group, zp_group);
+
+        if (conf.group == 1) {
+            conf.qpattern = jit_4bit_qpattern_t::per_point;
+        } else if (conf.group > 1) {
+            conf.qpattern = jit_4bit_qpattern_t::grouped;
+            VDISPATCH_REORDER(conf.group % conf.simd_w == 0,
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
+            // An entry per row doesn't restrict splitting the row.
+            if (conf.group != conf.row_len) conf.unit = conf.group;
+        }
+    }
+
+    VDISPATCH_REORDER(conf.row_len % conf.unit == 0,
+            "row length is not a multiple of the kernel block");
+
+    return status::success;
+}
+
+jit_uni_reorder_4bit_t::kernel_base_t *
+jit_uni_reorder_4bit_t::kernel_base_t::create(
+        const jit_reorder_4bit_conf_t &conf) {
+    if (is_superset(conf.isa, avx512_core))
+        return new jit_4bit_reorder_kernel_t<Zmm>(conf);
+    else if (is_superset(conf.isa, avx2))
+        return new jit_4bit_reorder_kernel_t<Ymm>(conf);
+    assert(!"unexpected");
+    return nullptr;
+}
+
+status_t jit_uni_reorder_4bit_t::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(kernel_, kernel_base_t::create(pd()->conf_)));
+    return kernel_->create_kernel();
+}
+
+status_t jit_uni_reorder_4bit_t::execute(const exec_ctx_t &ctx) const {
+    const auto &conf = pd()->conf_;
+    const auto in = CTX_IN_MEM(const char *, DNNL_ARG_FROM);
+    auto out = CTX_OUT_MEM(char *, DNNL_ARG_TO);
+
+    const auto &scales = pd()->attr()->scales_;
+    const auto &zps = pd()->attr()->zero_points_;
+    const bool with_dyn_scales = conf.dyn_qmode != quantization_mode::undef;
+
+    const auto src_scales = CTX_IN_MEM(
+            const char *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
+    const auto src_zero_points = CTX_IN_MEM(
+            const char *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_SRC);
+    const auto dst_scales = with_dyn_scales
+            ? nullptr
+            : CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
+    const auto dyn_scales = with_dyn_scales
+            ? CTX_OUT_MEM(char *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST)
+            : nullptr;
+
+    // Static quantization scales are single values.
+    float alpha = 1.f;
+    if (conf.is_quantization) {
+        if (!scales.has_default_values(DNNL_ARG_SRC))
+            alpha *= reinterpret_cast<const float *>(src_scales)[0];
+        if (dst_scales && !scales.has_default_values(DNNL_ARG_DST))
+            alpha /= dst_scales[0];
+    }
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const int ndims = src_d.ndims();
+
+    // Quantization entries are addressed by logical indices of the points
+    // they apply to.
+    const int q_arg = conf.is_quantization ? DNNL_ARG_DST : DNNL_ARG_SRC;
+    const auto &q_base_md = conf.is_quantization ? *pd()->dst_md()
+                                                 : *pd()->src_md();
+    memory_desc_t scales_md {}, zps_md {};
+    CHECK(scales.get(q_arg).get_md(scales_md, q_base_md));
+    CHECK(zps.get(DNNL_ARG_SRC).get_md(zps_md, q_base_md));
+    const memory_desc_wrapper scales_d(scales_md), zps_d(zps_md);
+
+    auto quant_off = [&](const memory_desc_wrapper &q_d,
+                             const quant_entry_t &e, const dims_t &idx) {
+        dims_t q_idx {};
+        for (int d = 0; d < ndims; d++) {
+            if (!(e.get_mask() & (1 << d))) continue;
+            dim_t group = 1;
+            if (d == ndims - 1) group = e.get_group(1);
+            if (d == ndims - 2) group = e.get_group(0);
+            q_idx[d] = idx[d] / group;
+        }
+        return q_d.off_v(q_idx);
+    };
+
+    auto byte_off = [](const memory_desc_wrapper &mdw, const dims_t &idx) {
+        return mdw.off_v(idx) * mdw.data_type_size()
+                / mdw.sub_byte_data_type_multiplier();
+    };
+
+    const dim_t row_len = conf.row_len;
+    const dim_t nrows = src_d.nelems() / row_len;
+    const dim_t units_per_row = row_len / conf.unit;
+    // Every call covers a few KB of f32 data to amortize the call overhead
+    // while leaving parallel work for a small number of long rows.
+    const dim_t units_per_piece = nstl::max<dim_t>(1,
+            nstl::min<dim_t>(units_per_row, 2048 / conf.unit));
+    const dim_t piece_len = units_per_piece * conf.unit;
+    const dim_t npieces = utils::div_up(units_per_row, units_per_piece);
+
+    parallel_nd(nrows, npieces, [&](dim_t r, dim_t p) {
+        dims_t idx {};
+        utils::l_dims_by_l_offset(idx, r, src_d.dims(), ndims - 1);
+        idx[ndims - 1] = p * piece_len;
+
+        call_params_t args;
+        args.src = in + byte_off(src_d, idx);
+        args.dst = out + byte_off(dst_d, idx);
+        args.scales = conf.with_scales
+                ? src_scales
+                        + quant_off(scales_d, scales.get(DNNL_ARG_SRC), idx)
+                                * types::data_type_size(conf.scales_dt)
+                : nullptr;
+        args.zero_points = conf.with_zps
+                ? src_zero_points
+                        + quant_off(zps_d, zps.get(DNNL_ARG_SRC), idx)
+                                * types::data_type_size(conf.zps_dt)
+                : nullptr;
+        args.dyn_scales = with_dyn_scales
+                ? dyn_scales
+                        + quant_off(scales_d, scales.get(DNNL_ARG_DST), idx)
+                                * scales_d.data_type_size()
+                : nullptr;
+        args.len = nstl::min(piece_len, row_len - idx[ndims - 1]);
+        args.group = nstl::min(conf.group, args.len);
+        args.alpha = alpha;
+        (*kernel_)(&args);
+    });
+
+    return status::success;
+}
+
+template struct jit_4bit_reorder_kernel_t<Zmm>;
+template struct jit_4bit_reorder_kernel_t<Ymm>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
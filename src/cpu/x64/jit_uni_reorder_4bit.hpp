@@ -0,0 +1,125 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_REORDER_4BIT_HPP
+#define CPU_X64_JIT_UNI_REORDER_4BIT_HPP
+
+#include "common/c_types_map.hpp"
+
+#include "cpu/reorder/cpu_reorder_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Describes how a quantization entry is picked along the last dimension.
+enum class jit_4bit_qpattern_t {
+    // No quantization entries.
+    none,
+    // An entry is shared by `group` consecutive points of a row.
+    grouped,
+    // An entry per point.
+    per_point,
+};
+
+struct jit_reorder_4bit_conf_t {
+    cpu_isa_t isa = isa_undef;
+    int simd_w = 0;
+    data_type_t src_dt = data_type::undef;
+    data_type_t dst_dt = data_type::undef;
+    // `true` for f32 -> 4-bit, `false` for 4-bit -> f32/bf16/f16.
+    bool is_quantization = false;
+
+    // Dequantization parameters.
+    bool with_scales = false;
+    data_type_t scales_dt = data_type::undef;
+    bool with_zps = false;
+    data_type_t zps_dt = data_type::undef;
+    jit_4bit_qpattern_t qpattern = jit_4bit_qpattern_t::none;
+
+    // Quantization parameters: `dynamic_mx` and `dynamic_fp` make the kernel
+    // compute a destination scale per `group` points of a row.
+    quantization_mode_t dyn_qmode = quantization_mode::undef;
+
+    // Number of consecutive row points sharing a quantization entry.
+    dim_t group = 0;
+    // Length of the last dimension.
+    dim_t row_len = 0;
+    // Granularity of a kernel call in points.
+    dim_t unit = 0;
+};
+
+struct jit_uni_reorder_4bit_t : public primitive_t {
+    using primitive_t::primitive_t;
+    struct pd_t : public cpu_reorder_pd_t {
+        using cpu_reorder_pd_t::cpu_reorder_pd_t;
+
+        DECLARE_COMMON_PD_T("jit_4bit:uni", jit_uni_reorder_4bit_t);
+
+        status_t init(
+                engine_t *engine, engine_t *src_engine, engine_t *dst_engine);
+
+        jit_reorder_4bit_conf_t conf_;
+
+    private:
+        static status_t create(reorder_pd_t **reorder_pd, engine_t *engine,
+                const primitive_attr_t *attr, engine_t *src_engine,
+                const memory_desc_t *src_md, engine_t *dst_engine,
+                const memory_desc_t *dst_md);
+
+        friend dnnl::impl::impl_list_item_t;
+    };
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+    struct call_params_t {
+        const void *src;
+        void *dst;
+        // Source scales and zero-points for dequantization.
+        const void *scales;
+        const void *zero_points;
+        // Destination scales computed for dynamic quantization.
+        void *dyn_scales;
+        // Number of points to process, a multiple of `conf.unit`.
+        dim_t len;
+        // Number of points sharing a quantization entry.
+        dim_t group;
+        // Static scale factor applied to the source values.
+        float alpha;
+    };
+
+    struct kernel_base_t {
+        virtual void operator()(const call_params_t *p) const = 0;
+        static kernel_base_t *create(const jit_reorder_4bit_conf_t &conf);
+        virtual status_t create_kernel() = 0;
+        virtual ~kernel_base_t() = default;
+    };
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::unique_ptr<kernel_base_t> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
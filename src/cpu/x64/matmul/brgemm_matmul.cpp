@@ -14,8 +14,12 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
+
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/float4.hpp"
+#include "common/float8.hpp"
 #include "common/memory_tracking.hpp"
 #include "common/tag_traits.hpp"
 #include "common/type_helpers.hpp"
@@ -23,6 +27,7 @@
 
 #include "cpu/cpu_primitive.hpp"
 #include "cpu/matmul/matmul_utils.hpp"
+#include "cpu/ref_io_helper.hpp"
 #include "cpu/scale_utils.hpp"
 
 #include "cpu/x64/amx_tile_configure.hpp"
@@ -121,6 +126,57 @@ int get_brg_kernel_index(const brgemm_matmul_conf_t &bgmmc, bool is_bs_tail,
     return idx;
 }
 
+// Packs @p n f32 values into 4-bit values of a destination starting at
+// element @p off.
+template <typename f4_t>
+void cvt_float_to_f4(nibble2_t *dst, dim_t off, const float *src, dim_t n) {
+    dim_t i = 0;
+    // A row starting in the middle of a byte shares it with the previous one.
+    if (off % 2 != 0 && n > 0) {
+        nibble2_t pair = dst[off / 2];
+        pair.set(f4_t(src[0]).raw_bits_, 1);
+        dst[off / 2] = pair;
+        i = 1;
+    }
+    nibble2_t *dst_pairs = dst + (off + i) / 2;
+    const dim_t npairs = (n - i) / 2;
+    PRAGMA_OMP_SIMD()
+    for (dim_t j = 0; j < npairs; j++)
+        dst_pairs[j] = nibble2_t(f4_t(src[i + 2 * j]).raw_bits_,
+                f4_t(src[i + 2 * j + 1]).raw_bits_);
+    i += 2 * npairs;
+    if (i < n) {
+        nibble2_t pair = dst[(off + i) / 2];
+        pair.set(f4_t(src[i]).raw_bits_, 0);
+        dst[(off + i) / 2] = pair;
+    }
+}
+
+// Converts @p n f32 values into a low precision destination of @p dt data
+// type starting at element @p off.
+void cvt_float_to_dst(
+        data_type_t dt, void *dst, dim_t off, const float *src, dim_t n) {
+    switch (dt) {
+        case f8_e5m2:
+            cvt_float_to_f8_e5m2(
+                    static_cast<float8_e5m2_t *>(dst) + off, src, n);
+            break;
+        case f8_e4m3:
+            cvt_float_to_f8_e4m3(
+                    static_cast<float8_e4m3_t *>(dst) + off, src, n);
+            break;
+        case f4_e2m1:
+            cvt_float_to_f4<float4_e2m1_t>(
+                    static_cast<nibble2_t *>(dst), off, src, n);
+            break;
+        case f4_e3m0:
+            cvt_float_to_f4<float4_e3m0_t>(
+                    static_cast<nibble2_t *>(dst), off, src, n);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
 } // anonymous namespace
 
 template <cpu_isa_t isa>
@@ -134,9 +190,18 @@ int brgemm_matmul_t<isa>::pd_t::get_brg_kernel_idx(bool is_bs_tail,
 
 template <cpu_isa_t isa>
 status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
-    const auto src_dt = src_md_.data_type;
+    const auto &dst_scales = attr()->scales_.get(DNNL_ARG_DST);
+    const bool with_dst_dynamic_scales = dst_scales.is_dynamic();
+    const bool with_src_dynamic_scales
+            = attr()->scales_.get(DNNL_ARG_SRC).is_dynamic();
+    const bool with_dynamic_scales
+            = with_dst_dynamic_scales || with_src_dynamic_scales;
+
     const auto wei_dt = weights_md_.data_type;
-    const auto dst_dt = dst_md_.data_type;
+    // Dynamically quantized source is computed in the weights data type.
+    const auto src_dt = with_src_dynamic_scales ? wei_dt : src_md_.data_type;
+    // Destination is computed in f32 first when any dynamic scales are used.
+    const auto dst_dt = with_dynamic_scales ? f32 : dst_md_.data_type;
 
     const bool is_f32 = everyone_is(f32, src_dt, wei_dt, dst_dt);
     const bool is_int8 = one_of(src_dt, u8, s8) && wei_dt == s8
@@ -195,7 +260,9 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     auto check_attr_scales = [&]() -> bool {
         const std::vector<int> supported_args
                 = {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST};
-        bool ok = attr_scales_ok(supported_args);
+        bool ok = attr_scales_ok(supported_args,
+                {quantization_mode::static_sazp, quantization_mode::dynamic_mx,
+                        quantization_mode::dynamic_fp});
         const auto &asc = attr()->scales_;
         if (!asc.has_default_values(DNNL_ARG_SRC)
                 && !asc.has_default_values(DNNL_ARG_WEIGHTS)
@@ -208,7 +275,10 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
                     || is_f32_with_int_wei)) {
             ok = ok && one_of(asc.get_data_type(DNNL_ARG_SRC), undef, f32);
             ok = ok && one_of(asc.get_data_type(DNNL_ARG_WEIGHTS), undef, f32);
-            ok = ok && one_of(asc.get_data_type(DNNL_ARG_DST), undef, f32);
+            ok = ok
+                    && IMPLICATION(!with_dst_dynamic_scales,
+                            one_of(asc.get_data_type(DNNL_ARG_DST), undef,
+                                    f32));
         }
         // This impl doesn't support scales over any batch dimensions.
         if (!asc.has_default_values(DNNL_ARG_WEIGHTS)) {
@@ -259,6 +329,66 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
         }
         return true;
     };
+    auto check_dst_dynamic_scales = [&]() -> bool {
+        if (!with_dst_dynamic_scales) return true;
+
+        // Quantized values are packed into MX-like low precision types.
+        bool ok = one_of(dst_md_.data_type, f8_e5m2, f8_e4m3, f4_e2m1, f4_e3m0);
+        // Groups split rows only.
+        ok = ok && dst_scales.get_group(-2) == 1
+                && dst_scales.get_group(-1) > 0
+                && !is_runtime_value(N())
+                && N() % dst_scales.get_group(-1) == 0;
+        // The intermediate f32 buffer mirrors a dense plain destination.
+        const memory_desc_wrapper dst_mdw(dst_md_);
+        ok = ok && !dst_mdw.has_runtime_dims_or_strides();
+        if (ok && !dst_mdw.format_any()) {
+            memory_desc_t plain_md = dst_md_;
+            ok = memory_desc_init_by_strides(plain_md, nullptr)
+                            == status::success
+                    && dst_mdw == memory_desc_wrapper(plain_md);
+        }
+        // The sum post-op would read the intermediate buffer.
+        ok = ok && attr()->post_ops_.find(primitive_kind::sum) == -1;
+        return ok;
+    };
+    auto check_src_dynamic_scales = [&]() -> bool {
+        if (!with_src_dynamic_scales) return true;
+
+        // Rows are quantized to s8 by the avx512 copy-A routine.
+        bool ok = is_superset(isa, avx512_core)
+                && one_of(src_md_.data_type, f32, bf16, f16) && wei_dt == s8
+                && one_of(dst_md_.data_type, f32, bf16, f16, s8, u8);
+        ok = ok && !with_dst_dynamic_scales && !with_reduce();
+        // Rows are read from a dense plain source without batch broadcast,
+        // and results are stored from a dense f32 buffer.
+        const memory_desc_wrapper src_mdw(src_md_);
+        const memory_desc_wrapper dst_mdw(dst_md_);
+        ok = ok && !src_mdw.has_runtime_dims_or_strides()
+                && !dst_mdw.has_runtime_dims_or_strides()
+                && src_mdw.nelems() == batch() * M() * K();
+        if (ok && !src_mdw.format_any()) {
+            ok = src_mdw.is_plain() && src_mdw.is_dense()
+                    && src_mdw.blocking_desc().strides[src_mdw.ndims() - 1]
+                            == 1;
+        }
+        if (ok && !dst_mdw.format_any()) {
+            memory_desc_t plain_md = dst_md_;
+            ok = memory_desc_init_by_strides(plain_md, nullptr)
+                            == status::success
+                    && dst_mdw == memory_desc_wrapper(plain_md);
+        }
+        // Per-row scales, bias and post-ops are applied on f32 results by
+        // the post-ops kernels.
+        const auto &asc = attr()->scales_;
+        ok = ok
+                && IMPLICATION(!asc.has_default_values(DNNL_ARG_DST),
+                        asc.get_mask(DNNL_ARG_DST) == 0);
+        ok = ok && attr()->zero_points_.has_default_values();
+        ok = ok && attr()->post_ops_.find(primitive_kind::sum) == -1;
+        return ok;
+    };
+
     const bool problem_dt_correct = one_of(true, is_f4, is_int8, is_f8, is_bf16,
             is_f32, is_f16, is_f32_f16, is_f32_bf16, is_bf16_with_int_wei,
             is_f16_with_int_wei, is_f32_with_int_wei);
@@ -301,6 +431,10 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
             VERBOSE_UNSUPPORTED_POSTOP);
 
     VDISPATCH_MATMUL(check_attr_scales(), VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_MATMUL(
+            check_dst_dynamic_scales(), VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_MATMUL(
+            check_src_dynamic_scales(), VERBOSE_UNSUPPORTED_SCALES_CFG);
     VDISPATCH_MATMUL(check_attr_zero_points(is_bf16_with_int_wei
                              || is_f16_with_int_wei || is_f32_with_int_wei),
             VERBOSE_UNSUPPORTED_ZP_CFG);
@@ -308,8 +442,68 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     VDISPATCH_MATMUL(check_reduce(), VERBOSE_UNSUPPORTED_FEATURE,
             "reduce is not supported");
 
-    CHECK(init_brgemm_matmul_conf(isa, bgmmc_, *desc(), src_md_, weights_md_,
-            dst_md_, bias_md_, attr_));
+    if (with_dynamic_scales) {
+        if (dst_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_strides(dst_md_, nullptr));
+        brg_dst_md_ = dst_md_;
+        brg_dst_md_.data_type = f32;
+        CHECK(brg_attr_.copy_from(attr_));
+        CHECK(brg_attr_.scales_.set(DNNL_ARG_DST, default_quant_entry()));
+    }
+
+    // With dynamic src quantization the kernels compute a plain
+    // low-precision matmul, while src scales, bias and post-ops are applied
+    // by `apply_src_dynamic_scales()`.
+    matmul_desc_t brg_desc = *desc();
+    memory_desc_t brg_bias_md = bias_md_;
+    if (with_src_dynamic_scales) {
+        if (src_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_strides(src_md_, nullptr));
+        CHECK(memory_desc_init_by_strides(brg_src_md_, src_md_.ndims,
+                src_md_.dims, wei_dt, src_md_.format_desc.blocking.strides));
+        CHECK(brg_attr_.scales_.set(DNNL_ARG_SRC, default_quant_entry()));
+        brg_attr_.post_ops_ = post_ops_t();
+        brg_desc.src_desc = brg_src_md_;
+        brg_desc.dst_desc = brg_dst_md_;
+        brg_desc.bias_desc = glob_zero_md;
+        brg_bias_md = glob_zero_md;
+    }
+
+    CHECK(init_brgemm_matmul_conf(isa, bgmmc_, brg_desc,
+            with_src_dynamic_scales ? brg_src_md_ : src_md_, weights_md_,
+            with_dynamic_scales ? brg_dst_md_ : dst_md_, brg_bias_md,
+            with_dynamic_scales ? brg_attr_ : attr_,
+            with_src_dynamic_scales ? src_md_.data_type : data_type::undef));
+    VDISPATCH_MATMUL(
+            IMPLICATION(bgmmc_.with_src_dynamic_scales, !bgmmc_.transposed_A),
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+
+    if (with_dynamic_scales) CHECK(attr_.set_default_formats(&dst_md_));
+    if (with_src_dynamic_scales) {
+        // The post-ops kernels take a src scale per row while weights scales
+        // are already applied by the brgemm kernels.
+        primitive_attr_t po_attr;
+        CHECK(po_attr.copy_from(attr_));
+        CHECK(po_attr.scales_.set(DNNL_ARG_SRC, 0));
+        CHECK(po_attr.scales_.set(DNNL_ARG_WEIGHTS, default_quant_entry()));
+        // The intermediate f32 buffer and the destination share the layout.
+        CHECK(brgemm_desc_init(&brg_po_, isa_undef, brgemm_addr, f32, f32,
+                false, false, brgemm_row_major, 1.f, 0.f, bgmmc_.K,
+                bgmmc_.LDD, bgmmc_.LDD, bgmmc_.M_blk, bgmmc_.N_blk, bgmmc_.K));
+        VDISPATCH_MATMUL(
+                brgemm_desc_set_postops(&brg_po_, &po_attr, &dst_md_,
+                        bgmmc_.LDD, bias_md_.data_type)
+                        == status::success,
+                VERBOSE_UNSUPPORTED_POSTOP);
+        CHECK(brgemm_desc_finalize(&brg_po_));
+        brg_po_.is_bcast_src_scale = true;
+        brg_po_.is_bf16_emu
+                = dst_md_.data_type == bf16 && !mayiuse(avx512_core_bf16);
+    }
+    if (with_dst_dynamic_scales) {
+        bgmmc_.with_dst_dynamic_scales = true;
+        bgmmc_.dst_dynamic_scales_group = dst_scales.get_group(-1);
+    }
 
     // f32:f16 configuration on AVX2 doesn't support tails with proper
     // instruction sequence in copy routines. Anchor: F32_F16_AVX2_NO_TAIL.
@@ -394,7 +588,7 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
             brg.skip_zp_b_compensation = true;
         if (bgmmc_.apply_scales_in_buffer_b) brg.skip_wei_scales = true;
         CHECK(brgemm_desc_set_postops(
-                &brg, attr(), &dst_md_, LDD, bgmmc_.bia_dt));
+                &brg, brg_attr(), brg_dst_md(), LDD, bgmmc_.bia_dt));
 
         brgemm_attr_t brgattr;
         brgattr.generate_skip_accumulation
@@ -514,6 +708,28 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
         CHECK(sparse_decompress_kernel_->create_kernel());
     }
 
+    if (bgmmc.with_src_dynamic_scales) {
+        const dim_t N_tail = bgmmc.N % bgmmc.N_blk;
+        for_(int i_M = 0; i_M < 2; i_M++)
+        for (int i_N = 0; i_N < 2; i_N++) {
+            const dim_t M = i_M ? 1 : bgmmc.M_blk;
+            const dim_t N = i_N ? N_tail : bgmmc.N_blk;
+            if (N == 0) continue;
+            brgemm_desc_t po_cfg = pd()->get_brg_po_desc();
+            po_cfg.load_dim = N;
+            po_cfg.bcast_dim = M;
+            po_cfg.LDC = bgmmc.LDD;
+            po_cfg.dt_c = f32;
+            po_cfg.typesize_C = types::data_type_size(f32);
+            po_cfg.alpha = 1;
+            po_cfg.beta = 1;
+            CHECK(safe_ptr_assign(kernels_po_[i_M][i_N],
+                    jit_brgemm_kernel_post_ops_base_t::create(
+                            po_cfg.isa_impl, po_cfg, *pd()->attr())));
+            CHECK(kernels_po_[i_M][i_N]->generate_kernel());
+        }
+    }
+
     return status::success;
 }
 
@@ -684,8 +900,9 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
                                         ithr, b, nb, kb);
 
                             if (use_buffer_a && nb == n_start && !skip_copy_a)
-                                copy_a_chunk_in_buffer(
-                                        brgmm_ctx, a_batch_ptr, ithr, mb, kb);
+                                copy_a_chunk_in_buffer(brgmm_ctx,
+                                        a_batch_ptr, ithr, b, mb, kb,
+                                        kc == kc_start && kb == kb_start);
 
                             compute_kernel(brgmm_ctx, a_batch_ptr, b_batch_ptr,
                                     ithr, b, mb, nb, kb,
@@ -697,6 +914,17 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
                     nb_prev = nb;
                 }
             }
+            if (brgmm_ctx.finalize_dst_in_chunk()) {
+                const dim_t M = brgmm_ctx.get_M();
+                const dim_t N = brgmm_ctx.get_N();
+                finalize_dst(brgmm_ctx, b,
+                        brgmm_ctx.get_M_idx(m_start),
+                        nstl::min(brgmm_ctx.get_M_idx(m_end - 1) + bgmmc.M_blk,
+                                M),
+                        brgmm_ctx.get_N_idx(n_start),
+                        nstl::min(brgmm_ctx.get_N_idx(n_end - 1) + bgmmc.N_blk,
+                                N));
+            }
             mc_prev = mc;
             b_prev = b;
 
@@ -708,6 +936,16 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
     maybe_reduce_and_convert_partial_results_A(brgmm_ctx_ptr);
     maybe_reduce_partial_results_and_apply_postops(brgmm_ctx_ptr);
 
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    if ((bgmmc.with_dst_dynamic_scales || bgmmc.with_src_dynamic_scales)
+            && !brgmm_ctx_ptr->finalize_dst_in_chunk()) {
+        const dim_t M = brgmm_ctx_ptr->get_M();
+        const dim_t N = brgmm_ctx_ptr->get_N();
+        parallel_nd(bgmmc.batch, M, [&](dim_t b, dim_t m) {
+            finalize_dst(*brgmm_ctx_ptr, (int)b, m, m + 1, 0, N);
+        });
+    }
+
     return status::success;
 }
 
@@ -1216,7 +1454,8 @@ void brgemm_matmul_t<isa>::maybe_reduce_partial_results_and_apply_postops(
 template <cpu_isa_t isa>
 void brgemm_matmul_t<isa>::copy_a_chunk_in_buffer(
         const brg_matmul_exec_ctx_t &brgmm_ctx, const char *A_data_batch_ptr,
-        int ithr, int m_blk_idx, int k_blk_idx) const {
+        int ithr, int b_idx, int m_blk_idx, int k_blk_idx,
+        bool is_first_k_blk) const {
     const auto &bgmmc = pd()->get_brgemm_matmul_conf();
 
     auto ctx = jit_brgemm_matmul_copy_a_t::ctx_t();
@@ -1249,6 +1488,13 @@ void brgemm_matmul_t<isa>::copy_a_chunk_in_buffer(
     ctx.zp_b_neg_val_ptr = &neg_zp_b;
     ctx.zp_ab_comp_ptr = &neg_zp_ab_comp;
 
+    // Row scales are computed by the first copy of the rows in a thread and
+    // reused by the copies of the next K blocks. Threads sharing the rows
+    // compute the same values.
+    if (bgmmc.with_src_dynamic_scales)
+        ctx.src_scales_ptr = brgmm_ctx.get_src_dynamic_scales_ptr()
+                + b_idx * brgmm_ctx.get_M() + m;
+
     for (int gb = 0; gb < gemm_batch_iters; gb++) {
         const dim_t k = k_start + gb * bgmmc.K_blk;
         ctx.src = (void *)brgmm_ctx.get_data_A_mk_ptr(A_data_batch_ptr, m, k);
@@ -1256,6 +1502,7 @@ void brgemm_matmul_t<isa>::copy_a_chunk_in_buffer(
                 ithr, m_blk_idx, k_blk_idx, gb);
         ctx.current_K_blk = nstl::min(bgmmc.K_blk, bgmmc.K);
         ctx.current_K_start = k;
+        ctx.compute_src_scales = is_first_k_blk && gb == 0;
 
         (*copy_A_kernel_)(&ctx);
     }
@@ -1267,6 +1514,7 @@ void brgemm_matmul_t<isa>::copy_a_chunk_in_buffer(
                 ithr, m_blk_idx, k_blk_idx, gemm_batch_iters);
         ctx.current_K_blk = K_tail;
         ctx.current_K_start = k;
+        ctx.compute_src_scales = is_first_k_blk && gemm_batch_iters == 0;
 
         (*copy_A_kernel_)(&ctx);
     }
@@ -1406,12 +1654,125 @@ void brgemm_matmul_t<isa>::accumulate(
         assert(!"unsupported accumulation data type");
 }
 
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::quantize_dst_dynamically(
+        const brg_matmul_exec_ctx_t &brgmm_ctx, int b, dim_t m_start,
+        dim_t m_end, dim_t n_start, dim_t n_end) const {
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const auto &dst_scales = pd()->attr()->scales_.get(DNNL_ARG_DST);
+    const auto dst_dt = pd()->dst_md()->data_type;
+    const auto scales_dt = dst_scales.get_data_type();
+    const dim_t group = bgmmc.dst_dynamic_scales_group;
+    const dim_t M = brgmm_ctx.get_M();
+    const dim_t N_groups = brgmm_ctx.get_N() / group;
+    const float dst_max = types::max_value<float>(dst_dt);
+    // MX rounds both the group maximum and the data type maximum down to a
+    // power of two before the division, same as the reference.
+    const float dst_max_rnd = types::round_to_dt(scales_dt, dst_max);
+
+    char *dst = brgmm_ctx.get_user_dst_ptr();
+    void *scales = brgmm_ctx.get_dst_dynamic_scales_ptr();
+    const dim_t n_len = n_end - n_start;
+
+    // Every group of a row is scaled in place in the intermediate buffer,
+    // then the whole row is converted at once.
+    for (dim_t m = m_start; m < m_end; m++) {
+        float *acc = reinterpret_cast<float *>(
+                brgmm_ctx.get_data_C_ptr(b, m, n_start));
+        for (dim_t n = 0; n < n_len; n += group) {
+            float *acc_group = acc + n;
+            float amax = 0.f;
+            PRAGMA_OMP_SIMD(reduction(max : amax))
+            for (dim_t i = 0; i < group; i++)
+                amax = nstl::max(amax, std::fabs(acc_group[i]));
+
+            float scale = 1.f;
+            if (dst_scales.is_mx())
+                scale = types::round_to_dt(scales_dt,
+                        types::round_to_dt(scales_dt, amax) / dst_max_rnd);
+            else if (amax != 0.f)
+                scale = types::round_to_dt(scales_dt, amax / dst_max);
+            cpu::io::store_float_value(scales_dt, scale, scales,
+                    (b * M + m) * N_groups + (n_start + n) / group);
+
+            const float scale_inv = 1.f / scale;
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < group; i++)
+                acc_group[i] *= scale_inv;
+        }
+        cvt_float_to_dst(dst_dt, dst, brgmm_ctx.get_user_dst_off(b, m, n_start),
+                acc, n_len);
+    }
+}
+
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::apply_src_dynamic_scales(
+        const brg_matmul_exec_ctx_t &brgmm_ctx, int b, dim_t m_start,
+        dim_t m_end, dim_t n_start, dim_t n_end) const {
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const auto &attr = *pd()->attr();
+    const bool with_dst_scales = !attr.scales_.has_default_values(DNNL_ARG_DST);
+    const dim_t M = brgmm_ctx.get_M();
+
+    const float *src_scales = brgmm_ctx.get_src_dynamic_scales_ptr();
+    float *src_scales_out = brgmm_ctx.get_src_dynamic_scales_out_ptr();
+    if (src_scales_out && n_start == 0) {
+        for (dim_t m = m_start; m < m_end; m++)
+            src_scales_out[b * M + m] = src_scales[b * M + m];
+    }
+
+    // The kernels multiply by dst scales.
+    const float dst_scale_inv = with_dst_scales
+            ? 1.f / *static_cast<const float *>(brgmm_ctx.get_dst_scales_ptr())
+            : 1.f;
+    const char *bias = brgmm_ctx.get_user_bias_ptr();
+    char *dst = brgmm_ctx.get_user_dst_ptr();
+    const size_t dst_dt_size = types::data_type_size(pd()->dst_md()->data_type);
+
+    brgemm_kernel_post_ops_args_t p;
+    p.ptr_binary_post_ops_rhs
+            = brgmm_ctx.get_post_ops_binary_rhs_arg_vec().data();
+    p.dst_orig = dst;
+    p.ptr_dst_scales = &dst_scale_inv;
+
+    for (dim_t m = m_start; m < m_end;) {
+        const bool is_m_blk = m + bgmmc.M_blk <= m_end;
+        const dim_t m_len = is_m_blk ? bgmmc.M_blk : 1;
+        for (dim_t n = n_start; n < n_end; n += bgmmc.N_blk) {
+            const bool is_n_tail = n + bgmmc.N_blk > n_end;
+            const auto &kernel = kernels_po_[!is_m_blk][is_n_tail];
+            assert(IMPLICATION(is_n_tail, n_end == bgmmc.N));
+            p.ptr_in = brgmm_ctx.get_data_C_ptr(b, m, n);
+            p.ptr_out = dst + dst_dt_size * brgmm_ctx.get_user_dst_off(b, m, n);
+            p.ptr_bias = bias ? const_cast<char *>(bias) + bgmmc.bias_dt_sz * n
+                              : nullptr;
+            p.ptr_src_scales = src_scales + b * M + m;
+            (*kernel)(&p);
+        }
+        m += m_len;
+    }
+}
+
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::finalize_dst(
+        const brg_matmul_exec_ctx_t &brgmm_ctx, int b, dim_t m_start,
+        dim_t m_end, dim_t n_start, dim_t n_end) const {
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    if (bgmmc.with_src_dynamic_scales)
+        apply_src_dynamic_scales(
+                brgmm_ctx, b, m_start, m_end, n_start, n_end);
+    else if (bgmmc.with_dst_dynamic_scales)
+        quantize_dst_dynamically(
+                brgmm_ctx, b, m_start, m_end, n_start, n_end);
+}
+
 template <cpu_isa_t isa>
 struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
     brg_matmul_exec_ctx_t(
             const exec_ctx_t &ctx, const pd_t *pd, matmul_helper_t &helper)
-        : bgmmc_(pd->get_brgemm_matmul_conf())
-        , src_d_(pd->src_md())
+        : exec_ctx_(ctx)
+        , bgmmc_(pd->get_brgemm_matmul_conf())
+        , src_d_(pd->brg_src_md())
         , wei_d_(pd->weights_md())
         , dst_d_(pd->dst_md())
         , data_A_ptr_(CTX_IN_MEM(const char *, DNNL_ARG_SRC))
@@ -1450,6 +1811,30 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                 const float *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
         dst_scales_inv_ = scratchpad.template get<float>(key_matmul_dst_scales);
 
+        // With dynamic quantization the kernels write f32 results into an
+        // intermediate buffer, the user destination gets final values.
+        user_dst_ptr_ = nullptr;
+        dst_dyn_scales_ = nullptr;
+        if (bgmmc.with_dst_dynamic_scales || bgmmc.with_src_dynamic_scales) {
+            user_dst_ptr_ = data_C_ptr_;
+            data_C_ptr_ = scratchpad.template get<char>(
+                    key_matmul_dst_in_acc_dt);
+        }
+        if (bgmmc.with_dst_dynamic_scales)
+            dst_dyn_scales_ = CTX_OUT_MEM(
+                    void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
+
+        // With dynamic src quantization the copy-A routine writes the
+        // computed row scales into a scratchpad buffer.
+        src_dyn_scales_ = nullptr;
+        src_dyn_scales_out_ = nullptr;
+        if (bgmmc.with_src_dynamic_scales) {
+            src_dyn_scales_ = scratchpad.template get<float>(
+                    key_matmul_dyn_scale_space);
+            src_dyn_scales_out_ = CTX_OUT_MEM(
+                    float *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
+        }
+
         batch_element_ptr_ = scratchpad.template get<brgemm_batch_element_t>(
                 key_brgemm_primitive_batch);
 
@@ -1504,6 +1889,8 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                           key_brgemm_primitive_zp_comp_b)
                 : nullptr;
 
+        // With dynamic src quantization post-ops are applied by the post-ops
+        // kernels rather than by the brgemm kernels.
         post_ops_binary_rhs_arg_vec_ = binary_injector::prepare_binary_args(
                 pd->attr()->post_ops_, ctx);
         base_brg_ker_idx_
@@ -2141,6 +2528,31 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
     const void *get_dst_scales_ptr() const { return dst_scales_; }
 
+    // The user destination when the kernels write f32 results into an
+    // intermediate buffer.
+    char *get_user_dst_ptr() const { return user_dst_ptr_; }
+    dim_t get_user_dst_off(int b, dim_t m, dim_t n) const {
+        return dst_d_.off_l((b * M_ + m) * N_ + n);
+    }
+    void *get_dst_dynamic_scales_ptr() const { return dst_dyn_scales_; }
+
+    const exec_ctx_t &get_exec_ctx() const { return exec_ctx_; }
+    const char *get_user_bias_ptr() const { return bias_ptr_; }
+    float *get_src_dynamic_scales_ptr() const { return src_dyn_scales_; }
+    float *get_src_dynamic_scales_out_ptr() const {
+        return src_dyn_scales_out_;
+    }
+
+    // The destination is finalized right after the chunk computation when
+    // the chunk holds final values, i.e. there is no parallel reduction over
+    // K.
+    bool finalize_dst_in_chunk() const {
+        if (parallel_reduction_is_used() || bgmmc_.is_gemv) return false;
+        if (bgmmc_.with_src_dynamic_scales) return true;
+        return bgmmc_.with_dst_dynamic_scales
+                && bgmmc_.N_blk % bgmmc_.dst_dynamic_scales_group == 0;
+    }
+
     // Since `dst_scales_inv_` is a scratchpad memory, @p ithr points to the
     // correspondent piece of that memory.
     const void *get_dst_scales_inv_ptr(int ithr) const {
@@ -2495,6 +2907,7 @@ private:
     bool is_A_batch_layout_trivial_;
     bool is_B_batch_layout_trivial_;
     bool is_C_batch_layout_trivial_;
+    const exec_ctx_t &exec_ctx_;
     const brgemm_matmul_conf_t &bgmmc_;
     const memory_desc_wrapper src_d_;
     const memory_desc_wrapper wei_d_;
@@ -2526,6 +2939,10 @@ private:
 
     const void *dst_scales_;
     const void *dst_scales_inv_;
+    char *user_dst_ptr_;
+    void *dst_dyn_scales_;
+    float *src_dyn_scales_;
+    float *src_dyn_scales_out_;
     int32_t *s8s8_compensation_ptr_;
 
     int32_t *zero_point_a_compensations_ptr_;
@@ -68,9 +68,34 @@ struct brgemm_matmul_t : public primitive_t {
             return bgmmc_;
         }
 
+        // Attributes and descriptors the brgemm kernels are generated for.
+        // With dynamic quantization the kernels produce f32 values without
+        // dst scales applied. With dynamic src quantization the kernels also
+        // skip src scales, bias and post-ops, and read the quantized source.
+        const primitive_attr_t *brg_attr() const {
+            return with_dynamic_scales() ? &brg_attr_ : attr();
+        }
+        const memory_desc_t *brg_src_md() const {
+            return bgmmc_.with_src_dynamic_scales ? &brg_src_md_ : src_md();
+        }
+        const memory_desc_t *brg_dst_md() const {
+            return with_dynamic_scales() ? &brg_dst_md_ : dst_md();
+        }
+        // Post-ops kernels configuration for dynamic src quantization.
+        const brgemm_desc_t &get_brg_po_desc() const { return brg_po_; }
+
     private:
+        bool with_dynamic_scales() const {
+            return bgmmc_.with_dst_dynamic_scales
+                    || bgmmc_.with_src_dynamic_scales;
+        }
+
         brgemm_desc_t brg_descs_[max_num_brg_kernels_matmul];
+        brgemm_desc_t brg_po_;
         brgemm_matmul_conf_t bgmmc_;
+        primitive_attr_t brg_attr_;
+        memory_desc_t brg_src_md_;
+        memory_desc_t brg_dst_md_;
     };
 
     brgemm_matmul_t(const pd_t *apd) : primitive_t(apd) {}
@@ -97,8 +122,8 @@ private:
             const brg_matmul_exec_ctx_t &brgmm_ctx) const;
 
     void copy_a_chunk_in_buffer(const brg_matmul_exec_ctx_t &brgmm_ctx,
-            const char *A_data_batch_ptr, int ithr, int m_blk_idx,
-            int k_blk_idx) const;
+            const char *A_data_batch_ptr, int ithr, int b_idx, int m_blk_idx,
+            int k_blk_idx, bool is_first_k_blk) const;
     void copy_b_chunk_in_buffer(const brg_matmul_exec_ctx_t &brgmm_ctx,
             const char *B_data_batch_ptr, int ithr, int b_idx, int n_blk_idx,
             int k_blk_idx) const;
@@ -111,6 +136,20 @@ private:
             const std::shared_ptr<brg_matmul_exec_ctx_t> &brgmm_ctx_ptr) const;
     void accumulate(
             char *result_ptr, const char *reduce_ptr, size_t size) const;
+    // Quantizes f32 results of rows [m_start, m_end) and columns
+    // [n_start, n_end) into the destination, computing a scale per group.
+    void quantize_dst_dynamically(const brg_matmul_exec_ctx_t &brgmm_ctx,
+            int b, dim_t m_start, dim_t m_end, dim_t n_start,
+            dim_t n_end) const;
+    // Applies per-row src scales, bias, post-ops and dst scales to f32
+    // results of rows [m_start, m_end) and columns [n_start, n_end) with the
+    // post-ops kernels and stores them into the destination.
+    void apply_src_dynamic_scales(const brg_matmul_exec_ctx_t &brgmm_ctx,
+            int b, dim_t m_start, dim_t m_end, dim_t n_start,
+            dim_t n_end) const;
+    // Finalizes the destination for the dynamic quantization modes.
+    void finalize_dst(const brg_matmul_exec_ctx_t &brgmm_ctx, int b,
+            dim_t m_start, dim_t m_end, dim_t n_start, dim_t n_end) const;
 
     std::unique_ptr<brgemm_kernel_t> brg_kernels_[max_num_brg_kernels_matmul];
     brgemm_containers::brgemm_palette_container_t brgemm_palettes_ {
@@ -122,6 +161,8 @@ private:
     std::unique_ptr<cpu_accumulator_1d_t<data_type::s32>> acc_ker_s32_;
     std::unique_ptr<jit_avx512_sparse_decompress_kernel_t>
             sparse_decompress_kernel_;
+    // Indexed by M (full block or a single row) and N (full block or tail).
+    std::unique_ptr<jit_brgemm_kernel_post_ops_base_t> kernels_po_[2][2];
 
     using reducer_t = x64::jit_brgemm_kernel_diff_bias_t<
             typename cpu_isa_traits_t<isa>::Vmm>;
@@ -526,6 +526,261 @@ void jit_brgemm_matmul_copy_a_impl_t<Vmm>::generate() {
 template struct jit_brgemm_matmul_copy_a_impl_t<Zmm>;
 template struct jit_brgemm_matmul_copy_a_impl_t<Ymm>;
 
+// Copies A rows quantizing them into s8 with a scale computed per row as the
+// maximum absolute value of the whole row divided by the s8 maximum. The
+// scales of the rows are computed by the first copy of the rows and loaded by
+// the copies of the next K blocks.
+struct jit_brgemm_matmul_copy_a_dynamic_quant_t
+    : public jit_brgemm_matmul_copy_a_t,
+      public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_matmul_copy_a_dynamic_quant_t)
+
+    jit_brgemm_matmul_copy_a_dynamic_quant_t(const brgemm_matmul_conf_t *conf)
+        : jit_brgemm_matmul_copy_a_t(conf)
+        , jit_generator_t(jit_name())
+        , typesize_(conf_->a_dt_sz)
+        , vnni_granularity_(data_type_vnni_granularity(conf_->src_dt))
+        , src_stride_(conf_->copy_A_src_stride)
+        , tr_src_stride_(conf_->LDA * conf_->tr_a_dt_sz) {
+        assert(conf_->src_dt == data_type::s8 && conf_->tr_a_dt_sz == 1);
+    }
+
+    void operator()(ctx_t *ctx) override { jit_generator_t::operator()(ctx); }
+    status_t create_kernel() override {
+        return jit_generator_t::create_kernel();
+    }
+
+private:
+    using reg64_t = const Xbyak::Reg64;
+    using opmask_t = const Xbyak::Opmask;
+
+    static constexpr int simd_w_ = 16;
+    static constexpr int num_amax_acc_ = 4;
+    static constexpr int num_copy_vmms_ = 8;
+
+    const int typesize_;
+    const int vnni_granularity_;
+    const dim_t src_stride_;
+    const dim_t tr_src_stride_;
+
+    opmask_t kTail_load = k7;
+    opmask_t kTail_store = k6;
+    opmask_t kTail_amax = k5;
+
+    reg64_t reg_src = rax;
+    reg64_t reg_tr_src = rbx;
+    reg64_t reg_scales = rdx;
+    reg64_t reg_K_start_off = rsi;
+    reg64_t reg_M_blk = r9;
+    reg64_t reg_K_blk = r10;
+    reg64_t reg_row = r11;
+    reg64_t reg_k_iter = r12;
+    reg64_t reg_compute_scales = r13;
+    reg64_t regq_tmp = r14;
+
+    // Registers used by the scale computation are below 16 to allow VEX
+    // encoded blending.
+    const Xmm xmm_one = Xmm(8);
+    const Xmm xmm_q_max = Xmm(9);
+    const Xmm xmm_zero = Xmm(10);
+    const Xmm xmm_is_zero = Xmm(11);
+    const Zmm zmm_abs_mask = Zmm(12);
+    const Zmm zmm_scale = Zmm(13);
+
+    Zmm get_zmm_amax_acc(int i) const {
+        assert(i >= 0 && i < num_amax_acc_);
+        return Zmm(i);
+    }
+
+    Zmm get_zmm_amax_tmp(int i) const {
+        assert(i >= 0 && i < num_amax_acc_);
+        return Zmm(num_amax_acc_ + i);
+    }
+
+    Zmm get_zmm_copy(int i) const { return Zmm(16 + i % num_copy_vmms_); }
+
+    void kmovw(opmask_t k, int nelems) {
+        mov(regq_tmp.cvt32(), (1 << nelems) - 1);
+        jit_generator_t::kmovw(k, regq_tmp.cvt32());
+    }
+
+    void load_f32(const Zmm &zmm, const Xbyak::Address &addr, bool is_tail,
+            opmask_t k_tail);
+    void compute_row_scale();
+    void copy_row(int K_blk);
+    void copy_M_loop(int K_blk);
+    void generate() override;
+};
+
+void jit_brgemm_matmul_copy_a_dynamic_quant_t::load_f32(const Zmm &zmm,
+        const Xbyak::Address &addr, bool is_tail, opmask_t k_tail) {
+    const auto zmm_load = is_tail ? zmm | k_tail | T_z : zmm;
+    switch (conf_->orig_src_dt) {
+        case data_type::f32: vmovups(zmm_load, addr); break;
+        case data_type::bf16:
+            vpmovzxwd(zmm_load, addr);
+            vpslld(zmm, zmm, 16);
+            break;
+        case data_type::f16: vcvtph2ps(zmm_load, addr); break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+void jit_brgemm_matmul_copy_a_dynamic_quant_t::compute_row_scale() {
+    const dim_t K = conf_->K;
+    const dim_t num_vecs = K / simd_w_;
+    const dim_t num_iters = num_vecs / num_amax_acc_;
+    const int num_vecs_tail = num_vecs % num_amax_acc_;
+    const int k_tail = K % simd_w_;
+
+    for (int i = 0; i < num_amax_acc_; i++)
+        vpxord(get_zmm_amax_acc(i), get_zmm_amax_acc(i), get_zmm_amax_acc(i));
+
+    auto update_amax = [this](int i, int offset, bool is_tail) {
+        const auto zmm_tmp = get_zmm_amax_tmp(i);
+        load_f32(zmm_tmp, ptr[reg_row + offset * typesize_], is_tail,
+                kTail_amax);
+        vandps(zmm_tmp, zmm_tmp, zmm_abs_mask);
+        vmaxps(get_zmm_amax_acc(i), get_zmm_amax_acc(i), zmm_tmp);
+    };
+
+    // The row starts `current_K_start` elements before the copied block.
+    mov(reg_row, reg_src);
+    sub(reg_row, reg_K_start_off);
+    if (num_iters > 0) {
+        Label loop_K;
+        mov(reg_k_iter, num_iters);
+        L(loop_K);
+        for (int i = 0; i < num_amax_acc_; i++)
+            update_amax(i, i * simd_w_, false);
+        add(reg_row, num_amax_acc_ * simd_w_ * typesize_);
+        dec(reg_k_iter);
+        jnz(loop_K, T_NEAR);
+    }
+    for (int i = 0; i < num_vecs_tail; i++)
+        update_amax(i, i * simd_w_, false);
+    if (k_tail > 0) update_amax(0, num_vecs_tail * simd_w_, true);
+
+    // Reduce the accumulators and the lanes of the result.
+    const auto zmm_amax = get_zmm_amax_acc(0);
+    const auto zmm_tmp = get_zmm_amax_tmp(0);
+    vmaxps(get_zmm_amax_acc(0), get_zmm_amax_acc(0), get_zmm_amax_acc(1));
+    vmaxps(get_zmm_amax_acc(2), get_zmm_amax_acc(2), get_zmm_amax_acc(3));
+    vmaxps(zmm_amax, zmm_amax, get_zmm_amax_acc(2));
+    const auto ymm_amax = Ymm(zmm_amax.getIdx());
+    const auto ymm_tmp = Ymm(zmm_tmp.getIdx());
+    vextractf64x4(ymm_tmp, zmm_amax, 1);
+    vmaxps(ymm_amax, ymm_amax, ymm_tmp);
+    const auto xmm_amax = Xmm(zmm_amax.getIdx());
+    const auto xmm_tmp = Xmm(zmm_tmp.getIdx());
+    vextractf128(xmm_tmp, ymm_amax, 1);
+    vmaxps(xmm_amax, xmm_amax, xmm_tmp);
+    vshufps(xmm_tmp, xmm_amax, xmm_amax, 0x4e);
+    vmaxps(xmm_amax, xmm_amax, xmm_tmp);
+    vshufps(xmm_tmp, xmm_amax, xmm_amax, 0xb1);
+    vmaxps(xmm_amax, xmm_amax, xmm_tmp);
+
+    // scale = amax == 0 ? 1 : amax / q_max
+    const auto xmm_scale = Xmm(zmm_scale.getIdx());
+    vdivss(xmm_scale, xmm_amax, xmm_q_max);
+    vcmpeqss(xmm_is_zero, xmm_amax, xmm_zero);
+    vblendvps(xmm_scale, xmm_scale, xmm_one, xmm_is_zero);
+    vmovss(ptr[reg_scales], xmm_scale);
+    vbroadcastss(zmm_scale, xmm_scale);
+}
+
+void jit_brgemm_matmul_copy_a_dynamic_quant_t::copy_row(int K_blk) {
+    const int num_vecs = K_blk / simd_w_;
+    const int k_tail = K_blk % simd_w_;
+
+    auto quantize = [this](int i, int k, bool is_tail) {
+        const auto zmm = get_zmm_copy(i);
+        load_f32(zmm, ptr[reg_src + k * typesize_], is_tail, kTail_load);
+        vdivps(zmm, zmm, zmm_scale);
+        vcvtps2dq(zmm, zmm);
+        const auto addr = ptr[reg_tr_src + k];
+        if (is_tail)
+            vpmovsdb(addr, zmm | kTail_store);
+        else
+            vpmovsdb(addr, zmm);
+    };
+
+    for (int i = 0; i < num_vecs; i++)
+        quantize(i, i * simd_w_, false);
+    if (k_tail > 0) quantize(num_vecs, num_vecs * simd_w_, true);
+}
+
+void jit_brgemm_matmul_copy_a_dynamic_quant_t::copy_M_loop(int K_blk) {
+    const int k_tail = K_blk % simd_w_;
+    if (k_tail > 0) {
+        // The store tail is padded with zeros up to the vnni granularity.
+        kmovw(kTail_load, k_tail);
+        kmovw(kTail_store, rnd_up(k_tail, vnni_granularity_));
+    }
+
+    Label loop_M;
+    L(loop_M);
+    {
+        Label load_scale, scale_done;
+        test(reg_compute_scales, reg_compute_scales);
+        jz(load_scale, T_NEAR);
+        compute_row_scale();
+        jmp(scale_done, T_NEAR);
+        L(load_scale);
+        vbroadcastss(zmm_scale, ptr[reg_scales]);
+        L(scale_done);
+    }
+
+    copy_row(K_blk);
+
+    add(reg_src, src_stride_);
+    add(reg_tr_src, tr_src_stride_);
+    add(reg_scales, sizeof(float));
+    dec(reg_M_blk);
+    jnz(loop_M, T_NEAR);
+}
+
+void jit_brgemm_matmul_copy_a_dynamic_quant_t::generate() {
+    preamble();
+
+    mov(reg_src, ptr[param1 + GET_OFF(src)]);
+    mov(reg_tr_src, ptr[param1 + GET_OFF(tr_src)]);
+    mov(reg_scales, ptr[param1 + GET_OFF(src_scales_ptr)]);
+    mov(reg_K_blk, ptr[param1 + GET_OFF(current_K_blk)]);
+    mov(reg_M_blk, ptr[param1 + GET_OFF(current_M_blk)]);
+    movzx(reg_compute_scales.cvt32(),
+            byte[param1 + GET_OFF(compute_src_scales)]);
+    mov(reg_K_start_off, ptr[param1 + GET_OFF(current_K_start)]);
+    imul(reg_K_start_off, reg_K_start_off, typesize_);
+
+    mov(regq_tmp.cvt32(), 0x7fffffff);
+    vpbroadcastd(zmm_abs_mask, regq_tmp.cvt32());
+    mov(regq_tmp.cvt32(), float2int(1.f));
+    vmovd(xmm_one, regq_tmp.cvt32());
+    mov(regq_tmp.cvt32(), float2int(types::max_value<float>(conf_->src_dt)));
+    vmovd(xmm_q_max, regq_tmp.cvt32());
+    vxorps(xmm_zero, xmm_zero, xmm_zero);
+    const int k_tail_amax = conf_->K % simd_w_;
+    if (k_tail_amax > 0) kmovw(kTail_amax, k_tail_amax);
+
+    Label done;
+    // might be different from conf_->K_tail
+    const dim_t K_blk_tail = conf_->K_tail > 0 ? conf_->K % conf_->K_blk : 0;
+    if (K_blk_tail > 0) {
+        Label not_K_tail;
+        cmp(reg_K_blk, K_blk_tail);
+        jne(not_K_tail, T_NEAR);
+        copy_M_loop(K_blk_tail);
+        jmp(done, T_NEAR);
+
+        L(not_K_tail);
+    }
+    copy_M_loop(nstl::min(conf_->K, conf_->K_blk));
+    L(done);
+
+    postamble();
+}
+
 template <typename Vmm>
 struct jit_brgemm_matmul_copy_a_transposed_impl_t
     : public jit_brgemm_matmul_copy_a_t,
@@ -6051,6 +6306,10 @@ status_t create_brgemm_matmul_copy_a(
         else
             CHECK(safe_ptr_assign(copy_ker,
                     new jit_brgemm_matmul_copy_a_transposed_impl_t<Ymm>(conf)));
+    } else if (conf->with_src_dynamic_scales) {
+        assert(is_superset(conf->isa, avx512_core));
+        CHECK(safe_ptr_assign(
+                copy_ker, new jit_brgemm_matmul_copy_a_dynamic_quant_t(conf)));
     } else {
         if (is_superset(conf->isa, avx512_core))
             CHECK(safe_ptr_assign(
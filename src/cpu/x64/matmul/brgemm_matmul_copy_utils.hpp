@@ -66,6 +66,12 @@ struct jit_brgemm_matmul_copy_a_t {
         dim_t current_K_blk = 0;
         dim_t current_M_blk = 0;
         dim_t dynamic_src_ld = 0;
+
+        // Dynamic src quantization: per-row scales of the copied rows,
+        // computed over the whole K when `compute_src_scales` is set and
+        // loaded otherwise.
+        float *src_scales_ptr = nullptr;
+        bool compute_src_scales = false;
     };
 
     virtual void operator()(ctx_t *ctx) = 0;
@@ -1439,7 +1439,8 @@ status_t compute_blocking_heuristic(brgemm_matmul_conf_t &bgmmc,
 status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
         const matmul_desc_t &mmd, memory_desc_t &src_md,
         memory_desc_t &weights_md, memory_desc_t &dst_md,
-        memory_desc_t &bias_md, primitive_attr_t &attr) {
+        memory_desc_t &bias_md, primitive_attr_t &attr,
+        data_type_t dynamic_quant_src_dt) {
     const memory_desc_wrapper src_d(&src_md);
     const memory_desc_wrapper weights_d(&weights_md);
     const memory_desc_wrapper dst_d(&dst_md);
@@ -1484,6 +1485,15 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.a_dt_sz = bgmmc.tr_a_dt_sz = types::data_type_size(bgmmc.src_dt);
     bgmmc.b_dt_sz = bgmmc.tr_b_dt_sz = types::data_type_size(bgmmc.wei_dt);
 
+    // With dynamic src quantization `src_md` describes the quantized source,
+    // while the user source of `dynamic_quant_src_dt` data type is read and
+    // quantized by the copy-A routine.
+    bgmmc.with_src_dynamic_scales = dynamic_quant_src_dt != data_type::undef;
+    if (bgmmc.with_src_dynamic_scales) {
+        bgmmc.orig_src_dt = dynamic_quant_src_dt;
+        bgmmc.a_dt_sz = types::data_type_size(dynamic_quant_src_dt);
+    }
+
     bgmmc.packed_sparse_weights = weights_d.is_sparse_packed_desc();
     if (bgmmc.packed_sparse_weights) {
         VCONDCHECK_BG(bgmmc.is_amx, VERBOSE_ISA_SPARSE_ENCODING_MISMATCH);
@@ -1817,7 +1827,7 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
                             && isa == avx512_core_fp16)
                     || (bgmmc.wei_zp_type != brgemm_broadcast_t::none
                             && !bm_conf_utils.with_weights_decompression())
-                    || bgmmc.transposed_A);
+                    || bgmmc.transposed_A || bgmmc.with_src_dynamic_scales);
 
     bgmmc.use_buffer_a = is_copy_a_required;
 
@@ -2395,6 +2405,15 @@ void init_scratchpad(memory_tracking::registrar_t &scratchpad,
         scratchpad.book(key_brgemm_primitive_buffer_d,
                 bgmmc.M_blk * bgmmc.N_blk * bgmmc.c_dt_sz * bgmmc.nthr,
                 default_data_align);
+    if (bgmmc.with_src_dynamic_scales) {
+        const size_t nrows = static_cast<size_t>(bgmmc.batch) * bgmmc.M;
+        scratchpad.book(key_matmul_dyn_scale_space, nrows,
+                types::data_type_size(f32));
+    }
+    if (bgmmc.with_dst_dynamic_scales || bgmmc.with_src_dynamic_scales)
+        scratchpad.book(key_matmul_dst_in_acc_dt,
+                static_cast<size_t>(bgmmc.batch) * bgmmc.M * bgmmc.N,
+                types::data_type_size(f32));
     if (bgmmc.with_dst_scales) {
         // See brgemm_types.hpp comment for `with_dst_scales`.
         scratchpad.book(key_matmul_dst_scales,
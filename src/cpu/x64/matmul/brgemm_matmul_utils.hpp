@@ -142,6 +142,15 @@ struct brgemm_matmul_conf_t {
     bool with_src_scales;
     bool with_wei_scales;
     bool with_dst_scales;
+    // Dynamic dst quantization: kernels write f32 results into an
+    // intermediate buffer that is quantized by groups of
+    // `dst_dynamic_scales_group` elements along N with computed scales.
+    bool with_dst_dynamic_scales;
+    dim_t dst_dynamic_scales_group;
+    // Dynamic src quantization: the copy-A routine quantizes `orig_src_dt`
+    // rows into `src_dt` with computed per-row scales, and the kernels write
+    // f32 results that are scaled, biased and post-processed afterwards.
+    bool with_src_dynamic_scales;
     bool s8s8_compensation_required;
     bool packed_sparse_weights;
     bool with_wei_decompression;
@@ -491,7 +500,8 @@ void init_aux_values(brgemm_matmul_conf_t &bgmmc,
 status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
         const matmul_desc_t &mmd, memory_desc_t &src_md,
         memory_desc_t &weights_md, memory_desc_t &dst_md,
-        memory_desc_t &bias_md, primitive_attr_t &attr);
+        memory_desc_t &bias_md, primitive_attr_t &attr,
+        data_type_t dynamic_quant_src_dt = data_type::undef);
 
 void init_scratchpad(memory_tracking::registrar_t &scratchpad,
         const brgemm_matmul_conf_t &bgmmc);
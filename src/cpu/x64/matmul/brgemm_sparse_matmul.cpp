@@ -0,0 +1,594 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <cstring>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/x64/injectors/jit_uni_binary_injector.hpp"
+#include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
+#include "cpu/x64/matmul/brgemm_sparse_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+
+// Copies a K x N row-major matrix with leading dimension `ld_src` into the
+// layout where the K elements of each column that fill 4 bytes are adjacent
+// and the leading dimension is `ld_dst`. K is a multiple of their number.
+template <typename T>
+void reorder_to_vnni(
+        T *dst, const T *src, dim_t K, dim_t N, dim_t ld_src, dim_t ld_dst) {
+    constexpr int vnni = sizeof(uint32_t) / sizeof(T);
+    for (dim_t k = 0; k < K; k += vnni) {
+        T *d = dst + k * ld_dst;
+        const T *s = src + k * ld_src;
+        PRAGMA_OMP_SIMD()
+        for (dim_t n = 0; n < N; n++)
+            for (int j = 0; j < vnni; j++)
+                d[n * vnni + j] = s[j * ld_src + n];
+    }
+}
+
+// Decompresses the first N columns of a panel of 2:4 structured weights into
+// a dense buffer where the K elements of each column that fill 4 bytes are
+// adjacent. Every element of a group of four is written with either a kept
+// value or zero, so the buffer needs no initialization. Returns `false` if
+// the positions of some kept values are not increasing.
+template <typename T>
+bool decompress_2_4_to_vnni(T *dst, const T *values, const uint8_t *metadata,
+        dim_t K, dim_t N, dim_t ld_src, dim_t ld_dst) {
+    constexpr int vnni = sizeof(uint32_t) / sizeof(T);
+    int is_bad = 0;
+    for (dim_t g = 0; g < K / 4; g++) {
+        const uint8_t *meta = metadata + g * ld_src;
+        const T *v0 = values + 2 * g * ld_src;
+        const T *v1 = v0 + ld_src;
+        PRAGMA_OMP_SIMD(reduction(| : is_bad))
+        for (dim_t n = 0; n < N; n++) {
+            const int p0 = meta[n] & 0x3;
+            const int p1 = (meta[n] >> 2) & 0x3;
+            is_bad |= (meta[n] >> 4) != 0 || p0 >= p1;
+            for (int j = 0; j < 4; j++) {
+                const dim_t k = 4 * g + j;
+                dst[(k / vnni) * ld_dst * vnni + n * vnni + k % vnni] = p0 == j
+                        ? v0[n]
+                        : (p1 == j ? v1[n] : T(0));
+            }
+        }
+    }
+    return is_bad == 0;
+}
+
+} // namespace
+
+template <cpu_isa_t isa>
+status_t brgemm_sparse_matmul_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md(0));
+    const memory_desc_wrapper dst_d(dst_md());
+
+    // Disabling verbose dispatch messages for unsupported isa for better
+    // readability.
+    if (!mayiuse(isa)) return status::unimplemented;
+
+    VDISPATCH_MATMUL(wei_d.is_sparse_desc()
+                    && one_of(wei_d.encoding(), sparse_encoding::bsr,
+                            sparse_encoding::structured_2_4),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(!src_d.is_sparse_desc() && !dst_d.is_sparse_desc()
+                    && IMPLICATION(with_bias(),
+                            !memory_desc_wrapper(weights_md(1))
+                                     .is_sparse_desc()),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(ndims() == 2, VERBOSE_BAD_NDIMS, "dst", ndims());
+    VDISPATCH_MATMUL(
+            !has_runtime_dims_or_strides(), VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_MATMUL(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+
+    const auto src_dt = src_d.data_type();
+    const auto wei_dt = wei_d.data_type();
+    const auto dst_dt = dst_d.data_type();
+    const bool is_f32 = everyone_is(f32, src_dt, wei_dt, dst_dt);
+    const bool is_bf16
+            = everyone_is(bf16, src_dt, wei_dt) && one_of(dst_dt, bf16, f32);
+    const bool is_int8
+            = src_dt == u8 && wei_dt == s8 && one_of(dst_dt, f32, s32, s8, u8);
+    const bool problem_dt_correct
+            = (one_of(isa, avx512_core, avx2) && is_f32)
+            || (isa == avx512_core_bf16 && is_bf16)
+            || (isa == avx512_core_vnni && is_int8);
+    VDISPATCH_MATMUL(problem_dt_correct, VERBOSE_UNSUPPORTED_DT_CFG);
+
+    if (wei_d.encoding() == sparse_encoding::bsr) {
+        VDISPATCH_MATMUL(everyone_is(s32, wei_d.metadata_type(0),
+                                 wei_d.metadata_type(1)),
+                VERBOSE_UNSUPPORTED_SPARSE_CFG);
+        // The block height must be a multiple of the number of K elements
+        // the kernel packs together.
+        const dim_t K_blk = wei_d.sparse_desc().bsr_desc.block_dims[0];
+        VDISPATCH_MATMUL(
+                K_blk % (dim_t)data_type_vnni_granularity(wei_dt) == 0,
+                VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    } else {
+        VDISPATCH_MATMUL(
+                wei_d.metadata_type(0) == u8, VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    }
+
+    if (with_bias()) {
+        const memory_desc_wrapper bia_d(weights_md(1));
+        VDISPATCH_MATMUL(bia_d.data_type() == f32
+                        || (is_bf16 && bia_d.data_type() == bf16),
+                VERBOSE_UNSUPPORTED_BIAS_CFG);
+        VDISPATCH_MATMUL(bia_d.dims()[0] == 1, VERBOSE_UNSUPPORTED_BIAS_CFG);
+    }
+
+    VDISPATCH_MATMUL(attr()->has_default_values(smask_t::scales_data_type
+                             | smask_t::post_ops | smask_t::sum_dt,
+                             dst_dt),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_MATMUL(attr()->post_ops_.check_sum_consistency(dst_dt, is_int8),
+            VERBOSE_UNSUPPORTED_POSTOP);
+
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(src_d.matches_one_of_tag(format_tag::ab)
+                    && dst_d.matches_one_of_tag(format_tag::ab),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(
+            attr_.set_default_formats(dst_md()) == status::success,
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_MATMUL(post_ops_ok(), VERBOSE_UNSUPPORTED_POSTOP);
+
+    CHECK(init_conf());
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+bool brgemm_sparse_matmul_t<isa>::pd_t::scales_ok() const {
+    const auto &scales = attr()->scales_;
+    if (scales.has_default_values()) return true;
+
+    // Only the scales brgemm kernels apply in the epilogue are supported:
+    // common source and destination scales and common or per-N weights
+    // scales.
+    bool ok = attr_scales_ok();
+    for (int arg : {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST}) {
+        if (scales.has_default_values(arg)) continue;
+        const auto &entry = scales.get(arg);
+        const int mask = entry.get_mask();
+        ok = ok && entry.has_default_groups()
+                && entry.get_data_type() == data_type::f32
+                && (mask == 0
+                        || (arg == DNNL_ARG_WEIGHTS && mask == wei_qmask_N()));
+    }
+    return ok;
+}
+
+template <cpu_isa_t isa>
+bool brgemm_sparse_matmul_t<isa>::pd_t::post_ops_ok() const {
+    using namespace injector;
+
+    const memory_desc_wrapper dst_d(dst_md());
+    return injector::post_ops_ok(post_ops_ok_args_t(isa,
+            {sum, eltwise, binary}, attr()->post_ops_, &dst_d,
+            false /*sum_at_pos_0_only*/, false /*sum_requires_scale_one*/,
+            true /*sum_requires_zp_zero*/, true /*sum_requires_same_params*/,
+            {broadcasting_strategy_t::per_oc, broadcasting_strategy_t::scalar,
+                    broadcasting_strategy_t::no_broadcast}));
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sparse_matmul_t<isa>::pd_t::init_conf() {
+    using namespace data_type;
+
+    const memory_desc_wrapper wei_d(weights_md(0));
+    auto &c = conf_;
+    c = brgemm_sparse_matmul_conf_t();
+
+    c.encoding = wei_d.encoding();
+    c.src_dt = src_md()->data_type;
+    c.wei_dt = wei_d.data_type();
+    c.dst_dt = dst_md()->data_type;
+    c.acc_dt = types::is_integral_dt(c.src_dt) ? s32 : f32;
+    c.with_bias = with_bias();
+    c.bia_dt = c.with_bias ? weights_md(1)->data_type : data_type::undef;
+
+    c.M = M();
+    c.N = N();
+    c.K = K();
+    c.vnni_granularity = (int)data_type_vnni_granularity(c.wei_dt);
+
+    if (c.encoding == sparse_encoding::bsr) {
+        const auto &bsr_desc = wei_d.sparse_desc().bsr_desc;
+        c.K_blk = bsr_desc.block_dims[0];
+        c.N_blk = bsr_desc.block_dims[1];
+        c.nblocks = wei_d.nnz() / (c.K_blk * c.N_blk);
+    } else {
+        // The decompressed panel is expected to stay in L2.
+        const dim_t max_panel_size = 256 * 1024;
+        const dim_t wei_dt_size = types::data_type_size(c.wei_dt);
+        c.K_blk = c.K;
+        c.N_blk = 64;
+        while (c.N_blk > 16 && c.K * c.N_blk * wei_dt_size > max_panel_size)
+            c.N_blk /= 2;
+        c.N_blk = nstl::min(c.N_blk, c.N);
+    }
+    c.M_blk = nstl::min<dim_t>(64, c.M);
+
+    c.MB = div_up(c.M, c.M_blk);
+    c.NB = div_up(c.N, c.N_blk);
+    c.KB = c.K / c.K_blk;
+    c.M_tail = c.M % c.M_blk;
+    c.N_tail = c.N % c.N_blk;
+
+    const auto &scales = attr()->scales_;
+    const auto &post_ops = attr()->post_ops_;
+    c.with_src_scales = !scales.has_default_values(DNNL_ARG_SRC);
+    c.with_wei_scales = !scales.has_default_values(DNNL_ARG_WEIGHTS);
+    c.with_dst_scales = !scales.has_default_values(DNNL_ARG_DST);
+    c.is_oc_scale = c.with_wei_scales && scales.get_mask(DNNL_ARG_WEIGHTS) > 0;
+    c.with_sum = post_ops.find(primitive_kind::sum) != -1;
+
+    c.post_ops_applicable = one_of(true, c.with_bias, c.with_src_scales,
+            c.with_wei_scales, c.with_dst_scales, post_ops.len() > 0,
+            c.acc_dt != c.dst_dt);
+    // The destination can serve as the accumulation buffer unless it is
+    // required to keep the values for the sum post-op.
+    c.use_buffer_c = c.post_ops_applicable
+            && (c.acc_dt != c.dst_dt || c.with_sum);
+    c.nthr = dnnl_get_max_threads();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sparse_matmul_t<isa>::pd_t::init_brgemm_descs() {
+    const auto &c = conf_;
+    for (int idx = 0; idx < max_num_brg_kernels_sparse_matmul; idx++) {
+        if (!brg_kernel_exists(idx)) continue;
+        const bool is_m_tail = idx / 2, is_n_tail = idx % 2;
+        const dim_t M = is_m_tail ? c.M_tail : c.M_blk;
+        const dim_t N = is_n_tail ? c.N_tail : c.N_blk;
+        const dim_t LDC = c.use_buffer_c ? c.N_blk : c.N;
+
+        auto &brg = brg_descs_[idx];
+        CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, c.src_dt, c.wei_dt,
+                false, false, brgemm_row_major, 1.f, 0.f, c.K, c.N_blk, LDC,
+                M, N, c.K_blk));
+
+        brgemm_attr_t brgattr;
+        // A BSR block column may contain every block row, an empty one is
+        // computed with a single zero block.
+        brgattr.max_bs = c.encoding == sparse_encoding::bsr
+                ? (int)nstl::max<dim_t>(c.KB, 1)
+                : 1;
+        brgattr.hint_expected_A_size = M * c.K;
+        brgattr.hint_expected_B_size = N * c.K;
+        brgattr.hint_expected_C_size = M * N;
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        CHECK(brgemm_desc_set_postops(
+                &brg, attr(), dst_md(), c.N, c.bia_dt));
+        CHECK(brgemm_desc_finalize(&brg));
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_sparse_matmul_t<isa>::pd_t::init_scratchpad() {
+    const auto &c = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+    const size_t wei_dt_size = types::data_type_size(c.wei_dt);
+
+    scratchpad.template book<brgemm_batch_element_t>(key_brgemm_primitive_batch,
+            c.nthr * nstl::max<dim_t>(c.KB, 1));
+    if (c.use_buffer_c)
+        scratchpad.book(key_brgemm_primitive_buffer,
+                c.nthr * c.M_blk * c.N_blk * types::data_type_size(c.acc_dt),
+                1, 64);
+
+    if (c.encoding == sparse_encoding::bsr) {
+        // The reordered blocks (if required) are followed by a zero block.
+        const dim_t reordered_size
+                = c.vnni_granularity > 1 ? c.nblocks * c.K_blk * c.N_blk : 0;
+        scratchpad.book(key_brgemm_primitive_buffer_b,
+                (reordered_size + c.K_blk * c.N_blk) * wei_dt_size, 1, 64);
+        // Block column pointers, block row indices and block numbers.
+        scratchpad.template book<int32_t>(
+                key_matmul_sparse_tmp_ptr, c.NB + 1 + 2 * c.nblocks);
+    } else {
+        scratchpad.book(key_brgemm_primitive_buffer_b,
+                c.nthr * c.K * c.N_blk * wei_dt_size, 1, 64);
+    }
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sparse_matmul_t<isa>::init(engine_t *engine) {
+    for (int idx = 0; idx < max_num_brg_kernels_sparse_matmul; idx++) {
+        if (!pd()->brg_kernel_exists(idx)) continue;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->get_brg_desc(idx)));
+        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sparse_matmul_t<isa>::prepare_bsr_weights(
+        const exec_ctx_t &ctx, const char *&wei_values) const {
+    const auto &c = pd()->get_conf();
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    const auto values = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS, 0);
+    const auto indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 1);
+    const auto pointers = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 2);
+
+    bool pointers_ok = pointers[0] == 0 && pointers[c.KB] == c.nblocks;
+    for (dim_t kb = 0; kb < c.KB; kb++)
+        pointers_ok = pointers_ok && pointers[kb] <= pointers[kb + 1];
+    VCONDCHECK(primitive, exec, check, matmul, pointers_ok,
+            status::invalid_arguments,
+            "pointers are not increasing from 0 to %ld", (long)c.nblocks);
+    bool indices_ok = true;
+    for (dim_t p = 0; p < c.nblocks; p++)
+        indices_ok = indices_ok && indices[p] >= 0 && indices[p] < c.NB;
+    VCONDCHECK(primitive, exec, check, matmul, indices_ok,
+            status::invalid_arguments, "indices are out of range [0, %ld)",
+            (long)c.NB);
+
+    // Transpose the block structure so the non-zero blocks of each block
+    // column are listed in the increasing order of block rows.
+    int32_t *col_ptr = scratchpad.template get<int32_t>(
+            key_matmul_sparse_tmp_ptr);
+    int32_t *col_kb = col_ptr + c.NB + 1;
+    int32_t *col_blk = col_kb + c.nblocks;
+
+    std::fill(col_ptr, col_ptr + c.NB + 1, 0);
+    for (dim_t p = 0; p < c.nblocks; p++)
+        col_ptr[indices[p] + 1]++;
+    for (dim_t nb = 0; nb < c.NB; nb++)
+        col_ptr[nb + 1] += col_ptr[nb];
+    for (dim_t kb = 0; kb < c.KB; kb++)
+        for (int32_t p = pointers[kb]; p < pointers[kb + 1]; p++) {
+            const int32_t pos = col_ptr[indices[p]]++;
+            col_kb[pos] = (int32_t)kb;
+            col_blk[pos] = p;
+        }
+    for (dim_t nb = c.NB; nb > 0; nb--)
+        col_ptr[nb] = col_ptr[nb - 1];
+    col_ptr[0] = 0;
+
+    const size_t wei_dt_size = types::data_type_size(c.wei_dt);
+    const dim_t blk_size = c.K_blk * c.N_blk;
+    char *wei_buf
+            = scratchpad.template get<char>(key_brgemm_primitive_buffer_b);
+    const bool need_reorder = c.vnni_granularity > 1;
+    char *zero_blk
+            = wei_buf + (need_reorder ? c.nblocks * blk_size * wei_dt_size : 0);
+    std::memset(zero_blk, 0, blk_size * wei_dt_size);
+
+    wei_values = need_reorder ? wei_buf : values;
+    if (!need_reorder) return status::success;
+
+    assert(c.vnni_granularity == (int)(sizeof(uint32_t) / wei_dt_size));
+    parallel_nd(c.nblocks, [&](dim_t p) {
+        const size_t off = p * blk_size * wei_dt_size;
+        if (wei_dt_size == 2)
+            reorder_to_vnni(reinterpret_cast<uint16_t *>(wei_buf + off),
+                    reinterpret_cast<const uint16_t *>(values + off), c.K_blk,
+                    c.N_blk, c.N_blk, c.N_blk);
+        else
+            reorder_to_vnni(reinterpret_cast<uint8_t *>(wei_buf + off),
+                    reinterpret_cast<const uint8_t *>(values + off), c.K_blk,
+                    c.N_blk, c.N_blk, c.N_blk);
+    });
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+bool brgemm_sparse_matmul_t<isa>::decompress_2_4_panel(const char *values,
+        const uint8_t *metadata, char *wei_buf, dim_t n) const {
+    const auto &c = pd()->get_conf();
+    const size_t wei_dt_size = types::data_type_size(c.wei_dt);
+    const dim_t N = nstl::min(c.N_blk, c.N - n);
+    assert(c.vnni_granularity == (int)(sizeof(uint32_t) / wei_dt_size));
+
+    const char *panel_values = values + n * wei_dt_size;
+    const uint8_t *panel_metadata = metadata + n;
+    switch (wei_dt_size) {
+        case 4:
+            return decompress_2_4_to_vnni(reinterpret_cast<uint32_t *>(wei_buf),
+                    reinterpret_cast<const uint32_t *>(panel_values),
+                    panel_metadata, c.K, N, c.N, c.N_blk);
+        case 2:
+            return decompress_2_4_to_vnni(reinterpret_cast<uint16_t *>(wei_buf),
+                    reinterpret_cast<const uint16_t *>(panel_values),
+                    panel_metadata, c.K, N, c.N, c.N_blk);
+        case 1:
+            return decompress_2_4_to_vnni(reinterpret_cast<uint8_t *>(wei_buf),
+                    reinterpret_cast<const uint8_t *>(panel_values),
+                    panel_metadata, c.K, N, c.N, c.N_blk);
+        default: assert(!"unsupported data type size");
+    }
+    return false;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sparse_matmul_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto &c = pd()->get_conf();
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    const auto post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(
+                    pd()->attr()->post_ops_, ctx);
+
+    const void *src_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
+    const char *wei_scales
+            = CTX_IN_MEM(const char *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS);
+    const float *dst_scales
+            = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
+
+    const size_t src_dt_size = types::data_type_size(c.src_dt);
+    const size_t wei_dt_size = types::data_type_size(c.wei_dt);
+    const size_t dst_dt_size = types::data_type_size(c.dst_dt);
+    const size_t acc_dt_size = types::data_type_size(c.acc_dt);
+    const size_t bia_dt_size
+            = c.with_bias ? types::data_type_size(c.bia_dt) : 0;
+    const dim_t max_bs = nstl::max<dim_t>(c.KB, 1);
+
+    auto batch_global = scratchpad.template get<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch);
+    auto c_buffer_global = c.use_buffer_c
+            ? scratchpad.template get<char>(key_brgemm_primitive_buffer)
+            : nullptr;
+
+    const bool is_bsr = c.encoding == sparse_encoding::bsr;
+    const char *wei_values = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS, 0);
+    if (is_bsr) CHECK(prepare_bsr_weights(ctx, wei_values));
+    const auto wei_metadata = is_bsr
+            ? nullptr
+            : CTX_IN_MEM(const uint8_t *, DNNL_ARG_WEIGHTS, 1);
+    const int32_t *col_ptr = is_bsr
+            ? scratchpad.template get<int32_t>(key_matmul_sparse_tmp_ptr)
+            : nullptr;
+    const int32_t *col_kb = is_bsr ? col_ptr + c.NB + 1 : nullptr;
+    const int32_t *col_blk = is_bsr ? col_kb + c.nblocks : nullptr;
+    const char *zero_blk = is_bsr
+            ? scratchpad.template get<char>(key_brgemm_primitive_buffer_b)
+                    + (c.vnni_granularity > 1 ? c.nblocks : 0) * c.K_blk
+                            * c.N_blk * wei_dt_size
+            : nullptr;
+
+    std::atomic<bool> metadata_ok(true);
+    parallel(c.nthr, [&](const int ithr, const int nthr) {
+        // Blocks are iterated along M first so the weights of a block
+        // column (or a decompressed panel) are reused by the thread.
+        dim_t start {0}, end {0};
+        balance211(c.MB * c.NB, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        brgemm_batch_element_t *batch = batch_global + ithr * max_bs;
+        char *c_buffer = c.use_buffer_c
+                ? c_buffer_global + ithr * c.M_blk * c.N_blk * acc_dt_size
+                : nullptr;
+        char *wei_panel = is_bsr ? nullptr
+                                 : scratchpad.template get<char>(
+                                           key_brgemm_primitive_buffer_b)
+                        + ithr * c.K * c.N_blk * wei_dt_size;
+        const float dst_scale_inv
+                = c.with_dst_scales ? 1.f / dst_scales[0] : 1.f;
+
+        dim_t decompressed_nb = -1;
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t nb = iwork / c.MB;
+            const dim_t mb = iwork % c.MB;
+            const dim_t m = mb * c.M_blk;
+            const dim_t n = nb * c.N_blk;
+            const char *ptr_A = src + m * c.K * src_dt_size;
+
+            int bs = 0;
+            if (is_bsr) {
+                for (int32_t pos = col_ptr[nb]; pos < col_ptr[nb + 1];
+                        pos++) {
+                    batch[bs].ptr.A
+                            = ptr_A + col_kb[pos] * c.K_blk * src_dt_size;
+                    batch[bs].ptr.B = wei_values
+                            + col_blk[pos] * c.K_blk * c.N_blk * wei_dt_size;
+                    bs++;
+                }
+                if (bs == 0) {
+                    batch[0].ptr.A = ptr_A;
+                    batch[0].ptr.B = zero_blk;
+                    bs = 1;
+                }
+            } else {
+                if (decompressed_nb != nb) {
+                    if (!decompress_2_4_panel(
+                                wei_values, wei_metadata, wei_panel, n))
+                        metadata_ok.store(false, std::memory_order_relaxed);
+                    decompressed_nb = nb;
+                }
+                batch[0].ptr.A = ptr_A;
+                batch[0].ptr.B = wei_panel;
+                bs = 1;
+            }
+
+            const bool is_m_tail = m + c.M_blk > c.M;
+            const bool is_n_tail = n + c.N_blk > c.N;
+            const int brg_ker_idx
+                    = pd_t::get_brg_kernel_idx(is_m_tail, is_n_tail);
+            const auto brg_kernel = brg_kernels_[brg_ker_idx].get();
+            char *ptr_D = dst + (m * c.N + n) * dst_dt_size;
+            char *ptr_C = c.use_buffer_c ? c_buffer : ptr_D;
+
+            if (c.post_ops_applicable) {
+                const brgemm_post_ops_data_t post_ops_data {
+                        c.with_bias ? bias + n * bia_dt_size : nullptr,
+                        post_ops_binary_rhs_arg_vec.data(),
+                        static_cast<size_t>(n), static_cast<size_t>(m), dst,
+                        static_cast<size_t>(m * c.N + n), nullptr, nullptr,
+                        nullptr, false, 1, false, false, src_scales,
+                        c.with_wei_scales ? wei_scales
+                                        + c.is_oc_scale * n * sizeof(float)
+                                          : nullptr,
+                        c.with_dst_scales ? &dst_scale_inv : nullptr};
+                brgemm_kernel_execute_postops(brg_kernel, bs, batch,
+                        (void *)ptr_C, (void *)ptr_D, post_ops_data);
+            } else {
+                brgemm_kernel_execute(brg_kernel, bs, batch, (void *)ptr_C);
+            }
+        }
+    });
+
+    VCONDCHECK(primitive, exec, check, matmul, metadata_ok.load(),
+            status::invalid_arguments,
+            "positions of kept values are not increasing");
+    return status::success;
+}
+
+template struct brgemm_sparse_matmul_t<avx512_core_bf16>;
+template struct brgemm_sparse_matmul_t<avx512_core_vnni>;
+template struct brgemm_sparse_matmul_t<avx512_core>;
+template struct brgemm_sparse_matmul_t<avx2>;
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,132 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_BRGEMM_SPARSE_MATMUL_HPP
+#define CPU_X64_MATMUL_BRGEMM_SPARSE_MATMUL_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+// Kernels are generated for full and tail blocks along M and N.
+constexpr int max_num_brg_kernels_sparse_matmul = 2 * 2;
+
+struct brgemm_sparse_matmul_conf_t {
+    sparse_encoding_t encoding;
+    data_type_t src_dt, wei_dt, dst_dt, acc_dt, bia_dt;
+    dim_t M, N, K;
+    // For BSR weights `K_blk` x `N_blk` is the block shape. For 2:4
+    // weights `K_blk` is equal to K and `N_blk` is the width of the panel
+    // that is decompressed at once.
+    dim_t M_blk, N_blk, K_blk;
+    dim_t M_tail, N_tail;
+    dim_t MB, NB, KB;
+    // Number of stored weights blocks for BSR.
+    dim_t nblocks;
+    // Number of K elements packed together in the B matrix layout.
+    int vnni_granularity;
+    bool with_bias, with_sum, with_src_scales, with_wei_scales,
+            with_dst_scales;
+    bool is_oc_scale;
+    bool post_ops_applicable, use_buffer_c;
+    int nthr;
+};
+
+// Matrix multiplication with dense source and BSR or 2:4 structured sparse
+// weights on top of brgemm kernels.
+//
+// BSR: every (M block, block column) pair is computed with a single brgemm
+// call whose batch contains only the non-zero weights blocks of the block
+// column, so zero blocks are neither loaded nor multiplied.
+//
+// 2:4: weights panels are decompressed into a thread-local buffer right
+// before use, so only the compressed values and metadata are read from
+// memory.
+template <cpu_isa_t isa>
+struct brgemm_sparse_matmul_t : public primitive_t {
+    struct pd_t : public ::dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using ::dnnl::impl::cpu::matmul::cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_sparse_matmul:", isa, ""),
+                brgemm_sparse_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        static int get_brg_kernel_idx(bool is_m_tail, bool is_n_tail) {
+            return 2 * is_m_tail + is_n_tail;
+        }
+        const brgemm_desc_t &get_brg_desc(int idx) const {
+            return brg_descs_[idx];
+        }
+        bool brg_kernel_exists(int idx) const {
+            const bool is_m_tail = idx / 2, is_n_tail = idx % 2;
+            return IMPLICATION(is_m_tail, conf_.M_tail > 0)
+                    && IMPLICATION(is_n_tail, conf_.N_tail > 0);
+        }
+        const brgemm_sparse_matmul_conf_t &get_conf() const { return conf_; }
+
+    private:
+        bool scales_ok() const;
+        bool post_ops_ok() const;
+        status_t init_conf();
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+
+        brgemm_desc_t brg_descs_[max_num_brg_kernels_sparse_matmul];
+        brgemm_sparse_matmul_conf_t conf_;
+    };
+
+    brgemm_sparse_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // Validates the block structure, builds a per block column list of
+    // non-zero weights blocks and, if required by the kernel, reorders the
+    // blocks into the VNNI layout. Sets @p wei_values to the weights blocks
+    // to use in the computation.
+    status_t prepare_bsr_weights(
+            const exec_ctx_t &ctx, const char *&wei_values) const;
+    // Decompresses the panel of 2:4 weights that starts at column @p n
+    // into the dense @p wei_buf in the layout expected by the kernel.
+    // Returns `false` if the metadata of the panel is malformed.
+    bool decompress_2_4_panel(const char *values, const uint8_t *metadata,
+            char *wei_buf, dim_t n) const;
+
+    std::unique_ptr<brgemm_kernel_t>
+            brg_kernels_[max_num_brg_kernels_sparse_matmul];
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -51,6 +51,7 @@ dim_t brgemm_calc_m_block_lstm(dim_t nthr, dim_t M, dim_t N_blocks, bool is_f32,
         dim_t l2_cache_size);
 dim_t adjust_m_block_lstm(dim_t nthr, dim_t M, dim_t N_blocks, bool is_int8_amx,
         bool is_xf16_amx);
+dim_t adjust_m_block_varlen(dim_t M, dim_t m_block, bool is_amx);
 
 dim_t brgemm_calc_n_block(
         const cpu::rnn_utils::rnn_conf_t &rnn, alg_kind_t cell_kind);
@@ -279,6 +280,17 @@ dim_t adjust_m_block_lstm(dim_t nthr, dim_t M, dim_t N_blocks, bool is_int8_amx,
     return m_block;
 }
 
+dim_t adjust_m_block_varlen(dim_t M, dim_t m_block, bool is_amx) {
+    // The active minibatch of variable-length sequences shrinks in whole
+    // m_block steps, a finer blocking reduces the number of padded rows
+    // computed once the shorter sequences are over.
+    const dim_t max_M = nstl::min(m_block, is_amx ? dim_t(32) : dim_t(16));
+    const dim_t min_M = 4;
+    for (dim_t m = max_M; m >= min_M; m--)
+        if (M % m == 0) return m;
+    return m_block;
+}
+
 x64::cpu_isa_t adjust_isa_by_m_block(
         x64::cpu_isa_t current_isa, dim_t m_block, bool is_int8_amx) {
     /*
@@ -421,6 +433,9 @@ status_t rnn_brgemm_t<prop_kind::forward>::configure_brgemm(
     rnn.m_block = brgemm_calc_m_block(cell_kind, prop_kind::forward, rnn.nthr,
             rnn.M, rnn.N_blocks, rnn.is_cell_dt_f32(), rnn.is_cell_int8_amx(),
             rnn.is_cell_xf16_amx(), work_by_N, As, Bs, Cs, l2_cache_size);
+    if (rnn.is_varlen)
+        rnn.m_block = adjust_m_block_varlen(
+                rnn.M, rnn.m_block, rnn.is_cell_amx());
 
     rnn.M_blocks = rnn.M / rnn.m_block;
 
@@ -202,6 +202,8 @@ status_t ref_rnn_fwd_t::pd_t::init(impl::engine_t *engine) {
 
     VDISPATCH_RNN(
             one_of(cell_kind, alg_kind::vanilla_rnn), VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_RNN(!this->with_seq_lengths(), VERBOSE_UNSUPPORTED_FEATURE,
+            "variable-length sequences");
     VDISPATCH_RNN(weights_iter_dt == weights_layer_dt, VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_RNN_SC(this->set_default_params(), VERBOSE_UNSUPPORTED_TAG);
     VDISPATCH_RNN(this->with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
@@ -376,6 +378,8 @@ status_t ref_rnn_bwd_t::pd_t::init(impl::engine_t *engine) {
 
     VDISPATCH_RNN(
             one_of(cell_kind, alg_kind::vanilla_rnn), VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_RNN(!this->with_seq_lengths(), VERBOSE_UNSUPPORTED_FEATURE,
+            "variable-length sequences");
     VDISPATCH_RNN(weights_iter_dt == weights_layer_dt, VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_RNN_SC(this->set_default_params(), VERBOSE_UNSUPPORTED_TAG);
     VDISPATCH_RNN(this->with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
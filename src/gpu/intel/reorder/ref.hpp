@@ -60,6 +60,8 @@ struct ref_t : public primitive_t {
                             | smask_t::rounding_mode)
                             && post_ops_ok(),
                     VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_REORDER(!attr()->scales_.get(DNNL_ARG_DST).is_dynamic(),
+                    VERBOSE_UNSUPPORTED_SCALES_CFG);
             VDISPATCH_REORDER(
                     IMPLICATION(!attr()->rounding_mode_.has_default_values(),
                             utils::one_of(sdt, f32, bf16, f16)
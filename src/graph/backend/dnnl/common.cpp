@@ -473,6 +473,23 @@ memory::desc to_ncx_format(const memory::desc &adesc) {
             get_ncx_format(adesc.get_ndims()));
 }
 
+memory::desc get_view_desc(const memory::desc &adesc, const dims &adims,
+        const dims &offsets, dim &offset) {
+    memory::desc sub = adesc.submemory_desc(adims, offsets, true);
+    if (!sub) return sub;
+
+    offset = sub.get_submemory_offset() - adesc.get_submemory_offset();
+    if (is_plain(sub))
+        return memory::desc(adims, sub.get_data_type(), sub.get_strides());
+
+    // keep the blocking of the parent and drop the offset
+    dnnl_memory_desc_t view = nullptr;
+    if (dnnl_memory_desc_clone(&view, sub.get()) != dnnl_success)
+        return memory::desc();
+    view->offset0 = 0;
+    return memory::desc(view);
+}
+
 inline bool maybe_reorder_value(const value_t *val) {
     for (const auto &consumer : val->get_consumers()) {
         if (consumer.get_op().get_kind() == graph::op_kind::Reorder) {
@@ -123,6 +123,13 @@ bool is_plain(const memory::desc &adesc);
 
 memory::desc to_ncx_format(const memory::desc &adesc);
 
+// Returns the desc of the sub-tensor of adesc with adims at offsets. The
+// returned desc has no offset of its own: the distance from the start of adesc
+// to the start of the sub-tensor is returned in offset, in elements. An empty
+// desc is returned if the sub-tensor can't be described in the adesc layout.
+memory::desc get_view_desc(const memory::desc &adesc, const dims &adims,
+        const dims &offsets, dim &offset);
+
 void set_all_layout_to_any(std::vector<std::shared_ptr<op_t>> &subgraph);
 
 status_t fill_layout_info(logical_tensor_t *lt, const memory::desc &md);
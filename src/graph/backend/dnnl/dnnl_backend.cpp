@@ -60,6 +60,10 @@ pass::pass_registry_t dnnl_backend_t::register_passes() {
     DNNL_BACKEND_REGISTER_PATTERN_CALL(groupnorm_fusion, pass_registry);
     DNNL_BACKEND_REGISTER_PATTERN_CALL(mlp, pass_registry);
     DNNL_BACKEND_REGISTER_PATTERN_CALL(bmb, pass_registry);
+    DNNL_BACKEND_REGISTER_PATTERN_CALL(embedding_bag_fusion, pass_registry);
+    DNNL_BACKEND_REGISTER_PATTERN_CALL(rope_fusion, pass_registry);
+    DNNL_BACKEND_REGISTER_PATTERN_CALL(topk_fusion, pass_registry);
+    DNNL_BACKEND_REGISTER_PATTERN_CALL(data_movement_fusion, pass_registry);
 
     const std::vector<data_type_t> dtypes_to_check
             = {dnnl_bf16, dnnl_f16, dnnl_f8_e4m3, dnnl_f8_e5m2};
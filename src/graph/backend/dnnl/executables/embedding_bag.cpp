@@ -0,0 +1,166 @@
+/*******************************************************************************
+ * Copyright 2026 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include "graph/backend/dnnl/executables/embedding_bag.hpp"
+
+#include "common/embedding_bag_iface.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+namespace {
+// Scales and zero-points of a quantized table are fused as trailing inputs,
+// after the optional per-sample weights.
+bool with_per_sample_weights(const op_t *op) {
+    const fusion_info_t &fusion_info = op->has_attr(op_attr::fusion_info)
+            ? op->get_attr<fusion_info_t>(op_attr::fusion_info)
+            : fusion_info_t();
+    size_t num_fused_inputs = 0;
+    if (fusion_info.with_runtime_scales(true, 0)) num_fused_inputs++;
+    if (fusion_info.with_runtime_zero_points(true, 0)) num_fused_inputs++;
+    return op->num_inputs() > 3 + num_fused_inputs;
+}
+} // namespace
+
+embedding_bag_executable_t::embedding_bag_executable_t(
+        std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+        pd_cache_t &pd_cache, const fpmath_t &fpmath, bool use_block_layout) {
+    auto src_md = make_dnnl_memory_desc(op->get_input_logical_tensor(0));
+    auto indices_md = make_dnnl_memory_desc(op->get_input_logical_tensor(1));
+    auto offsets_md = make_dnnl_memory_desc(op->get_input_logical_tensor(2));
+    dnnl::memory::desc weights_md;
+    if (with_per_sample_weights(op.get()))
+        weights_md = make_dnnl_memory_desc(op->get_input_logical_tensor(3));
+    auto dst_md = make_dnnl_memory_desc(op->get_output_logical_tensor(0));
+
+    const std::string mode = op->has_attr(op_attr::mode)
+            ? op->get_attr<std::string>(op_attr::mode)
+            : "sum";
+    dnnl::algorithm alg = dnnl::algorithm::reduction_sum;
+    if (mode == "mean")
+        alg = dnnl::algorithm::reduction_mean;
+    else if (mode == "max")
+        alg = dnnl::algorithm::reduction_max;
+
+    dnnl::primitive_attr prm_attr;
+    if (op->has_attr(op_attr::fusion_info)) {
+        const fusion_info_t &fusion_info
+                = op->get_attr<fusion_info_t>(op_attr::fusion_info);
+        prm_attr = make_dnnl_primitive_attr(op, fusion_info);
+    }
+
+    dnnl_primitive_desc_t pd = nullptr;
+    auto ret = dnnl_embedding_bag_primitive_desc_create(&pd, p_engine.get(),
+            static_cast<dnnl_alg_kind_t>(alg), src_md.get(), indices_md.get(),
+            offsets_md.get(), weights_md.get(), dst_md.get(),
+            prm_attr.get());
+    if (pd && ret == dnnl_success) {
+        pd_.reset(pd);
+        dnnl_primitive_t prim = nullptr;
+        ret = dnnl_primitive_create(&prim, pd_.get());
+        if (prim && ret == dnnl_success) { prim_.reset(prim); }
+    }
+}
+
+void embedding_bag_executable_t::execute(const stream &stream,
+        const std::unordered_map<int, memory> &args) const {
+    std::vector<dnnl_exec_arg_t> c_args;
+    c_args.reserve(args.size());
+    for (const auto &a : args)
+        c_args.push_back({a.first, a.second.get()});
+
+    auto ret = dnnl_primitive_execute(prim_.get(), stream.get(),
+            static_cast<int>(c_args.size()), c_args.data());
+    dnnl::error::wrap_c_api(ret, "could not execute embedding bag primitive");
+}
+
+#ifdef DNNL_WITH_SYCL
+::sycl::event embedding_bag_executable_t::execute_sycl(const stream &stream,
+        const std::unordered_map<int, memory> &args,
+        const std::vector<::sycl::event> &deps) const {
+    std::vector<dnnl_exec_arg_t> c_args;
+    c_args.reserve(args.size());
+    for (const auto &a : args)
+        c_args.push_back({a.first, a.second.get()});
+
+    sycl::event return_event;
+    auto ret = dnnl_sycl_interop_primitive_execute(prim_.get(), stream.get(),
+            c_args.size(), c_args.data(), &deps, &return_event);
+    dnnl::error::wrap_c_api(
+            ret, "could not execute embedding bag primitive with sycl runtime");
+
+    return return_event;
+}
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+cl_event embedding_bag_executable_t::execute_ocl(const stream &stream,
+        const std::unordered_map<int, memory> &args,
+        const std::vector<cl_event> &deps) const {
+    std::vector<dnnl_exec_arg_t> c_args;
+    c_args.reserve(args.size());
+    for (const auto &a : args)
+        c_args.push_back({a.first, a.second.get()});
+
+    const cl_event *c_deps = deps.empty() ? nullptr : deps.data();
+
+    cl_event return_event = nullptr;
+    auto ret = dnnl_ocl_interop_primitive_execute(prim_.get(), stream.get(),
+            static_cast<int>(c_args.size()), c_args.data(), c_deps,
+            static_cast<int>(deps.size()), &return_event);
+    dnnl::error::wrap_c_api(
+            ret, "could not execute embedding bag primitive with ocl runtime");
+
+    return return_event;
+}
+#endif
+
+arg_indices_t embedding_bag_executable_t::get_arg_indices(const op_t *op) {
+    arg_indices_t args;
+    // inputs: table, indices, offsets, optional per-sample weights, then
+    // the fused table scales and zero-points
+    size_t idx = 0;
+    args.insert({DNNL_ARG_SRC, {indices_t::type_t::input, idx++}});
+    args.insert({DNNL_ARG_INDICES, {indices_t::type_t::input, idx++}});
+    args.insert({DNNL_ARG_OFFSETS, {indices_t::type_t::input, idx++}});
+    if (with_per_sample_weights(op))
+        args.insert({DNNL_ARG_WEIGHTS, {indices_t::type_t::input, idx++}});
+
+    const fusion_info_t &fusion_info = op->has_attr(op_attr::fusion_info)
+            ? op->get_attr<fusion_info_t>(op_attr::fusion_info)
+            : fusion_info_t();
+    if (fusion_info.with_runtime_scales(true, 0)) {
+        args.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC,
+                {indices_t::type_t::input, idx++}});
+    }
+    if (fusion_info.with_runtime_zero_points(true, 0)) {
+        args.insert({DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_SRC,
+                {indices_t::type_t::input, idx++}});
+    }
+
+    // outputs
+    args.insert({DNNL_ARG_DST, {indices_t::type_t::output, 0}});
+    args.insert({DNNL_ARG_SCRATCHPAD, {indices_t::type_t::output, 1}});
+
+    return args;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,158 @@
+/*******************************************************************************
+ * Copyright 2026 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "common/bfloat16.hpp"
+#include "common/float16.hpp"
+
+#include "graph/backend/dnnl/executables/pad.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+namespace {
+template <typename T>
+void fill_with_value(std::vector<char> &buf, T value) {
+    T *ptr = reinterpret_cast<T *>(buf.data());
+    const size_t nelems = buf.size() / sizeof(T);
+    for (size_t i = 0; i < nelems; ++i)
+        ptr[i] = value;
+}
+
+template <typename T>
+T saturate_and_round(float value) {
+    const float lo = static_cast<float>(std::numeric_limits<T>::lowest());
+    const float hi = static_cast<float>(std::numeric_limits<T>::max());
+    return static_cast<T>(std::nearbyint(std::min(std::max(value, lo), hi)));
+}
+} // namespace
+
+arg_indices_t pad_executable_t::get_arg_indices(const op_t *op) {
+    UNUSED(op);
+    arg_indices_t args;
+    args.insert({DNNL_ARG_FROM, {indices_t::type_t::input, 0}});
+    args.insert({DNNL_ARG_TO, {indices_t::type_t::output, 0}});
+    return args;
+}
+
+pad_executable_t::pad_executable_t(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, pd_cache_t &pd_cache,
+        const fpmath_t &fpmath, bool use_block_layout) {
+    UNUSED(pd_cache);
+    UNUSED(fpmath);
+    UNUSED(use_block_layout);
+
+    auto src_md = make_dnnl_memory_desc(op->get_input_logical_tensor(0));
+    auto dst_md = make_dnnl_memory_desc(op->get_output_logical_tensor(0));
+    const auto pads_begin = op->get_attr<dims>(op_attr::pads_begin);
+    const float pad_value = op->has_attr(op_attr::pad_value)
+            ? op->get_attr<float>(op_attr::pad_value)
+            : 0.f;
+
+    fill_data_.resize(dst_md.get_size());
+    switch (dst_md.get_data_type()) {
+        case memory::data_type::f32:
+            fill_with_value(fill_data_, pad_value);
+            break;
+        case memory::data_type::bf16:
+            fill_with_value(fill_data_, bfloat16_t(pad_value));
+            break;
+        case memory::data_type::f16:
+            fill_with_value(fill_data_, float16_t(pad_value));
+            break;
+        case memory::data_type::s8:
+            fill_with_value(fill_data_, saturate_and_round<int8_t>(pad_value));
+            break;
+        case memory::data_type::u8:
+            fill_with_value(fill_data_, saturate_and_round<uint8_t>(pad_value));
+            break;
+        default: assert(!"unsupported data type for pad"); return;
+    }
+
+    dst_view_md_ = dst_md.submemory_desc(src_md.get_dims(), pads_begin);
+    auto pd = dnnl::reorder::primitive_desc(
+            p_engine, src_md, p_engine, dst_view_md_);
+    prim_ = dnnl::reorder(pd);
+}
+
+memory pad_executable_t::make_dst_view(const memory &dst) const {
+    return make_dnnl_memory(
+            dst_view_md_, dst.get_engine(), dst.get_data_handle());
+}
+
+void pad_executable_t::execute(const stream &stream,
+        const std::unordered_map<int, memory> &args) const {
+    const memory &src = args.at(DNNL_ARG_FROM);
+    const memory &dst = args.at(DNNL_ARG_TO);
+    std::memcpy(dst.get_data_handle(), fill_data_.data(), fill_data_.size());
+
+    auto dst_view = make_dst_view(dst);
+    prim_.execute(stream, {{DNNL_ARG_FROM, src}, {DNNL_ARG_TO, dst_view}});
+}
+
+#ifdef DNNL_WITH_SYCL
+::sycl::event pad_executable_t::execute_sycl(const stream &stream,
+        const std::unordered_map<int, memory> &args,
+        const std::vector<::sycl::event> &deps) const {
+    const memory &src = args.at(DNNL_ARG_FROM);
+    const memory &dst = args.at(DNNL_ARG_TO);
+    auto sycl_queue = dnnl::sycl_interop::get_queue(stream);
+    auto fill_e = sycl_queue.memcpy(dst.get_data_handle(), fill_data_.data(),
+            fill_data_.size(), deps);
+
+    auto dst_view = make_dst_view(dst);
+    auto e = dnnl::sycl_interop::execute(prim_, stream,
+            {{DNNL_ARG_FROM, const_cast<memory &>(src)},
+                    {DNNL_ARG_TO, dst_view}},
+            {fill_e});
+    if (stream.get_engine().get_kind() == engine::kind::cpu) e.wait();
+    return e;
+}
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+cl_event pad_executable_t::execute_ocl(const stream &stream,
+        const std::unordered_map<int, memory> &args,
+        const std::vector<cl_event> &deps) const {
+    const memory &src = args.at(DNNL_ARG_FROM);
+    const memory &dst = args.at(DNNL_ARG_TO);
+    assert(deps.size() <= 1);
+    // Passing the empty event to memcpy below causes failure.
+    const bool empty = deps.empty() || deps[0] == nullptr;
+    const cl_uint num = empty ? 0 : static_cast<cl_uint>(deps.size());
+    cl_event fill_e;
+    UNUSED_STATUS(xpu::ocl::usm::memcpy(stream.get(), dst.get_data_handle(),
+            fill_data_.data(), fill_data_.size(), num,
+            empty ? nullptr : deps.data(), &fill_e));
+
+    auto dst_view = make_dst_view(dst);
+    return dnnl::ocl_interop::execute(prim_, stream,
+            {{DNNL_ARG_FROM, const_cast<memory &>(src)},
+                    {DNNL_ARG_TO, dst_view}},
+            {fill_e});
+}
+#endif
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,135 @@
+/*******************************************************************************
+ * Copyright 2026 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include "graph/interface/shape_infer.hpp"
+
+#include "graph/backend/dnnl/executables/slice.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+arg_indices_t slice_executable_t::get_arg_indices(const op_t *op) {
+    UNUSED(op);
+    arg_indices_t args;
+    args.insert({DNNL_ARG_FROM, {indices_t::type_t::input, 0}});
+    args.insert({DNNL_ARG_TO, {indices_t::type_t::output, 0}});
+    return args;
+}
+
+slice_executable_t::slice_executable_t(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, pd_cache_t &pd_cache,
+        const fpmath_t &fpmath, bool use_block_layout) {
+    UNUSED(pd_cache);
+    UNUSED(fpmath);
+    UNUSED(use_block_layout);
+
+    auto src_md = make_dnnl_memory_desc(op->get_input_logical_tensor(0));
+    auto dst_md = make_dnnl_memory_desc(op->get_output_logical_tensor(0));
+
+    // The region is validated by the layout propagation. If it is invalid
+    // anyway, no primitive is created and `is_initialized()` reports the
+    // failure to `compile_ops`.
+    dims offsets, sizes;
+    if (get_slice_region(op.get(), src_md.get_dims(), offsets, sizes)
+            != status::success) {
+        assertm(false, "invalid slice region");
+        return;
+    }
+
+    is_view_ = op->has_attr(op_attr::is_view)
+            && op->get_attr<bool>(op_attr::is_view);
+    if (is_view_) {
+        dim offset = 0;
+        auto view_md = get_view_desc(src_md, sizes, offsets, offset);
+        if (view_md && view_md == dst_md) {
+            offset_in_bytes_ = static_cast<size_t>(offset)
+                    * memory::data_type_size(src_md.get_data_type());
+            return;
+        }
+        // The layout of the dst doesn't match the view anymore, fall back to
+        // copy.
+        is_view_ = false;
+    }
+
+    src_view_md_ = src_md.submemory_desc(sizes, offsets);
+    auto pd = dnnl::reorder::primitive_desc(
+            p_engine, src_view_md_, p_engine, dst_md);
+    prim_ = dnnl::reorder(pd);
+}
+
+memory slice_executable_t::make_src_view(const memory &src) const {
+    return make_dnnl_memory(
+            src_view_md_, src.get_engine(), src.get_data_handle());
+}
+
+void slice_executable_t::execute(const stream &stream,
+        const std::unordered_map<int, memory> &args) const {
+    const memory &src = args.at(DNNL_ARG_FROM);
+    memory dst = args.at(DNNL_ARG_TO);
+    if (is_view_) {
+        dst.set_data_handle(
+                static_cast<char *>(src.get_data_handle()) + offset_in_bytes_);
+        return;
+    }
+
+    auto src_view = make_src_view(src);
+    prim_.execute(stream, {{DNNL_ARG_FROM, src_view}, {DNNL_ARG_TO, dst}});
+}
+
+#ifdef DNNL_WITH_SYCL
+::sycl::event slice_executable_t::execute_sycl(const stream &stream,
+        const std::unordered_map<int, memory> &args,
+        const std::vector<::sycl::event> &deps) const {
+    const memory &src = args.at(DNNL_ARG_FROM);
+    memory dst = args.at(DNNL_ARG_TO);
+    if (is_view_) {
+        dst.set_data_handle(
+                static_cast<char *>(src.get_data_handle()) + offset_in_bytes_);
+        return dummy_impl_t::execute_sycl(stream, args, deps);
+    }
+
+    auto src_view = make_src_view(src);
+    auto e = dnnl::sycl_interop::execute(prim_, stream,
+            {{DNNL_ARG_FROM, src_view}, {DNNL_ARG_TO, dst}}, deps);
+    if (stream.get_engine().get_kind() == engine::kind::cpu) e.wait();
+    return e;
+}
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+cl_event slice_executable_t::execute_ocl(const stream &stream,
+        const std::unordered_map<int, memory> &args,
+        const std::vector<cl_event> &deps) const {
+    const memory &src = args.at(DNNL_ARG_FROM);
+    memory dst = args.at(DNNL_ARG_TO);
+    if (is_view_) {
+        dst.set_data_handle(
+                static_cast<char *>(src.get_data_handle()) + offset_in_bytes_);
+        return dummy_impl_t::execute_ocl(stream, args, deps);
+    }
+
+    auto src_view = make_src_view(src);
+    return dnnl::ocl_interop::execute(prim_, stream,
+            {{DNNL_ARG_FROM, src_view}, {DNNL_ARG_TO, dst}}, deps);
+}
+#endif
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,70 @@
+/*******************************************************************************
+ * Copyright 2026 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_EXECUTABLES_SLICE_HPP
+#define GRAPH_BACKEND_DNNL_EXECUTABLES_SLICE_HPP
+
+#include "graph/backend/dnnl/executables/base.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Executable of the internal _slice op. When memory planning marks the op as a
+// view, the dst buffer is an alias of the src buffer and the executable only
+// moves the dst data handle to the beginning of the slice. Otherwise the slice
+// region is copied with a reorder.
+struct slice_executable_t : public dummy_impl_t {
+    DECLARE_ARG_INDICES_GETTER;
+
+    slice_executable_t(std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+            pd_cache_t &pd_cache, const fpmath_t &fpmath,
+            bool use_block_layout);
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override;
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps) const override;
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps) const override;
+#endif
+
+    bool is_initialized() const override { return is_view_ || prim_; }
+
+private:
+    // Returns a memory object describing the slice region of the src buffer.
+    memory make_src_view(const memory &src) const;
+
+    bool is_view_ {false};
+    size_t offset_in_bytes_ {0};
+    memory::desc src_view_md_;
+    dnnl::reorder prim_;
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif // GRAPH_BACKEND_DNNL_EXECUTABLES_SLICE_HPP
@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * Copyright 2026 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include "graph/backend/dnnl/executables/topk.hpp"
+
+#include "common/topk_iface.hpp"
+
+#define DNNL_ARG_DST_INDICES DNNL_ARG_DST_1
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+topk_executable_t::topk_executable_t(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, pd_cache_t &pd_cache,
+        const fpmath_t &fpmath, bool use_block_layout) {
+    auto src_md = make_dnnl_memory_desc(op->get_input_logical_tensor(0));
+    auto dst_md = make_dnnl_memory_desc(op->get_output_logical_tensor(0));
+    auto idx_md = make_dnnl_memory_desc(op->get_output_logical_tensor(1));
+
+    const auto k = op->get_attr<int64_t>(op_attr::k);
+    const bool with_softmax = op->has_attr(op_attr::mode)
+            && op->get_attr<std::string>(op_attr::mode) == "softmax";
+    const float temperature = op->has_attr(op_attr::temperature)
+            ? op->get_attr<float>(op_attr::temperature)
+            : 1.f;
+
+    dnnl_primitive_desc_t pd = nullptr;
+    auto ret = dnnl_topk_primitive_desc_create(&pd, p_engine.get(), k,
+            with_softmax, temperature, src_md.get(), dst_md.get(),
+            idx_md.get(), nullptr);
+    if (pd && ret == dnnl_success) {
+        pd_.reset(pd);
+        dnnl_primitive_t prim = nullptr;
+        ret = dnnl_primitive_create(&prim, pd_.get());
+        if (prim && ret == dnnl_success) { prim_.reset(prim); }
+    }
+}
+
+void topk_executable_t::execute(const stream &stream,
+        const std::unordered_map<int, memory> &args) const {
+    std::vector<dnnl_exec_arg_t> c_args;
+    c_args.reserve(args.size());
+    for (const auto &a : args)
+        c_args.push_back({a.first, a.second.get()});
+
+    auto ret = dnnl_primitive_execute(prim_.get(), stream.get(),
+            static_cast<int>(c_args.size()), c_args.data());
+    dnnl::error::wrap_c_api(ret, "could not execute topk primitive");
+}
+
+#ifdef DNNL_WITH_SYCL
+::sycl::event topk_executable_t::execute_sycl(const stream &stream,
+        const std::unordered_map<int, memory> &args,
+        const std::vector<::sycl::event> &deps) const {
+    std::vector<dnnl_exec_arg_t> c_args;
+    c_args.reserve(args.size());
+    for (const auto &a : args)
+        c_args.push_back({a.first, a.second.get()});
+
+    sycl::event return_event;
+    auto ret = dnnl_sycl_interop_primitive_execute(prim_.get(), stream.get(),
+            c_args.size(), c_args.data(), &deps, &return_event);
+    dnnl::error::wrap_c_api(
+            ret, "could not execute topk primitive with sycl runtime");
+
+    return return_event;
+}
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+cl_event topk_executable_t::execute_ocl(const stream &stream,
+        const std::unordered_map<int, memory> &args,
+        const std::vector<cl_event> &deps) const {
+    std::vector<dnnl_exec_arg_t> c_args;
+    c_args.reserve(args.size());
+    for (const auto &a : args)
+        c_args.push_back({a.first, a.second.get()});
+
+    const cl_event *c_deps = deps.empty() ? nullptr : deps.data();
+
+    cl_event return_event = nullptr;
+    auto ret = dnnl_ocl_interop_primitive_execute(prim_.get(), stream.get(),
+            static_cast<int>(c_args.size()), c_args.data(), c_deps,
+            static_cast<int>(deps.size()), &return_event);
+    dnnl::error::wrap_c_api(
+            ret, "could not execute topk primitive with ocl runtime");
+
+    return return_event;
+}
+#endif
+
+arg_indices_t topk_executable_t::get_arg_indices(const op_t *op) {
+    UNUSED(op);
+    arg_indices_t args;
+    // inputs
+    args.insert({DNNL_ARG_SRC, {indices_t::type_t::input, 0}});
+
+    // outputs: values, indices
+    args.insert({DNNL_ARG_DST, {indices_t::type_t::output, 0}});
+    args.insert({DNNL_ARG_DST_INDICES, {indices_t::type_t::output, 1}});
+    args.insert({DNNL_ARG_SCRATCHPAD, {indices_t::type_t::output, 2}});
+
+    return args;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -182,7 +182,12 @@ dnnl::primitive_attr make_dnnl_primitive_attr(
                                     zps_data_type));
 
                 } else {
-                    int mask = 0;
+                    // Quantized embedding tables come with per-row
+                    // zero-points, the pattern only accepts axis 0 for them.
+                    // Other primitives only support common zero-points.
+                    const bool per_row = qtype == "per_channel"
+                            && op->get_kind() == op_kind::_embedding_bag;
+                    int mask = per_row ? 1 << 0 : 0;
                     attr.set_zero_points(in_zps_indices == 0 ? DNNL_ARG_SRC
                                                              : DNNL_ARG_WEIGHTS,
                             mask, default_groups,
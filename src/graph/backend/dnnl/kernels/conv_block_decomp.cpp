@@ -0,0 +1,681 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <future>
+#include <unordered_set>
+
+#include "common/compiler_workarounds.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "graph/backend/dnnl/kernels/conv_block_decomp.hpp"
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include "cpu/cpu_stream.hpp"
+#include "oneapi/dnnl/dnnl_threadpool.h"
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+#define VCHECK_CONV_BLOCK_DECOMP(cond, status, msg, ...) \
+    VCONDCHECK(graph, create, check, conv_block_decomp_kernel, (cond), \
+            status, msg, ##__VA_ARGS__);
+
+namespace {
+
+using ltw = logical_tensor_wrapper_t;
+
+// Row-major dense 4D tensor, i.e. NXC activations of the block
+bool is_dense_nxc(const logical_tensor_t &lt) {
+    const ltw w(lt);
+    return w.ndims() == 4 && w.is_strided()
+            && w.vstrides() == get_ncx_strides(w.vdims());
+}
+
+bool is_act(const op_t *op) {
+    return impl::utils::one_of(
+            op->get_kind(), graph::op_kind::ReLU, graph::op_kind::Clamp);
+}
+
+} // namespace
+
+status_t conv_block_decomp_kernel_t::init_layers(
+        const dnnl_partition_impl_t *part,
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    VCHECK_CONV_BLOCK_DECOMP(outputs.size() == 1, status::unimplemented,
+            "unexpected number of outputs: %zu", outputs.size());
+
+    const auto &ops = part->get_ops();
+    std::unordered_set<const op_t *> op_set;
+    for (const auto &op : ops)
+        op_set.insert(op.get());
+    for (size_t i = 0; i < inputs.size(); ++i)
+        input_idx_[inputs[i].id] = i;
+
+    const auto is_partition_input = [&](const std::shared_ptr<value_t> &val) {
+        return (!val->has_producer() || !op_set.count(&val->get_producer()))
+                && input_idx_.count(val->get_logical_tensor().id);
+    };
+
+    // The chain starts from the convolution fed from outside of the partition
+    op_t *conv = nullptr;
+    for (const auto &op : ops) {
+        if (op->get_kind() != graph::op_kind::Convolution
+                || !is_partition_input(op->get_input_value(0)))
+            continue;
+        VCHECK_CONV_BLOCK_DECOMP(conv == nullptr, status::unimplemented,
+                "multiple entry convolutions");
+        conv = op.get();
+    }
+    VCHECK_CONV_BLOCK_DECOMP(
+            conv, status::unimplemented, "no entry convolution");
+
+    // Returns the only consumer of the op output, nullptr for the partition
+    // output. Returns false if the op output is consumed more than once.
+    size_t nvisited = 0;
+    const auto get_next = [&](const op_t *op, op_t *&next) {
+        nvisited++;
+        next = nullptr;
+        const auto &val = op->get_output_value(0);
+        for (const auto &c : val->get_consumers()) {
+            if (!op_set.count(&c.get_op())) continue;
+            if (next) return false;
+            next = &c.get_op();
+        }
+        return (next == nullptr)
+                == (val->get_logical_tensor().id == outputs[0].id);
+    };
+    const auto get_eltwise = [](const op_t *op) {
+        if (op->get_kind() == graph::op_kind::Clamp)
+            return eltwise_t {algorithm::eltwise_clip,
+                    op->get_attr<float>(op_attr::min),
+                    op->get_attr<float>(op_attr::max)};
+        return eltwise_t {algorithm::eltwise_relu, 0.f, 0.f};
+    };
+
+    src_id_ = conv->get_input_value(0)->get_logical_tensor().id;
+    const logical_tensor_t &src_lt = inputs[input_idx_[src_id_]];
+    VCHECK_CONV_BLOCK_DECOMP(is_dense_nxc(src_lt), status::unimplemented,
+            "src is not a dense 4D tensor");
+    dt_ = static_cast<memory::data_type>(src_lt.data_type);
+    VCHECK_CONV_BLOCK_DECOMP(impl::utils::one_of(dt_, memory::data_type::f32,
+                                     memory::data_type::bf16,
+                                     memory::data_type::f16),
+            status::unimplemented, "unsupported data type");
+    mb_ = src_lt.dims[0];
+    memory::dim ih = src_lt.dims[1], iw = src_lt.dims[2],
+                ic = src_lt.dims[3];
+
+    op_t *next = nullptr;
+    while (conv) {
+        VCHECK_CONV_BLOCK_DECOMP(
+                conv->get_attr<std::string>(op_attr::data_format) == "NXC",
+                status::unimplemented, "only NXC activations are supported");
+        const auto auto_pad = conv->get_attr<std::string>(op_attr::auto_pad);
+        VCHECK_CONV_BLOCK_DECOMP(
+                impl::utils::one_of(auto_pad, "None", "VALID"),
+                status::unimplemented, "unsupported auto_pad");
+
+        layer_t l;
+        l.ih = ih;
+        l.iw = iw;
+        l.ic = ic;
+
+        const auto &wei_val = conv->get_input_value(1);
+        VCHECK_CONV_BLOCK_DECOMP(is_partition_input(wei_val),
+                status::unimplemented, "weights are not a partition input");
+        l.wei_id = wei_val->get_logical_tensor().id;
+        const ltw wei(inputs[input_idx_[l.wei_id]]);
+        l.wei_constant = wei.is_constant();
+        VCHECK_CONV_BLOCK_DECOMP(wei.ndims() == 4 && wei.is_strided()
+                        && static_cast<memory::data_type>(wei.data_type())
+                                == dt_,
+                status::unimplemented, "unsupported weights");
+        const auto wei_dims = wei.vdims();
+        const auto wei_strides = wei.vstrides();
+        // Logical order of the weights dims: o, i, kh, kw
+        const bool is_xio
+                = conv->get_attr<std::string>(op_attr::weights_format)
+                == "XIO";
+        const std::vector<size_t> perm = is_xio
+                ? std::vector<size_t> {3, 2, 0, 1}
+                : std::vector<size_t> {0, 1, 2, 3};
+        l.oc = wei_dims[perm[0]];
+        l.kh = wei_dims[perm[2]];
+        l.kw = wei_dims[perm[3]];
+        l.g = conv->has_attr(op_attr::groups)
+                ? conv->get_attr<int64_t>(op_attr::groups)
+                : 1;
+        VCHECK_CONV_BLOCK_DECOMP(l.g > 0 && wei_dims[perm[1]] * l.g == l.ic
+                        && l.oc % l.g == 0,
+                status::unimplemented, "inconsistent channels");
+
+        memory::dims user_wei_dims, user_wei_strides;
+        if (l.g > 1) {
+            user_wei_dims.push_back(l.g);
+            user_wei_strides.push_back(l.oc / l.g * wei_strides[perm[0]]);
+        }
+        user_wei_dims.push_back(l.g > 1 ? l.oc / l.g : l.oc);
+        user_wei_strides.push_back(wei_strides[perm[0]]);
+        for (size_t d = 1; d < 4; ++d) {
+            user_wei_dims.push_back(wei_dims[perm[d]]);
+            user_wei_strides.push_back(wei_strides[perm[d]]);
+        }
+        l.user_wei_md = memory::desc(user_wei_dims, dt_, user_wei_strides);
+
+        const auto strides = conv->get_attr<dims>(op_attr::strides);
+        const auto dilations = conv->get_attr<dims>(op_attr::dilations);
+        auto pads_begin = conv->get_attr<dims>(op_attr::pads_begin);
+        auto pads_end = conv->get_attr<dims>(op_attr::pads_end);
+        if (auto_pad == "VALID") {
+            pads_begin.assign(2, 0);
+            pads_end.assign(2, 0);
+        }
+        VCHECK_CONV_BLOCK_DECOMP(strides.size() == 2 && dilations.size() == 2
+                        && pads_begin.size() == 2 && pads_end.size() == 2,
+                status::unimplemented, "unexpected conv attributes");
+        l.sh = strides[0];
+        l.sw = strides[1];
+        l.dh = dilations[0] - 1;
+        l.dw = dilations[1] - 1;
+        l.pad_t = pads_begin[0];
+        l.pad_l = pads_begin[1];
+        l.pad_b = pads_end[0];
+        l.pad_r = pads_end[1];
+        l.oh = (l.ih + l.pad_t + l.pad_b - ((l.kh - 1) * (l.dh + 1) + 1))
+                        / l.sh
+                + 1;
+        l.ow = (l.iw + l.pad_l + l.pad_r - ((l.kw - 1) * (l.dw + 1) + 1))
+                        / l.sw
+                + 1;
+        VCHECK_CONV_BLOCK_DECOMP(l.oh > 0 && l.ow > 0, status::unimplemented,
+                "empty convolution output");
+
+        std::shared_ptr<value_t> bia_val;
+        if (conv->num_inputs() > 2) bia_val = conv->get_input_value(2);
+        VCHECK_CONV_BLOCK_DECOMP(get_next(conv, next), status::unimplemented,
+                "not a convolution chain");
+        if (next && next->get_kind() == graph::op_kind::BiasAdd) {
+            VCHECK_CONV_BLOCK_DECOMP(!bia_val
+                            && (!next->has_attr(op_attr::data_format)
+                                    || next->get_attr<std::string>(
+                                               op_attr::data_format)
+                                            == "NXC"),
+                    status::unimplemented, "unsupported bias add");
+            bia_val = next->get_input_value(1);
+            VCHECK_CONV_BLOCK_DECOMP(get_next(next, next),
+                    status::unimplemented, "not a convolution chain");
+        }
+        if (bia_val) {
+            VCHECK_CONV_BLOCK_DECOMP(is_partition_input(bia_val),
+                    status::unimplemented, "bias is not a partition input");
+            l.with_bias = true;
+            l.bia_id = bia_val->get_logical_tensor().id;
+            const ltw bia(inputs[input_idx_[l.bia_id]]);
+            VCHECK_CONV_BLOCK_DECOMP(bia.ndims() == 1 && bia.vdims()[0] == l.oc
+                            && bia.is_strided() && bia.vstrides()[0] == 1,
+                    status::unimplemented, "unsupported bias");
+            l.bia_md = memory::desc({l.oc},
+                    static_cast<memory::data_type>(bia.data_type()),
+                    format_tag::a);
+        }
+        while (next && is_act(next)) {
+            l.acts.push_back(get_eltwise(next));
+            VCHECK_CONV_BLOCK_DECOMP(get_next(next, next),
+                    status::unimplemented, "not a convolution chain");
+        }
+
+        ih = l.oh;
+        iw = l.ow;
+        ic = l.oc;
+        layers_.push_back(l);
+
+        conv = nullptr;
+        if (next && next->get_kind() == graph::op_kind::Convolution) {
+            conv = next;
+        } else if (next && next->get_kind() == graph::op_kind::Add) {
+            const auto &in0 = next->get_input_value(0);
+            const auto &in1 = next->get_input_value(1);
+            const bool chain_is_in0 = in0->has_producer()
+                    && op_set.count(&in0->get_producer());
+            const auto &residual = chain_is_in0 ? in1 : in0;
+            VCHECK_CONV_BLOCK_DECOMP(is_partition_input(residual),
+                    status::unimplemented,
+                    "residual is not a partition input");
+            with_residual_ = true;
+            residual_id_ = residual->get_logical_tensor().id;
+            const logical_tensor_t &res_lt = inputs[input_idx_[residual_id_]];
+            const dims res_dims = {mb_, l.oh, l.ow, l.oc};
+            VCHECK_CONV_BLOCK_DECOMP(is_dense_nxc(res_lt)
+                            && ltw(res_lt).vdims() == res_dims
+                            && static_cast<memory::data_type>(
+                                       res_lt.data_type)
+                                    == dt_,
+                    status::unimplemented, "unsupported residual");
+            VCHECK_CONV_BLOCK_DECOMP(get_next(next, next),
+                    status::unimplemented, "not a convolution chain");
+            while (next && is_act(next)) {
+                post_acts_.push_back(get_eltwise(next));
+                VCHECK_CONV_BLOCK_DECOMP(get_next(next, next),
+                        status::unimplemented, "not a convolution chain");
+            }
+            VCHECK_CONV_BLOCK_DECOMP(next == nullptr, status::unimplemented,
+                    "unexpected op after the residual add");
+        } else {
+            VCHECK_CONV_BLOCK_DECOMP(next == nullptr, status::unimplemented,
+                    "unexpected op in the chain");
+        }
+    }
+    VCHECK_CONV_BLOCK_DECOMP(
+            layers_.size() > 1, status::unimplemented, "nothing to fuse");
+    VCHECK_CONV_BLOCK_DECOMP(nvisited == ops.size(), status::unimplemented,
+            "unexpected ops in the partition");
+
+    const ltw dst(outputs[0]);
+    const auto &last = layers_.back();
+    const dims dst_dims = {mb_, last.oh, last.ow, last.oc};
+    VCHECK_CONV_BLOCK_DECOMP(dst.vdims() == dst_dims
+                    && static_cast<memory::data_type>(dst.data_type()) == dt_
+                    && (dst.is_any() || is_dense_nxc(outputs[0])),
+            status::unimplemented, "unsupported dst");
+    return status::success;
+}
+
+memory::dim conv_block_decomp_kernel_t::select_band_rows() const {
+    const size_t dt_size = memory::data_type_size(dt_);
+    // Footprint of the rows of all the layers needed for an output band
+    const auto band_bytes = [&](memory::dim rows) {
+        size_t bytes = 0;
+        memory::dim dst_rows = rows;
+        for (auto l = layers_.rbegin(); l != layers_.rend(); ++l) {
+            const memory::dim src_rows = std::min(l->ih,
+                    (dst_rows - 1) * l->sh + (l->kh - 1) * (l->dh + 1) + 1);
+            bytes += static_cast<size_t>(dst_rows * l->ow * l->oc) * dt_size;
+            dst_rows = src_rows;
+            if (l + 1 == layers_.rend())
+                bytes += static_cast<size_t>(src_rows * l->iw * l->ic)
+                        * dt_size;
+        }
+        return bytes;
+    };
+
+    // Take the largest band keeping the intermediates in half of L2, then
+    // split it further until every thread gets a band
+    const size_t l2_size = cpu::platform::get_per_core_cache_size(2);
+    const memory::dim oh = layers_.back().oh;
+    memory::dim rows = oh;
+    while (rows > 1 && band_bytes(rows) > l2_size / 2)
+        rows = impl::utils::div_up(rows, 2);
+    while (rows > 1 && mb_ * impl::utils::div_up(oh, rows) < nthr_)
+        rows = impl::utils::div_up(rows, 2);
+    return rows;
+}
+
+void conv_block_decomp_kernel_t::init_bands(memory::dim band_rows) {
+    const size_t nlayers = layers_.size();
+    const memory::dim oh = layers_.back().oh;
+    for (memory::dim o = 0; o < oh; o += band_rows) {
+        band_t b;
+        b.src_row.resize(nlayers);
+        b.dst_row.resize(nlayers);
+        b.prim_idx.resize(nlayers);
+
+        // Walk the chain backwards to find the rows each layer has to
+        // produce, the out-of-tensor rows become the band padding
+        memory::dim beg = o, end = std::min(o + band_rows, oh);
+        for (size_t k = nlayers; k-- > 0;) {
+            auto &l = layers_[k];
+            const memory::dim ext = (l.kh - 1) * (l.dh + 1) + 1;
+            const memory::dim src_beg = beg * l.sh - l.pad_t;
+            const memory::dim src_end = (end - 1) * l.sh - l.pad_t + ext;
+
+            band_prim_t bp;
+            bp.ih = std::min(src_end, l.ih) - std::max<memory::dim>(src_beg, 0);
+            bp.oh = end - beg;
+            bp.pad_t = std::max<memory::dim>(-src_beg, 0);
+            bp.pad_b = std::max<memory::dim>(src_end - l.ih, 0);
+
+            size_t idx = 0;
+            for (; idx < l.prims.size(); ++idx) {
+                const auto &p = l.prims[idx];
+                if (p.ih == bp.ih && p.oh == bp.oh && p.pad_t == bp.pad_t
+                        && p.pad_b == bp.pad_b)
+                    break;
+            }
+            if (idx == l.prims.size()) l.prims.push_back(bp);
+
+            b.prim_idx[k] = idx;
+            b.dst_row[k] = beg;
+            b.src_row[k] = std::max<memory::dim>(src_beg, 0);
+            beg = b.src_row[k];
+            end = std::min(src_end, l.ih);
+        }
+        bands_.push_back(b);
+    }
+}
+
+status_t conv_block_decomp_kernel_t::create_band_prims(
+        const dnnl_partition_impl_t *part) {
+    const auto &fpmath = part->get_fpmath_mode();
+    const size_t dt_size = memory::data_type_size(dt_);
+    const size_t nlayers = layers_.size();
+    size_t buf_size = 0, scratchpad_size = 0;
+
+    for (size_t k = 0; k < nlayers; ++k) {
+        auto &l = layers_[k];
+        const bool is_last = k + 1 == nlayers;
+
+        // All the band primitives of a layer have to share the weights
+        // layout, so the one of the most common band is created first and
+        // the others follow its choice
+        const size_t main_idx = bands_[bands_.size() / 2].prim_idx[k];
+        std::vector<size_t> order {main_idx};
+        for (size_t idx = 0; idx < l.prims.size(); ++idx)
+            if (idx != main_idx) order.push_back(idx);
+
+        for (size_t idx : order) {
+            auto &bp = l.prims[idx];
+            VCHECK_CONV_BLOCK_DECOMP(bp.ih > 0, status::unimplemented,
+                    "band without input rows");
+            bp.src_md = memory::desc(
+                    {1, l.ic, bp.ih, l.iw}, dt_, format_tag::nhwc);
+            bp.dst_md = memory::desc(
+                    {1, l.oc, bp.oh, l.ow}, dt_, format_tag::nhwc);
+
+            dnnl::post_ops pops;
+            for (const auto &e : l.acts)
+                pops.append_eltwise(e.alg, e.alpha, e.beta);
+            if (is_last && with_residual_) {
+                bp.bin_md = bp.dst_md;
+                pops.append_binary(algorithm::binary_add, bp.bin_md);
+            }
+            if (is_last)
+                for (const auto &e : post_acts_)
+                    pops.append_eltwise(e.alg, e.alpha, e.beta);
+
+            dnnl::primitive_attr attr;
+            attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+            attr.set_fpmath_mode(static_cast<dnnl::fpmath_mode>(fpmath.mode_));
+            attr.set_post_ops(pops);
+
+            const memory::desc wei_md = idx == main_idx
+                    ? memory::desc(
+                            l.user_wei_md.get_dims(), dt_, format_tag::any)
+                    : l.wei_md;
+            auto pd = dnnl::convolution_forward::primitive_desc(p_engine_,
+                    prop_kind::forward_inference,
+                    algorithm::convolution_direct, bp.src_md, wei_md,
+                    l.bia_md, bp.dst_md, {l.sh, l.sw}, {l.dh, l.dw},
+                    {bp.pad_t, l.pad_l}, {bp.pad_b, l.pad_r}, attr, true);
+            VCHECK_CONV_BLOCK_DECOMP(pd, status::unimplemented,
+                    "band convolution is not supported");
+            if (idx == main_idx) l.wei_md = pd.weights_desc();
+            VCHECK_CONV_BLOCK_DECOMP(pd.weights_desc() == l.wei_md,
+                    status::unimplemented,
+                    "band convolutions disagree on weights layout");
+
+            bp.prim = dnnl::convolution_forward(pd);
+            bp.scratchpad_md = pd.scratchpad_desc();
+            scratchpad_size = std::max(
+                    scratchpad_size, bp.scratchpad_md.get_size());
+            if (!is_last)
+                buf_size = std::max(buf_size,
+                        static_cast<size_t>(bp.oh * l.ow * l.oc) * dt_size);
+        }
+
+        if (l.wei_md != l.user_wei_md) {
+            auto pd = dnnl::reorder::primitive_desc(p_engine_, l.user_wei_md,
+                    p_engine_, l.wei_md, dnnl::primitive_attr(), true);
+            VCHECK_CONV_BLOCK_DECOMP(pd, status::unimplemented,
+                    "weights reorder is not supported");
+            l.wei_reorder = dnnl::reorder(pd);
+            auto &registry
+                    = l.wei_constant ? const_wei_registry_ : wei_registry_;
+            registry.book(k, l.wei_md.get_size(), 64);
+        }
+    }
+
+    // Layer k writes its band to buffer k % 2, the last one writes to dst
+    thr_registry_.book(0, buf_size, 64);
+    if (nlayers > 2) thr_registry_.book(1, buf_size, 64);
+    if (scratchpad_size > 0) thr_registry_.book(2, scratchpad_size, 64);
+    return status::success;
+}
+
+status_t conv_block_decomp_kernel_t::compile_impl(
+        const dnnl_partition_impl_t *part, const engine_t *g_engine,
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    p_engine_ = make_dnnl_engine(*g_engine);
+    g_alloc_
+            = reinterpret_cast<graph::allocator_t *>(g_engine->get_allocator());
+    nthr_ = dnnl_get_current_num_threads();
+
+    CHECK(init_layers(part, inputs, outputs));
+
+    const memory::dim band_rows = select_band_rows();
+    VCHECK_CONV_BLOCK_DECOMP(
+            mb_ * impl::utils::div_up(layers_.back().oh, band_rows) >= nthr_,
+            status::unimplemented, "not enough bands for %d threads", nthr_);
+    init_bands(band_rows);
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    // The band primitives are executed by a single thread each
+    omp_set_num_threads(1);
+#endif
+    const status_t status = create_band_prims(part);
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    omp_set_num_threads(nthr_);
+#endif
+    CHECK(status);
+
+    std::vector<memory::desc> const_wei_mds;
+    for (const auto &l : layers_)
+        if (l.wei_reorder && l.wei_constant) const_wei_mds.push_back(l.wei_md);
+    const_md_hash_ = generate_constant_md_hash(part->id(), const_wei_mds);
+
+    // The partition output is written by rows as a dense NXC tensor
+    auto &out = const_cast<logical_tensor_t &>(outputs[0]);
+    if (ltw(out).is_any()) {
+        const auto strides = get_ncx_strides(ltw(out).vdims());
+        out.layout_type = layout_type::strided;
+        for (size_t d = 0; d < strides.size(); ++d)
+            out.layout.strides[d] = strides[d];
+    }
+    return status::success;
+}
+
+status_t conv_block_decomp_kernel_t::execute_impl(const stream_t *g_stream,
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs) {
+    dnnl::stream strm = make_dnnl_stream(p_engine_, *g_stream);
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    auto *tp_stream
+            = dnnl::impl::utils::downcast<dnnl::impl::cpu::cpu_stream_t *>(
+                    const_cast<stream_t *>(g_stream));
+    tp_stream->before_exec_hook();
+    int thread_num = 1;
+    dnnl_threadpool_interop_get_max_concurrency(&thread_num);
+    nthr_ = thread_num;
+#endif
+
+    const size_t nlayers = layers_.size();
+    const size_t dt_size = memory::data_type_size(dt_);
+    // Without the constant tensor cache the constant weights are reordered
+    // into the scratchpad on every execution like the other ones
+    const bool use_const_cache
+            = const_wei_registry_.size() > 0 && enabled_constant_cache();
+    const size_t wei_size = wei_registry_.size()
+            + (use_const_cache ? 0 : const_wei_registry_.size());
+    const size_t thr_size = thr_registry_.size();
+    auto scratchpad = std::make_shared<temporary_scratchpad_t>(
+            wei_size + thr_size * nthr_, p_engine_, *g_alloc_);
+    assertm(scratchpad->size() >= wei_size + thr_size * nthr_,
+            "no enough scratchpad memory");
+    char *buffer = scratchpad->get_buffer();
+    grantor_t wei_grantor = wei_registry_.grantor(buffer);
+
+    constant_tensor_cache_t::cached_t c_buffer;
+    std::promise<constant_tensor_cache_t::cached_t> c_promise;
+    bool const_wei_ready = false;
+    if (use_const_cache) {
+        const size_t encoded_key
+                = encode_constant_cache_key(inputs, const_md_hash_);
+        constant_tensor_cache_t::value_t cached_value
+                = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
+                        const_wei_registry_.size(), c_promise.get_future());
+        const_wei_ready = cached_value.valid();
+        if (const_wei_ready) {
+            c_buffer = cached_value.get();
+        } else {
+            c_buffer = std::make_shared<dnnl_constant_buffer_t>(
+                    const_wei_registry_.size(), p_engine_, g_alloc_);
+        }
+    }
+    grantor_t const_wei_grantor = const_wei_registry_.grantor(use_const_cache
+                    ? c_buffer->data<char>()
+                    : buffer + wei_registry_.size());
+
+    // The weights are reordered once for all the bands
+    std::vector<memory> wei_mems(nlayers);
+    for (size_t k = 0; k < nlayers; ++k) {
+        const auto &l = layers_[k];
+        void *user_wei = inputs[input_idx_.at(l.wei_id)].get_data_handle();
+        if (!l.wei_reorder) {
+            wei_mems[k] = memory(l.wei_md, p_engine_, user_wei);
+            continue;
+        }
+        wei_mems[k] = memory(l.wei_md, p_engine_,
+                l.wei_constant ? const_wei_grantor.get(k)
+                               : wei_grantor.get(k));
+        if (l.wei_constant && const_wei_ready) continue;
+        const std::unordered_map<int, memory> args {
+                {DNNL_ARG_FROM, memory(l.user_wei_md, p_engine_, user_wei)},
+                {DNNL_ARG_TO, wei_mems[k]}};
+        dnnl_primitive_execute_without_tp_hook(l.wei_reorder, strm, args);
+    }
+    if (use_const_cache && !const_wei_ready) c_promise.set_value(c_buffer);
+
+    const char *src = static_cast<const char *>(
+            inputs[input_idx_.at(src_id_)].get_data_handle());
+    const char *residual = with_residual_
+            ? static_cast<const char *>(
+                    inputs[input_idx_.at(residual_id_)].get_data_handle())
+            : nullptr;
+    char *dst = static_cast<char *>(outputs[0].get_data_handle());
+
+    const auto nbands = static_cast<memory::dim>(bands_.size());
+    const memory::dim work_amount = mb_ * nbands;
+
+    parallel(nthr_, [= COMPAT_THIS_CAPTURE, &wei_mems](int ithr, int nthr) {
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+        // Deactivating since nested usage model demands it.
+        threadpool_utils::deactivate_threadpool();
+#endif
+        memory::dim start = 0, end = 0;
+        balance211(work_amount, nthr, ithr, start, end);
+
+        grantor_t thr_grantor = thr_registry_.grantor(
+                buffer + wei_size + static_cast<size_t>(ithr) * thr_size);
+        char *bufs[2] = {thr_grantor.get(0), thr_grantor.get(1)};
+
+        // Execution args of every band primitive of the thread
+        std::vector<std::vector<std::unordered_map<int, memory>>> args(
+                nlayers);
+        for (size_t k = 0; k < nlayers && start < end; ++k) {
+            const auto &l = layers_[k];
+            void *bias = l.with_bias
+                    ? inputs[input_idx_.at(l.bia_id)].get_data_handle()
+                    : nullptr;
+            for (const auto &bp : l.prims) {
+                std::unordered_map<int, memory> a {
+                        {DNNL_ARG_SRC, memory(bp.src_md, p_engine_, nullptr)},
+                        {DNNL_ARG_WEIGHTS, wei_mems[k]},
+                        {DNNL_ARG_DST, memory(bp.dst_md, p_engine_, nullptr)}};
+                if (bp.scratchpad_md.get_size() > 0)
+                    a.insert({DNNL_ARG_SCRATCHPAD,
+                            memory(bp.scratchpad_md, p_engine_,
+                                    thr_grantor.get(2))});
+                if (l.with_bias)
+                    a.insert({DNNL_ARG_BIAS,
+                            memory(l.bia_md, p_engine_, bias)});
+                if (bp.bin_md)
+                    a.insert({DNNL_ARG_ATTR_MULTIPLE_POST_OP(
+                                      static_cast<int>(l.acts.size()))
+                                    | DNNL_ARG_SRC_1,
+                            memory(bp.bin_md, p_engine_, nullptr)});
+                args[k].push_back(std::move(a));
+            }
+        }
+
+        for (memory::dim iwork = start; iwork < end; ++iwork) {
+            const memory::dim n = iwork / nbands;
+            const auto &b = bands_[iwork % nbands];
+            for (size_t k = 0; k < nlayers; ++k) {
+                const auto &l = layers_[k];
+                const auto &bp = l.prims[b.prim_idx[k]];
+                auto &a = args[k][b.prim_idx[k]];
+
+                const size_t src_off
+                        = static_cast<size_t>((n * l.ih + b.src_row[k]) * l.iw
+                                  * l.ic)
+                        * dt_size;
+                const size_t dst_off
+                        = static_cast<size_t>((n * l.oh + b.dst_row[k]) * l.ow
+                                  * l.oc)
+                        * dt_size;
+                a.at(DNNL_ARG_SRC).set_data_handle(k == 0
+                                ? const_cast<char *>(src) + src_off
+                                : bufs[(k - 1) % 2]);
+                a.at(DNNL_ARG_DST).set_data_handle(
+                        k + 1 == nlayers ? dst + dst_off : bufs[k % 2]);
+                if (bp.bin_md)
+                    a.at(DNNL_ARG_ATTR_MULTIPLE_POST_OP(
+                                 static_cast<int>(l.acts.size()))
+                             | DNNL_ARG_SRC_1)
+                            .set_data_handle(
+                                    const_cast<char *>(residual) + dst_off);
+
+                dnnl_primitive_execute_without_tp_hook(bp.prim, strm, a);
+            }
+        }
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+        auto tp = threadpool_utils::get_active_threadpool();
+        threadpool_utils::activate_threadpool(tp);
+#endif
+    });
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    tp_stream->after_exec_hook();
+#endif
+
+    prolong_temporary_scratchpad_lifetime(g_stream, scratchpad);
+
+    return status::success;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
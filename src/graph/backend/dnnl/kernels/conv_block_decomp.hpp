@@ -0,0 +1,161 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_CONV_BLOCK_DECOMP_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_CONV_BLOCK_DECOMP_HPP
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "graph/interface/c_types_map.hpp"
+
+#include "graph/backend/dnnl/kernels/kernel_base.hpp"
+
+#include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/dnnl_constant_tensor_cache.hpp"
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+#include "graph/backend/dnnl/scratchpad.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Executes a short chain of NXC convolutions (e.g. an inverted residual or a
+// basic residual block) by bands of output rows. Each band is pushed through
+// all the convolutions of the chain with the intermediate rows kept in small
+// per-thread buffers, so that the intermediates stay in cache instead of
+// round-tripping through memory at each layer boundary. The input rows needed
+// by a band (halo) are recomputed by the neighbouring bands.
+struct conv_block_decomp_kernel_t : public kernel_base_t {
+private:
+    // A primitive for one band geometry of a layer
+    struct band_prim_t {
+        memory::dim ih, oh, pad_t, pad_b;
+        dnnl::primitive prim;
+        memory::desc src_md, dst_md, bin_md, scratchpad_md;
+    };
+
+    struct eltwise_t {
+        algorithm alg;
+        float alpha, beta;
+    };
+
+    // A convolution along with its fused bias and activations
+    struct layer_t {
+        size_t wei_id = 0, bia_id = 0;
+        bool with_bias = false, wei_constant = false;
+        std::vector<eltwise_t> acts;
+        memory::dim ic = 0, oc = 0, g = 1, kh = 0, kw = 0;
+        memory::dim sh = 1, sw = 1, dh = 0, dw = 0;
+        memory::dim pad_t = 0, pad_b = 0, pad_l = 0, pad_r = 0;
+        memory::dim ih = 0, iw = 0, oh = 0, ow = 0;
+        memory::desc user_wei_md, wei_md, bia_md;
+        dnnl::reorder wei_reorder;
+        std::vector<band_prim_t> prims;
+    };
+
+    // Rows of a band for each layer of the chain
+    struct band_t {
+        std::vector<memory::dim> src_row, dst_row;
+        std::vector<size_t> prim_idx;
+    };
+
+    allocator_t *g_alloc_ = nullptr;
+    memory::data_type dt_ = memory::data_type::undef;
+    memory::dim mb_ = 0;
+    int nthr_ = 1;
+
+    std::vector<layer_t> layers_;
+    std::vector<band_t> bands_;
+    // Activations applied after the residual add
+    std::vector<eltwise_t> post_acts_;
+    bool with_residual_ = false;
+    size_t src_id_ = 0, residual_id_ = 0;
+    std::unordered_map<size_t, size_t> input_idx_;
+
+    // Per-thread buffers for the intermediate bands and the scratchpad of the
+    // band primitives, along with the reordered weights shared by all threads.
+    // The reordered constant weights are kept in the constant tensor cache
+    // when it is enabled.
+    registry_t thr_registry_;
+    registry_t wei_registry_;
+    registry_t const_wei_registry_;
+    size_t const_md_hash_ = 0;
+
+    status_t init_layers(const dnnl_partition_impl_t *part,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs);
+    memory::dim select_band_rows() const;
+    void init_bands(memory::dim band_rows);
+    status_t create_band_prims(const dnnl_partition_impl_t *part);
+
+public:
+    conv_block_decomp_kernel_t() = default;
+
+    status_t compile_impl(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) override;
+
+    status_t execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override;
+
+#ifdef DNNL_WITH_SYCL
+    status_t sycl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(sycl_deps);
+        UNUSED(sycl_event);
+        return status::unimplemented;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    status_t ocl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<cl_event> &cl_deps,
+            cl_event *ret_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(cl_deps);
+        UNUSED(ret_event);
+        return status::unimplemented;
+    }
+#endif
+
+    DEF_KERNEL_METHOD_STR(conv_block_decomp_kernel_t)
+    DNNL_DISALLOW_COPY_AND_ASSIGN(conv_block_decomp_kernel_t)
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
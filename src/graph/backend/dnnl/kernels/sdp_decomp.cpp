@@ -52,8 +52,15 @@ status_t sdp_decomp_kernel_t<quantized, dt>::compile_impl(
             part->get_ops(), p_engine_, part->get_fpmath_mode(), false, true);
     BACKEND_DNNL_CHECK(set_given_inputs_outputs(subgraph_, inputs, outputs));
 
+    // The KV cache append is performed by the kernel itself, the present K/V
+    // are appended to the inputs of the subgraph.
+    std::vector<logical_tensor_t> sdp_inputs = inputs;
+    if (sdp_cfg_.record_kv_append(subgraph_, sdp_inputs, outputs)
+            != status::success)
+        return status::unimplemented;
+
     // Check if it's supported by decomposition kernel
-    if (!sdp_cfg_.initial_check(subgraph_, inputs, outputs))
+    if (!sdp_cfg_.initial_check(subgraph_, sdp_inputs, outputs))
         return status::unimplemented;
 
     subgraph_visualizer_t vis(part->id(), [this](const value_t *val) {
@@ -112,7 +119,7 @@ status_t sdp_decomp_kernel_t<quantized, dt>::compile_impl(
 
     // Initialize and construct kernel params
     return sdp_cfg_.construct_params<quantized, dt>(
-            subgraph_, sdp_registry_, p_engine_, inputs);
+            subgraph_, sdp_registry_, p_engine_, sdp_inputs);
 }
 
 template <bool quantized, memory::data_type dt>
@@ -180,18 +187,42 @@ status_t sdp_decomp_kernel_t<quantized, dt>::execute_impl(
     sdp_args_set_t *res = res_cache.get_or_add(
             reinterpret_cast<size_t>(this), resource_ctor_);
 
-    dim_t MBO = sdp_cfg_.batch_size, MBI = sdp_cfg_.num_head_q;
+    dim_t MBO = sdp_cfg_.batch_size,
+          MBI = sdp_cfg_.num_head_q / sdp_cfg_.fold_heads;
+
+    // The present K/V written by the kv append are partition outputs.
+    const auto get_input_handle = [&](int inport) -> char * {
+        if (inport < (int)inputs.size())
+            return static_cast<char *>(inputs[inport].get_data_handle());
+        for (const auto &kv_append : sdp_cfg_.kv_appends) {
+            if (kv_append.present_inport == inport)
+                return static_cast<char *>(
+                        outputs[kv_append.present_outport].get_data_handle());
+        }
+        return nullptr;
+    };
 
-    char *src1_user_pointer = static_cast<char *>(
-            inputs[sdp_cfg_.graph_inport[sdp_decomp_config_t::mm1_src]]
-                    .get_data_handle());
-    char *wei1_user_pointer = static_cast<char *>(
-            inputs[sdp_cfg_.graph_inport[sdp_decomp_config_t::mm1_wei]]
-                    .get_data_handle());
-    char *wei2_user_pointer = static_cast<char *>(
-            inputs[sdp_cfg_.graph_inport[sdp_decomp_config_t::mm2_wei]]
-                    .get_data_handle());
-    char *dst2_user_pointer = static_cast<char *>(outputs[0].get_data_handle());
+    char *src1_user_pointer = get_input_handle(
+            sdp_cfg_.graph_inport[sdp_decomp_config_t::mm1_src]);
+    char *wei1_user_pointer = get_input_handle(
+            sdp_cfg_.graph_inport[sdp_decomp_config_t::mm1_wei]);
+    char *wei2_user_pointer = get_input_handle(
+            sdp_cfg_.graph_inport[sdp_decomp_config_t::mm2_wei]);
+    char *dst2_user_pointer = static_cast<char *>(
+            outputs[sdp_cfg_.dst_outport].get_data_handle());
+
+    const dim_t group_head = sdp_cfg_.num_head_q / sdp_cfg_.num_head_kv;
+    const auto kv_append = [&](dim_t bo, dim_t head) {
+        for (const auto &app : sdp_cfg_.kv_appends) {
+            app.execute(static_cast<const char *>(
+                                inputs[app.past_inport].get_data_handle()),
+                    static_cast<const char *>(
+                            inputs[app.cur_inport].get_data_handle()),
+                    static_cast<char *>(
+                            outputs[app.present_outport].get_data_handle()),
+                    bo, head);
+        }
+    };
 
     size_t block_size = sdp_registry_.size();
     auto scratchpad = std::make_shared<temporary_scratchpad_t>(
@@ -214,7 +245,15 @@ status_t sdp_decomp_kernel_t<quantized, dt>::execute_impl(
         // prepare execution args and allocate real memory
         prepare_sub_args(var_grantor, tid, block_size, res->mem_map);
 
-        const size_t group_head = sdp_cfg_.num_head_q / sdp_cfg_.num_head_kv;
+        // With folded query heads, an iteration starts at the first query
+        // head of the group.
+        bi *= sdp_cfg_.fold_heads;
+
+        // Without head grouping or with folded query heads, the kv head is
+        // only used by this iteration, so its new rows are appended right
+        // before they are consumed.
+        if (group_head == sdp_cfg_.fold_heads) kv_append(bo, bi / group_head);
+
         const size_t wei_head_offset = bi / group_head;
         const size_t group_id = bi % group_head;
 
@@ -407,6 +446,12 @@ status_t sdp_decomp_kernel_t<quantized, dt>::execute_impl(
     tp_stream->before_exec_hook();
 #endif
 
+    // A kv head is shared by several iterations, append it beforehand.
+    if (!sdp_cfg_.kv_appends.empty() && group_head != sdp_cfg_.fold_heads) {
+        parallel_nd_ext(sdp_cfg_.nthr, MBO, sdp_cfg_.num_head_kv,
+                [&](int, int, dim_t bo, dim_t head) { kv_append(bo, head); });
+    }
+
     parallel_nd_ext(sdp_cfg_.nthr, MBO, MBI, loop);
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstring>
+
 #include "graph/backend/dnnl/kernels/sdp_decomp_config.hpp"
 #include "graph/interface/shape_infer.hpp"
 
@@ -26,6 +28,137 @@ namespace impl {
 namespace graph {
 namespace dnnl_impl {
 
+void sdp_kv_append_t::execute(const char *past, const char *cur,
+        char *present, dim_t bo, dim_t head) const {
+    const size_t seq_axis = present_strides.size() - 2;
+    const size_t row_size = head_size * dt_size;
+    const auto copy_rows = [&](const char *src, const dims &src_strides,
+                                   dim_t len, dim_t row_offset) {
+        const char *src_head = src
+                + (bo * src_strides[0] + head * src_strides[1]) * dt_size;
+        char *dst_head = present
+                + (bo * present_strides[0] + head * present_strides[1])
+                        * dt_size;
+        for (dim_t r = 0; r < len; r++) {
+            std::memcpy(dst_head
+                            + (row_offset + r) * present_strides[seq_axis]
+                                    * dt_size,
+                    src_head + r * src_strides[seq_axis] * dt_size, row_size);
+        }
+    };
+
+    // The past rows are already in place if the cache is updated in place.
+    if (past != present || past_strides != present_strides)
+        copy_rows(past, past_strides, past_len, 0);
+    copy_rows(cur, cur_strides, cur_len, past_len);
+}
+
+impl::status_t sdp_decomp_config_t::record_kv_append(
+        std::shared_ptr<subgraph_t> &sg, std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    const auto find_port = [](const std::vector<logical_tensor_t> &lts,
+                                   size_t id) {
+        for (int i = 0; i < (int)lts.size(); i++) {
+            if (lts[i].id == id) return i;
+        }
+        return -1;
+    };
+
+    subgraph_rewriter_t rewriter(sg);
+    for (const auto &cur_op : sg->get_ops()) {
+        if (cur_op->get_kind() != graph::op_kind::Concat) continue;
+        VCHECK_SDP_DECOMP(cur_op->num_inputs() == 2, status::unimplemented,
+                "kv append expects 2 inputs, but got %zu",
+                cur_op->num_inputs());
+
+        auto past_val = cur_op->get_input_value(0);
+        auto cur_val = cur_op->get_input_value(1);
+        auto present_val = cur_op->get_output_value(0);
+        VCHECK_SDP_DECOMP(!past_val->has_producer() && !cur_val->has_producer(),
+                status::unimplemented,
+                "kv append expects past cache and current rows as partition "
+                "inputs");
+
+        op_ptr end_op = nullptr;
+        for (auto &consumer : present_val->get_consumers()) {
+            if (consumer.get_op().get_kind() == graph::op_kind::End)
+                end_op = consumer.get_op().shared_from_this();
+        }
+        VCHECK_SDP_DECOMP(end_op != nullptr, status::unimplemented,
+                "kv append expects present cache as partition output");
+
+        sdp_kv_append_t kv_append;
+        kv_append.past_inport
+                = find_port(inputs, past_val->get_logical_tensor().id);
+        kv_append.cur_inport
+                = find_port(inputs, cur_val->get_logical_tensor().id);
+        kv_append.present_outport
+                = find_port(outputs, present_val->get_logical_tensor().id);
+        VCHECK_SDP_DECOMP(kv_append.past_inport != -1
+                        && kv_append.cur_inport != -1
+                        && kv_append.present_outport != -1,
+                status::invalid_arguments,
+                "Failed to find the given logical tensors of kv append");
+
+        const auto &past_lt = inputs[kv_append.past_inport];
+        const auto &cur_lt = inputs[kv_append.cur_inport];
+        const auto &present_lt = outputs[kv_append.present_outport];
+        const auto present_dims = ltw(present_lt).vdims();
+        const int32_t nd = ltw(present_lt).ndims();
+        VCHECK_SDP_DECOMP(nd == 4 || (nd == 5 && present_dims[2] == 1),
+                status::unimplemented,
+                "kv append expects 4D cache or 5D cache with a single head "
+                "group");
+        int64_t axis = cur_op->get_attr<int64_t>(op_attr::axis);
+        if (axis < 0) axis += nd;
+        VCHECK_SDP_DECOMP(axis == nd - 2, status::unimplemented,
+                "kv append is only supported along the sequence axis, but got "
+                "axis %ld",
+                static_cast<long int>(axis));
+
+        for (const auto *lt : {&past_lt, &cur_lt, &present_lt}) {
+            VCHECK_SDP_DECOMP(ltw(*lt).is_strided() && ltw(*lt).ndims() == nd
+                            && ltw(*lt).vstrides()[nd - 1] == 1,
+                    status::unimplemented,
+                    "kv append expects strided tensors with dense rows");
+        }
+
+        kv_append.past_len = ltw(past_lt).vdims()[nd - 2];
+        kv_append.cur_len = ltw(cur_lt).vdims()[nd - 2];
+        kv_append.head_size = present_dims[nd - 1];
+        kv_append.past_strides = ltw(past_lt).vstrides();
+        kv_append.cur_strides = ltw(cur_lt).vstrides();
+        kv_append.present_strides = ltw(present_lt).vstrides();
+        kv_append.dt_size = ltw(present_lt).data_type_size();
+
+        // Disconnect the concat so the present cache becomes an input of the
+        // subgraph.
+        past_val->remove_consumer(*cur_op, 0);
+        cur_val->remove_consumer(*cur_op, 1);
+        present_val->remove_consumer(*end_op, 0);
+        present_val->reset_producer();
+        rewriter.to_remove(cur_op);
+        rewriter.to_remove(end_op);
+
+        kv_append.present_inport = static_cast<int>(inputs.size());
+        inputs.push_back(present_lt);
+        kv_appends.push_back(kv_append);
+    }
+    rewriter.run();
+    sg->ins_ = inputs;
+
+    for (int i = 0; i < (int)outputs.size(); i++) {
+        if (std::none_of(kv_appends.begin(), kv_appends.end(),
+                    [i](const sdp_kv_append_t &kv_append) {
+            return kv_append.present_outport == i;
+        })) {
+            dst_outport = i;
+            break;
+        }
+    }
+    return status::success;
+}
+
 bool sdp_decomp_config_t::initial_check(const std::shared_ptr<subgraph_t> &sg,
         const std::vector<logical_tensor_t> &inputs,
         const std::vector<logical_tensor_t> &outputs) {
@@ -36,8 +169,8 @@ bool sdp_decomp_config_t::initial_check(const std::shared_ptr<subgraph_t> &sg,
     ndims = src1_user_dims.size();
     VCHECK_SDP_DECOMP(ndims == 4 || ndims == 5, false,
             "Input dims should be 4 or 5, but got %zu", src1_user_dims.size());
-    VCHECK_SDP_DECOMP(
-            outputs.size() == 1, false, "does not support multiple outputs");
+    VCHECK_SDP_DECOMP(outputs.size() == 1 + kv_appends.size(), false,
+            "does not support multiple outputs");
 
     // Initialize SDP input dimension according to the src of mm1
     int index = 0;
@@ -143,6 +276,29 @@ impl::status_t sdp_decomp_config_t::construct_params(
             : static_cast<memory::data_type>(
                       ltw(sdp_op[1]->get_output_logical_tensor(0)).data_type());
 
+    // Speculative decoding verifies a few draft tokens per step against a long
+    // cached context, which leaves the per-head matmuls with a tiny M. In this
+    // case the query heads sharing a kv head are folded into one iteration so
+    // the key and value are loaded once for the whole group. The per-iteration
+    // problems become 3D with the query heads as batch and the key and value
+    // broadcast across it, which matmul folds into M.
+    const dim_t group_head = num_head_q / num_head_kv;
+    const bool can_fold = group_head > 1 && seq_len_q <= max_fold_seq_len
+            && !(has_select && !select_fusiable)
+            && batch_size * num_head_kv >= dnnl_get_max_threads();
+    fold_heads = can_fold ? group_head : 1;
+    // The dimension of query heads in user tensors
+    const dim_t q_head_dim = ndims == 4 ? 1 : 2;
+    const auto fold_dims = [&](dim_t heads, const dims &mat_dims) {
+        dims ret = mat_dims;
+        if (fold_heads > 1) ret.insert(ret.begin(), heads);
+        return ret;
+    };
+    const auto fold_tag = [&](format_tag tag) {
+        if (fold_heads == 1) return tag;
+        return tag == format_tag::ab ? format_tag::abc : format_tag::acb;
+    };
+
     ////////////////////////////////////////////////////////////////////////
     ////////////// Start Creating primitives ///////////////////////////////
     ////////////////////////////////////////////////////////////////////////
@@ -163,12 +319,13 @@ impl::status_t sdp_decomp_config_t::construct_params(
     sub_reorder0_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
 
     // per-head: reorder src1 to dense, for first matmul
-    dims sub_src1_dims = {seq_len_q, head_size_qk};
+    dims sub_src1_dims = fold_dims(fold_heads, {seq_len_q, head_size_qk});
     src1_strides = ltw(inputs[graph_inport[mm1_src]]).vstrides();
     sub_src1_md = memory::desc(sub_src1_dims, dt_src_user,
-            {src1_strides[second_last_dim], src1_strides[last_dim]});
-    auto sub_src1_d_md
-            = memory::desc(sub_src1_dims, dt_src_user, format_tag::ab);
+            fold_dims(src1_strides[q_head_dim],
+                    {src1_strides[second_last_dim], src1_strides[last_dim]}));
+    auto sub_src1_d_md = memory::desc(
+            sub_src1_dims, dt_src_user, fold_tag(format_tag::ab));
     auto sub_reorder0_pd = reorder::primitive_desc(
             p_engine, sub_src1_md, p_engine, sub_src1_d_md, sub_reorder0_attr);
     sub_reorder0.init(sub_reorder0_pd);
@@ -176,13 +333,15 @@ impl::status_t sdp_decomp_config_t::construct_params(
     // per-head: reorder u8->s8 wei for first matmul
     // create reorder1 primitive attr
     dnnl::primitive_attr sub_reorder1_attr = make_primitive_attr(sdp_op[0]);
-    dims sub_wei1_dims = {head_size_qk, seq_len_kv};
+    dims sub_wei1_dims = fold_dims(1, {head_size_qk, seq_len_kv});
     auto wei_md = make_dnnl_memory_desc(sdp_op[1]->get_input_logical_tensor(1));
     wei1_strides = wei_md.get_strides();
     sub_wei1_user_md = memory::desc(sub_wei1_dims, dt_wei_user,
-            {wei1_strides[second_last_dim], wei1_strides[last_dim]});
+            fold_dims(wei1_strides[1],
+                    {wei1_strides[second_last_dim], wei1_strides[last_dim]}));
     // Flip the format to have `ba` weights MBI item in per thread loop.
-    sub_wei1_md = memory::desc(sub_wei1_dims, dt_wei, format_tag::ba);
+    sub_wei1_md
+            = memory::desc(sub_wei1_dims, dt_wei, fold_tag(format_tag::ba));
     auto sub_reorder1_pd = reorder::primitive_desc(p_engine, sub_wei1_user_md,
             p_engine, sub_wei1_md, sub_reorder1_attr);
     sub_reorder1.init(sub_reorder1_pd);
@@ -190,14 +349,16 @@ impl::status_t sdp_decomp_config_t::construct_params(
     // first matmul
     // create first matmul primitive attr
     dnnl::primitive_attr sub_matmul1_attr = make_primitive_attr(sdp_op[1]);
-    dims sub_mm1_src_dims = {seq_len_q, head_size_qk};
-    dims sub_mm1_wei_dims = {head_size_qk, seq_len_kv};
-    dims sub_mm1_dst_dims = {seq_len_q, seq_len_kv};
-
-    sub_mm1_src_md
-            = memory::desc(sub_mm1_src_dims, dt_src_user, format_tag::ab);
-    sub_mm1_wei_md = memory::desc(sub_mm1_wei_dims, dt_wei, format_tag::ba);
-    sub_mm1_dst_md = memory::desc(sub_mm1_dst_dims, dt_inter, format_tag::ab);
+    dims sub_mm1_src_dims = fold_dims(fold_heads, {seq_len_q, head_size_qk});
+    dims sub_mm1_wei_dims = fold_dims(1, {head_size_qk, seq_len_kv});
+    dims sub_mm1_dst_dims = fold_dims(fold_heads, {seq_len_q, seq_len_kv});
+
+    sub_mm1_src_md = memory::desc(
+            sub_mm1_src_dims, dt_src_user, fold_tag(format_tag::ab));
+    sub_mm1_wei_md = memory::desc(
+            sub_mm1_wei_dims, dt_wei, fold_tag(format_tag::ba));
+    sub_mm1_dst_md = memory::desc(
+            sub_mm1_dst_dims, dt_inter, fold_tag(format_tag::ab));
     dnnl::post_ops dnnl_pops;
     auto mm1_ori_dnnl_pops = sub_matmul1_attr.get_post_ops();
     auto make_sub_md = [&](const dnnl::impl::memory_desc_t &ori_desc,
@@ -206,11 +367,15 @@ impl::status_t sdp_decomp_config_t::construct_params(
         auto post_shape = ori_desc.dims;
         auto post_stride = ori_desc.format_desc.blocking.strides;
         auto post_dt = static_cast<dnnl::memory::data_type>(ori_desc.data_type);
-        dims post_stride_dims
-                = {post_stride[second_last_dim], post_stride[last_dim]};
-        return dnnl::memory::desc(
-                {post_shape[second_last_dim], post_shape[last_dim]}, post_dt,
-                post_stride_dims);
+        // A post-op input broadcast across heads stays broadcast across the
+        // folded heads.
+        const dim_t post_heads = post_shape[q_head_dim] == 1 ? 1 : fold_heads;
+        dims post_stride_dims = fold_dims(post_stride[q_head_dim],
+                {post_stride[second_last_dim], post_stride[last_dim]});
+        return dnnl::memory::desc(fold_dims(post_heads,
+                                          {post_shape[second_last_dim],
+                                                  post_shape[last_dim]}),
+                post_dt, post_stride_dims);
     };
     for (int i = 0; i < mm1_ori_dnnl_pops.get()->len(); i++) {
         if (mm1_ori_dnnl_pops.get()->entry_[i].is_binary()) {
@@ -292,19 +457,14 @@ impl::status_t sdp_decomp_config_t::construct_params(
                 softmax_ori_dnnl_pops.get()->entry_[i].binary.alg);
         const dnnl::impl::memory_desc_t &ori_desc
                 = softmax_ori_dnnl_pops.get()->entry_[i].binary.user_src1_desc;
-        auto post_shape = ori_desc.dims;
-        auto post_stride = ori_desc.format_desc.blocking.strides;
-        auto post_dt = static_cast<memory::data_type>(ori_desc.data_type);
-        auto new_sub_md = memory::desc(
-                {post_shape[second_last_dim], post_shape[last_dim]}, post_dt,
-                {post_stride[second_last_dim], post_stride[last_dim]});
+        auto new_sub_md = make_sub_md(ori_desc, second_last_dim, last_dim);
         sub_softmax_post_md.emplace_back(new_sub_md);
         dnnl_pops.append_binary(alg, new_sub_md);
     }
     sub_softmax_attr.set_post_ops(dnnl_pops);
 
-    sub_softmax_dst_md
-            = memory::desc(sub_mm1_dst_dims, dt_src_user, format_tag::ab);
+    sub_softmax_dst_md = memory::desc(
+            sub_mm1_dst_dims, dt_src_user, fold_tag(format_tag::ab));
     const auto mode = sdp_op[2]->get_attr<std::string>(op_attr::mode);
     const dnnl::algorithm algo = mode == "inf_as_zero"
             ? static_cast<dnnl::algorithm>(
@@ -319,12 +479,14 @@ impl::status_t sdp_decomp_config_t::construct_params(
     // reorder u8->s8 wei for second matmul
     // create reorder2 primitive attr
     dnnl::primitive_attr sub_reorder2_attr = make_primitive_attr(sdp_op[3]);
-    dims sub_wei2_dims = {seq_len_kv, head_size_v};
+    dims sub_wei2_dims = fold_dims(1, {seq_len_kv, head_size_v});
     wei2_strides = ltw(inputs[graph_inport[mm2_wei]]).vstrides();
     sub_wei2_user_md = memory::desc(sub_wei2_dims, dt_wei_user,
-            {wei2_strides[second_last_dim], wei2_strides[last_dim]});
+            fold_dims(wei2_strides[1],
+                    {wei2_strides[second_last_dim], wei2_strides[last_dim]}));
     // The format is `ab` due to performance of reorder to `ba` is low.
-    auto sub_wei2_md = memory::desc(sub_wei2_dims, dt_wei, format_tag::ab);
+    auto sub_wei2_md
+            = memory::desc(sub_wei2_dims, dt_wei, fold_tag(format_tag::ab));
     auto sub_reorder2_pd = reorder::primitive_desc(p_engine, sub_wei2_user_md,
             p_engine, sub_wei2_md, sub_reorder2_attr);
     sub_reorder2.init(sub_reorder2_pd);
@@ -332,14 +494,15 @@ impl::status_t sdp_decomp_config_t::construct_params(
     // second matmul
     // create second matmul primitive attr
     dnnl::primitive_attr sub_matmul2_attr = make_primitive_attr(sdp_op[4]);
-    dims sub_mm2_src_dims = {seq_len_q, seq_len_kv};
-    dims sub_mm2_wei_dims = {seq_len_kv, head_size_v};
-    dims sub_mm2_dst_dims = {seq_len_q, head_size_v};
-    auto sub_mm2_src_md
-            = memory::desc(sub_mm2_src_dims, dt_src_user, format_tag::ab);
-    sub_mm2_wei_md = memory::desc(sub_mm2_wei_dims, dt_wei, format_tag::ab);
-    sub_mm2_dst_md
-            = memory::desc(sub_mm2_dst_dims, dt_src_user, format_tag::ab);
+    dims sub_mm2_src_dims = fold_dims(fold_heads, {seq_len_q, seq_len_kv});
+    dims sub_mm2_wei_dims = fold_dims(1, {seq_len_kv, head_size_v});
+    dims sub_mm2_dst_dims = fold_dims(fold_heads, {seq_len_q, head_size_v});
+    auto sub_mm2_src_md = memory::desc(
+            sub_mm2_src_dims, dt_src_user, fold_tag(format_tag::ab));
+    sub_mm2_wei_md = memory::desc(
+            sub_mm2_wei_dims, dt_wei, fold_tag(format_tag::ab));
+    sub_mm2_dst_md = memory::desc(
+            sub_mm2_dst_dims, dt_src_user, fold_tag(format_tag::ab));
     auto sub_mm2_pd = matmul::primitive_desc(p_engine, sub_mm2_src_md,
             sub_mm2_wei_md, sub_mm2_dst_md, sub_matmul2_attr);
     sub_mm2_prim = matmul(sub_mm2_pd);
@@ -347,12 +510,14 @@ impl::status_t sdp_decomp_config_t::construct_params(
     // per-head: reorder dst2 from dense to strided
     primitive_attr sub_reorder3_attr;
     sub_reorder3_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
-    dims sub_dst_dims = {seq_len_q, head_size_v};
+    dims sub_dst_dims = fold_dims(fold_heads, {seq_len_q, head_size_v});
     auto out_lt = sdp_op[4]->get_output_logical_tensor(0);
     dst_strides = ltw(out_lt).vstrides();
-    sub_dst_md = memory::desc(sub_dst_dims, dt_src_user, format_tag::ab);
+    sub_dst_md
+            = memory::desc(sub_dst_dims, dt_src_user, fold_tag(format_tag::ab));
     sub_dst_user_md = memory::desc(sub_dst_dims, dt_src_user,
-            {dst_strides[second_last_dim], dst_strides[last_dim]});
+            fold_dims(dst_strides[q_head_dim],
+                    {dst_strides[second_last_dim], dst_strides[last_dim]}));
     auto sub_reorder3_pd = reorder::primitive_desc(
             p_engine, sub_dst_md, p_engine, sub_dst_user_md, sub_reorder3_attr);
     sub_reorder3.init(sub_reorder3_pd);
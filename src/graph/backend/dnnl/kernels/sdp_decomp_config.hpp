@@ -70,6 +70,28 @@ private:
     bool is_inplace_ = false;
 };
 
+// KV cache append fused into SDP. The key or the value is a concatenation of
+// the past cache and the rows of the current step along the sequence axis, and
+// the concatenation result (the present cache) is also a partition output. The
+// decomposition kernel writes the present cache of a head right before the head
+// is consumed by the matmul. If the present cache shares the buffer with the
+// past cache (cache preallocated for the max sequence length), only the rows
+// of the current step are written.
+struct sdp_kv_append_t {
+    // Offsets of past cache and current rows in partition inputs
+    int past_inport = -1, cur_inport = -1;
+    // Offset of present cache in partition outputs, and in the inputs of the
+    // subgraph where it's consumed by the matmul
+    int present_outport = -1, present_inport = -1;
+    dim_t past_len = 0, cur_len = 0, head_size = 0;
+    dims past_strides, cur_strides, present_strides;
+    size_t dt_size = 0;
+
+    // Writes the present cache of the (bo, head) slice
+    void execute(const char *past, const char *cur, char *present, dim_t bo,
+            dim_t head) const;
+};
+
 struct sdp_decomp_config_t {
 public:
     sdp_decomp_config_t() = default;
@@ -85,6 +107,14 @@ public:
     // Thread nums during the workflow
     int nthr;
 
+    // Number of query heads processed by one iteration of the parallel loop.
+    // It's the head group size when the query heads sharing a kv head are
+    // folded together, see construct_params.
+    dim_t fold_heads = 1;
+    // Max query sequence length to fold the query heads, covers decoding and
+    // verification of draft tokens in speculative decoding.
+    static constexpr dim_t max_fold_seq_len = 16;
+
     // Used to record the exact input offset in subgraph
     // [mm1_src,mm1_wei,mm2_wei,mm1_scale,mm1_soft_capping,mm1_add,select_condition,select_other_input]
     std::vector<int> graph_inport;
@@ -99,6 +129,11 @@ public:
         select_other_input
     };
 
+    // KV cache appends performed by the kernel
+    std::vector<sdp_kv_append_t> kv_appends;
+    // Offset of SDP output in partition outputs
+    int dst_outport = 0;
+
     // Primitives that actually perform calculations
     primitive sub_mm1_prim, sub_softmax_prim, sub_mm2_prim, sub_select_prim;
     sdp_reorder_t sub_reorder0, sub_reorder1, sub_reorder2, sub_reorder3;
@@ -156,6 +191,13 @@ public:
     // batch_size, num_head and thread num.
     // If the check passes, initialize few members according to inputs
     // If no, return unimplemented status directly and fallback to large kernel
+    // Records the KV cache appends (Concat + End) in the subgraph and removes
+    // them from it. The present caches become the inputs of the subgraph and
+    // are appended to inputs.
+    impl::status_t record_kv_append(std::shared_ptr<subgraph_t> &sg,
+            std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs);
+
     bool initial_check(const std::shared_ptr<subgraph_t> &sg,
             const std::vector<logical_tensor_t> &inputs,
             const std::vector<logical_tensor_t> &outputs);
@@ -2005,6 +2005,183 @@ status_t layout_propagator_for_gated_mlp(std::shared_ptr<op_t> &op,
     return status;
 }
 
+status_t layout_propagator_for_embedding_bag(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, pd_cache_t &pd_cache,
+        const fpmath_t &fpmath, bool use_block_layout,
+        subgraph_rewriter_t &rewriter) {
+    // the embedding table is gathered row by row, so it is expected to be
+    // in plain row-major layout.
+    auto src_md = make_dnnl_memory_desc(op->get_input_logical_tensor(0));
+    if (!is_plain(src_md)) {
+        src_md = dnnl::memory::desc(src_md.get_dims(), src_md.get_data_type(),
+                dnnl::memory::format_tag::ab);
+        insert_reorder_before(op, 0, src_md, p_engine, pd_cache, fpmath,
+                use_block_layout, rewriter);
+    }
+
+    value_ptr dst_val = op->get_output_value(0);
+    const logical_tensor_t &dst_lt = dst_val->get_logical_tensor();
+
+    dnnl::memory::desc expected_md;
+    if (ltw(dst_lt).is_any()) {
+        expected_md = {ltw(dst_lt).vdims(),
+                static_cast<dnnl::memory::data_type>(ltw(dst_lt).data_type()),
+                dnnl::memory::format_tag::ab};
+    } else {
+        expected_md = make_dnnl_memory_desc(dst_lt);
+    }
+    status_t status = fill_layout_info(dst_val, expected_md);
+    if (status != status::success) return status;
+
+    // fill scratchpads dimensions and data type to scratchpad value_t
+    value_ptr scratchpad_val = op->get_output_value(1);
+    const memory::desc scratchpad_desc;
+    status = fill_layout_info(scratchpad_val, scratchpad_desc);
+    return status;
+}
+
+status_t layout_propagator_for_rope(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, pd_cache_t &pd_cache,
+        const fpmath_t &fpmath, bool use_block_layout,
+        subgraph_rewriter_t &rewriter) {
+    // the rotated dimension needs unit stride, so blocked layouts produced by
+    // a preceding op are reordered to plain. Strided plain layouts, like
+    // transposed views of the projection output, are kept.
+    auto src_md = make_dnnl_memory_desc(op->get_input_logical_tensor(0));
+    if (!is_plain(src_md) || src_md.get_strides().back() != 1) {
+        src_md = to_ncx_format(src_md);
+        insert_reorder_before(op, 0, src_md, p_engine, pd_cache, fpmath,
+                use_block_layout, rewriter);
+    }
+
+    // the output follows the input layout which makes in-place execution
+    // possible.
+    value_ptr dst_val = op->get_output_value(0);
+    const logical_tensor_t &dst_lt = dst_val->get_logical_tensor();
+    const auto dst_md = ltw(dst_lt).is_any() ? src_md
+                                             : make_dnnl_memory_desc(dst_lt);
+    status_t status = fill_layout_info(dst_val, dst_md);
+    if (status != status::success) return status;
+
+    // fill scratchpads dimensions and data type to scratchpad value_t
+    value_ptr scratchpad_val = op->get_output_value(1);
+    const memory::desc scratchpad_desc;
+    status = fill_layout_info(scratchpad_val, scratchpad_desc);
+    return status;
+}
+
+status_t layout_propagator_for_topk(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, pd_cache_t &pd_cache,
+        const fpmath_t &fpmath, bool use_block_layout,
+        subgraph_rewriter_t &rewriter) {
+    // rows are scanned along the innermost dimension, which needs unit
+    // stride.
+    auto src_md = make_dnnl_memory_desc(op->get_input_logical_tensor(0));
+    if (!is_plain(src_md) || src_md.get_strides().back() != 1) {
+        src_md = to_ncx_format(src_md);
+        insert_reorder_before(op, 0, src_md, p_engine, pd_cache, fpmath,
+                use_block_layout, rewriter);
+    }
+
+    // values and indices
+    status_t status = status::success;
+    for (size_t i = 0; i < 2; ++i) {
+        value_ptr dst_val = op->get_output_value(i);
+        const logical_tensor_t &dst_lt = dst_val->get_logical_tensor();
+        auto dst_md = make_dnnl_memory_desc(dst_lt);
+        if (ltw(dst_lt).is_any()) dst_md = to_ncx_format(dst_md);
+        status = fill_layout_info(dst_val, dst_md);
+        if (status != status::success) return status;
+    }
+
+    // fill scratchpads dimensions and data type to scratchpad value_t
+    value_ptr scratchpad_val = op->get_output_value(2);
+    const memory::desc scratchpad_desc;
+    status = fill_layout_info(scratchpad_val, scratchpad_desc);
+    return status;
+}
+
+status_t layout_propagator_for_slice(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, pd_cache_t &pd_cache,
+        const fpmath_t &fpmath, bool use_block_layout,
+        subgraph_rewriter_t &rewriter) {
+    value_ptr src = op->get_input_value(0);
+    value_ptr dst = op->get_output_value(0);
+    const logical_tensor_t &in_lt = src->get_logical_tensor();
+    const logical_tensor_t &out_lt = dst->get_logical_tensor();
+
+    VCHECK_LAYOUT_PROPAGATOR(!ltw(in_lt).is_any(), status::invalid_arguments,
+            "layout of slice src can't be any layout");
+
+    dnnl::memory::desc in_md = make_dnnl_memory_desc(in_lt);
+    dims offsets, sizes;
+    CHECK(get_slice_region(op.get(), in_md.get_dims(), offsets, sizes));
+
+    // The dst of a slice always has the layout of the sub-tensor in the src,
+    // so that it can be a view of the src buffer. Blocked layouts are kept
+    // when the offsets are aligned to the blocks, otherwise the src is
+    // reordered to a plain layout first.
+    dim offset = 0;
+    dnnl::memory::desc view_md = get_view_desc(in_md, sizes, offsets, offset);
+    if (!view_md) {
+        in_md = to_ncx_format(in_md);
+        insert_reorder_before(op, 0, in_md, p_engine, pd_cache, fpmath,
+                use_block_layout, rewriter);
+        view_md = get_view_desc(in_md, sizes, offsets, offset);
+    }
+
+    // partition outputs are dense instead of having the strides of the src
+    status_t status = status::success;
+    if (ltw(out_lt).is_any() && dst->get_consumers().empty()) {
+        status = fill_layout_info(dst,
+                dnnl::memory::desc(sizes, view_md.get_data_type(),
+                        get_ncx_format(sizes.size())));
+        VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+                "failed to fill layout info for slice dst");
+    }
+
+    insert_reorder_after(op, 0, view_md, p_engine, pd_cache, fpmath,
+            use_block_layout, rewriter);
+    dst = op->get_output_value(0);
+    status = fill_layout_info(dst, view_md);
+    return status;
+}
+
+status_t layout_propagator_for_pad(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, pd_cache_t &pd_cache,
+        const fpmath_t &fpmath, bool use_block_layout,
+        subgraph_rewriter_t &rewriter) {
+    value_ptr src = op->get_input_value(0);
+    value_ptr dst = op->get_output_value(0);
+    const logical_tensor_t &in_lt = src->get_logical_tensor();
+    const logical_tensor_t &out_lt = dst->get_logical_tensor();
+
+    VCHECK_LAYOUT_PROPAGATOR(!ltw(in_lt).is_any(), status::invalid_arguments,
+            "layout of pad src can't be any layout");
+
+    // The whole dst is filled with the pad value before the src is copied to
+    // its interior, so it needs a plain layout. Channels-last src keeps its
+    // format. Any src layout can be copied.
+    const auto in_md = make_dnnl_memory_desc(in_lt);
+    const auto out_dims = ltw(out_lt).vdims();
+    dnnl::memory::desc expected_out_md;
+    if (in_md.get_ndims() > 2 && is_format(in_md, "nxc")) {
+        expected_out_md = dnnl::memory::desc(out_dims, in_md.get_data_type(),
+                get_nxc_strides(out_dims));
+    } else {
+        expected_out_md = dnnl::memory::desc(out_dims, in_md.get_data_type(),
+                get_ncx_format(out_dims.size()));
+    }
+
+    if (!ltw(out_lt).is_any() && is_plain(make_dnnl_memory_desc(out_lt)))
+        return status::success;
+
+    insert_reorder_after(op, 0, expected_out_md, p_engine, pd_cache, fpmath,
+            use_block_layout, rewriter);
+    dst = op->get_output_value(0);
+    return fill_layout_info(dst, expected_out_md);
+}
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
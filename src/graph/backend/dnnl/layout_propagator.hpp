@@ -98,6 +98,11 @@ DECLARE_LAYOUT_PROPAGATOR(sdpa_bwd);
 DECLARE_LAYOUT_PROPAGATOR(host_scalar);
 DECLARE_LAYOUT_PROPAGATOR(identity);
 DECLARE_LAYOUT_PROPAGATOR(gated_mlp);
+DECLARE_LAYOUT_PROPAGATOR(embedding_bag);
+DECLARE_LAYOUT_PROPAGATOR(rope);
+DECLARE_LAYOUT_PROPAGATOR(topk);
+DECLARE_LAYOUT_PROPAGATOR(slice);
+DECLARE_LAYOUT_PROPAGATOR(pad);
 
 #undef DECLARE_LAYOUT_PROPAGATOR
 
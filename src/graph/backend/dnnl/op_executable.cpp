@@ -79,6 +79,11 @@ executable_creator_func op_func_t::get_executable_creator(op_kind_t kind) {
             {_dropout, dummy_executable_creator},
             {_gated_mlp, executable_creator<gated_mlp_executable_t>},
             {_sdpa_bwd, executable_creator<sdpa_bwd_executable_t>},
+            {_embedding_bag, executable_creator<embedding_bag_executable_t>},
+            {_rope, executable_creator<rope_executable_t>},
+            {_topk, executable_creator<topk_executable_t>},
+            {_slice, executable_creator<slice_executable_t>},
+            {_pad, executable_creator<pad_executable_t>},
     };
 
     if (_map.count(kind) == 0) {
@@ -144,6 +149,11 @@ arg_indices_getter_func op_func_t::get_arg_indices_getter(op_kind_t kind) {
             {_dropout, dummy_arg_indices_getter},
             {_gated_mlp, gated_mlp_executable_t::get_arg_indices},
             {_sdpa_bwd, sdpa_bwd_executable_t::get_arg_indices},
+            {_embedding_bag, embedding_bag_executable_t::get_arg_indices},
+            {_rope, rope_executable_t::get_arg_indices},
+            {_topk, topk_executable_t::get_arg_indices},
+            {_slice, slice_executable_t::get_arg_indices},
+            {_pad, pad_executable_t::get_arg_indices},
     };
 
     if (_map.count(kind) == 0) {
@@ -207,6 +217,11 @@ layout_propagator_func op_func_t::get_layout_propagator(op_kind_t kind) {
             {_identity, layout_propagator_for_identity},
             {_gated_mlp, layout_propagator_for_gated_mlp},
             {_sdpa_bwd, layout_propagator_for_sdpa_bwd},
+            {_embedding_bag, layout_propagator_for_embedding_bag},
+            {_rope, layout_propagator_for_rope},
+            {_topk, layout_propagator_for_topk},
+            {_slice, layout_propagator_for_slice},
+            {_pad, layout_propagator_for_pad},
     };
 
     if (_map.count(kind) == 0) {
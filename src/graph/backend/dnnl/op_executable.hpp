@@ -24,6 +24,7 @@
 #include "graph/backend/dnnl/executables/conv.hpp"
 #include "graph/backend/dnnl/executables/deconv.hpp"
 #include "graph/backend/dnnl/executables/eltwise.hpp"
+#include "graph/backend/dnnl/executables/embedding_bag.hpp"
 #include "graph/backend/dnnl/executables/gated_mlp.hpp"
 #include "graph/backend/dnnl/executables/gen_index.hpp"
 #include "graph/backend/dnnl/executables/group_norm.hpp"
@@ -33,6 +34,10 @@
 #include "graph/backend/dnnl/executables/memory_reparser.hpp"
 #include "graph/backend/dnnl/executables/pool.hpp"
 #include "graph/backend/dnnl/executables/reduction.hpp"
+#include "graph/backend/dnnl/executables/rope.hpp"
+#include "graph/backend/dnnl/executables/topk.hpp"
+#include "graph/backend/dnnl/executables/slice.hpp"
+#include "graph/backend/dnnl/executables/pad.hpp"
 #include "graph/backend/dnnl/executables/reorder.hpp"
 #include "graph/backend/dnnl/executables/resampling.hpp"
 #include "graph/backend/dnnl/executables/sdpa.hpp"
@@ -14,10 +14,14 @@
  * limitations under the License.
  *******************************************************************************/
 
+#include <atomic>
+#include <exception>
 #include <memory>
 #include <vector>
 #include <unordered_map>
 
+#include "common/dnnl_thread.hpp"
+
 #include "graph/interface/c_types_map.hpp"
 #include "graph/interface/value.hpp"
 
@@ -34,37 +38,97 @@ namespace dnnl {
 namespace impl {
 namespace graph {
 namespace dnnl_impl {
+
+namespace {
+
+status_t create_executable(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, pd_cache_t &pd_cache,
+        const fpmath_t &fpm, bool use_block_layout,
+        std::shared_ptr<op_executable_t> &exec) {
+    auto creator = op_func_t::get_executable_creator(op->get_kind());
+    VCHECK_COMPILE_OPS(creator != nullptr, status::invalid_graph_op,
+            "no executable creator in schema of op %s",
+            op->get_name().c_str());
+    exec = creator(op, p_engine, pd_cache, fpm, use_block_layout);
+    VCHECK_COMPILE_OPS(exec != nullptr, status::invalid_graph_op,
+            "unimplemented op, can't compile op %s", op->get_name().c_str());
+    VCHECK_COMPILE_OPS(exec->is_initialized(), status::invalid_graph_op,
+            "failed to create executable for op %s", op->get_name().c_str());
+    return status::success;
+}
+
+} // namespace
+
 /// After the lower down, infer shape, infer type and layout propagation passes,
 /// each op in the subgraph will has complete attributes and each edge will have
 /// complete shape/dtype/layout information. We can create executable for these
 /// ops.
+///
+/// Creating an executable only reads the op it is created for, so the
+/// executables are created concurrently on the library threads. Most of the
+/// time is spent in kernel generation, and identical primitives requested by
+/// several threads are generated once thanks to the primitive cache.
 status_t compile_ops(std::shared_ptr<subgraph_t> &sg) {
     const auto &p_engine = *(sg->p_engine_);
     auto &pd_cache = sg->pd_cache_;
     auto &fpm = sg->get_fpmath_mode();
     bool use_block_layout = sg->can_use_blocked_layout_;
 
-    return topo_order_visit(sg->get_output_ops(), [&](op_t *op) {
-        auto creator = op_func_t::get_executable_creator(op->get_kind());
-        VCHECK_COMPILE_OPS(creator != nullptr, status::invalid_graph_op,
-                "no executable creator in schema of op %s",
-                op->get_name().c_str());
-        auto cur_op = op->shared_from_this();
-        std::shared_ptr<op_executable_t> exec
-                = creator(cur_op, p_engine, pd_cache, fpm, use_block_layout);
-        VCHECK_COMPILE_OPS(exec != nullptr, status::invalid_graph_op,
-                "unimplemented op, can't compile op %s",
-                op->get_name().c_str());
-        VCHECK_COMPILE_OPS(exec->is_initialized(), status::invalid_graph_op,
-                "failed to create executable for op %s",
-                op->get_name().c_str());
-
-        sg->execs_.emplace_back(exec);
-
-        sg->is_constant_.push_back(op->has_attr(op_attr::is_constant)
-                && op->get_attr<bool>(op_attr::is_constant));
+    std::vector<std::shared_ptr<op_t>> ops;
+    CHECK(topo_order_visit(sg->get_output_ops(), [&](op_t *op) {
+        ops.emplace_back(op->shared_from_this());
         return status::success;
-    });
+    }));
+    const size_t nops = ops.size();
+
+    // Creators add the primitive descriptors they create to the cache, so
+    // each op gets a private cache, which is merged back afterwards.
+    std::vector<pd_cache_t> op_pd_caches(nops);
+    for (size_t i = 0; i < nops; i++) {
+        const auto it = pd_cache.find(ops[i].get());
+        if (it != pd_cache.end()) op_pd_caches[i].insert(*it);
+    }
+
+    std::vector<std::shared_ptr<op_executable_t>> execs(nops);
+    std::vector<status_t> statuses(nops, status::success);
+    std::vector<std::exception_ptr> exceptions(nops);
+    const auto create = [&](size_t i) {
+        // Exceptions must not leave a parallel region.
+        try {
+            statuses[i] = create_executable(ops[i], p_engine, op_pd_caches[i],
+                    fpm, use_block_layout, execs[i]);
+        } catch (...) { exceptions[i] = std::current_exception(); }
+    };
+
+    const int nthr = static_cast<int>(
+            std::min<size_t>(nops, dnnl_get_current_num_threads()));
+    if (nthr <= 1) {
+        for (size_t i = 0; i < nops; i++)
+            create(i);
+    } else {
+        // Creation times differ a lot between ops, so the ops are handed out
+        // one at a time.
+        std::atomic<size_t> next {0};
+        parallel(nthr, [&](int, int) {
+            for (size_t i = next++; i < nops; i = next++)
+                create(i);
+        });
+    }
+
+    // Report the first failure in topological order, as the serial creation
+    // would do.
+    for (size_t i = 0; i < nops; i++) {
+        if (exceptions[i]) std::rethrow_exception(exceptions[i]);
+        CHECK(statuses[i]);
+    }
+
+    for (size_t i = 0; i < nops; i++) {
+        pd_cache.insert(op_pd_caches[i].begin(), op_pd_caches[i].end());
+        sg->execs_.emplace_back(execs[i]);
+        sg->is_constant_.push_back(ops[i]->has_attr(op_attr::is_constant)
+                && ops[i]->get_attr<bool>(op_attr::is_constant));
+    }
+    return status::success;
 }
 
 } // namespace dnnl_impl
@@ -314,6 +314,53 @@ static status_t static_transpose_handler(
     return status::success;
 }
 
+static status_t slice_handler(
+        const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
+    auto new_op = std::make_shared<op_t>(op_kind::_slice);
+    new_op->merge_attributes(op->get_attributes());
+    rewriter.replace_op(op, new_op);
+    return status::success;
+}
+
+static status_t pad_handler(
+        const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
+    auto new_op = std::make_shared<op_t>(op_kind::_pad);
+    new_op->merge_attributes(op->get_attributes());
+    rewriter.replace_op(op, new_op);
+    return status::success;
+}
+
+// Split is lowered to one _slice per output, so that each output can be a view
+// of the input.
+static status_t split_handler(
+        const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
+    const auto &src = op->get_input_value(0);
+    const auto axis = op->get_attr<int64_t>(op_attr::axis);
+    const auto &sizes = op->get_attr<std::vector<int64_t>>(op_attr::sizes);
+    VCHECK_INVALID_ARGUMENT(sizes.size() == op->num_outputs(),
+            "Split should have %zu outputs but got %zu", sizes.size(),
+            op->num_outputs());
+
+    src->remove_consumer(*op, 0);
+    int64_t start = 0;
+    for (size_t i = 0; i < op->num_outputs(); ++i) {
+        auto slice_op = std::make_shared<op_t>(op_kind::_slice);
+        slice_op->set_attr<std::vector<int64_t>>(op_attr::axes, {axis});
+        slice_op->set_attr<std::vector<int64_t>>(op_attr::starts, {start});
+        slice_op->set_attr<std::vector<int64_t>>(
+                op_attr::ends, {start + sizes[i]});
+        start += sizes[i];
+
+        src->add_consumer(*slice_op, 0);
+        slice_op->add_input(src);
+        slice_op->add_output(op->get_output_value(i));
+        rewriter.to_insert(slice_op);
+    }
+
+    rewriter.to_remove(op);
+    return status::success;
+}
+
 static status_t dummy_handler(
         const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
     UNUSED(op);
@@ -921,6 +968,9 @@ static const std::unordered_map<graph::op_kind_t, handler_func> handler_table {
         // data formatting
         ITEM(StaticReshape, static_reshape_handler),
         ITEM(StaticTranspose, static_transpose_handler),
+        ITEM(Slice, slice_handler),
+        ITEM(Split, split_handler),
+        ITEM(Pad, pad_handler),
         // misc
         ITEM(BiasAdd, bias_add_handler),
         ITEM(Reorder, reorder_handler),
@@ -930,6 +980,9 @@ static const std::unordered_map<graph::op_kind_t, handler_func> handler_table {
         ITEM(SquaredDifference, squared_difference_handler),
         ITEM(Select, select_handler),
         ITEM(GenIndex, gen_index_handler),
+        ITEM(EmbeddingBag, common_handler<op_kind::_embedding_bag>),
+        ITEM(RoPE, common_handler<op_kind::_rope>),
+        ITEM(TopK, common_handler<op_kind::_topk>),
         ITEM(Dropout, dropout_handler),
         // utility
         ITEM(Wildcard, dummy_handler),
@@ -22,6 +22,7 @@
 #include <unordered_set>
 
 #include "graph/interface/c_types_map.hpp"
+#include "graph/interface/shape_infer.hpp"
 #include "graph/interface/value.hpp"
 
 #include "graph/backend/dnnl/common.hpp"
@@ -63,6 +64,7 @@ std::vector<op_inplace_pair_t> get_op_inplace_pairs(op_t &op) {
             op_kind::_softmax_bwd,
             op_kind::_logsoftmax_bwd,
             op_kind::_identity,
+            op_kind::_rope,
     };
     std::vector<op_inplace_pair_t> pairs;
 
@@ -153,7 +155,21 @@ std::vector<op_inplace_pair_t> get_op_inplace_pairs(op_t &op) {
         // Do nothing
     }
 
-    return pairs;
+    // The buffer of a sliced view is shared with the whole input of the slice,
+    // so it can't be reused by the output of the consumer.
+    std::vector<op_inplace_pair_t> ret;
+    for (const auto &pair : pairs) {
+        auto in = op.get_input_value(pair.in_idx_);
+        if (in->has_producer()) {
+            const op_t &producer = in->get_producer();
+            if (producer.get_kind() == op_kind::_slice
+                    && producer.has_attr(op_attr::is_view)
+                    && producer.get_attr<bool>(op_attr::is_view))
+                continue;
+        }
+        ret.push_back(pair);
+    }
+    return ret;
 }
 
 std::shared_ptr<execution_args_set_t> execution_args_set_t::clone() const {
@@ -268,11 +284,52 @@ void alias_analyzer_t::clear() {
     reverse_alias_map_.clear();
 }
 
+namespace {
+// A _slice op can be executed as a view of its input if the output layout is
+// the strided sub-region of the input layout. The view shares the input buffer
+// and is only supported on CPU where the data handle can be offset directly.
+// Subgraph outputs and constants are excluded since their buffers are managed
+// outside of the temporary buffer, and so are the outputs consumed by other
+// alias ops which would be bound to the beginning of the shared buffer.
+bool is_slice_view(const op_t &op, const std::shared_ptr<subgraph_t> &sg) {
+    if (sg->p_engine_->get_kind() != dnnl::engine::kind::cpu) return false;
+    if (op.has_attr(op_attr::is_constant)
+            && op.get_attr<bool>(op_attr::is_constant))
+        return false;
+
+    const value_t *in = op.get_input_value(0).get();
+    const value_t *out = op.get_output_value(0).get();
+    for (const auto &lt : sg->outs_) {
+        if (lt.id == in->get_logical_tensor().id
+                || lt.id == out->get_logical_tensor().id)
+            return false;
+    }
+    for (const auto &consumer : out->get_consumers()) {
+        if (is_preprocess_op(consumer.get_op())) return false;
+    }
+
+    const auto in_md = make_dnnl_memory_desc(in->get_logical_tensor());
+    const auto out_md = make_dnnl_memory_desc(out->get_logical_tensor());
+    dims offsets, sizes;
+    if (get_slice_region(&op, in_md.get_dims(), offsets, sizes)
+            != status::success)
+        return false;
+    dim offset = 0;
+    const auto view_md = get_view_desc(in_md, sizes, offsets, offset);
+    return view_md && view_md == out_md;
+}
+} // namespace
+
 status_t alias_analyzer_t::run(std::shared_ptr<subgraph_t> &sg) {
     clear();
     // find alias values
     for (auto &cur_op : sg->get_ops()) {
-        if (!is_preprocess_op(*cur_op)) continue;
+        if (cur_op->get_kind() == op_kind::_slice) {
+            const bool is_view = is_slice_view(*cur_op, sg);
+            cur_op->set_attr<bool>(op_attr::is_view, is_view);
+            if (!is_view) continue;
+        } else if (!is_preprocess_op(*cur_op))
+            continue;
         value_t *out = cur_op->get_output_value(0).get();
         value_t *in = cur_op->get_input_value(0).get();
         alias_map_.insert({out, in});
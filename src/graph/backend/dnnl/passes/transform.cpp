@@ -274,7 +274,8 @@ status_t convert_to_runtime_src_scales(std::shared_ptr<subgraph_t> &sg) {
         if (consumers.empty()) continue;
         if (!impl::utils::one_of(consumers[0].get_op().get_kind(),
                     op_kind::_matmul, op_kind::_convolution,
-                    op_kind::_convtranspose, op_kind::_reorder))
+                    op_kind::_convtranspose, op_kind::_reorder,
+                    op_kind::_embedding_bag))
             continue;
 
         // make scales as a constant input
@@ -331,16 +332,19 @@ status_t convert_to_runtime_src_zero_points(std::shared_ptr<subgraph_t> &sg) {
         auto out_val = zp_op->get_output_values()[0];
         auto consumers = out_val->get_consumers();
 
-        if (!impl::utils::one_of(consumers[0].get_op().get_kind(),
-                    op_kind::_matmul, op_kind::_convolution,
-                    op_kind::_convtranspose, op_kind::_reorder))
+        const auto consumer_kind = consumers[0].get_op().get_kind();
+        if (!impl::utils::one_of(consumer_kind, op_kind::_matmul,
+                    op_kind::_convolution, op_kind::_convtranspose,
+                    op_kind::_reorder, op_kind::_embedding_bag))
             continue;
 
         // make zps as a constant input
         op_ptr const_data_op;
         auto zps = zp_op->get_attr<std::vector<int64_t>>(op_attr::zps);
-        // adjusted zp
-        std::vector<int64_t> adj_zps = {zps[0]};
+        // adjusted zp, embedding bag keeps per-row zero-points of the table
+        std::vector<int64_t> adj_zps = consumer_kind == op_kind::_embedding_bag
+                ? zps
+                : std::vector<int64_t> {zps[0]};
         const_data_op = std::make_shared<op_t>(op_kind::_constant_zps);
         const_data_op->set_attr(op_attr::zps, adj_zps);
         std::vector<int64_t> dst_shape(1, adj_zps.size());
@@ -1234,10 +1238,15 @@ status_t fuse_src_zero_points(std::shared_ptr<subgraph_t> &sg) {
         auto out_val = zp_op->get_output_values()[0];
         auto consumers = out_val->get_consumers();
 
-        if (!has_int8_support(consumers[0].get_op().get_kind())) continue;
+        const auto consumer_kind = consumers[0].get_op().get_kind();
+        if (!has_int8_support(consumer_kind)
+                && consumer_kind != op_kind::_embedding_bag)
+            continue;
 
         auto &next_op = consumers[0].get_op();
         auto offset = consumers[0].get_offset();
+        // Only the table of an embedding bag can be quantized.
+        if (consumer_kind == op_kind::_embedding_bag && offset != 0) continue;
         if (offset == 0 || offset == 1) {
             if (!next_op.has_attr(op_attr::fusion_info)) {
                 fusion_info_t fusion_info;
@@ -1322,11 +1331,15 @@ status_t fuse_src_scales(std::shared_ptr<subgraph_t> &sg) {
         if (consumers.empty()) continue;
         if (!impl::utils::one_of(consumers[0].get_op().get_kind(),
                     op_kind::_matmul, op_kind::_convolution,
-                    op_kind::_convtranspose, op_kind::_reorder))
+                    op_kind::_convtranspose, op_kind::_reorder,
+                    op_kind::_embedding_bag))
             continue;
 
         auto &next_op = consumers[0].get_op();
         auto offset = consumers[0].get_offset();
+        // Only the table of an embedding bag can be quantized.
+        if (next_op.get_kind() == op_kind::_embedding_bag && offset != 0)
+            continue;
         if (offset == 0 || offset == 1) {
             // Matmul only support applying scale per channel along the last
             // dimension for DNNL_ARG_WEIGHTS.
@@ -3429,6 +3442,41 @@ status_t decompose_softmax_with_stats(std::shared_ptr<subgraph_t> &sg) {
     return infer_shape(sg);
 }
 
+status_t fuse_softmax_to_topk(std::shared_ptr<subgraph_t> &sg) {
+    subgraph_rewriter_t rewriter(sg);
+
+    for (auto &cur_op : sg->get_ops()) {
+        if (cur_op->get_kind() != op_kind::_softmax) continue;
+        // Softmax with stats output or fused post-ops can't be folded.
+        if (cur_op->num_inputs() != 1 || cur_op->num_outputs() != 2
+                || cur_op->has_attr(op_attr::fusion_info))
+            continue;
+        if (cur_op->has_attr(op_attr::mode)
+                && cur_op->get_attr<std::string>(op_attr::mode) != "none")
+            continue;
+
+        const auto ndims = cur_op->get_input_logical_tensor(0).ndims;
+        auto axis = cur_op->get_attr<int64_t>(op_attr::axis);
+        if (axis < 0) axis += ndims;
+        if (axis != ndims - 1) continue;
+
+        const auto &consumers = cur_op->get_output_value(0)->get_consumers();
+        if (consumers.size() != 1) continue;
+        auto &topk_op = consumers[0].get_op();
+        if (topk_op.get_kind() != op_kind::_topk) continue;
+        if (topk_op.has_attr(op_attr::mode)
+                && topk_op.get_attr<std::string>(op_attr::mode) != "none")
+            continue;
+
+        topk_op.set_attr<std::string>(op_attr::mode, "softmax");
+        topk_op.set_attr<float>(op_attr::temperature, 1.f);
+        rewriter.fuse_op_to_successor(cur_op);
+    }
+
+    rewriter.run();
+    return impl::status::success;
+}
+
 status_t reorder_canonicalization(std::shared_ptr<subgraph_t> &sg) {
     subgraph_rewriter_t rewriter(sg);
 
@@ -313,6 +313,11 @@ status_t fuse_gated_mlp(std::shared_ptr<subgraph_t> &sg);
 /// of softmax primitive doesn't support stats.
 status_t decompose_softmax_with_stats(std::shared_ptr<subgraph_t> &sg);
 
+/// This pass will fold a softmax over the innermost axis into the following
+/// top-k op, which then computes the probabilities of the selected elements
+/// directly from the logits instead of reading the whole softmax output.
+status_t fuse_softmax_to_topk(std::shared_ptr<subgraph_t> &sg);
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include "graph/backend/dnnl/kernels/conv_block.hpp"
 #include "graph/backend/dnnl/kernels/large_partition.hpp"
 #include "graph/backend/dnnl/patterns/fusions.hpp"
 #include "graph/backend/dnnl/patterns/pattern_matcher_pass.hpp"
@@ -352,6 +353,86 @@ pm::pb_op_t *identical_bottleneck_resblock(
     return dst2;
 }
 
+// Convolutions consuming dequantized data are left to the quantized patterns
+bool check_non_quantized_inputs(op_t *op) {
+    bool result = true;
+    for (size_t i = 0; i < op->num_inputs(); ++i) {
+        const auto &in_val = op->get_input_value(i);
+        if (!in_val->has_producer()) continue;
+        const auto kind = in_val->get_producer().get_kind();
+        result = result
+                && !impl::utils::one_of(kind, graph::op_kind::Dequantize,
+                        graph::op_kind::DynamicDequantize,
+                        graph::op_kind::TypeCast);
+    }
+
+    VCHECK_PATTERN_UTILS(result, result, "unexpected quantized input");
+    return result;
+}
+
+pm::pb_op_t *fp_conv_bias(const std::shared_ptr<pb_graph_t> &pgraph,
+        pm::pb_op_t *input, bool grouped = false, bool use_biasadd = false) {
+    in_edges_t in_edges;
+    if (input) { in_edges = in_edges_t {in_edge(0, input, 0)}; }
+    pm::pb_op_t *conv
+            = pgraph->append_op(graph::op_kind::Convolution, in_edges);
+    conv->append_decision_function(check_non_quantized_inputs);
+    pm::pb_op_t *conv_bias_dst = nullptr;
+    if (use_biasadd) {
+        conv->append_decision_function(check_input_num<2>);
+        pm::pb_op_t *biasadd = pgraph->append_op(
+                graph::op_kind::BiasAdd, in_edges_t {in_edge(0, conv, 0)});
+        conv_bias_dst = biasadd;
+    } else {
+        conv->append_decision_function(check_input_num<3>);
+        conv_bias_dst = conv;
+    }
+    conv->append_decision_function(
+            grouped ? check_grouped<true> : check_grouped<false>);
+    return conv_bias_dst;
+}
+
+pm::pb_op_t *conv_bias_act(const std::shared_ptr<pb_graph_t> &pgraph,
+        pm::pb_op_t *input, bool grouped = false, bool use_biasadd = false) {
+    pm::pb_op_t *conv_bias_dst
+            = fp_conv_bias(pgraph, input, grouped, use_biasadd);
+    pm::pb_op_t *act = pgraph->append_alternation(
+            {graph::op_kind::ReLU, graph::op_kind::Clamp},
+            in_edges_t {in_edge(0, conv_bias_dst, 0)});
+    return act;
+}
+
+pm::pb_op_t *conv_bias_add(const std::shared_ptr<pb_graph_t> &pgraph,
+        pm::pb_op_t *input, pm::pb_op_t *post_src, bool grouped = false,
+        bool use_biasadd = false) {
+    pm::pb_op_t *conv_bias_dst
+            = fp_conv_bias(pgraph, input, grouped, use_biasadd);
+    in_edges_t add_in_edges = in_edges_t {in_edge(0, conv_bias_dst, 0)};
+    if (post_src) { add_in_edges.emplace_back(in_edge(1, post_src, 0)); }
+    pm::pb_op_t *add = pgraph->append_op(graph::op_kind::Add, add_in_edges);
+    return add;
+}
+
+// MobileNet-v2 style block: pointwise expansion, depthwise convolution and
+// pointwise projection with a residual connection.
+pm::pb_op_t *inverted_residual_block(const std::shared_ptr<pb_graph_t> &pgraph,
+        pm::pb_op_t *input, bool use_biasadd = false) {
+    pm::pb_op_t *dst0 = conv_bias_act(pgraph, input, false, use_biasadd);
+    pm::pb_op_t *dst1 = conv_bias_act(pgraph, dst0, true, use_biasadd);
+    pm::pb_op_t *dst2
+            = conv_bias_add(pgraph, dst1, nullptr, false, use_biasadd);
+    return dst2;
+}
+
+pm::pb_op_t *identical_basic_resblock(const std::shared_ptr<pb_graph_t> &pgraph,
+        pm::pb_op_t *input, bool use_biasadd = false) {
+    pm::pb_op_t *dst0 = conv_bias_act(pgraph, input, false, use_biasadd);
+    pm::pb_op_t *dst1
+            = conv_bias_add(pgraph, dst0, nullptr, false, use_biasadd);
+    pm::pb_op_t *relu = pgraph->append_op(
+            graph::op_kind::ReLU, in_edges_t {in_edge(0, dst1, 0)});
+    return relu;
+}
 } // namespace
 
 /*!
@@ -710,6 +791,46 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(
             return std::make_shared<larger_partition_kernel_t>();
         });
 
+// Short convolution chains of memory-bound models. The partition is executed
+// by spatial tiles through all the convolutions of the block, so that the
+// intermediate activations stay in cache. The blocks the tiled kernel can't
+// handle fall back to the regular larger partition kernel.
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(
+        dnnl, fp_inverted_residual_block_fusion_cpu)
+        .set_priority(21.f)
+        .set_engine_kind(engine_kind::cpu)
+        .set_kind(partition_kind_t::residual_conv_blocks)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    inverted_residual_block(pgraph, nullptr);
+                })
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    inverted_residual_block(pgraph, nullptr, true);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<conv_block_base_t>();
+        });
+
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(
+        dnnl, fp_identical_basic_resblock_fusion_cpu)
+        .set_priority(21.f)
+        .set_engine_kind(engine_kind::cpu)
+        .set_kind(partition_kind_t::residual_conv_blocks)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    identical_basic_resblock(pgraph, nullptr);
+                })
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    identical_basic_resblock(pgraph, nullptr, true);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<conv_block_base_t>();
+        });
+#endif
+
 DNNL_BACKEND_REGISTER_PATTERN_DEF_END
 
 } // namespace pattern
@@ -0,0 +1,126 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "graph/backend/dnnl/kernels/large_partition.hpp"
+
+#include "graph/backend/dnnl/patterns/fusions.hpp"
+#include "graph/backend/dnnl/patterns/pattern_matcher_pass.hpp"
+#include "graph/backend/dnnl/patterns/utils.hpp"
+
+#include "graph/utils/pm/pbuilder.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+namespace pattern {
+
+namespace pm = graph::utils::pm;
+using in_edges_t = pm::in_edges_t;
+using pb_graph_t = pm::pb_graph_t;
+using FCreatePattern = graph::pass::FCreatePattern;
+
+DNNL_BACKEND_REGISTER_PATTERN_DEF_BEGIN(data_movement_fusion)
+
+// The data movement ops are only available on CPU.
+#define DATA_MOVEMENT_PASS(op, name) \
+    DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, name) \
+            .set_priority(8.f) \
+            .set_engine_kind(engine_kind::cpu) \
+            .set_kind(partition_kind_t::misc_post_ops) \
+            .set_attr<FCreatePattern>("FCreatePattern", \
+                    [](const std::shared_ptr<pb_graph_t> &pgraph) -> void { \
+                        pgraph->append_op(graph::op_kind::op); \
+                    }) \
+            .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr { \
+                return std::make_shared<larger_partition_kernel_t>(); \
+            });
+
+DATA_MOVEMENT_PASS(Slice, slice_pass)
+DATA_MOVEMENT_PASS(Split, split_pass)
+DATA_MOVEMENT_PASS(Pad, pad_pass)
+
+#undef DATA_MOVEMENT_PASS
+
+/*
+            \   /
+            matmul
+              |
+           [bias]*
+              |
+            split
+          /   |   \
+
+The fused projection of attention: the query, key and value are produced by one
+matmul and split in the same partition.
+*/
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_matmul_split)
+        .set_priority(10.6f)
+        .set_engine_kind(engine_kind::cpu)
+        .set_kind(partition_kind_t::matmul_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    pm::pb_op_t *pmatmul
+                            = pgraph->append_op(graph::op_kind::MatMul);
+
+                    // Optional bias
+                    auto popt_bias = optional_bias_add(pgraph, pmatmul, false);
+
+                    pgraph->append_op(graph::op_kind::Split,
+                            in_edges_t {in_edge(0, popt_bias, 0)});
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<larger_partition_kernel_t>();
+        });
+
+/*
+              |
+            slice
+              |    /
+             matmul
+              |
+           [bias]*
+              |
+
+The slice is executed as a view of the partition input when the matmul can
+consume the strided region directly, so no copy is made.
+*/
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_slice_matmul)
+        .set_priority(10.6f)
+        .set_engine_kind(engine_kind::cpu)
+        .set_kind(partition_kind_t::matmul_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    pm::pb_op_t *pslice
+                            = pgraph->append_op(graph::op_kind::Slice);
+                    pm::pb_op_t *pmatmul
+                            = pgraph->append_op(graph::op_kind::MatMul,
+                                    in_edges_t {in_edge(0, pslice, 0)});
+
+                    // Optional bias
+                    optional_bias_add(pgraph, pmatmul, false);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<larger_partition_kernel_t>();
+        });
+
+DNNL_BACKEND_REGISTER_PATTERN_DEF_END
+
+} // namespace pattern
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
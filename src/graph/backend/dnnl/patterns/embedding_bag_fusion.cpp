@@ -0,0 +1,166 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "graph/backend/dnnl/kernels/large_partition.hpp"
+
+#include "graph/backend/dnnl/patterns/fusions.hpp"
+#include "graph/backend/dnnl/patterns/pattern_matcher_pass.hpp"
+#include "graph/backend/dnnl/patterns/utils.hpp"
+
+#include "graph/utils/pm/pbuilder.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+namespace pattern {
+
+namespace pm = graph::utils::pm;
+using in_edges_t = pm::in_edges_t;
+using pb_graph_t = pm::pb_graph_t;
+using FCreatePattern = graph::pass::FCreatePattern;
+
+namespace {
+
+// Quantized tables are dequantized either with a common scale or with one
+// scale (and zero-point) per table row.
+bool check_table_qtype(op_t *op) {
+    const auto &qtype = op->get_attr<std::string>(op_attr::qtype);
+    if (qtype == "per_tensor") return true;
+    return qtype == "per_channel" && op->get_attr<int64_t>(op_attr::axis) == 0;
+}
+
+pm::pb_op_t *append_embedding_bag(
+        const std::shared_ptr<pb_graph_t> &pgraph, bool quantized) {
+    if (!quantized) return pgraph->append_op(graph::op_kind::EmbeddingBag);
+
+    pm::pb_op_t *pdequant = pgraph->append_alternation(
+            {graph::op_kind::Dequantize, graph::op_kind::DynamicDequantize});
+    pdequant->append_decision_function(check_table_qtype);
+    return pgraph->append_op(
+            graph::op_kind::EmbeddingBag, {in_edge(0, pdequant, 0)});
+}
+
+void append_matmul_post_ops(
+        const std::shared_ptr<pb_graph_t> &pgraph, pm::pb_op_t *pemb) {
+    pm::pb_op_t *pmatmul = pgraph->append_op(
+            graph::op_kind::MatMul, {in_edge(0, pemb, 0)});
+
+    // Optional bias
+    auto popt_bias = optional_bias_add(pgraph, pmatmul, false);
+
+    auto alt_graph = std::make_shared<pb_graph_t>();
+    auto palt = alt_graph->append_alternation(get_unary_binary_ops());
+    palt->allow_internal_inputs();
+    alt_graph->create_input_port(0, palt, 0);
+    alt_graph->create_output_port(0, palt, 0);
+
+    pgraph->append_repetition(alt_graph, {0, 0}, 0, MAX_REPETITION,
+            in_edges_t {in_edge(0, popt_bias, 0)});
+}
+
+} // namespace
+
+DNNL_BACKEND_REGISTER_PATTERN_DEF_BEGIN(embedding_bag_fusion)
+
+// The embedding bag implementation is only available on CPU.
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, embedding_bag_pass)
+        .set_priority(8.f)
+        .set_engine_kind(engine_kind::cpu)
+        .set_kind(partition_kind_t::misc_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    append_embedding_bag(pgraph, false);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<larger_partition_kernel_t>();
+        });
+
+/*
+    [table]
+       |
+  [dynamic_]dequantize
+       |   [indices] [offsets]
+       |      |      /
+      embedding_bag
+
+The table dequantization is folded into the embedding bag as source scales
+and zero-points, so quantized rows are only expanded while being pooled.
+*/
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, x8_embedding_bag)
+        .set_priority(9.f)
+        .set_engine_kind(engine_kind::cpu)
+        .set_kind(partition_kind_t::misc_quantized_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    append_embedding_bag(pgraph, true);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<larger_partition_kernel_t>();
+        });
+
+/*
+    [table] [indices] [offsets]
+         \      |      /
+         embedding_bag
+                |   [weights]
+                |  /
+              matmul
+                |
+             [bias]*
+                |
+    [unary/binary]*[0,MAX_REPETITION)
+                |
+
+The pooled embeddings are consumed by the matmul directly in the same
+partition so that the intermediate tensor does not leave the library. The
+priority is higher than the matmul post-ops patterns to make sure the
+embedding bag is not left in a separate partition.
+*/
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_embedding_bag_matmul)
+        .set_priority(10.6f)
+        .set_engine_kind(engine_kind::cpu)
+        .set_kind(partition_kind_t::misc_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    append_matmul_post_ops(
+                            pgraph, append_embedding_bag(pgraph, false));
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<larger_partition_kernel_t>();
+        });
+
+// Same as above with a quantized table.
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, x8_embedding_bag_matmul)
+        .set_priority(10.7f)
+        .set_engine_kind(engine_kind::cpu)
+        .set_kind(partition_kind_t::misc_quantized_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    append_matmul_post_ops(
+                            pgraph, append_embedding_bag(pgraph, true));
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<larger_partition_kernel_t>();
+        });
+
+DNNL_BACKEND_REGISTER_PATTERN_DEF_END
+
+} // namespace pattern
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -49,6 +49,10 @@ DNNL_BACKEND_REGISTER_PATTERN_DECLARE(concat_fusion)
 DNNL_BACKEND_REGISTER_PATTERN_DECLARE(groupnorm_fusion)
 DNNL_BACKEND_REGISTER_PATTERN_DECLARE(mlp)
 DNNL_BACKEND_REGISTER_PATTERN_DECLARE(bmb)
+DNNL_BACKEND_REGISTER_PATTERN_DECLARE(embedding_bag_fusion)
+DNNL_BACKEND_REGISTER_PATTERN_DECLARE(rope_fusion)
+DNNL_BACKEND_REGISTER_PATTERN_DECLARE(topk_fusion)
+DNNL_BACKEND_REGISTER_PATTERN_DECLARE(data_movement_fusion)
 
 #undef DNNL_BACKEND_REGISTER_PATTERN_DECLARE
 
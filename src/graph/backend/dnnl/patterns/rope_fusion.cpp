@@ -0,0 +1,100 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "graph/backend/dnnl/kernels/large_partition.hpp"
+
+#include "graph/backend/dnnl/patterns/fusions.hpp"
+#include "graph/backend/dnnl/patterns/pattern_matcher_pass.hpp"
+#include "graph/backend/dnnl/patterns/utils.hpp"
+
+#include "graph/utils/pm/pbuilder.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+namespace pattern {
+
+namespace pm = graph::utils::pm;
+using in_edges_t = pm::in_edges_t;
+using pb_graph_t = pm::pb_graph_t;
+using FCreatePattern = graph::pass::FCreatePattern;
+
+DNNL_BACKEND_REGISTER_PATTERN_DEF_BEGIN(rope_fusion)
+
+// The rope implementation is only available on CPU.
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, rope_pass)
+        .set_priority(8.f)
+        .set_engine_kind(engine_kind::cpu)
+        .set_kind(partition_kind_t::misc_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    pgraph->append_op(graph::op_kind::RoPE);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<larger_partition_kernel_t>();
+        });
+
+/*
+              \   /
+              matmul
+                |
+             [bias]*
+                |
+         [StaticReshape]*
+                |
+        [StaticTranspose]*   [cos] [sin] [position_ids]*
+                 \            /     /     /
+                         rope
+                          |
+
+Q and K projections are rotated right after they are computed. Keeping the
+rope in the projection partition lets it run in place on the matmul output
+instead of writing Q and K out and reading them back in another partition.
+*/
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_matmul_rope)
+        .set_priority(10.6f)
+        .set_engine_kind(engine_kind::cpu)
+        .set_kind(partition_kind_t::misc_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    pm::pb_op_t *pmatmul
+                            = pgraph->append_op(graph::op_kind::MatMul);
+
+                    // Optional bias
+                    auto popt_bias = optional_bias_add(pgraph, pmatmul, false);
+
+                    // Optional split of heads
+                    auto popt_reshape = append_siso_repetition_subgraph(
+                            pgraph, graph::op_kind::StaticReshape, popt_bias);
+                    auto popt_transpose = append_siso_repetition_subgraph(
+                            pgraph, graph::op_kind::StaticTranspose,
+                            popt_reshape);
+
+                    pgraph->append_op(graph::op_kind::RoPE,
+                            in_edges_t {in_edge(0, popt_transpose, 0)});
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<larger_partition_kernel_t>();
+        });
+
+DNNL_BACKEND_REGISTER_PATTERN_DEF_END
+
+} // namespace pattern
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -138,6 +138,107 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_sdp_fusion)
             return std::make_shared<sdp_base_t<>>();
         });
 
+/*
+ [query] [cos/sin]  [key] [cos/sin]
+     \   /             \   /
+      RoPE             RoPE
+        \               |
+         \     [StaticTranspose]*
+          \           /
+             MatMul
+               |
+     [scale and masks]*
+               |
+            Softmax   [value]
+                  \     /
+                   MatMul
+                     |
+
+Rotary embedding of Q and K is kept inside the SDPA partition so the
+attention block does not split into separate partitions around it. The fused
+SDPA kernels don't support rope yet, the partition is executed as a larger
+partition.
+*/
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_sdp_rope_fusion)
+        .set_priority(21.2f)
+        .set_engine_kind(engine_kind::cpu)
+        .set_kind(partition_kind_t::sdp)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    auto rope_q = pgraph->append_op(graph::op_kind::RoPE);
+                    auto rope_k = pgraph->append_op(graph::op_kind::RoPE);
+                    auto opt_transpose_k = append_siso_repetition_subgraph(
+                            pgraph, graph::op_kind::StaticTranspose, rope_k);
+                    auto matmul_qk = pgraph->append_op(graph::op_kind::MatMul,
+                            {in_edge(0, rope_q, 0),
+                                    in_edge(1, opt_transpose_k, 0)});
+                    auto optional_scale_and_mask
+                            = optional_scale_and_masks(pgraph, matmul_qk);
+                    auto softmax = pgraph->append_op(graph::op_kind::SoftMax,
+                            {in_edge(0, optional_scale_and_mask, 0)});
+                    auto tc = optional_typecast(pgraph, softmax);
+                    auto matmul_v = pgraph->append_op(
+                            graph::op_kind::MatMul, {in_edge(0, tc, 0)});
+                    // Optional transpose + reshape/reorder
+                    optional_transpose_reshape(pgraph, matmul_v, 0);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<larger_partition_kernel_t>();
+        });
+
+/*
+ [past_key] [key]
+        \   /
+        Concat---End
+          |
+ [StaticTranspose]*
+          |
+ [query]  |                 [past_value] [value]
+     \    |                        \    /
+      MatMul                       Concat---End
+        |                            |
+ [scale and masks]*                  |
+        |                            |
+     Softmax                         |
+            \                       /
+                     MatMul
+                       |
+
+KV cache append of autoregressive decoding: the rows of the current step are
+concatenated to the past cache and the present cache is both consumed by the
+attention and returned to the user. The decomposition kernel writes the present
+cache of each head right before the head is consumed.
+*/
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_sdp_kv_append_fusion)
+        .set_priority(21.3f)
+        .set_engine_kind(engine_kind::cpu)
+        .set_kind(partition_kind_t::sdp)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    auto concat_k = pgraph->append_op(graph::op_kind::Concat);
+                    pgraph->append_op(
+                            graph::op_kind::End, {in_edge(0, concat_k, 0)});
+                    auto opt_transpose_k = append_siso_repetition_subgraph(
+                            pgraph, graph::op_kind::StaticTranspose, concat_k);
+                    auto matmul_qk = pgraph->append_op(graph::op_kind::MatMul,
+                            {in_edge(1, opt_transpose_k, 0)});
+                    auto optional_scale_and_mask
+                            = optional_scale_and_masks(pgraph, matmul_qk);
+                    auto softmax = pgraph->append_op(graph::op_kind::SoftMax,
+                            {in_edge(0, optional_scale_and_mask, 0)});
+                    auto tc = optional_typecast(pgraph, softmax);
+                    auto concat_v = pgraph->append_op(graph::op_kind::Concat);
+                    pgraph->append_op(
+                            graph::op_kind::End, {in_edge(0, concat_v, 0)});
+                    auto matmul_v = pgraph->append_op(graph::op_kind::MatMul,
+                            {in_edge(0, tc, 0), in_edge(1, concat_v, 0)});
+                    // Optional transpose + reshape/reorder
+                    optional_transpose_reshape(pgraph, matmul_v, 0);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<sdp_base_t<>>();
+        });
+
 DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_sdp_gemma_fusion_cpu)
         .set_priority(21.0f)
         .set_kind(partition_kind_t::sdp)
@@ -153,6 +153,7 @@ const op_kind_t DynamicDequantize = dnnl_graph_op_dynamic_dequantize;
 const op_kind_t DynamicQuantize = dnnl_graph_op_dynamic_quantize;
 const op_kind_t Elu = dnnl_graph_op_elu;
 const op_kind_t EluBackward = dnnl_graph_op_elu_backward;
+const op_kind_t EmbeddingBag = dnnl_graph_op_embedding_bag;
 const op_kind_t End = dnnl_graph_op_end;
 const op_kind_t Exp = dnnl_graph_op_exp;
 const op_kind_t GELU = dnnl_graph_op_gelu;
@@ -180,6 +181,7 @@ const op_kind_t Minimum = dnnl_graph_op_minimum;
 const op_kind_t Mish = dnnl_graph_op_mish;
 const op_kind_t MishBackward = dnnl_graph_op_mish_backward;
 const op_kind_t Multiply = dnnl_graph_op_multiply;
+const op_kind_t Pad = dnnl_graph_op_pad;
 const op_kind_t Pow = dnnl_graph_op_pow;
 const op_kind_t PReLU = dnnl_graph_op_prelu;
 const op_kind_t PReLUBackward = dnnl_graph_op_prelu_backward;
@@ -195,15 +197,18 @@ const op_kind_t ReduceSum = dnnl_graph_op_reduce_sum;
 const op_kind_t ReLU = dnnl_graph_op_relu;
 const op_kind_t ReLUBackward = dnnl_graph_op_relu_backward;
 const op_kind_t RMSNorm = dnnl_graph_op_rms_norm;
+const op_kind_t RoPE = dnnl_graph_op_rope;
 const op_kind_t Reorder = dnnl_graph_op_reorder;
 const op_kind_t Round = dnnl_graph_op_round;
 const op_kind_t Select = dnnl_graph_op_select;
 const op_kind_t Sigmoid = dnnl_graph_op_sigmoid;
 const op_kind_t SigmoidBackward = dnnl_graph_op_sigmoid_backward;
+const op_kind_t Slice = dnnl_graph_op_slice;
 const op_kind_t SoftMax = dnnl_graph_op_softmax;
 const op_kind_t SoftMaxBackward = dnnl_graph_op_softmax_backward;
 const op_kind_t SoftPlus = dnnl_graph_op_softplus;
 const op_kind_t SoftPlusBackward = dnnl_graph_op_softplus_backward;
+const op_kind_t Split = dnnl_graph_op_split;
 const op_kind_t Sqrt = dnnl_graph_op_sqrt;
 const op_kind_t SqrtBackward = dnnl_graph_op_sqrt_backward;
 const op_kind_t Square = dnnl_graph_op_square;
@@ -213,6 +218,7 @@ const op_kind_t StaticTranspose = dnnl_graph_op_static_transpose;
 const op_kind_t Subtract = dnnl_graph_op_subtract;
 const op_kind_t Tanh = dnnl_graph_op_tanh;
 const op_kind_t TanhBackward = dnnl_graph_op_tanh_backward;
+const op_kind_t TopK = dnnl_graph_op_topk;
 const op_kind_t TypeCast = dnnl_graph_op_type_cast;
 const op_kind_t Wildcard = dnnl_graph_op_wildcard;
 const op_kind_t Dropout = dnnl_graph_op_dropout;
@@ -271,6 +277,11 @@ const op_kind_t _identity = 1071;
 const op_kind_t _dropout = 1072;
 const op_kind_t _gated_mlp = 1073;
 const op_kind_t _sdpa_bwd = 1074;
+const op_kind_t _embedding_bag = 1075;
+const op_kind_t _rope = 1076;
+const op_kind_t _topk = 1077;
+const op_kind_t _slice = 1078;
+const op_kind_t _pad = 1079;
 } // namespace op_kind
 
 using op_attr_t = typename std::underlying_type<dnnl_graph_op_attr_t>::type;
@@ -283,12 +294,15 @@ const op_attr_t epsilon = dnnl_graph_op_attr_epsilon;
 const op_attr_t max = dnnl_graph_op_attr_max;
 const op_attr_t min = dnnl_graph_op_attr_min;
 const op_attr_t momentum = dnnl_graph_op_attr_momentum;
+const op_attr_t temperature = dnnl_graph_op_attr_temperature;
+const op_attr_t pad_value = dnnl_graph_op_attr_pad_value;
 
 const op_attr_t scales = dnnl_graph_op_attr_scales;
 
 const op_attr_t axis = dnnl_graph_op_attr_axis;
 const op_attr_t begin_norm_axis = dnnl_graph_op_attr_begin_norm_axis;
 const op_attr_t groups = dnnl_graph_op_attr_groups;
+const op_attr_t k = dnnl_graph_op_attr_k;
 
 const op_attr_t axes = dnnl_graph_op_attr_axes;
 const op_attr_t dilations = dnnl_graph_op_attr_dilations;
@@ -305,6 +319,8 @@ const op_attr_t sizes = dnnl_graph_op_attr_sizes;
 const op_attr_t strides = dnnl_graph_op_attr_strides;
 const op_attr_t zps = dnnl_graph_op_attr_zps;
 const op_attr_t group_shape = dnnl_graph_op_attr_group_shape;
+const op_attr_t starts = dnnl_graph_op_attr_starts;
+const op_attr_t ends = dnnl_graph_op_attr_ends;
 
 const op_attr_t exclude_pad = dnnl_graph_op_attr_exclude_pad;
 const op_attr_t keep_dims = dnnl_graph_op_attr_keep_dims;
@@ -352,6 +368,7 @@ const op_attr_t with_scale = 0x10010;
 const op_attr_t is_invert_scale = 0x10011;
 const op_attr_t mask_type = 0x10012;
 const op_attr_t is_rms = 0x10013;
+const op_attr_t is_view = 0x10014;
 
 // int64_t
 const op_attr_t partition_id = 0x10100;
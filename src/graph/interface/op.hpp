@@ -324,11 +324,16 @@ public:
             CASE(max);
             CASE(min);
             CASE(momentum);
+            CASE(temperature);
+            CASE(pad_value);
             CASE(scales);
             CASE(axis);
             CASE(begin_norm_axis);
             CASE(groups);
+            CASE(k);
             CASE(group_shape);
+            CASE(starts);
+            CASE(ends);
             CASE(axes);
             CASE(dilations);
             CASE(weights_shape);
@@ -396,6 +401,7 @@ public:
             CASE(qk_acc_mode);
             CASE(vs_acc_mode);
             CASE(is_rms);
+            CASE(is_view);
             CASE(with_dropout);
             default: return "undefined_attr";
         }
@@ -434,6 +440,7 @@ public:
             CASE(DynamicQuantize);
             CASE(Elu);
             CASE(EluBackward);
+            CASE(EmbeddingBag);
             CASE(End);
             CASE(Exp);
             CASE(GELU);
@@ -461,6 +468,7 @@ public:
             CASE(Mish);
             CASE(MishBackward);
             CASE(Multiply);
+            CASE(Pad);
             CASE(Pow);
             CASE(PReLU);
             CASE(PReLUBackward);
@@ -478,13 +486,16 @@ public:
             CASE(Reorder);
             CASE(Round);
             CASE(RMSNorm);
+            CASE(RoPE);
             CASE(Select);
             CASE(Sigmoid);
             CASE(SigmoidBackward);
+            CASE(Slice);
             CASE(SoftMax);
             CASE(SoftMaxBackward);
             CASE(SoftPlus);
             CASE(SoftPlusBackward);
+            CASE(Split);
             CASE(Sqrt);
             CASE(SqrtBackward);
             CASE(Square);
@@ -494,6 +505,7 @@ public:
             CASE(Subtract);
             CASE(Tanh);
             CASE(TanhBackward);
+            CASE(TopK);
             CASE(TypeCast);
             CASE(Wildcard);
             CASE(LastSymbol);
@@ -548,6 +560,11 @@ public:
             CASE(_dropout);
             CASE(_gated_mlp);
             CASE(_sdpa_bwd);
+            CASE(_embedding_bag);
+            CASE(_rope);
+            CASE(_topk);
+            CASE(_slice);
+            CASE(_pad);
             default: return "undefined_op";
         }
 #undef CASE
@@ -421,6 +421,24 @@ DNNL_GRAPH_OP_SCHEMA(EluBackward, 1,
                         "T", {data_type::f32, data_type::bf16, data_type::f16})
                 .set_shape_inference_function(infer_identity_output_shape))
 
+DNNL_GRAPH_OP_SCHEMA(EmbeddingBag, 1,
+        op_schema_t()
+                .set_inputs_option(op_schema_t::param_num_option::optional)
+                .set_num_inputs(std::set<size_t>({3, 4}))
+                .set_num_outputs(1)
+                .set_input(0, "src", "T1")
+                .set_input(1, "indices", "T2")
+                .set_input(2, "offsets", "T2")
+                .set_input(3, "per_sample_weights", "T3")
+                .set_output(0, "dst", "T1")
+                .set_attr(op_attr::mode, false, attribute_kind::s, "sum",
+                        {"sum", "mean", "max"})
+                .set_type_constraints(
+                        "T1", {data_type::f32, data_type::bf16, data_type::f16})
+                .set_type_constraints("T2", {data_type::s32})
+                .set_type_constraints("T3", {data_type::f32})
+                .set_shape_inference_function(infer_embedding_bag_output_shape))
+
 DNNL_GRAPH_OP_SCHEMA(End, 1,
         op_schema_t()
                 .set_num_inputs(1)
@@ -1374,6 +1392,86 @@ DNNL_GRAPH_OP_SCHEMA(RMSNorm, 1,
                 .set_shape_inference_function(infer_norm_output_shape)
                 .set_op_def_constraint_function(check_norm_data_type))
 
+DNNL_GRAPH_OP_SCHEMA(RoPE, 1,
+        op_schema_t()
+                .set_inputs_option(op_schema_t::param_num_option::optional)
+                .set_num_inputs(std::set<size_t>({3, 4}))
+                .set_num_outputs(1)
+                .set_input(0, "src", "T1")
+                .set_input(1, "cos", "T2")
+                .set_input(2, "sin", "T2")
+                .set_input(3, "position_ids", "T3")
+                .set_output(0, "dst", "T1")
+                .set_attr(op_attr::mode, false, attribute_kind::s, "half",
+                        {"half", "interleaved"})
+                .set_type_constraints(
+                        "T1", {data_type::f32, data_type::bf16, data_type::f16})
+                .set_type_constraints("T2", {data_type::f32})
+                .set_type_constraints("T3", {data_type::s32})
+                .set_shape_inference_function(infer_rope_output_shape))
+
+DNNL_GRAPH_OP_SCHEMA(TopK, 1,
+        op_schema_t()
+                .set_num_inputs(1)
+                .set_num_outputs(2)
+                .set_input(0, "src", "T1")
+                .set_output(0, "values", "T2")
+                .set_output(1, "indices", "T3")
+                .set_attr(op_attr::k, true, attribute_kind::i)
+                .set_attr(op_attr::axis, false, attribute_kind::i, int64_t(-1))
+                .set_attr(op_attr::mode, false, attribute_kind::s, "none",
+                        {"none", "softmax"})
+                .set_attr(op_attr::temperature, false, attribute_kind::f, 1.f)
+                .set_type_constraints(
+                        "T1", {data_type::f32, data_type::bf16, data_type::f16})
+                .set_type_constraints(
+                        "T2", {data_type::f32, data_type::bf16, data_type::f16})
+                .set_type_constraints("T3", {data_type::s32})
+                .set_shape_inference_function(infer_topk_output_shape))
+
+DNNL_GRAPH_OP_SCHEMA(Slice, 1,
+        op_schema_t()
+                .set_num_inputs(1)
+                .set_num_outputs(1)
+                .set_input(0, "src", "T")
+                .set_output(0, "dst", "T")
+                .set_attr(op_attr::starts, true, attribute_kind::is)
+                .set_attr(op_attr::ends, true, attribute_kind::is)
+                .set_attr(op_attr::axes, false, attribute_kind::is,
+                        std::vector<int64_t>())
+                .set_type_constraints("T",
+                        {data_type::f32, data_type::bf16, data_type::f16,
+                                data_type::s8, data_type::u8})
+                .set_shape_inference_function(infer_slice_output_shape))
+
+DNNL_GRAPH_OP_SCHEMA(Split, 1,
+        op_schema_t()
+                .set_num_inputs(1)
+                .set_outputs_option(op_schema_t::param_num_option::variadic)
+                .set_num_outputs(std::set<size_t>({1, 64}))
+                .set_input(0, "src", "T")
+                .set_output(0, "dst_i", "T")
+                .set_attr(op_attr::axis, true, attribute_kind::i)
+                .set_attr(op_attr::sizes, true, attribute_kind::is)
+                .set_type_constraints("T",
+                        {data_type::f32, data_type::bf16, data_type::f16,
+                                data_type::s8, data_type::u8})
+                .set_shape_inference_function(infer_split_output_shape))
+
+DNNL_GRAPH_OP_SCHEMA(Pad, 1,
+        op_schema_t()
+                .set_num_inputs(1)
+                .set_num_outputs(1)
+                .set_input(0, "src", "T")
+                .set_output(0, "dst", "T")
+                .set_attr(op_attr::pads_begin, true, attribute_kind::is)
+                .set_attr(op_attr::pads_end, true, attribute_kind::is)
+                .set_attr(op_attr::pad_value, false, attribute_kind::f, 0.f)
+                .set_type_constraints("T",
+                        {data_type::f32, data_type::bf16, data_type::f16,
+                                data_type::s8, data_type::u8})
+                .set_shape_inference_function(infer_pad_output_shape))
+
 // Definitions of internal ops
 #define SET_ATTR_IS_CONSTANT \
     set_attr(op_attr::is_constant, false, attribute_kind::b, false)
@@ -2398,6 +2496,87 @@ DNNL_GRAPH_OP_SCHEMA(_gated_mlp, 1,
                 .set_attr(op_attr::alg_kind, true, attribute_kind::i)
                 .set_shape_inference_function(infer_gated_mlp_output_shape))
 
+DNNL_GRAPH_OP_SCHEMA(_embedding_bag, 1,
+        op_schema_t()
+                .set_inputs_option(op_schema_t::param_num_option::optional)
+                .set_num_inputs(std::set<size_t>({3, 4, 5, 6}))
+                .set_num_outputs(2)
+                .set_input(0, "src")
+                .set_input(1, "indices")
+                .set_input(2, "offsets")
+                // optional per-sample weights followed by the fused table
+                // scales and zero-points
+                .set_input(3, "per_sample_weights")
+                .set_output(0, "dst")
+                .set_output(1, "scratchpad")
+                // Attributes inherited from front EmbeddingBag ops
+                .set_attr(op_attr::mode, false, attribute_kind::s, "sum",
+                        {"sum", "mean", "max"})
+                .set_shape_inference_function(infer_embedding_bag_output_shape))
+
+DNNL_GRAPH_OP_SCHEMA(_rope, 1,
+        op_schema_t()
+                .set_inputs_option(op_schema_t::param_num_option::optional)
+                .set_num_inputs(std::set<size_t>({3, 4}))
+                .set_num_outputs(2)
+                .set_input(0, "src")
+                .set_input(1, "cos")
+                .set_input(2, "sin")
+                .set_input(3, "position_ids")
+                .set_output(0, "dst")
+                .set_output(1, "scratchpad")
+                // Attributes inherited from front RoPE ops
+                .set_attr(op_attr::mode, false, attribute_kind::s, "half",
+                        {"half", "interleaved"})
+                .set_shape_inference_function(infer_rope_output_shape))
+
+DNNL_GRAPH_OP_SCHEMA(_topk, 1,
+        op_schema_t()
+                .set_num_inputs(1)
+                .set_num_outputs(3)
+                .set_input(0, "src")
+                .set_output(0, "values")
+                .set_output(1, "indices")
+                .set_output(2, "scratchpad")
+                // Attributes inherited from front TopK ops
+                .set_attr(op_attr::k, true, attribute_kind::i)
+                .set_attr(op_attr::axis, false, attribute_kind::i, int64_t(-1))
+                .set_attr(op_attr::mode, false, attribute_kind::s, "none",
+                        {"none", "softmax"})
+                .set_attr(op_attr::temperature, false, attribute_kind::f, 1.f)
+                .set_shape_inference_function(infer_topk_output_shape))
+
+// Split ops are lowered to one _slice per output. The is_view attribute is set
+// by memory planning when the output can share the buffer of the input.
+DNNL_GRAPH_OP_SCHEMA(_slice, 1,
+        op_schema_t()
+                .set_num_inputs(1)
+                .set_num_outputs(1)
+                .set_input(0, "src")
+                .set_output(0, "dst")
+                // Attributes inherited from front Slice ops
+                .set_attr(op_attr::starts, true, attribute_kind::is)
+                .set_attr(op_attr::ends, true, attribute_kind::is)
+                .set_attr(op_attr::axes, false, attribute_kind::is,
+                        std::vector<int64_t>())
+                // Attributes set by memory planning
+                .set_attr(op_attr::is_view, false, attribute_kind::b, false)
+                .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                .set_shape_inference_function(infer_slice_output_shape))
+
+DNNL_GRAPH_OP_SCHEMA(_pad, 1,
+        op_schema_t()
+                .set_num_inputs(1)
+                .set_num_outputs(1)
+                .set_input(0, "src")
+                .set_output(0, "dst")
+                // Attributes inherited from front Pad ops
+                .set_attr(op_attr::pads_begin, true, attribute_kind::is)
+                .set_attr(op_attr::pads_end, true, attribute_kind::is)
+                .set_attr(op_attr::pad_value, false, attribute_kind::f, 0.f)
+                .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                .set_shape_inference_function(infer_pad_output_shape))
+
 // Backward op for SDPA
 DNNL_GRAPH_OP_SCHEMA(_sdpa_bwd, 1,
         op_schema_t()
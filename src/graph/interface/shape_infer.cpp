@@ -1820,6 +1820,283 @@ status_t infer_groupnorm_output_shape(op_t *n,
     return status::success;
 }
 
+status_t infer_embedding_bag_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto table = logical_tensor_wrapper_t(inputs[0]);
+    auto indices = logical_tensor_wrapper_t(inputs[1]);
+    auto offsets = logical_tensor_wrapper_t(inputs[2]);
+    auto out0 = logical_tensor_wrapper_t(outputs[0]);
+
+    VCHECK_INVALID_SHAPE(table.ndims() == 2,
+            "%s, only support 2D embedding table, but got table dim: %d",
+            op_t::kind2str(n->get_kind()).c_str(), table.ndims());
+    VCHECK_INVALID_SHAPE(indices.ndims() == 1 && offsets.ndims() == 1,
+            "%s, indices and offsets should be 1D, but got indices dim: %d, "
+            "offsets dim: %d",
+            op_t::kind2str(n->get_kind()).c_str(), indices.ndims(),
+            offsets.ndims());
+    // The internal op may also carry fused table scales and zero-points, the
+    // per-sample weights are validated on the frontend op.
+    if (n->get_kind() == op_kind::EmbeddingBag && inputs.size() > 3) {
+        auto weights = logical_tensor_wrapper_t(inputs[3]);
+        VCHECK_INVALID_SHAPE(validate(indices.vdims(), weights.vdims()),
+                "%s, per-sample weights should have the same shape as "
+                "indices, but got indices shape: %s, weights shape: %s",
+                op_t::kind2str(n->get_kind()).c_str(),
+                dims2str(indices.vdims()).c_str(),
+                dims2str(weights.vdims()).c_str());
+    }
+
+    // output_dims[num_bags, embedding_dim]
+    const dims inferred = {offsets.vdims()[0], table.vdims()[1]};
+    if (!out0.is_shape_unknown()) {
+        VCHECK_INVALID_SHAPE(validate(inferred, out0.vdims()),
+                "%s, inferred out shape is not compatible with the given "
+                "output shape",
+                op_t::kind2str(n->get_kind()).c_str());
+    }
+    set_shape_and_strides(*outputs[0], inferred);
+
+    return status::success;
+}
+
+status_t infer_rope_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto in0 = logical_tensor_wrapper_t(inputs[0]);
+    auto cos = logical_tensor_wrapper_t(inputs[1]);
+    auto sin = logical_tensor_wrapper_t(inputs[2]);
+
+    VCHECK_INVALID_SHAPE(in0.ndims() >= 2,
+            "%s, src should be at least 2D, but got src dim: %d",
+            op_t::kind2str(n->get_kind()).c_str(), in0.ndims());
+    const dim_t head_size = in0.vdims().back();
+    VCHECK_INVALID_SHAPE(head_size % 2 == 0,
+            "%s, the innermost dimension of src should be even, but got %s",
+            op_t::kind2str(n->get_kind()).c_str(),
+            std::to_string(head_size).c_str());
+    // cos and sin tables hold one angle per rotated pair and position.
+    VCHECK_INVALID_SHAPE(cos.ndims() == 2 && validate(cos.vdims(), sin.vdims())
+                    && cos.vdims()[1] == head_size / 2,
+            "%s, cos and sin should be [max_positions, %s], but got cos shape: "
+            "%s, sin shape: %s",
+            op_t::kind2str(n->get_kind()).c_str(),
+            std::to_string(head_size / 2).c_str(),
+            dims2str(cos.vdims()).c_str(), dims2str(sin.vdims()).c_str());
+    if (inputs.size() > 3) {
+        auto pos = logical_tensor_wrapper_t(inputs[3]);
+        VCHECK_INVALID_SHAPE(pos.ndims() == in0.ndims() - 1,
+                "%s, position ids should cover all src dimensions but the "
+                "innermost one, but got position ids dim: %d",
+                op_t::kind2str(n->get_kind()).c_str(), pos.ndims());
+    }
+
+    return infer_identity_output_shape(n, inputs, outputs);
+}
+
+status_t infer_topk_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto in0 = logical_tensor_wrapper_t(inputs[0]);
+    auto out0 = logical_tensor_wrapper_t(outputs[0]);
+    auto out1 = logical_tensor_wrapper_t(outputs[1]);
+
+    const int32_t ndims = in0.ndims();
+    VCHECK_INVALID_SHAPE(ndims >= 1,
+            "%s, src should be at least 1D, but got src dim: %d",
+            op_t::kind2str(n->get_kind()).c_str(), ndims);
+    int64_t axis = n->has_attr(op_attr::axis)
+            ? n->get_attr<int64_t>(op_attr::axis)
+            : -1;
+    if (axis < 0) axis += ndims;
+    VCHECK_INVALID_SHAPE(axis == ndims - 1,
+            "%s, only the innermost axis is supported, but got axis: %s",
+            op_t::kind2str(n->get_kind()).c_str(),
+            std::to_string(axis).c_str());
+    const int64_t k = n->get_attr<int64_t>(op_attr::k);
+    VCHECK_INVALID_SHAPE(k >= 1 && k <= in0.vdims().back(),
+            "%s, k should be in the range [1, %s], but got k: %s",
+            op_t::kind2str(n->get_kind()).c_str(),
+            std::to_string(in0.vdims().back()).c_str(),
+            std::to_string(k).c_str());
+
+    // values and indices: [..., k]
+    dims inferred = in0.vdims();
+    inferred.back() = k;
+    for (auto *out : {&out0, &out1}) {
+        if (out->is_shape_unknown()) continue;
+        VCHECK_INVALID_SHAPE(validate(inferred, out->vdims()),
+                "%s, inferred out shape is not compatible with the given "
+                "output shape",
+                op_t::kind2str(n->get_kind()).c_str());
+    }
+    set_shape_and_strides(*outputs[0], inferred);
+    set_shape_and_strides(*outputs[1], inferred);
+
+    return status::success;
+}
+
+status_t get_slice_region(
+        const op_t *n, const dims &src_dims, dims &offsets, dims &sizes) {
+    const auto &starts = n->get_attr<std::vector<int64_t>>(op_attr::starts);
+    const auto &ends = n->get_attr<std::vector<int64_t>>(op_attr::ends);
+    const auto ndims = static_cast<int64_t>(src_dims.size());
+
+    std::vector<int64_t> axes;
+    if (n->has_attr(op_attr::axes))
+        axes = n->get_attr<std::vector<int64_t>>(op_attr::axes);
+    // by default, starts and ends are applied to the leading dimensions
+    if (axes.empty()) {
+        axes.resize(starts.size());
+        for (size_t i = 0; i < axes.size(); ++i)
+            axes[i] = static_cast<int64_t>(i);
+    }
+    VCHECK_INVALID_SHAPE(
+            starts.size() == ends.size() && starts.size() == axes.size(),
+            "%s, starts, ends and axes should have the same size, but got "
+            "%zu, %zu and %zu",
+            op_t::kind2str(n->get_kind()).c_str(), starts.size(), ends.size(),
+            axes.size());
+
+    offsets.assign(src_dims.size(), 0);
+    sizes = src_dims;
+    std::vector<bool> sliced(src_dims.size(), false);
+    for (size_t i = 0; i < axes.size(); ++i) {
+        int64_t axis = axes[i];
+        VCHECK_INVALID_SHAPE(axis >= -ndims && axis < ndims,
+                "%s, axis should be in range [-%s, %s), but got %s",
+                op_t::kind2str(n->get_kind()).c_str(),
+                std::to_string(ndims).c_str(), std::to_string(ndims).c_str(),
+                std::to_string(axis).c_str());
+        if (axis < 0) axis += ndims;
+        VCHECK_INVALID_SHAPE(!sliced[axis], "%s, axis %s is sliced twice",
+                op_t::kind2str(n->get_kind()).c_str(),
+                std::to_string(axis).c_str());
+        sliced[axis] = true;
+
+        // negative positions count from the end of the dimension, and out of
+        // range positions are clamped to the dimension
+        const dim_t dim = src_dims[axis];
+        const auto clamp = [dim](int64_t pos) {
+            if (pos < 0) pos += dim;
+            return std::min(std::max(pos, int64_t(0)), dim);
+        };
+        const int64_t begin = clamp(starts[i]);
+        const int64_t end = clamp(ends[i]);
+        offsets[axis] = begin;
+        sizes[axis] = std::max(end - begin, int64_t(0));
+    }
+
+    return status::success;
+}
+
+status_t infer_slice_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto in0 = logical_tensor_wrapper_t(inputs[0]);
+    auto out0 = logical_tensor_wrapper_t(outputs[0]);
+
+    dims offsets, inferred;
+    CHECK(get_slice_region(n, in0.vdims(), offsets, inferred));
+
+    if (!out0.is_shape_unknown()) {
+        VCHECK_INVALID_SHAPE(validate(inferred, out0.vdims()),
+                "%s, inferred out shape is not compatible with the given "
+                "output shape",
+                op_t::kind2str(n->get_kind()).c_str());
+        return status::success;
+    }
+    set_shape_and_strides(*outputs[0], inferred);
+
+    return status::success;
+}
+
+status_t infer_split_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto in0 = logical_tensor_wrapper_t(inputs[0]);
+    const int32_t ndims = in0.ndims();
+
+    int64_t axis = n->get_attr<int64_t>(op_attr::axis);
+    VCHECK_INVALID_SHAPE(axis >= -ndims && axis < ndims,
+            "%s, axis should be in range [-%d, %d), but got %s",
+            op_t::kind2str(n->get_kind()).c_str(), ndims, ndims,
+            std::to_string(axis).c_str());
+    if (axis < 0) axis += ndims;
+
+    const auto &sizes = n->get_attr<std::vector<int64_t>>(op_attr::sizes);
+    VCHECK_INVALID_SHAPE(sizes.size() == outputs.size(),
+            "%s, the number of sizes should be equal to the number of "
+            "outputs, but got %zu sizes and %zu outputs",
+            op_t::kind2str(n->get_kind()).c_str(), sizes.size(),
+            outputs.size());
+    int64_t sum = 0;
+    for (const auto size : sizes) {
+        VCHECK_INVALID_SHAPE(size >= 0, "%s, sizes should be non-negative",
+                op_t::kind2str(n->get_kind()).c_str());
+        sum += size;
+    }
+    VCHECK_INVALID_SHAPE(sum == in0.vdims()[axis],
+            "%s, sizes should add up to the src dim on axis: %s, but got %s",
+            op_t::kind2str(n->get_kind()).c_str(),
+            std::to_string(in0.vdims()[axis]).c_str(),
+            std::to_string(sum).c_str());
+
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        dims inferred = in0.vdims();
+        inferred[axis] = sizes[i];
+        auto out = logical_tensor_wrapper_t(outputs[i]);
+        if (!out.is_shape_unknown()) {
+            VCHECK_INVALID_SHAPE(validate(inferred, out.vdims()),
+                    "%s, inferred out shape is not compatible with the given "
+                    "shape of output %zu",
+                    op_t::kind2str(n->get_kind()).c_str(), i);
+            continue;
+        }
+        set_shape_and_strides(*outputs[i], inferred);
+    }
+
+    return status::success;
+}
+
+status_t infer_pad_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto in0 = logical_tensor_wrapper_t(inputs[0]);
+    auto out0 = logical_tensor_wrapper_t(outputs[0]);
+
+    const auto &pads_begin
+            = n->get_attr<std::vector<int64_t>>(op_attr::pads_begin);
+    const auto &pads_end = n->get_attr<std::vector<int64_t>>(op_attr::pads_end);
+    const auto ndims = static_cast<size_t>(in0.ndims());
+    VCHECK_INVALID_SHAPE(
+            pads_begin.size() == ndims && pads_end.size() == ndims,
+            "%s, pads_begin and pads_end should have %zu elements, but got "
+            "%zu and %zu",
+            op_t::kind2str(n->get_kind()).c_str(), ndims, pads_begin.size(),
+            pads_end.size());
+
+    dims inferred = in0.vdims();
+    for (size_t i = 0; i < ndims; ++i) {
+        VCHECK_INVALID_SHAPE(pads_begin[i] >= 0 && pads_end[i] >= 0,
+                "%s, pads should be non-negative",
+                op_t::kind2str(n->get_kind()).c_str());
+        inferred[i] += pads_begin[i] + pads_end[i];
+    }
+
+    if (!out0.is_shape_unknown()) {
+        VCHECK_INVALID_SHAPE(validate(inferred, out0.vdims()),
+                "%s, inferred out shape is not compatible with the given "
+                "output shape",
+                op_t::kind2str(n->get_kind()).c_str());
+        return status::success;
+    }
+    set_shape_and_strides(*outputs[0], inferred);
+
+    return status::success;
+}
+
 using ltw = logical_tensor_wrapper_t;
 
 static status_t infer_dnnl_conv_common_bwd_weight_output_shape(op_t *n,
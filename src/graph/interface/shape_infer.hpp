@@ -78,6 +78,11 @@ std::string dims2str(const dims &dims);
 
 status_t one_way_broadcast(const dims &lhs, const dims &rhs);
 
+/// get the offsets and the sizes of the sub-tensor selected by a slice op from
+/// a tensor with src_dims
+status_t get_slice_region(
+        const op_t *n, const dims &src_dims, dims &offsets, dims &sizes);
+
 /// This function assumes the size of all vectors are correct. Eg. size of
 /// strides/dilations/pads should be the same as spatial size of src_dims and
 /// fil_dims. Size of output_dims should be the same as size of src_dims.
@@ -219,6 +224,30 @@ status_t infer_groupnorm_output_shape(op_t *n,
         std::vector<logical_tensor_t *> &inputs,
         std::vector<logical_tensor_t *> &outputs);
 
+status_t infer_embedding_bag_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs);
+
+status_t infer_rope_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs);
+
+status_t infer_topk_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs);
+
+status_t infer_slice_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs);
+
+status_t infer_split_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs);
+
+status_t infer_pad_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs);
+
 status_t infer_dummy_output_shape(op_t *n,
         std::vector<logical_tensor_t *> &inputs,
         std::vector<logical_tensor_t *> &outputs);
@@ -405,6 +405,8 @@ dnnl::graph::op::attr attrstr2kind(const std::string &attr_name) {
             {"max", dnnl::graph::op::attr::max},
             {"min", dnnl::graph::op::attr::min},
             {"momentum", dnnl::graph::op::attr::momentum},
+            {"temperature", dnnl::graph::op::attr::temperature},
+            {"pad_value", dnnl::graph::op::attr::pad_value},
             // float32 vector attributes. The value of these attributes can be a
             // vector of float32 numbers.
             {"scales", dnnl::graph::op::attr::scales},
@@ -413,6 +415,7 @@ dnnl::graph::op::attr attrstr2kind(const std::string &attr_name) {
             {"axis", dnnl::graph::op::attr::axis},
             {"begin_norm_axis", dnnl::graph::op::attr::begin_norm_axis},
             {"groups", dnnl::graph::op::attr::groups},
+            {"k", dnnl::graph::op::attr::k},
             {"group_shape", dnnl::graph::op::attr::group_shape},
             // int64_t vector attributes. The value of these attributes can be a
             // vector of int64 numbers.
@@ -430,6 +433,8 @@ dnnl::graph::op::attr attrstr2kind(const std::string &attr_name) {
             {"sizes", dnnl::graph::op::attr::sizes},
             {"strides", dnnl::graph::op::attr::strides},
             {"zps", dnnl::graph::op::attr::zps},
+            {"starts", dnnl::graph::op::attr::starts},
+            {"ends", dnnl::graph::op::attr::ends},
             // bool attributes. The value of these attributes can be any single bool
             // value.
             {"exclude_pad", dnnl::graph::op::attr::exclude_pad},
@@ -118,6 +118,12 @@ TEST(APIOp, CreateAllOps) {
             op::kind::GreaterEqual,
             op::kind::RMSNorm,
             op::kind::Dropout,
+            op::kind::EmbeddingBag,
+            op::kind::RoPE,
+            op::kind::TopK,
+            op::kind::Slice,
+            op::kind::Split,
+            op::kind::Pad,
     };
     // clang-format on
 
@@ -0,0 +1,231 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl_graph.hpp"
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+#include "graph/unit/utils.hpp"
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+using dim_t = dnnl_dim_t;
+using dims = std::vector<dim_t>;
+
+static inline void custom_setenv(
+        const char *name, const char *value, int overwrite) {
+#ifdef _WIN32
+    SetEnvironmentVariable(name, value);
+#else
+    ::setenv(name, value, overwrite);
+#endif
+}
+
+namespace {
+
+// Adds an NXC convolution with bias to the graph
+void add_conv(graph::graph_t &g, size_t &id, graph::logical_tensor_t &src,
+        graph::logical_tensor_t &dst, const dims &wei_shape,
+        const std::string &wei_format, int64_t groups, dim_t stride,
+        dim_t pad) {
+    graph::op_t conv(id++, graph::op_kind::Convolution, "conv");
+    conv.set_attr<dims>(graph::op_attr::strides, dims {stride, stride});
+    conv.set_attr<dims>(graph::op_attr::dilations, dims {1, 1});
+    conv.set_attr<dims>(graph::op_attr::pads_begin, dims {pad, pad});
+    conv.set_attr<dims>(graph::op_attr::pads_end, dims {pad, pad});
+    conv.set_attr<int64_t>(graph::op_attr::groups, groups);
+    conv.set_attr<std::string>(graph::op_attr::data_format, "NXC");
+    conv.set_attr<std::string>(graph::op_attr::weights_format, wei_format);
+
+    const dim_t oc = wei_format == "OIX" ? wei_shape[0] : wei_shape[3];
+    auto wei = utils::logical_tensor_init(
+            id++, wei_shape, graph::data_type::f32);
+    auto bia = utils::logical_tensor_init(id++, {oc}, graph::data_type::f32);
+    conv.add_input(src);
+    conv.add_input(wei);
+    conv.add_input(bia);
+    conv.add_output(dst);
+    ASSERT_EQ(g.add_op(&conv), graph::status::success);
+}
+
+void add_eltwise(graph::graph_t &g, size_t &id, graph::op_kind_t kind,
+        graph::logical_tensor_t &src, graph::logical_tensor_t &dst) {
+    graph::op_t op(id++, kind, "eltwise");
+    if (kind == graph::op_kind::Clamp) {
+        op.set_attr<float>(graph::op_attr::min, 0.f);
+        op.set_attr<float>(graph::op_attr::max, 6.f);
+    }
+    op.add_input(src);
+    op.add_output(dst);
+    ASSERT_EQ(g.add_op(&op), graph::status::success);
+}
+
+void add_add(graph::graph_t &g, size_t &id, graph::logical_tensor_t &src0,
+        graph::logical_tensor_t &src1, graph::logical_tensor_t &dst) {
+    graph::op_t add(id++, graph::op_kind::Add, "add");
+    add.add_input(src0);
+    add.add_input(src1);
+    add.add_output(dst);
+    ASSERT_EQ(g.add_op(&add), graph::status::success);
+}
+
+// The tiled kernel needs a band of output rows for every thread, each image
+// provides at least one
+dim_t get_mb() {
+    return std::max<dim_t>(4, dnnl_get_current_num_threads());
+}
+
+// Compiles and executes the single partition of the graph, with the tiled
+// kernel or with the regular larger partition kernel
+std::vector<float> run_partition(graph::graph_t &g, bool force_primitive) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    auto part = g.get_partitions()[0];
+    graph::partition_t p;
+    p.init(part);
+
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs)
+        inputs.emplace_back(&lt);
+    for (auto &lt : partition_outputs) {
+        lt = utils::logical_tensor_init(
+                lt.id, lt.data_type, graph::layout_type::any);
+        outputs.emplace_back(&lt);
+    }
+
+    custom_setenv("_ONEDNN_GRAPH_CONV_BLOCK_FORCE_PRIMITIVE",
+            force_primitive ? "1" : "0", 1);
+    graph::compiled_partition_t cp(p);
+    EXPECT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+    EXPECT_EQ(cp.get_pimpl()->str(),
+            force_primitive ? "larger_partition_kernel_t"
+                            : "conv_block_decomp_kernel_t");
+
+    std::vector<test_tensor_t> inputs_ts, outputs_ts;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        inputs_ts.emplace_back(*inputs[i], eng);
+        // The fill is deterministic, both runs get the same inputs
+        inputs_ts.back().fill<float>(
+                0.f, 1.f / static_cast<float>(i + 1), 1.);
+    }
+    graph::logical_tensor_t compiled_output;
+    cp.query_logical_tensor(outputs[0]->id, &compiled_output);
+    outputs_ts.emplace_back(compiled_output, eng);
+
+    EXPECT_EQ(cp.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                      test_tensor_t::to_graph_tensor(outputs_ts)),
+            graph::status::success);
+    strm->wait();
+    return outputs_ts[0].as_vec_type<float>();
+}
+
+} // namespace
+
+TEST(test_conv_block_decomp_execute, F32InvertedResidualBlock_CPU) {
+    graph::engine_t *eng = get_engine();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    const dim_t mb = get_mb(), h = 28, w = 28, c = 16, expand = 64;
+    for (dim_t stride : {1, 2}) {
+        graph::graph_t g(eng->kind());
+        size_t id = 0;
+        const dim_t oh = h / stride, ow = w / stride;
+        auto src = utils::logical_tensor_init(
+                id++, {mb, h, w, c}, graph::data_type::f32);
+        auto dst0 = utils::logical_tensor_init(
+                id++, {mb, h, w, expand}, graph::data_type::f32);
+        auto act0 = utils::logical_tensor_init(
+                id++, {mb, h, w, expand}, graph::data_type::f32);
+        auto dst1 = utils::logical_tensor_init(
+                id++, {mb, oh, ow, expand}, graph::data_type::f32);
+        auto act1 = utils::logical_tensor_init(
+                id++, {mb, oh, ow, expand}, graph::data_type::f32);
+        auto dst2 = utils::logical_tensor_init(
+                id++, {mb, oh, ow, c}, graph::data_type::f32);
+        auto residual = utils::logical_tensor_init(
+                id++, {mb, oh, ow, c}, graph::data_type::f32);
+        auto dst = utils::logical_tensor_init(
+                id++, {mb, oh, ow, c}, graph::data_type::f32);
+
+        add_conv(g, id, src, dst0, {expand, c, 1, 1}, "OIX", 1, 1, 0);
+        add_eltwise(g, id, graph::op_kind::ReLU, dst0, act0);
+        add_conv(g, id, act0, dst1, {expand, 1, 3, 3}, "OIX", expand, stride,
+                1);
+        add_eltwise(g, id, graph::op_kind::Clamp, dst1, act1);
+        add_conv(g, id, act1, dst2, {c, expand, 1, 1}, "OIX", 1, 1, 0);
+        add_add(g, id, dst2, stride == 1 ? src : residual, dst);
+        g.finalize();
+
+        graph::pass::pass_base_ptr apass
+                = get_pass("fp_inverted_residual_block_fusion_cpu");
+        apass->run(g);
+        ASSERT_EQ(g.get_num_partitions(), 1U);
+
+        const auto ref = run_partition(g, true);
+        const auto out = run_partition(g, false);
+        ASSERT_TRUE(allclose(out, ref, 1e-4f, 1e-4f));
+    }
+}
+
+TEST(test_conv_block_decomp_execute, F32BasicResblock_CPU) {
+    graph::engine_t *eng = get_engine();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    const dim_t mb = get_mb(), h = 30, w = 17, c = 32;
+    graph::graph_t g(eng->kind());
+    size_t id = 0;
+    auto src = utils::logical_tensor_init(
+            id++, {mb, h, w, c}, graph::data_type::f32);
+    auto dst0 = utils::logical_tensor_init(
+            id++, {mb, h, w, c}, graph::data_type::f32);
+    auto act0 = utils::logical_tensor_init(
+            id++, {mb, h, w, c}, graph::data_type::f32);
+    auto dst1 = utils::logical_tensor_init(
+            id++, {mb, h, w, c}, graph::data_type::f32);
+    auto sum = utils::logical_tensor_init(
+            id++, {mb, h, w, c}, graph::data_type::f32);
+    auto dst = utils::logical_tensor_init(
+            id++, {mb, h, w, c}, graph::data_type::f32);
+
+    add_conv(g, id, src, dst0, {3, 3, c, c}, "XIO", 1, 1, 1);
+    add_eltwise(g, id, graph::op_kind::ReLU, dst0, act0);
+    add_conv(g, id, act0, dst1, {3, 3, c, c}, "XIO", 1, 1, 1);
+    add_add(g, id, dst1, src, sum);
+    add_eltwise(g, id, graph::op_kind::ReLU, sum, dst);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass
+            = get_pass("fp_identical_basic_resblock_fusion_cpu");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+
+    const auto ref = run_partition(g, true);
+    const auto out = run_partition(g, false);
+    ASSERT_TRUE(allclose(out, ref, 1e-4f, 1e-4f));
+}
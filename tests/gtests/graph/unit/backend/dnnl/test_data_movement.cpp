@@ -0,0 +1,351 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+
+TEST(test_data_movement_execute, Slice) {
+    graph::engine_t *engine = get_engine();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu, "skip on gpu");
+
+    // Take [1:3, :, -3:] from a 4x2x5 tensor.
+    const int64_t D0 = 4, D1 = 2, D2 = 5;
+    std::vector<float> src(D0 * D1 * D2);
+    std::iota(src.begin(), src.end(), 0.f);
+    std::vector<float> dst(2 * D1 * 3, 0.f);
+
+    graph::op_t slice_op(0, graph::op_kind::Slice, "slice");
+    slice_op.set_attr<std::vector<int64_t>>(graph::op_attr::starts, {1, -3});
+    slice_op.set_attr<std::vector<int64_t>>(graph::op_attr::ends, {3, 100});
+    slice_op.set_attr<std::vector<int64_t>>(graph::op_attr::axes, {0, 2});
+
+    auto src_lt = utils::logical_tensor_init(
+            0, {D0, D1, D2}, graph::data_type::f32);
+    auto dst_lt
+            = utils::logical_tensor_init(1, {2, D1, 3}, graph::data_type::f32);
+    slice_op.add_input(src_lt);
+    slice_op.add_output(dst_lt);
+
+    graph::graph_t g(engine->kind());
+    ASSERT_EQ(g.add_op(&slice_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("slice_pass");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {&src_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, engine), graph::status::success);
+
+    graph::stream_t *stream = get_stream();
+    test_tensor_t src_ts(src_lt, engine, src);
+    test_tensor_t dst_ts(dst_lt, engine, dst);
+    ASSERT_EQ(cp.execute(stream, {src_ts.get()}, {dst_ts.get()}),
+            graph::status::success);
+    stream->wait();
+    dst = dst_ts.as_vec_type<float>();
+
+    size_t i = 0;
+    for (int64_t d0 = 1; d0 < 3; ++d0)
+        for (int64_t d1 = 0; d1 < D1; ++d1)
+            for (int64_t d2 = 2; d2 < D2; ++d2)
+                ASSERT_EQ(dst[i++], src[(d0 * D1 + d1) * D2 + d2]);
+}
+
+TEST(test_data_movement_execute, Split) {
+    graph::engine_t *engine = get_engine();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu, "skip on gpu");
+
+    const int64_t M = 3;
+    const std::vector<int64_t> sizes {2, 5, 1};
+    const int64_t N = 8;
+    std::vector<float> src(M * N);
+    std::iota(src.begin(), src.end(), 0.f);
+
+    graph::op_t split_op(0, graph::op_kind::Split, "split");
+    split_op.set_attr<int64_t>(graph::op_attr::axis, -1);
+    split_op.set_attr<std::vector<int64_t>>(graph::op_attr::sizes, sizes);
+
+    auto src_lt = utils::logical_tensor_init(0, {M, N}, graph::data_type::f32);
+    split_op.add_input(src_lt);
+    std::vector<graph::logical_tensor_t> dst_lts;
+    for (size_t i = 0; i < sizes.size(); ++i)
+        dst_lts.emplace_back(utils::logical_tensor_init(
+                i + 1, {M, sizes[i]}, graph::data_type::f32));
+    for (const auto &lt : dst_lts)
+        split_op.add_output(lt);
+
+    graph::graph_t g(engine->kind());
+    ASSERT_EQ(g.add_op(&split_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("split_pass");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {&src_lt};
+    std::vector<const graph::logical_tensor_t *> outputs;
+    for (const auto &lt : dst_lts)
+        outputs.emplace_back(&lt);
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, engine), graph::status::success);
+
+    graph::stream_t *stream = get_stream();
+    test_tensor_t src_ts(src_lt, engine, src);
+    std::vector<test_tensor_t> dst_ts;
+    for (const auto &lt : dst_lts)
+        dst_ts.emplace_back(lt, engine);
+    std::vector<graph::tensor_t> dst_tensors;
+    for (const auto &ts : dst_ts)
+        dst_tensors.emplace_back(ts.get());
+    ASSERT_EQ(cp.execute(stream, {src_ts.get()}, dst_tensors),
+            graph::status::success);
+    stream->wait();
+
+    int64_t start = 0;
+    for (size_t i = 0; i < sizes.size(); ++i) {
+        auto dst = dst_ts[i].as_vec_type<float>();
+        for (int64_t m = 0; m < M; ++m)
+            for (int64_t n = 0; n < sizes[i]; ++n)
+                ASSERT_EQ(dst[m * sizes[i] + n], src[m * N + start + n]);
+        start += sizes[i];
+    }
+}
+
+TEST(test_data_movement_execute, Pad) {
+    graph::engine_t *engine = get_engine();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu, "skip on gpu");
+
+    const int64_t H = 3, W = 4;
+    const std::vector<int64_t> pads_begin {1, 0}, pads_end {2, 3};
+    const int64_t OH = H + 3, OW = W + 3;
+    const float pad_value = -7.f;
+    std::vector<float> src(H * W);
+    std::iota(src.begin(), src.end(), 1.f);
+    std::vector<float> dst(OH * OW, 0.f);
+
+    graph::op_t pad_op(0, graph::op_kind::Pad, "pad");
+    pad_op.set_attr<std::vector<int64_t>>(
+            graph::op_attr::pads_begin, pads_begin);
+    pad_op.set_attr<std::vector<int64_t>>(graph::op_attr::pads_end, pads_end);
+    pad_op.set_attr<float>(graph::op_attr::pad_value, pad_value);
+
+    auto src_lt = utils::logical_tensor_init(0, {H, W}, graph::data_type::f32);
+    auto dst_lt
+            = utils::logical_tensor_init(1, {OH, OW}, graph::data_type::f32);
+    pad_op.add_input(src_lt);
+    pad_op.add_output(dst_lt);
+
+    graph::graph_t g(engine->kind());
+    ASSERT_EQ(g.add_op(&pad_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("pad_pass");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {&src_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, engine), graph::status::success);
+
+    graph::stream_t *stream = get_stream();
+    test_tensor_t src_ts(src_lt, engine, src);
+    test_tensor_t dst_ts(dst_lt, engine, dst);
+    ASSERT_EQ(cp.execute(stream, {src_ts.get()}, {dst_ts.get()}),
+            graph::status::success);
+    stream->wait();
+    dst = dst_ts.as_vec_type<float>();
+
+    for (int64_t oh = 0; oh < OH; ++oh)
+        for (int64_t ow = 0; ow < OW; ++ow) {
+            const int64_t h = oh - pads_begin[0], w = ow - pads_begin[1];
+            const bool inside = h >= 0 && h < H && w >= 0 && w < W;
+            ASSERT_EQ(dst[oh * OW + ow], inside ? src[h * W + w] : pad_value);
+        }
+}
+
+TEST(test_data_movement_execute, SliceMatmulFusion) {
+    graph::engine_t *engine = get_engine();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu, "skip on gpu");
+
+    // The matmul consumes the last K columns of the input in place.
+    const int64_t M = 4, FULL_K = 24, K = 16, N = 8;
+    std::vector<float> src(M * FULL_K), wei(K * N);
+    for (size_t i = 0; i < src.size(); ++i)
+        src[i] = 0.25f * static_cast<float>(static_cast<int>(i % 9) - 4);
+    for (size_t i = 0; i < wei.size(); ++i)
+        wei[i] = 0.5f * static_cast<float>(static_cast<int>(i % 5) - 2);
+    std::vector<float> dst(M * N, 0.f);
+
+    graph::op_t slice_op(0, graph::op_kind::Slice, "slice");
+    slice_op.set_attr<std::vector<int64_t>>(
+            graph::op_attr::starts, {FULL_K - K});
+    slice_op.set_attr<std::vector<int64_t>>(graph::op_attr::ends, {FULL_K});
+    slice_op.set_attr<std::vector<int64_t>>(graph::op_attr::axes, {1});
+    graph::op_t matmul_op(1, graph::op_kind::MatMul, "matmul");
+
+    auto src_lt
+            = utils::logical_tensor_init(0, {M, FULL_K}, graph::data_type::f32);
+    auto sliced_lt = utils::logical_tensor_init(1, {M, K},
+            graph::data_type::f32, graph::layout_type::any);
+    auto wei_lt = utils::logical_tensor_init(2, {K, N}, graph::data_type::f32);
+    auto dst_lt = utils::logical_tensor_init(3, {M, N}, graph::data_type::f32);
+
+    slice_op.add_input(src_lt);
+    slice_op.add_output(sliced_lt);
+    matmul_op.add_input(sliced_lt);
+    matmul_op.add_input(wei_lt);
+    matmul_op.add_output(dst_lt);
+
+    graph::graph_t g(engine->kind());
+    ASSERT_EQ(g.add_op(&slice_op), graph::status::success);
+    ASSERT_EQ(g.add_op(&matmul_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("float_slice_matmul");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+    ASSERT_EQ(part->get_ops().size(), 2U);
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {&src_lt, &wei_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, engine), graph::status::success);
+
+    graph::stream_t *stream = get_stream();
+    test_tensor_t src_ts(src_lt, engine, src);
+    test_tensor_t wei_ts(wei_lt, engine, wei);
+    test_tensor_t dst_ts(dst_lt, engine, dst);
+    ASSERT_EQ(cp.execute(stream, {src_ts.get(), wei_ts.get()}, {dst_ts.get()}),
+            graph::status::success);
+    stream->wait();
+    dst = dst_ts.as_vec_type<float>();
+
+    for (int64_t m = 0; m < M; ++m)
+        for (int64_t n = 0; n < N; ++n) {
+            float ref = 0.f;
+            for (int64_t k = 0; k < K; ++k)
+                ref += src[m * FULL_K + FULL_K - K + k] * wei[k * N + n];
+            ASSERT_NEAR(dst[m * N + n], ref, 1e-5f);
+        }
+}
+
+TEST(test_data_movement_execute, MatmulSplitFusion) {
+    graph::engine_t *engine = get_engine();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu, "skip on gpu");
+
+    // A fused query/key/value projection.
+    const int64_t M = 5, K = 8, H = 4;
+    std::vector<float> src(M * K), wei(K * 3 * H);
+    for (size_t i = 0; i < src.size(); ++i)
+        src[i] = 0.25f * static_cast<float>(static_cast<int>(i % 7) - 3);
+    for (size_t i = 0; i < wei.size(); ++i)
+        wei[i] = 0.5f * static_cast<float>(static_cast<int>(i % 5) - 2);
+
+    graph::op_t matmul_op(0, graph::op_kind::MatMul, "matmul");
+    graph::op_t split_op(1, graph::op_kind::Split, "split");
+    split_op.set_attr<int64_t>(graph::op_attr::axis, 1);
+    split_op.set_attr<std::vector<int64_t>>(graph::op_attr::sizes, {H, H, H});
+
+    auto src_lt = utils::logical_tensor_init(0, {M, K}, graph::data_type::f32);
+    auto wei_lt
+            = utils::logical_tensor_init(1, {K, 3 * H}, graph::data_type::f32);
+    auto qkv_lt
+            = utils::logical_tensor_init(2, {M, 3 * H}, graph::data_type::f32);
+    std::vector<graph::logical_tensor_t> dst_lts;
+    for (size_t i = 0; i < 3; ++i)
+        dst_lts.emplace_back(utils::logical_tensor_init(
+                i + 3, {M, H}, graph::data_type::f32));
+
+    matmul_op.add_input(src_lt);
+    matmul_op.add_input(wei_lt);
+    matmul_op.add_output(qkv_lt);
+    split_op.add_input(qkv_lt);
+    for (const auto &lt : dst_lts)
+        split_op.add_output(lt);
+
+    graph::graph_t g(engine->kind());
+    ASSERT_EQ(g.add_op(&matmul_op), graph::status::success);
+    ASSERT_EQ(g.add_op(&split_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("float_matmul_split");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+    ASSERT_EQ(part->get_ops().size(), 2U);
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {&src_lt, &wei_lt};
+    std::vector<const graph::logical_tensor_t *> outputs;
+    for (const auto &lt : dst_lts)
+        outputs.emplace_back(&lt);
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, engine), graph::status::success);
+
+    graph::stream_t *stream = get_stream();
+    test_tensor_t src_ts(src_lt, engine, src);
+    test_tensor_t wei_ts(wei_lt, engine, wei);
+    std::vector<test_tensor_t> dst_ts;
+    for (const auto &lt : dst_lts)
+        dst_ts.emplace_back(lt, engine);
+    std::vector<graph::tensor_t> dst_tensors;
+    for (const auto &ts : dst_ts)
+        dst_tensors.emplace_back(ts.get());
+    ASSERT_EQ(cp.execute(stream, {src_ts.get(), wei_ts.get()}, dst_tensors),
+            graph::status::success);
+    stream->wait();
+
+    for (int64_t i = 0; i < 3; ++i) {
+        auto dst = dst_ts[i].as_vec_type<float>();
+        for (int64_t m = 0; m < M; ++m)
+            for (int64_t h = 0; h < H; ++h) {
+                float ref = 0.f;
+                for (int64_t k = 0; k < K; ++k)
+                    ref += src[m * K + k] * wei[k * 3 * H + i * H + h];
+                ASSERT_NEAR(dst[m * H + h], ref, 1e-5f);
+            }
+    }
+}
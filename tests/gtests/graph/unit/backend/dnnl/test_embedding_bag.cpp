@@ -0,0 +1,301 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+#include "graph/unit/utils.hpp"
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+
+namespace {
+
+// Table rows are filled with the row index so the pooled values are easy to
+// compute by hand.
+std::vector<float> make_table(int64_t rows, int64_t dim) {
+    std::vector<float> table(rows * dim);
+    for (int64_t r = 0; r < rows; ++r)
+        for (int64_t d = 0; d < dim; ++d)
+            table[r * dim + d] = static_cast<float>(r) + 0.5f * d;
+    return table;
+}
+
+} // namespace
+
+TEST(test_embedding_bag_execute, SumWithWeights) {
+    graph::engine_t *engine = get_engine();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu, "skip on gpu");
+
+    const int64_t rows = 10, dim = 4, batch = 3;
+    std::vector<float> table = make_table(rows, dim);
+    std::vector<int32_t> indices {1, 3, 5, 7, 9, 2};
+    std::vector<int32_t> offsets {0, 2, 2};
+    std::vector<float> weights {1.f, 2.f, 0.5f, 1.f, 1.f, 3.f};
+    std::vector<float> dst(batch * dim, -1.f);
+
+    graph::op_t emb_op(0, graph::op_kind::EmbeddingBag, "embedding_bag");
+    emb_op.set_attr<std::string>(graph::op_attr::mode, "sum");
+
+    auto table_lt = utils::logical_tensor_init(
+            0, {rows, dim}, graph::data_type::f32);
+    auto indices_lt = utils::logical_tensor_init(
+            1, {(int64_t)indices.size()}, graph::data_type::s32);
+    auto offsets_lt
+            = utils::logical_tensor_init(2, {batch}, graph::data_type::s32);
+    auto weights_lt = utils::logical_tensor_init(
+            3, {(int64_t)weights.size()}, graph::data_type::f32);
+    auto dst_lt = utils::logical_tensor_init(
+            4, {batch, dim}, graph::data_type::f32);
+
+    emb_op.add_input(table_lt);
+    emb_op.add_input(indices_lt);
+    emb_op.add_input(offsets_lt);
+    emb_op.add_input(weights_lt);
+    emb_op.add_output(dst_lt);
+
+    graph::graph_t g(engine->kind());
+    ASSERT_EQ(g.add_op(&emb_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("embedding_bag_pass");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {
+            &table_lt, &indices_lt, &offsets_lt, &weights_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, engine), graph::status::success);
+
+    graph::stream_t *stream = get_stream();
+    test_tensor_t table_ts(table_lt, engine, table);
+    test_tensor_t indices_ts(indices_lt, engine, indices);
+    test_tensor_t offsets_ts(offsets_lt, engine, offsets);
+    test_tensor_t weights_ts(weights_lt, engine, weights);
+    test_tensor_t dst_ts(dst_lt, engine, dst);
+
+    ASSERT_EQ(cp.execute(stream,
+                      {table_ts.get(), indices_ts.get(), offsets_ts.get(),
+                              weights_ts.get()},
+                      {dst_ts.get()}),
+            graph::status::success);
+    stream->wait();
+    dst = dst_ts.as_vec_type<float>();
+
+    for (int64_t d = 0; d < dim; ++d) {
+        // bag 0: rows 1 and 3, bag 1: empty, bag 2: rows 5, 7, 9 and 2.
+        ASSERT_FLOAT_EQ(dst[0 * dim + d], 1.f * (1 + 0.5f * d)
+                        + 2.f * (3 + 0.5f * d));
+        ASSERT_FLOAT_EQ(dst[1 * dim + d], 0.f);
+        ASSERT_FLOAT_EQ(dst[2 * dim + d], 0.5f * (5 + 0.5f * d)
+                        + (7 + 0.5f * d) + (9 + 0.5f * d)
+                        + 3.f * (2 + 0.5f * d));
+    }
+}
+
+TEST(test_embedding_bag_execute, EmbeddingBagMatmulFusion) {
+    graph::engine_t *engine = get_engine();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu, "skip on gpu");
+
+    const int64_t rows = 16, dim = 8, batch = 4, oc = 6;
+    std::vector<float> table = make_table(rows, dim);
+    std::vector<int32_t> indices {0, 4, 8, 12, 15, 3, 6};
+    std::vector<int32_t> offsets {0, 1, 3, 5};
+    std::vector<float> wei(dim * oc, 0.25f);
+    std::vector<float> dst(batch * oc, 0.f);
+
+    graph::op_t emb_op(0, graph::op_kind::EmbeddingBag, "embedding_bag");
+    emb_op.set_attr<std::string>(graph::op_attr::mode, "mean");
+    graph::op_t matmul_op(1, graph::op_kind::MatMul, "matmul");
+    graph::op_t relu_op(2, graph::op_kind::ReLU, "relu");
+
+    auto table_lt = utils::logical_tensor_init(
+            0, {rows, dim}, graph::data_type::f32);
+    auto indices_lt = utils::logical_tensor_init(
+            1, {(int64_t)indices.size()}, graph::data_type::s32);
+    auto offsets_lt
+            = utils::logical_tensor_init(2, {batch}, graph::data_type::s32);
+    auto emb_dst_lt = utils::logical_tensor_init(
+            3, {batch, dim}, graph::data_type::f32);
+    auto wei_lt
+            = utils::logical_tensor_init(4, {dim, oc}, graph::data_type::f32);
+    auto mm_dst_lt = utils::logical_tensor_init(
+            5, {batch, oc}, graph::data_type::f32);
+    auto dst_lt = utils::logical_tensor_init(
+            6, {batch, oc}, graph::data_type::f32);
+
+    emb_op.add_input(table_lt);
+    emb_op.add_input(indices_lt);
+    emb_op.add_input(offsets_lt);
+    emb_op.add_output(emb_dst_lt);
+    matmul_op.add_input(emb_dst_lt);
+    matmul_op.add_input(wei_lt);
+    matmul_op.add_output(mm_dst_lt);
+    relu_op.add_input(mm_dst_lt);
+    relu_op.add_output(dst_lt);
+
+    graph::graph_t g(engine->kind());
+    ASSERT_EQ(g.add_op(&emb_op), graph::status::success);
+    ASSERT_EQ(g.add_op(&matmul_op), graph::status::success);
+    ASSERT_EQ(g.add_op(&relu_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("float_embedding_bag_matmul");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+    ASSERT_EQ(part->get_ops().size(), 3U);
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {
+            &table_lt, &indices_lt, &offsets_lt, &wei_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, engine), graph::status::success);
+
+    graph::stream_t *stream = get_stream();
+    test_tensor_t table_ts(table_lt, engine, table);
+    test_tensor_t indices_ts(indices_lt, engine, indices);
+    test_tensor_t offsets_ts(offsets_lt, engine, offsets);
+    test_tensor_t wei_ts(wei_lt, engine, wei);
+    test_tensor_t dst_ts(dst_lt, engine, dst);
+
+    ASSERT_EQ(cp.execute(stream,
+                      {table_ts.get(), indices_ts.get(), offsets_ts.get(),
+                              wei_ts.get()},
+                      {dst_ts.get()}),
+            graph::status::success);
+    stream->wait();
+    dst = dst_ts.as_vec_type<float>();
+
+    // reference: mean pooling followed by matmul with a constant weight.
+    for (int64_t b = 0; b < batch; ++b) {
+        const int32_t beg = offsets[b];
+        const int32_t end
+                = b + 1 < batch ? offsets[b + 1] : (int32_t)indices.size();
+        float row_sum = 0.f;
+        for (int32_t i = beg; i < end; ++i)
+            for (int64_t d = 0; d < dim; ++d)
+                row_sum += table[indices[i] * dim + d];
+        const float ref = 0.25f * row_sum / (end - beg);
+        for (int64_t o = 0; o < oc; ++o)
+            ASSERT_NEAR(dst[b * oc + o], std::max(ref, 0.f), 1e-4f);
+    }
+}
+
+TEST(test_embedding_bag_execute, DynamicDequantizeTableFusion) {
+    graph::engine_t *engine = get_engine();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu, "skip on gpu");
+
+    const int64_t rows = 6, dim = 4, batch = 2;
+    std::vector<int8_t> table(rows * dim);
+    for (size_t i = 0; i < table.size(); ++i)
+        table[i] = static_cast<int8_t>(static_cast<int>(i % 11) - 5);
+    std::vector<float> scales {0.5f, 1.f, 0.25f, 2.f, 0.125f, 1.5f};
+    std::vector<int8_t> zps {0, 1, -2, 3, 0, -1};
+    std::vector<int32_t> indices {5, 0, 2, 3};
+    std::vector<int32_t> offsets {0, 1};
+    std::vector<float> dst(batch * dim, -1.f);
+
+    graph::op_t dequant_op(
+            0, graph::op_kind::DynamicDequantize, "dynamic_dequantize");
+    dequant_op.set_attr<std::string>(graph::op_attr::qtype, "per_channel");
+    dequant_op.set_attr<int64_t>(graph::op_attr::axis, 0);
+    graph::op_t emb_op(1, graph::op_kind::EmbeddingBag, "embedding_bag");
+    emb_op.set_attr<std::string>(graph::op_attr::mode, "sum");
+
+    auto table_lt
+            = utils::logical_tensor_init(0, {rows, dim}, graph::data_type::s8);
+    auto scales_lt
+            = utils::logical_tensor_init(1, {rows}, graph::data_type::f32);
+    auto zps_lt = utils::logical_tensor_init(2, {rows}, graph::data_type::s8);
+    auto table_f32_lt = utils::logical_tensor_init(
+            3, {rows, dim}, graph::data_type::f32);
+    auto indices_lt = utils::logical_tensor_init(
+            4, {(int64_t)indices.size()}, graph::data_type::s32);
+    auto offsets_lt
+            = utils::logical_tensor_init(5, {batch}, graph::data_type::s32);
+    auto dst_lt = utils::logical_tensor_init(
+            6, {batch, dim}, graph::data_type::f32);
+
+    dequant_op.add_input(table_lt);
+    dequant_op.add_input(scales_lt);
+    dequant_op.add_input(zps_lt);
+    dequant_op.add_output(table_f32_lt);
+    emb_op.add_input(table_f32_lt);
+    emb_op.add_input(indices_lt);
+    emb_op.add_input(offsets_lt);
+    emb_op.add_output(dst_lt);
+
+    graph::graph_t g(engine->kind());
+    ASSERT_EQ(g.add_op(&dequant_op), graph::status::success);
+    ASSERT_EQ(g.add_op(&emb_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("x8_embedding_bag");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+    ASSERT_EQ(part->get_ops().size(), 2U);
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {
+            &table_lt, &scales_lt, &zps_lt, &indices_lt, &offsets_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, engine), graph::status::success);
+
+    graph::stream_t *stream = get_stream();
+    test_tensor_t table_ts(table_lt, engine, table);
+    test_tensor_t scales_ts(scales_lt, engine, scales);
+    test_tensor_t zps_ts(zps_lt, engine, zps);
+    test_tensor_t indices_ts(indices_lt, engine, indices);
+    test_tensor_t offsets_ts(offsets_lt, engine, offsets);
+    test_tensor_t dst_ts(dst_lt, engine, dst);
+
+    ASSERT_EQ(cp.execute(stream,
+                      {table_ts.get(), scales_ts.get(), zps_ts.get(),
+                              indices_ts.get(), offsets_ts.get()},
+                      {dst_ts.get()}),
+            graph::status::success);
+    stream->wait();
+    dst = dst_ts.as_vec_type<float>();
+
+    // reference: every row is dequantized with its own scale and zero-point.
+    for (int64_t b = 0; b < batch; ++b) {
+        const int32_t beg = offsets[b];
+        const int32_t end
+                = b + 1 < batch ? offsets[b + 1] : (int32_t)indices.size();
+        for (int64_t d = 0; d < dim; ++d) {
+            float ref = 0.f;
+            for (int32_t i = beg; i < end; ++i) {
+                const int32_t r = indices[i];
+                ref += scales[r] * (table[r * dim + d] - zps[r]);
+            }
+            ASSERT_FLOAT_EQ(dst[b * dim + d], ref);
+        }
+    }
+}
@@ -0,0 +1,216 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+
+#include <cmath>
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+
+namespace {
+
+void make_tables(int64_t max_pos, int64_t head_size, std::vector<float> &cos_t,
+        std::vector<float> &sin_t) {
+    const int64_t half = head_size / 2;
+    cos_t.resize(max_pos * half);
+    sin_t.resize(max_pos * half);
+    for (int64_t p = 0; p < max_pos; ++p)
+        for (int64_t i = 0; i < half; ++i) {
+            const float theta = p
+                    * std::pow(10000.f, -2.f * i / (float)head_size);
+            cos_t[p * half + i] = std::cos(theta);
+            sin_t[p * half + i] = std::sin(theta);
+        }
+}
+
+// Rotates the pairs `x[i], x[i + D / 2]` of every row of src.
+std::vector<float> rope_ref(const std::vector<float> &src, int64_t seq_len,
+        int64_t head_size, const std::vector<float> &cos_t,
+        const std::vector<float> &sin_t,
+        const std::vector<int32_t> &pos_ids) {
+    const int64_t half = head_size / 2;
+    const int64_t nrows = (int64_t)src.size() / head_size;
+    std::vector<float> dst(src.size());
+    for (int64_t r = 0; r < nrows; ++r) {
+        const int64_t s = r % seq_len;
+        const int64_t p = pos_ids.empty() ? s : pos_ids[s];
+        for (int64_t i = 0; i < half; ++i) {
+            const float c = cos_t[p * half + i], sn = sin_t[p * half + i];
+            const float x0 = src[r * head_size + i];
+            const float x1 = src[r * head_size + i + half];
+            dst[r * head_size + i] = x0 * c - x1 * sn;
+            dst[r * head_size + i + half] = x1 * c + x0 * sn;
+        }
+    }
+    return dst;
+}
+
+} // namespace
+
+TEST(test_rope_execute, RoPEWithPositionIds) {
+    graph::engine_t *engine = get_engine();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu, "skip on gpu");
+
+    const int64_t B = 1, H = 2, S = 5, D = 16, P = 32;
+    std::vector<float> src(B * H * S * D);
+    for (size_t i = 0; i < src.size(); ++i)
+        src[i] = 0.1f * static_cast<float>(static_cast<int>(i % 11) - 5);
+    std::vector<float> cos_t, sin_t;
+    make_tables(P, D, cos_t, sin_t);
+    std::vector<int32_t> pos_ids {7, 8, 9, 10, 11};
+    std::vector<float> dst(src.size(), 0.f);
+
+    graph::op_t rope_op(0, graph::op_kind::RoPE, "rope");
+    rope_op.set_attr<std::string>(graph::op_attr::mode, "half");
+
+    auto src_lt = utils::logical_tensor_init(
+            0, {B, H, S, D}, graph::data_type::f32);
+    auto cos_lt
+            = utils::logical_tensor_init(1, {P, D / 2}, graph::data_type::f32);
+    auto sin_lt
+            = utils::logical_tensor_init(2, {P, D / 2}, graph::data_type::f32);
+    auto pos_lt
+            = utils::logical_tensor_init(3, {B, 1, S}, graph::data_type::s32);
+    auto dst_lt = utils::logical_tensor_init(
+            4, {B, H, S, D}, graph::data_type::f32);
+
+    rope_op.add_input(src_lt);
+    rope_op.add_input(cos_lt);
+    rope_op.add_input(sin_lt);
+    rope_op.add_input(pos_lt);
+    rope_op.add_output(dst_lt);
+
+    graph::graph_t g(engine->kind());
+    ASSERT_EQ(g.add_op(&rope_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("rope_pass");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {
+            &src_lt, &cos_lt, &sin_lt, &pos_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, engine), graph::status::success);
+
+    graph::stream_t *stream = get_stream();
+    test_tensor_t src_ts(src_lt, engine, src);
+    test_tensor_t cos_ts(cos_lt, engine, cos_t);
+    test_tensor_t sin_ts(sin_lt, engine, sin_t);
+    test_tensor_t pos_ts(pos_lt, engine, pos_ids);
+    test_tensor_t dst_ts(dst_lt, engine, dst);
+
+    ASSERT_EQ(cp.execute(stream,
+                      {src_ts.get(), cos_ts.get(), sin_ts.get(),
+                              pos_ts.get()},
+                      {dst_ts.get()}),
+            graph::status::success);
+    stream->wait();
+    dst = dst_ts.as_vec_type<float>();
+
+    std::vector<float> ref = rope_ref(src, S, D, cos_t, sin_t, pos_ids);
+    for (size_t i = 0; i < dst.size(); ++i)
+        ASSERT_NEAR(dst[i], ref[i], 1e-5f);
+}
+
+TEST(test_rope_execute, MatmulRoPEFusion) {
+    graph::engine_t *engine = get_engine();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu, "skip on gpu");
+
+    const int64_t S = 6, IC = 8, D = 16;
+    std::vector<float> src(S * IC), wei(IC * D);
+    for (size_t i = 0; i < src.size(); ++i)
+        src[i] = 0.25f * static_cast<float>(static_cast<int>(i % 7) - 3);
+    for (size_t i = 0; i < wei.size(); ++i)
+        wei[i] = 0.125f * static_cast<float>(static_cast<int>(i % 5) - 2);
+    std::vector<float> cos_t, sin_t;
+    make_tables(S, D, cos_t, sin_t);
+    std::vector<float> dst(S * D, 0.f);
+
+    graph::op_t matmul_op(0, graph::op_kind::MatMul, "matmul");
+    graph::op_t rope_op(1, graph::op_kind::RoPE, "rope");
+
+    auto src_lt = utils::logical_tensor_init(0, {S, IC}, graph::data_type::f32);
+    auto wei_lt = utils::logical_tensor_init(1, {IC, D}, graph::data_type::f32);
+    auto mm_dst_lt
+            = utils::logical_tensor_init(2, {S, D}, graph::data_type::f32);
+    auto cos_lt
+            = utils::logical_tensor_init(3, {S, D / 2}, graph::data_type::f32);
+    auto sin_lt
+            = utils::logical_tensor_init(4, {S, D / 2}, graph::data_type::f32);
+    auto dst_lt = utils::logical_tensor_init(5, {S, D}, graph::data_type::f32);
+
+    matmul_op.add_input(src_lt);
+    matmul_op.add_input(wei_lt);
+    matmul_op.add_output(mm_dst_lt);
+    rope_op.add_input(mm_dst_lt);
+    rope_op.add_input(cos_lt);
+    rope_op.add_input(sin_lt);
+    rope_op.add_output(dst_lt);
+
+    graph::graph_t g(engine->kind());
+    ASSERT_EQ(g.add_op(&matmul_op), graph::status::success);
+    ASSERT_EQ(g.add_op(&rope_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("float_matmul_rope");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+    ASSERT_EQ(part->get_ops().size(), 2U);
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {
+            &src_lt, &wei_lt, &cos_lt, &sin_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, engine), graph::status::success);
+
+    graph::stream_t *stream = get_stream();
+    test_tensor_t src_ts(src_lt, engine, src);
+    test_tensor_t wei_ts(wei_lt, engine, wei);
+    test_tensor_t cos_ts(cos_lt, engine, cos_t);
+    test_tensor_t sin_ts(sin_lt, engine, sin_t);
+    test_tensor_t dst_ts(dst_lt, engine, dst);
+
+    ASSERT_EQ(cp.execute(stream,
+                      {src_ts.get(), wei_ts.get(), cos_ts.get(),
+                              sin_ts.get()},
+                      {dst_ts.get()}),
+            graph::status::success);
+    stream->wait();
+    dst = dst_ts.as_vec_type<float>();
+
+    std::vector<float> proj(S * D, 0.f);
+    for (int64_t s = 0; s < S; ++s)
+        for (int64_t d = 0; d < D; ++d)
+            for (int64_t k = 0; k < IC; ++k)
+                proj[s * D + d] += src[s * IC + k] * wei[k * D + d];
+    std::vector<float> ref = rope_ref(proj, S, D, cos_t, sin_t, {});
+    for (size_t i = 0; i < dst.size(); ++i)
+        ASSERT_NEAR(dst[i], ref[i], 1e-4f);
+}
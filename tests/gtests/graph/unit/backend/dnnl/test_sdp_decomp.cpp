@@ -1603,3 +1603,261 @@ TEST(test_sdp_decomp_execute, MultithreaSdpDecompCorr_CPU) {
         t2.join();
     }
 }
+
+TEST(test_sdp_decomp_execute, F32SdpKvAppendCorr_CPU) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    const dim_t batch_size = 32, num_head = 16, seq_len_q = 1,
+                past_len = 127, cur_len = 1, head_size = 64;
+    const dim_t seq_len_kv = past_len + cur_len;
+    const graph::data_type_t dt = graph::data_type::f32;
+
+    auto query = utils::logical_tensor_init(
+            0, {batch_size, num_head, seq_len_q, head_size}, dt);
+    auto past_key = utils::logical_tensor_init(
+            1, {batch_size, num_head, past_len, head_size}, dt);
+    auto cur_key = utils::logical_tensor_init(
+            2, {batch_size, num_head, cur_len, head_size}, dt);
+    auto present_key = utils::logical_tensor_init(
+            3, {batch_size, num_head, seq_len_kv, head_size}, dt);
+    auto score = utils::logical_tensor_init(
+            4, {batch_size, num_head, seq_len_q, seq_len_kv}, dt);
+    auto scale = utils::logical_tensor_init(5, {1}, dt);
+    auto scaled_score = utils::logical_tensor_init(
+            6, {batch_size, num_head, seq_len_q, seq_len_kv}, dt);
+    auto probs = utils::logical_tensor_init(
+            7, {batch_size, num_head, seq_len_q, seq_len_kv}, dt);
+    auto past_value = utils::logical_tensor_init(
+            8, {batch_size, num_head, past_len, head_size}, dt);
+    auto cur_value = utils::logical_tensor_init(
+            9, {batch_size, num_head, cur_len, head_size}, dt);
+    auto present_value = utils::logical_tensor_init(
+            10, {batch_size, num_head, seq_len_kv, head_size}, dt);
+    auto output = utils::logical_tensor_init(
+            11, {batch_size, num_head, seq_len_q, head_size}, dt);
+
+    graph::op_t concat_k {0, graph::op_kind::Concat, "concat_k"};
+    concat_k.set_attr<int64_t>(graph::op_attr::axis, 2);
+    concat_k.add_input(past_key);
+    concat_k.add_input(cur_key);
+    concat_k.add_output(present_key);
+
+    graph::op_t end_k {1, graph::op_kind::End, "end_k"};
+    end_k.add_input(present_key);
+
+    graph::op_t matmul_qk {2, graph::op_kind::MatMul, "matmul_qk"};
+    matmul_qk.set_attr<bool>(graph::op_attr::transpose_b, true);
+    matmul_qk.add_input(query);
+    matmul_qk.add_input(present_key);
+    matmul_qk.add_output(score);
+
+    graph::op_t scale_div {3, graph::op_kind::Divide, "scale_div"};
+    scale_div.set_attr(graph::op_attr::auto_broadcast, std::string("numpy"));
+    scale_div.add_input(score);
+    scale_div.add_input(scale);
+    scale_div.add_output(scaled_score);
+
+    graph::op_t softmax {4, graph::op_kind::SoftMax, "softmax"};
+    softmax.set_attr(graph::op_attr::axis, (int64_t)3);
+    softmax.add_input(scaled_score);
+    softmax.add_output(probs);
+
+    graph::op_t concat_v {5, graph::op_kind::Concat, "concat_v"};
+    concat_v.set_attr<int64_t>(graph::op_attr::axis, 2);
+    concat_v.add_input(past_value);
+    concat_v.add_input(cur_value);
+    concat_v.add_output(present_value);
+
+    graph::op_t end_v {6, graph::op_kind::End, "end_v"};
+    end_v.add_input(present_value);
+
+    graph::op_t matmul_v {7, graph::op_kind::MatMul, "matmul_v"};
+    matmul_v.add_input(probs);
+    matmul_v.add_input(present_value);
+    matmul_v.add_output(output);
+
+    graph::graph_t g(eng->kind());
+    for (auto *op : {&concat_k, &end_k, &matmul_qk, &scale_div, &softmax,
+                 &concat_v, &end_v, &matmul_v}) {
+        ASSERT_EQ(g.add_op(op), graph::status::success);
+    }
+    ASSERT_EQ(g.finalize(), graph::status::success);
+
+    graph::pass::pass_base_ptr apass = get_pass("float_sdp_kv_append_fusion");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+    ASSERT_EQ(partition_inputs.size(), 6U);
+    ASSERT_EQ(partition_outputs.size(), 3U);
+
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs) {
+        inputs.emplace_back(&lt);
+    }
+    for (auto &lt : partition_outputs) {
+        outputs.emplace_back(&lt);
+    }
+
+    std::vector<test_tensor_t> inputs_ts;
+    for (auto &lt : inputs) {
+        inputs_ts.emplace_back(*lt, eng);
+        inputs_ts.back().fill<float>();
+    }
+
+    const auto run = [&](const char *force_primitive,
+                             std::vector<test_tensor_t> &outputs_ts) {
+        custom_setenv("_ONEDNN_GRAPH_SDPA_FORCE_PRIMITIVE", force_primitive, 1);
+        graph::compiled_partition_t cp(p);
+        ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+        for (auto &lt : outputs) {
+            graph::logical_tensor_t compiled_output;
+            cp.query_logical_tensor(lt->id, &compiled_output);
+            outputs_ts.emplace_back(compiled_output, eng);
+        }
+        ASSERT_EQ(cp.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                          test_tensor_t::to_graph_tensor(outputs_ts)),
+                graph::status::success);
+        strm->wait();
+    };
+
+    std::vector<test_tensor_t> outputs1_ts, outputs2_ts;
+    run("1", outputs1_ts);
+    run("0", outputs2_ts);
+
+    // Both the attention output and the present K/V caches should match.
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        ASSERT_TRUE(allclose<float>(outputs1_ts[i], outputs2_ts[i],
+                /*rtol*/ 0.01f,
+                /*atol*/ 1e-6f));
+    }
+}
+
+// Speculative decoding verification: a few draft queries per head against a
+// long context, with query heads sharing a kv head.
+TEST(test_sdp_decomp_execute, F32GqaSmallQueryCorr_CPU) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    const dim_t batch_size = 16, num_head_kv = 8, group = 4, seq_len_q = 8,
+                seq_len_kv = 512, head_size = 64;
+    const graph::data_type_t dt = graph::data_type::f32;
+
+    auto query = utils::logical_tensor_init(
+            0, {batch_size, num_head_kv, group, seq_len_q, head_size}, dt);
+    auto key = utils::logical_tensor_init(
+            1, {batch_size, num_head_kv, 1, seq_len_kv, head_size}, dt);
+    auto score = utils::logical_tensor_init(2,
+            {batch_size, num_head_kv, group, seq_len_q, seq_len_kv}, dt);
+    auto scale = utils::logical_tensor_init(3, {1}, dt);
+    auto scaled_score = utils::logical_tensor_init(4,
+            {batch_size, num_head_kv, group, seq_len_q, seq_len_kv}, dt);
+    // The mask across draft tokens is shared by all heads.
+    auto mask = utils::logical_tensor_init(
+            5, {batch_size, 1, 1, seq_len_q, seq_len_kv}, dt);
+    auto masked_score = utils::logical_tensor_init(6,
+            {batch_size, num_head_kv, group, seq_len_q, seq_len_kv}, dt);
+    auto probs = utils::logical_tensor_init(7,
+            {batch_size, num_head_kv, group, seq_len_q, seq_len_kv}, dt);
+    auto value = utils::logical_tensor_init(
+            8, {batch_size, num_head_kv, 1, seq_len_kv, head_size}, dt);
+    auto output = utils::logical_tensor_init(
+            9, {batch_size, num_head_kv, group, seq_len_q, head_size}, dt);
+
+    graph::op_t matmul_qk {0, graph::op_kind::MatMul, "matmul_qk"};
+    matmul_qk.set_attr<bool>(graph::op_attr::transpose_b, true);
+    matmul_qk.add_input(query);
+    matmul_qk.add_input(key);
+    matmul_qk.add_output(score);
+
+    graph::op_t scale_mul {1, graph::op_kind::Multiply, "scale_mul"};
+    scale_mul.set_attr(graph::op_attr::auto_broadcast, std::string("numpy"));
+    scale_mul.add_input(score);
+    scale_mul.add_input(scale);
+    scale_mul.add_output(scaled_score);
+
+    graph::op_t mask_add {2, graph::op_kind::Add, "mask_add"};
+    mask_add.set_attr(graph::op_attr::auto_broadcast, std::string("numpy"));
+    mask_add.add_input(scaled_score);
+    mask_add.add_input(mask);
+    mask_add.add_output(masked_score);
+
+    graph::op_t softmax {3, graph::op_kind::SoftMax, "softmax"};
+    softmax.set_attr(graph::op_attr::axis, (int64_t)4);
+    softmax.add_input(masked_score);
+    softmax.add_output(probs);
+
+    graph::op_t matmul_v {4, graph::op_kind::MatMul, "matmul_v"};
+    matmul_v.add_input(probs);
+    matmul_v.add_input(value);
+    matmul_v.add_output(output);
+
+    graph::graph_t g(eng->kind());
+    for (auto *op : {&matmul_qk, &scale_mul, &mask_add, &softmax, &matmul_v}) {
+        ASSERT_EQ(g.add_op(op), graph::status::success);
+    }
+    ASSERT_EQ(g.finalize(), graph::status::success);
+
+    graph::pass::pass_base_ptr apass = get_pass("float_sdp_fusion");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+    ASSERT_EQ(partition_inputs.size(), 5U);
+    ASSERT_EQ(partition_outputs.size(), 1U);
+
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs) {
+        inputs.emplace_back(&lt);
+    }
+    for (auto &lt : partition_outputs) {
+        outputs.emplace_back(&lt);
+    }
+
+    std::vector<test_tensor_t> inputs_ts;
+    for (auto &lt : inputs) {
+        inputs_ts.emplace_back(*lt, eng);
+        inputs_ts.back().fill<float>();
+    }
+
+    const auto run = [&](const char *force_primitive,
+                             std::vector<test_tensor_t> &outputs_ts) {
+        custom_setenv("_ONEDNN_GRAPH_SDPA_FORCE_PRIMITIVE", force_primitive, 1);
+        graph::compiled_partition_t cp(p);
+        ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+        for (auto &lt : outputs) {
+            graph::logical_tensor_t compiled_output;
+            cp.query_logical_tensor(lt->id, &compiled_output);
+            outputs_ts.emplace_back(compiled_output, eng);
+        }
+        ASSERT_EQ(cp.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                          test_tensor_t::to_graph_tensor(outputs_ts)),
+                graph::status::success);
+        strm->wait();
+    };
+
+    std::vector<test_tensor_t> outputs1_ts, outputs2_ts;
+    run("1", outputs1_ts);
+    run("0", outputs2_ts);
+
+    ASSERT_TRUE(allclose<float>(outputs1_ts[0], outputs2_ts[0],
+            /*rtol*/ 0.01f,
+            /*atol*/ 1e-6f));
+}
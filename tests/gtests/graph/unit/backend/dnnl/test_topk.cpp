@@ -0,0 +1,200 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+
+namespace {
+
+// Returns the indices of the k largest elements of every row, ties are
+// ordered by index.
+std::vector<int32_t> topk_ref(
+        const std::vector<float> &src, int64_t n, int64_t k) {
+    const int64_t rows = (int64_t)src.size() / n;
+    std::vector<int32_t> idx(rows * k);
+    for (int64_t r = 0; r < rows; ++r) {
+        std::vector<int32_t> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int32_t a, int32_t b) {
+            return src[r * n + a] > src[r * n + b];
+        });
+        std::copy(order.begin(), order.begin() + k, idx.begin() + r * k);
+    }
+    return idx;
+}
+
+} // namespace
+
+TEST(test_topk_execute, TopK) {
+    graph::engine_t *engine = get_engine();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu, "skip on gpu");
+
+    const int64_t rows = 3, n = 257, k = 6;
+    std::vector<float> src(rows * n);
+    for (size_t i = 0; i < src.size(); ++i)
+        src[i] = static_cast<float>((i * 37) % 101) - 50.f;
+    std::vector<float> values(rows * k, 0.f);
+    std::vector<int32_t> indices(rows * k, -1);
+
+    graph::op_t topk_op(0, graph::op_kind::TopK, "topk");
+    topk_op.set_attr<int64_t>(graph::op_attr::k, k);
+
+    auto src_lt
+            = utils::logical_tensor_init(0, {rows, n}, graph::data_type::f32);
+    auto val_lt
+            = utils::logical_tensor_init(1, {rows, k}, graph::data_type::f32);
+    auto idx_lt
+            = utils::logical_tensor_init(2, {rows, k}, graph::data_type::s32);
+
+    topk_op.add_input(src_lt);
+    topk_op.add_output(val_lt);
+    topk_op.add_output(idx_lt);
+
+    graph::graph_t g(engine->kind());
+    ASSERT_EQ(g.add_op(&topk_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("topk_pass");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {&src_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&val_lt, &idx_lt};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, engine), graph::status::success);
+
+    graph::stream_t *stream = get_stream();
+    test_tensor_t src_ts(src_lt, engine, src);
+    test_tensor_t val_ts(val_lt, engine, values);
+    test_tensor_t idx_ts(idx_lt, engine, indices);
+
+    ASSERT_EQ(cp.execute(stream, {src_ts.get()}, {val_ts.get(), idx_ts.get()}),
+            graph::status::success);
+    stream->wait();
+    values = val_ts.as_vec_type<float>();
+    indices = idx_ts.as_vec_type<int32_t>();
+
+    std::vector<int32_t> ref = topk_ref(src, n, k);
+    for (int64_t r = 0; r < rows; ++r)
+        for (int64_t j = 0; j < k; ++j) {
+            ASSERT_EQ(indices[r * k + j], ref[r * k + j]);
+            ASSERT_EQ(values[r * k + j], src[r * n + ref[r * k + j]]);
+        }
+}
+
+TEST(test_topk_execute, MatmulSoftmaxTopKFusion) {
+    graph::engine_t *engine = get_engine();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu, "skip on gpu");
+
+    const int64_t M = 2, IC = 16, V = 300, k = 4;
+    std::vector<float> src(M * IC), wei(IC * V);
+    for (size_t i = 0; i < src.size(); ++i)
+        src[i] = 0.25f * static_cast<float>(static_cast<int>(i % 9) - 4);
+    for (size_t i = 0; i < wei.size(); ++i)
+        wei[i] = 0.125f * static_cast<float>(static_cast<int>(i % 13) - 6);
+    std::vector<float> values(M * k, 0.f);
+    std::vector<int32_t> indices(M * k, -1);
+
+    graph::op_t matmul_op(0, graph::op_kind::MatMul, "matmul");
+    graph::op_t softmax_op(1, graph::op_kind::SoftMax, "softmax");
+    softmax_op.set_attr<int64_t>(graph::op_attr::axis, -1);
+    graph::op_t topk_op(2, graph::op_kind::TopK, "topk");
+    topk_op.set_attr<int64_t>(graph::op_attr::k, k);
+
+    auto src_lt = utils::logical_tensor_init(0, {M, IC}, graph::data_type::f32);
+    auto wei_lt = utils::logical_tensor_init(1, {IC, V}, graph::data_type::f32);
+    auto logits_lt
+            = utils::logical_tensor_init(2, {M, V}, graph::data_type::f32);
+    auto prob_lt = utils::logical_tensor_init(3, {M, V}, graph::data_type::f32);
+    auto val_lt = utils::logical_tensor_init(4, {M, k}, graph::data_type::f32);
+    auto idx_lt = utils::logical_tensor_init(5, {M, k}, graph::data_type::s32);
+
+    matmul_op.add_input(src_lt);
+    matmul_op.add_input(wei_lt);
+    matmul_op.add_output(logits_lt);
+    softmax_op.add_input(logits_lt);
+    softmax_op.add_output(prob_lt);
+    topk_op.add_input(prob_lt);
+    topk_op.add_output(val_lt);
+    topk_op.add_output(idx_lt);
+
+    graph::graph_t g(engine->kind());
+    ASSERT_EQ(g.add_op(&matmul_op), graph::status::success);
+    ASSERT_EQ(g.add_op(&softmax_op), graph::status::success);
+    ASSERT_EQ(g.add_op(&topk_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("float_matmul_topk");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+    ASSERT_EQ(part->get_ops().size(), 3U);
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {&src_lt, &wei_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&val_lt, &idx_lt};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, engine), graph::status::success);
+
+    graph::stream_t *stream = get_stream();
+    test_tensor_t src_ts(src_lt, engine, src);
+    test_tensor_t wei_ts(wei_lt, engine, wei);
+    test_tensor_t val_ts(val_lt, engine, values);
+    test_tensor_t idx_ts(idx_lt, engine, indices);
+
+    ASSERT_EQ(cp.execute(stream, {src_ts.get(), wei_ts.get()},
+                      {val_ts.get(), idx_ts.get()}),
+            graph::status::success);
+    stream->wait();
+    values = val_ts.as_vec_type<float>();
+    indices = idx_ts.as_vec_type<int32_t>();
+
+    // reference: logits, softmax over the vocabulary, then top-k.
+    std::vector<float> logits(M * V, 0.f), prob(M * V);
+    for (int64_t m = 0; m < M; ++m) {
+        for (int64_t v = 0; v < V; ++v)
+            for (int64_t c = 0; c < IC; ++c)
+                logits[m * V + v] += src[m * IC + c] * wei[c * V + v];
+        const float max = *std::max_element(
+                logits.begin() + m * V, logits.begin() + (m + 1) * V);
+        float sum = 0.f;
+        for (int64_t v = 0; v < V; ++v)
+            sum += std::exp(logits[m * V + v] - max);
+        for (int64_t v = 0; v < V; ++v)
+            prob[m * V + v] = std::exp(logits[m * V + v] - max) / sum;
+    }
+    std::vector<int32_t> ref = topk_ref(logits, V, k);
+    for (int64_t m = 0; m < M; ++m)
+        for (int64_t j = 0; j < k; ++j) {
+            ASSERT_EQ(indices[m * k + j], ref[m * k + j]);
+            ASSERT_NEAR(values[m * k + j], prob[m * V + ref[m * k + j]], 1e-5f);
+        }
+}
@@ -0,0 +1,107 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "stdlib.h"
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace {
+
+void custom_setenv(const char *name, const char *value, int overwrite) {
+#ifdef _WIN32
+    auto status = SetEnvironmentVariable(name, value);
+    EXPECT_NE(status, 0);
+#else
+    auto status = ::setenv(name, value, overwrite);
+    EXPECT_EQ(status, 0);
+#endif
+}
+
+std::vector<std::string> read_lines(const char *path) {
+    std::vector<std::string> lines;
+    std::ifstream ifs(path);
+    std::string line;
+    while (std::getline(ifs, line))
+        if (!line.empty()) lines.push_back(line);
+    return lines;
+}
+
+} // namespace
+
+namespace dnnl {
+
+// The environment variables are read once per process, hence the test is built
+// as a separate executable.
+TEST(autotune_test_t, TuneAndReuse) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "Autotuning is supported for CPU engines only.");
+
+    const char *db_path = "test_internals_autotune.db";
+    std::remove(db_path);
+    custom_setenv("ONEDNN_AUTOTUNE", "2", 1);
+    custom_setenv("ONEDNN_AUTOTUNE_DB", db_path, 1);
+
+    engine eng(engine::kind::cpu, 0);
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+    memory::desc src_md({2, 32, 14, 14}, dt::f32, tag::any);
+    memory::desc wei_md({32, 32, 3, 3}, dt::f32, tag::any);
+    memory::desc dst_md({2, 32, 14, 14}, dt::f32, tag::any);
+
+    const auto create_pd = [&]() {
+        return convolution_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                src_md, wei_md, dst_md, {1, 1}, {1, 1}, {1, 1});
+    };
+
+    // The first creation tunes the problem and stores the winner.
+    auto pd = create_pd();
+    const std::string tuned_impl = pd.impl_info_str();
+    auto lines = read_lines(db_path);
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_NE(lines[0].find("\t" + tuned_impl + "\t"), std::string::npos);
+
+    // The second creation reuses the stored winner without tuning again.
+    auto pd2 = create_pd();
+    EXPECT_EQ(pd2.impl_info_str(), tuned_impl);
+    EXPECT_EQ(read_lines(db_path).size(), 1u);
+
+    // The selected implementation is functional.
+    auto src = test::make_memory(pd2.src_desc(), eng);
+    auto wei = test::make_memory(pd2.weights_desc(), eng);
+    auto dst = test::make_memory(pd2.dst_desc(), eng);
+    stream strm(eng);
+    convolution_forward(pd2).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst}});
+    strm.wait();
+
+    std::remove(db_path);
+}
+
+} // namespace dnnl
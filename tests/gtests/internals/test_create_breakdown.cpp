@@ -0,0 +1,103 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "common/create_breakdown.hpp"
+
+namespace dnnl {
+
+namespace {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+using phase_t = impl::create_breakdown::phase_t;
+
+matmul make_matmul(const engine &eng) {
+    memory::desc src_md({64, 96}, dt::f32, tag::ab);
+    memory::desc wei_md({96, 80}, dt::f32, tag::ab);
+    memory::desc dst_md({64, 80}, dt::f32, tag::ab);
+    return matmul(matmul::primitive_desc(eng, src_md, wei_md, dst_md));
+}
+
+} // namespace
+
+class create_breakdown_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        capacity_ = get_primitive_cache_capacity();
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "Creation breakdown is checked on CPU only.");
+        // Every creation has to go through all the phases.
+        set_primitive_cache_capacity(0);
+        impl::create_breakdown::reset_stats();
+    }
+
+    void TearDown() override {
+        impl::create_breakdown::set_enabled(false);
+        impl::create_breakdown::reset_stats();
+        set_primitive_cache_capacity(capacity_);
+    }
+
+    int capacity_ = 0;
+};
+
+TEST_F(create_breakdown_test_t, AccumulatesPhases) {
+    impl::create_breakdown::set_enabled(true);
+    auto prim = make_matmul(engine(engine::kind::cpu, 0));
+
+    const auto stats = impl::create_breakdown::get_stats();
+    EXPECT_GE(stats[phase_t::pd_iterate].count, 1u);
+    EXPECT_GE(stats[phase_t::pd_init_accepted].count, 1u);
+    EXPECT_GE(stats[phase_t::primitive_init].count, 1u);
+    for (int i = 0; i < static_cast<int>(phase_t::n_phases); i++)
+        EXPECT_GE(stats[static_cast<phase_t>(i)].time_ms, 0.);
+
+    // Every attributed rejection is accounted in the phase, and the most
+    // expensive implementations come first.
+    const auto rejections = impl::create_breakdown::get_rejection_stats();
+    size_t n_rejections = 0;
+    for (size_t i = 0; i < rejections.size(); i++) {
+        EXPECT_FALSE(rejections[i].impl_name.empty());
+        EXPECT_GE(rejections[i].count, 1u);
+        if (i > 0) {
+            EXPECT_LE(rejections[i].time_ms, rejections[i - 1].time_ms);
+        }
+        n_rejections += rejections[i].count;
+    }
+    EXPECT_LE(n_rejections, stats[phase_t::pd_init_rejected].count);
+
+    impl::create_breakdown::reset_stats();
+    const auto reset_stats = impl::create_breakdown::get_stats();
+    for (int i = 0; i < static_cast<int>(phase_t::n_phases); i++)
+        EXPECT_EQ(reset_stats[static_cast<phase_t>(i)].count, 0u);
+    EXPECT_TRUE(impl::create_breakdown::get_rejection_stats().empty());
+}
+
+TEST_F(create_breakdown_test_t, DisabledByDefault) {
+    SKIP_IF(impl::create_breakdown::is_enabled(),
+            "Creation breakdown is enabled by verbose.");
+    auto prim = make_matmul(engine(engine::kind::cpu, 0));
+
+    const auto stats = impl::create_breakdown::get_stats();
+    for (int i = 0; i < static_cast<int>(phase_t::n_phases); i++)
+        EXPECT_EQ(stats[static_cast<phase_t>(i)].count, 0u);
+}
+
+} // namespace dnnl
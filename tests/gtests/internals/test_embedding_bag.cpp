@@ -0,0 +1,262 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <algorithm>
+#include <cfloat>
+#include <unordered_map>
+#include <vector>
+
+#include "common/embedding_bag_iface.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using mdt = memory::data_type;
+
+/// Embedding bag internal primitive.
+struct embedding_bag_t : public primitive {
+    /// Primitive descriptor for an embedding bag primitive.
+    struct pd_t : public primitive_desc {
+        /// Default constructor. Produces an empty object.
+        pd_t() = default;
+
+        pd_t(const engine &aengine, algorithm alg, const memory::desc &src_desc,
+                const memory::desc &indices_desc,
+                const memory::desc &offsets_desc,
+                const memory::desc &weights_desc,
+                const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr()) {
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_embedding_bag_primitive_desc_create(
+                    &pd, aengine.get(), static_cast<dnnl_alg_kind_t>(alg),
+                    src_desc.get(), indices_desc.get(), offsets_desc.get(),
+                    weights_desc.get(), dst_desc.get(), attr.get());
+
+            error::wrap_c_api(status,
+                    "could not create a primitive descriptor for an "
+                    "embedding bag primitive");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    embedding_bag_t() = default;
+
+    /// Constructs an embedding bag primitive.
+    /// @param pd Primitive descriptor for an embedding bag primitive.
+    embedding_bag_t(const pd_t &pd) : primitive(pd) {}
+};
+
+struct embedding_bag_params_t {
+    algorithm alg;
+    memory::dim rows, dim, num_indices, batch;
+    bool with_weights;
+    mdt src_dt;
+};
+
+class embedding_bag_test_t
+    : public ::testing::TestWithParam<embedding_bag_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "Embedding bag primitive is CPU-only.");
+        p = GetParam();
+        eng = engine(engine::kind::cpu, 0);
+        SKIP_IF(unsupported_data_type(p.src_dt, eng),
+                "Engine does not support this data type.");
+    }
+
+    // Generates bags of different sizes including empty ones.
+    void init_indices(std::vector<int> &indices, std::vector<int> &offsets) {
+        indices.resize(p.num_indices);
+        for (memory::dim i = 0; i < p.num_indices; ++i)
+            indices[i] = static_cast<int>((i * 7 + 3) % p.rows);
+        offsets.resize(p.batch);
+        for (memory::dim b = 0; b < p.batch; ++b)
+            offsets[b] = static_cast<int>(
+                    std::min(p.num_indices, (b * b * 3) / 2));
+    }
+
+    embedding_bag_params_t p;
+    engine eng;
+};
+
+TEST_P(embedding_bag_test_t, Compare) {
+    stream strm(eng);
+
+    std::vector<int> indices, offsets;
+    init_indices(indices, offsets);
+
+    const bool is_int8 = p.src_dt == mdt::s8;
+    std::vector<float> table(p.rows * p.dim), row_scales(p.rows, 1.f);
+    for (size_t i = 0; i < table.size(); ++i)
+        table[i] = static_cast<float>(static_cast<int>((i * 13) % 17) - 8);
+    if (!is_int8) {
+        for (auto &v : table)
+            v *= 0.25f;
+    } else {
+        for (memory::dim r = 0; r < p.rows; ++r)
+            row_scales[r] = 0.125f * static_cast<float>(r % 5 + 1);
+    }
+
+    std::vector<float> weights(p.num_indices);
+    for (memory::dim i = 0; i < p.num_indices; ++i)
+        weights[i] = 0.5f + static_cast<float>(i % 3);
+
+    // reference
+    std::vector<float> dst_ref(p.batch * p.dim, 0.f);
+    for (memory::dim b = 0; b < p.batch; ++b) {
+        const memory::dim beg = offsets[b];
+        const memory::dim end
+                = b + 1 < p.batch ? offsets[b + 1] : p.num_indices;
+        for (memory::dim d = 0; d < p.dim; ++d) {
+            float acc = p.alg == algorithm::reduction_max ? -FLT_MAX : 0.f;
+            for (memory::dim i = beg; i < end; ++i) {
+                const int r = indices[i];
+                float v = row_scales[r] * table[r * p.dim + d];
+                if (p.with_weights) v *= weights[i];
+                acc = p.alg == algorithm::reduction_max ? std::max(acc, v)
+                                                        : acc + v;
+            }
+            if (end == beg) acc = 0.f;
+            if (p.alg == algorithm::reduction_mean && end > beg)
+                acc /= static_cast<float>(end - beg);
+            dst_ref[b * p.dim + d] = acc;
+        }
+    }
+
+    memory::desc src_md({p.rows, p.dim}, p.src_dt, tag::ab);
+    memory::desc idx_md({p.num_indices}, mdt::s32, tag::a);
+    memory::desc off_md({p.batch}, mdt::s32, tag::a);
+    memory::desc wei_md = p.with_weights
+            ? memory::desc({p.num_indices}, mdt::f32, tag::a)
+            : memory::desc();
+    memory::desc dst_md({p.batch, p.dim}, mdt::f32, tag::ab);
+
+    primitive_attr attr;
+    if (is_int8) attr.set_scales_mask(DNNL_ARG_SRC, 1 << 0);
+
+    embedding_bag_t::pd_t pd;
+    ASSERT_NO_THROW(pd = embedding_bag_t::pd_t(eng, p.alg, src_md, idx_md,
+                            off_md, wei_md, dst_md, attr));
+    embedding_bag_t prim(pd);
+
+    memory src_f32_m({{p.rows, p.dim}, mdt::f32, tag::ab}, eng, table.data());
+    memory src_m(src_md, eng);
+    reorder(src_f32_m, src_m).execute(strm, src_f32_m, src_m);
+    memory idx_m(idx_md, eng, indices.data());
+    memory off_m(off_md, eng, offsets.data());
+    memory dst_m(dst_md, eng);
+
+    std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src_m},
+            {DNNL_ARG_INDICES, idx_m}, {DNNL_ARG_OFFSETS, off_m},
+            {DNNL_ARG_DST, dst_m}};
+    if (p.with_weights)
+        args[DNNL_ARG_WEIGHTS] = memory(wei_md, eng, weights.data());
+    if (is_int8)
+        args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC] = memory(
+                {{p.rows}, mdt::f32, tag::a}, eng, row_scales.data());
+    prim.execute(strm, args);
+    strm.wait();
+
+    const float *dst = static_cast<const float *>(dst_m.get_data_handle());
+    const float tol = p.src_dt == mdt::bf16 ? 5e-2f : 1e-5f;
+    for (memory::dim i = 0; i < p.batch * p.dim; ++i)
+        ASSERT_NEAR(dst[i], dst_ref[i], tol * std::max(1.f, dst_ref[i]))
+                << "at index " << i;
+}
+
+TEST(embedding_bag_iface_test_t, InvalidArguments) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "Embedding bag primitive is CPU-only.");
+    engine eng(engine::kind::cpu, 0);
+
+    memory::desc src_md({16, 8}, mdt::f32, tag::ab);
+    memory::desc idx_md({10}, mdt::s32, tag::a);
+    memory::desc off_md({4}, mdt::s32, tag::a);
+    memory::desc dst_md({4, 8}, mdt::f32, tag::ab);
+
+    // dst batch does not match the number of offsets.
+    memory::desc bad_dst_md({3, 8}, mdt::f32, tag::ab);
+    EXPECT_ANY_THROW(embedding_bag_t::pd_t(eng, algorithm::reduction_sum,
+            src_md, idx_md, off_md, memory::desc(), bad_dst_md));
+
+    // per-sample weights are only supported with sum pooling.
+    memory::desc wei_md({10}, mdt::f32, tag::a);
+    EXPECT_ANY_THROW(embedding_bag_t::pd_t(eng, algorithm::reduction_max,
+            src_md, idx_md, off_md, wei_md, dst_md));
+
+    // indices must be s32.
+    memory::desc f32_idx_md({10}, mdt::f32, tag::a);
+    EXPECT_ANY_THROW(embedding_bag_t::pd_t(eng, algorithm::reduction_sum,
+            src_md, f32_idx_md, off_md, memory::desc(), dst_md));
+}
+
+TEST(embedding_bag_iface_test_t, OutOfRangeIndices) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "Embedding bag primitive is CPU-only.");
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    memory::desc src_md({4, 2}, mdt::f32, tag::ab);
+    memory::desc idx_md({3}, mdt::s32, tag::a);
+    memory::desc off_md({1}, mdt::s32, tag::a);
+    memory::desc dst_md({1, 2}, mdt::f32, tag::ab);
+
+    embedding_bag_t::pd_t pd;
+    ASSERT_NO_THROW(pd = embedding_bag_t::pd_t(eng, algorithm::reduction_sum,
+                            src_md, idx_md, off_md, memory::desc(), dst_md));
+    embedding_bag_t prim(pd);
+
+    std::vector<float> table = {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f};
+    std::vector<int> offsets = {0};
+    memory src_m(src_md, eng, table.data());
+    memory off_m(off_md, eng, offsets.data());
+    memory dst_m(dst_md, eng);
+
+    for (int bad_index : {-1, 4}) {
+        std::vector<int> indices = {1, bad_index, 3};
+        memory idx_m(idx_md, eng, indices.data());
+        EXPECT_ANY_THROW(prim.execute(strm,
+                {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_INDICES, idx_m},
+                        {DNNL_ARG_OFFSETS, off_m}, {DNNL_ARG_DST, dst_m}}));
+        strm.wait();
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(TestEmbeddingBag, embedding_bag_test_t,
+        ::testing::Values(
+                embedding_bag_params_t {algorithm::reduction_sum, 64, 16, 40,
+                        6, false, mdt::f32},
+                embedding_bag_params_t {algorithm::reduction_sum, 100, 33, 77,
+                        8, true, mdt::f32},
+                embedding_bag_params_t {algorithm::reduction_mean, 50, 64, 30,
+                        5, false, mdt::f32},
+                embedding_bag_params_t {algorithm::reduction_max, 31, 17, 60,
+                        7, false, mdt::f32},
+                embedding_bag_params_t {algorithm::reduction_sum, 64, 128, 200,
+                        12, false, mdt::bf16},
+                embedding_bag_params_t {algorithm::reduction_sum, 80, 24, 50,
+                        6, true, mdt::s8},
+                embedding_bag_params_t {algorithm::reduction_max, 80, 24, 50,
+                        6, false, mdt::s8}));
+
+} // namespace dnnl
@@ -0,0 +1,79 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include "stdlib.h"
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "cpu/x64/jit_code_arena.hpp"
+
+namespace dnnl {
+
+// The environment variable is read once per process, hence the test is built
+// as a separate executable.
+TEST(jit_code_arena_test_t, SharesIdenticalKernels) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "JIT code arena is a CPU feature.");
+    ASSERT_EQ(::setenv("ONEDNN_JIT_CODE_ARENA", "1", 1), 0);
+    // Make sure every primitive generates its own kernel.
+    set_primitive_cache_capacity(0);
+
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+    memory::desc md({2, 32, 8, 8}, memory::data_type::f32,
+            memory::format_tag::nchw);
+    auto pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md,
+            0.f);
+    SKIP_IF(std::string(pd.impl_info_str()).find("jit") == std::string::npos,
+            "No JIT implementation for the problem.");
+
+    std::vector<float> src(md.get_size() / sizeof(float));
+    for (size_t i = 0; i < src.size(); ++i)
+        src[i] = static_cast<float>(static_cast<int>(i % 7) - 3);
+
+    std::vector<eltwise_forward> prims;
+    for (int i = 0; i < 2; ++i)
+        prims.emplace_back(pd);
+
+    const auto stats = impl::cpu::x64::get_jit_code_arena_stats();
+    SKIP_IF(stats.mapped_bytes == 0, "JIT code arena is not supported.");
+    EXPECT_GT(stats.code_bytes, 0u);
+    EXPECT_GE(stats.shared_kernels, 1u);
+
+    // Kernels executed from the arena produce correct results.
+    for (auto &prim : prims) {
+        std::vector<float> dst(src.size(), -1.f);
+        memory src_m(md, eng, src.data()), dst_m(md, eng, dst.data());
+        prim.execute(strm, {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_DST, dst_m}});
+        strm.wait();
+        for (size_t i = 0; i < src.size(); ++i)
+            ASSERT_EQ(dst[i], src[i] > 0.f ? src[i] : 0.f);
+    }
+
+    // Releasing the primitives releases their kernels.
+    prims.clear();
+    EXPECT_LT(impl::cpu::x64::get_jit_code_arena_stats().code_bytes,
+            stats.code_bytes);
+}
+
+} // namespace dnnl
@@ -0,0 +1,228 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+#include "common/rope_iface.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using mdt = memory::data_type;
+
+/// Rotary position embedding internal primitive.
+struct rope_t : public primitive {
+    /// Primitive descriptor for a rope primitive.
+    struct pd_t : public primitive_desc {
+        /// Default constructor. Produces an empty object.
+        pd_t() = default;
+
+        pd_t(const engine &aengine, bool interleaved,
+                const memory::desc &src_desc, const memory::desc &cos_desc,
+                const memory::desc &sin_desc, const memory::desc &pos_desc,
+                const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr()) {
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_rope_primitive_desc_create(&pd,
+                    aengine.get(), interleaved, src_desc.get(),
+                    cos_desc.get(), sin_desc.get(), pos_desc.get(),
+                    dst_desc.get(), attr.get());
+
+            error::wrap_c_api(status,
+                    "could not create a primitive descriptor for a rope "
+                    "primitive");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    rope_t() = default;
+
+    /// Constructs a rope primitive.
+    /// @param pd Primitive descriptor for a rope primitive.
+    rope_t(const pd_t &pd) : primitive(pd) {}
+};
+
+struct rope_params_t {
+    bool interleaved;
+    memory::dims src_dims;
+    memory::dim max_pos;
+    // Empty when the position is the index along the sequence dimension.
+    memory::dims pos_dims;
+    bool in_place;
+    mdt dt;
+};
+
+class rope_test_t : public ::testing::TestWithParam<rope_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "Rope primitive is CPU-only.");
+        p = GetParam();
+        eng = engine(engine::kind::cpu, 0);
+        SKIP_IF(unsupported_data_type(p.dt, eng),
+                "Engine does not support this data type.");
+    }
+
+    rope_params_t p;
+    engine eng;
+};
+
+TEST_P(rope_test_t, Compare) {
+    stream strm(eng);
+
+    const int ndims = static_cast<int>(p.src_dims.size());
+    const memory::dim D = p.src_dims[ndims - 1];
+    const memory::dim S = p.src_dims[ndims - 2];
+    const memory::dim H = D / 2;
+    memory::dim nrows = 1;
+    for (int d = 0; d < ndims - 1; ++d)
+        nrows *= p.src_dims[d];
+
+    std::vector<float> src(nrows * D);
+    for (size_t i = 0; i < src.size(); ++i)
+        src[i] = 0.125f * static_cast<float>(static_cast<int>(i % 13) - 6);
+
+    std::vector<float> cos_t(p.max_pos * H), sin_t(p.max_pos * H);
+    for (memory::dim pos = 0; pos < p.max_pos; ++pos)
+        for (memory::dim i = 0; i < H; ++i) {
+            const float theta = static_cast<float>(pos)
+                    * std::pow(10000.f, -2.f * static_cast<float>(i) / D);
+            cos_t[pos * H + i] = std::cos(theta);
+            sin_t[pos * H + i] = std::sin(theta);
+        }
+
+    const bool with_pos = !p.pos_dims.empty();
+    memory::dim npos = 1;
+    for (auto d : p.pos_dims)
+        npos *= d;
+    std::vector<int> pos_ids(with_pos ? npos : 0);
+    for (memory::dim i = 0; i < npos && with_pos; ++i)
+        pos_ids[i] = static_cast<int>((i * 5 + 1) % p.max_pos);
+
+    // reference
+    std::vector<float> dst_ref(src.size());
+    for (memory::dim r = 0; r < nrows; ++r) {
+        memory::dim pos = r % S;
+        if (with_pos) {
+            // Unravel the row index and apply broadcast of position ids.
+            memory::dim rem = r, off = 0, stride = 1;
+            for (int d = ndims - 2; d >= 0; --d) {
+                const memory::dim idx = rem % p.src_dims[d];
+                rem /= p.src_dims[d];
+                if (p.pos_dims[d] != 1) off += idx * stride;
+                stride *= p.pos_dims[d];
+            }
+            pos = pos_ids[off];
+        }
+        for (memory::dim i = 0; i < H; ++i) {
+            const memory::dim i0 = p.interleaved ? 2 * i : i;
+            const memory::dim i1 = p.interleaved ? 2 * i + 1 : i + H;
+            const float c = cos_t[pos * H + i], s = sin_t[pos * H + i];
+            const float x0 = src[r * D + i0], x1 = src[r * D + i1];
+            dst_ref[r * D + i0] = x0 * c - x1 * s;
+            dst_ref[r * D + i1] = x1 * c + x0 * s;
+        }
+    }
+
+    const tag src_tag = ndims == 3 ? tag::abc : tag::abcd;
+    memory::desc src_md(p.src_dims, p.dt, src_tag);
+    memory::desc tbl_md({p.max_pos, H}, mdt::f32, tag::ab);
+    memory::desc pos_md = with_pos
+            ? memory::desc(p.pos_dims, mdt::s32,
+                    ndims == 3 ? tag::ab : tag::abc)
+            : memory::desc();
+
+    rope_t::pd_t pd;
+    ASSERT_NO_THROW(pd = rope_t::pd_t(eng, p.interleaved, src_md, tbl_md,
+                            tbl_md, pos_md, src_md));
+    rope_t prim(pd);
+
+    memory src_f32_m({p.src_dims, mdt::f32, src_tag}, eng, src.data());
+    memory src_m(src_md, eng);
+    reorder(src_f32_m, src_m).execute(strm, src_f32_m, src_m);
+    memory dst_m = p.in_place ? src_m : memory(src_md, eng);
+
+    std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src_m},
+            {DNNL_ARG_COS, memory(tbl_md, eng, cos_t.data())},
+            {DNNL_ARG_SIN, memory(tbl_md, eng, sin_t.data())},
+            {DNNL_ARG_DST, dst_m}};
+    if (with_pos)
+        args[DNNL_ARG_POSITIONS] = memory(pos_md, eng, pos_ids.data());
+    prim.execute(strm, args);
+
+    memory dst_f32_m({p.src_dims, mdt::f32, src_tag}, eng);
+    reorder(dst_m, dst_f32_m).execute(strm, dst_m, dst_f32_m);
+    strm.wait();
+
+    const float *dst = static_cast<const float *>(dst_f32_m.get_data_handle());
+    const float tol = p.dt == mdt::f32 ? 1e-5f : 2e-2f;
+    for (size_t i = 0; i < dst_ref.size(); ++i)
+        ASSERT_NEAR(dst[i], dst_ref[i], tol) << "at index " << i;
+}
+
+TEST(rope_iface_test_t, InvalidArguments) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "Rope primitive is CPU-only.");
+    engine eng(engine::kind::cpu, 0);
+
+    memory::desc src_md({2, 4, 16, 8}, mdt::f32, tag::abcd);
+    memory::desc tbl_md({32, 4}, mdt::f32, tag::ab);
+
+    // The rotated dimension must be even.
+    memory::desc odd_md({2, 4, 16, 7}, mdt::f32, tag::abcd);
+    EXPECT_ANY_THROW(rope_t::pd_t(
+            eng, false, odd_md, tbl_md, tbl_md, memory::desc(), odd_md));
+
+    // Tables must have head_size / 2 columns.
+    memory::desc bad_tbl_md({32, 8}, mdt::f32, tag::ab);
+    EXPECT_ANY_THROW(rope_t::pd_t(eng, false, src_md, bad_tbl_md, bad_tbl_md,
+            memory::desc(), src_md));
+
+    // Without position ids the table must cover the whole sequence.
+    memory::desc short_tbl_md({8, 4}, mdt::f32, tag::ab);
+    EXPECT_ANY_THROW(rope_t::pd_t(eng, false, src_md, short_tbl_md,
+            short_tbl_md, memory::desc(), src_md));
+
+    // Position ids must be s32.
+    memory::desc f32_pos_md({2, 1, 16}, mdt::f32, tag::abc);
+    EXPECT_ANY_THROW(rope_t::pd_t(
+            eng, false, src_md, tbl_md, tbl_md, f32_pos_md, src_md));
+}
+
+INSTANTIATE_TEST_SUITE_P(TestRope, rope_test_t,
+        ::testing::Values(rope_params_t {false, {2, 4, 16, 64}, 16, {}, false,
+                                  mdt::f32},
+                rope_params_t {true, {2, 4, 16, 64}, 32, {}, false, mdt::f32},
+                rope_params_t {false, {3, 2, 7, 34}, 64, {3, 1, 7}, false,
+                        mdt::f32},
+                rope_params_t {true, {1, 8, 5, 128}, 64, {1, 8, 5}, true,
+                        mdt::f32},
+                rope_params_t {false, {4, 9, 32}, 9, {}, true, mdt::f32},
+                rope_params_t {false, {2, 4, 16, 64}, 16, {1, 1, 16}, false,
+                        mdt::bf16},
+                rope_params_t {true, {2, 4, 16, 64}, 16, {}, true,
+                        mdt::f16}));
+
+} // namespace dnnl
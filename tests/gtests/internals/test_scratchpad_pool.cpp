@@ -0,0 +1,131 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include <thread>
+#include <vector>
+
+#include "stdlib.h"
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "common/scratchpad.hpp"
+
+namespace dnnl {
+
+namespace {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+void custom_setenv(const char *name, const char *value, int overwrite) {
+#ifdef _WIN32
+    auto status = SetEnvironmentVariable(name, value);
+    EXPECT_NE(status, 0);
+#else
+    auto status = ::setenv(name, value, overwrite);
+    EXPECT_EQ(status, 0);
+#endif
+}
+
+convolution_forward::primitive_desc make_conv_pd(
+        const engine &eng, scratchpad_mode mode) {
+    primitive_attr attr;
+    attr.set_scratchpad_mode(mode);
+    memory::desc src_md({1, 16, 32, 32}, dt::f32, tag::nchw);
+    memory::desc wei_md({32, 16, 3, 3}, dt::f32, tag::oihw);
+    memory::desc dst_md({1, 32, 30, 30}, dt::f32, tag::nchw);
+    return convolution_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            src_md, wei_md, dst_md, {1, 1}, {0, 0}, {0, 0}, attr);
+}
+
+} // namespace
+
+// The environment variable is read once per process, hence the test is built
+// as a separate executable.
+TEST(scratchpad_pool_test_t, BorrowsAndReuses) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "Scratchpad pool is a CPU feature.");
+    custom_setenv("ONEDNN_SCRATCHPAD_POOL", "1", 1);
+
+    engine eng(engine::kind::cpu, 0);
+    auto user_pd = make_conv_pd(eng, scratchpad_mode::user);
+    SKIP_IF(user_pd.scratchpad_desc().get_size() == 0,
+            "The convolution does not use a scratchpad.");
+    auto pd = make_conv_pd(eng, scratchpad_mode::library);
+
+    std::vector<float> src(user_pd.src_desc().get_size() / sizeof(float));
+    std::vector<float> wei(user_pd.weights_desc().get_size() / sizeof(float));
+    for (size_t i = 0; i < src.size(); ++i)
+        src[i] = static_cast<float>(static_cast<int>(i % 7) - 3);
+    for (size_t i = 0; i < wei.size(); ++i)
+        wei[i] = static_cast<float>(static_cast<int>(i % 5) - 2);
+    memory src_m(pd.src_desc(), eng, src.data());
+    memory wei_m(pd.weights_desc(), eng, wei.data());
+
+    // Reference results computed with a user-provided scratchpad.
+    std::vector<float> ref(pd.dst_desc().get_size() / sizeof(float));
+    {
+        stream strm(eng);
+        memory dst_m(pd.dst_desc(), eng, ref.data());
+        memory scratchpad_m(user_pd.scratchpad_desc(), eng);
+        convolution_forward(user_pd).execute(strm,
+                {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_WEIGHTS, wei_m},
+                        {DNNL_ARG_DST, dst_m},
+                        {DNNL_ARG_SCRATCHPAD, scratchpad_m}});
+        strm.wait();
+    }
+
+    convolution_forward prim(pd);
+    const auto run_and_check = [&]() {
+        stream strm(eng);
+        std::vector<float> dst(ref.size(), -1.f);
+        memory dst_m(pd.dst_desc(), eng, dst.data());
+        prim.execute(strm,
+                {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_WEIGHTS, wei_m},
+                        {DNNL_ARG_DST, dst_m}});
+        strm.wait();
+        for (size_t i = 0; i < dst.size(); ++i)
+            ASSERT_EQ(dst[i], ref[i]) << "at index " << i;
+    };
+
+    const int nruns = 16;
+    for (int i = 0; i < nruns / 2; ++i)
+        run_and_check();
+    // Threads executing one after another share the pooled buffers.
+    for (int i = 0; i < nruns / 2; ++i) {
+        std::thread t(run_and_check);
+        t.join();
+    }
+
+    const auto stats = impl::get_scratchpad_pool_stats();
+    SKIP_IF(stats.allocations + stats.hits == 0,
+            "Scratchpad pool is not supported in this configuration.");
+    EXPECT_EQ(stats.allocations + stats.hits, static_cast<size_t>(nruns));
+    EXPECT_LT(stats.allocations, static_cast<size_t>(nruns / 2));
+    EXPECT_GT(stats.pooled_bytes, 0u);
+    EXPECT_GE(stats.peak_pooled_bytes, stats.pooled_bytes);
+    EXPECT_EQ(stats.unpooled_allocations, 0u);
+}
+
+} // namespace dnnl
@@ -0,0 +1,188 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#define DNNL_ARG_DST_INDICES DNNL_ARG_DST_1
+
+#include "common/topk_iface.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using mdt = memory::data_type;
+
+/// Top-k internal primitive.
+struct topk_t : public primitive {
+    /// Primitive descriptor for a top-k primitive.
+    struct pd_t : public primitive_desc {
+        /// Default constructor. Produces an empty object.
+        pd_t() = default;
+
+        pd_t(const engine &aengine, memory::dim k, bool with_softmax,
+                float temperature, const memory::desc &src_desc,
+                const memory::desc &dst_desc,
+                const memory::desc &indices_desc,
+                const primitive_attr &attr = default_attr()) {
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_topk_primitive_desc_create(&pd,
+                    aengine.get(), k, with_softmax, temperature,
+                    src_desc.get(), dst_desc.get(), indices_desc.get(),
+                    attr.get());
+
+            error::wrap_c_api(status,
+                    "could not create a primitive descriptor for a top-k "
+                    "primitive");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    topk_t() = default;
+
+    /// Constructs a top-k primitive.
+    /// @param pd Primitive descriptor for a top-k primitive.
+    topk_t(const pd_t &pd) : primitive(pd) {}
+};
+
+struct topk_params_t {
+    memory::dim rows, n, k;
+    bool with_softmax;
+    float temperature;
+    mdt src_dt;
+};
+
+class topk_test_t : public ::testing::TestWithParam<topk_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "Top-k primitive is CPU-only.");
+        p = GetParam();
+        eng = engine(engine::kind::cpu, 0);
+        SKIP_IF(unsupported_data_type(p.src_dt, eng),
+                "Engine does not support this data type.");
+    }
+
+    topk_params_t p;
+    engine eng;
+};
+
+TEST_P(topk_test_t, Compare) {
+    stream strm(eng);
+
+    // Values repeat to exercise the tie breaking by index. They are exactly
+    // representable in all the tested data types.
+    std::vector<float> src(p.rows * p.n);
+    for (size_t i = 0; i < src.size(); ++i)
+        src[i] = 0.25f * static_cast<float>((i * 7919) % 61) - 7.f;
+
+    // reference
+    std::vector<float> vals_ref(p.rows * p.k);
+    std::vector<int> idx_ref(p.rows * p.k);
+    for (memory::dim r = 0; r < p.rows; ++r) {
+        const float *row = src.data() + r * p.n;
+        std::vector<int> order(p.n);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(),
+                [&](int a, int b) { return row[a] > row[b]; });
+
+        const float max = row[order[0]];
+        double sum = 0.;
+        for (memory::dim i = 0; i < p.n; ++i)
+            sum += std::exp((row[i] - max) / p.temperature);
+        for (memory::dim j = 0; j < p.k; ++j) {
+            const float v = row[order[j]];
+            vals_ref[r * p.k + j] = p.with_softmax
+                    ? static_cast<float>(
+                            std::exp((v - max) / p.temperature) / sum)
+                    : v;
+            idx_ref[r * p.k + j] = order[j];
+        }
+    }
+
+    memory::desc src_md({p.rows, p.n}, p.src_dt, tag::ab);
+    memory::desc dst_md({p.rows, p.k}, mdt::f32, tag::ab);
+    memory::desc idx_md({p.rows, p.k}, mdt::s32, tag::ab);
+
+    topk_t::pd_t pd;
+    ASSERT_NO_THROW(pd = topk_t::pd_t(eng, p.k, p.with_softmax,
+                            p.temperature, src_md, dst_md, idx_md));
+    topk_t prim(pd);
+
+    memory src_f32_m({{p.rows, p.n}, mdt::f32, tag::ab}, eng, src.data());
+    memory src_m(src_md, eng);
+    reorder(src_f32_m, src_m).execute(strm, src_f32_m, src_m);
+    memory dst_m(dst_md, eng);
+    memory idx_m(idx_md, eng);
+
+    prim.execute(strm,
+            {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_DST, dst_m},
+                    {DNNL_ARG_DST_INDICES, idx_m}});
+    strm.wait();
+
+    const float *dst = static_cast<const float *>(dst_m.get_data_handle());
+    const int *idx = static_cast<const int *>(idx_m.get_data_handle());
+    for (memory::dim i = 0; i < p.rows * p.k; ++i) {
+        ASSERT_EQ(idx[i], idx_ref[i]) << "at index " << i;
+        ASSERT_NEAR(dst[i], vals_ref[i], 1e-5f * std::max(1.f, vals_ref[i]))
+                << "at index " << i;
+    }
+}
+
+TEST(topk_iface_test_t, InvalidArguments) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "Top-k primitive is CPU-only.");
+    engine eng(engine::kind::cpu, 0);
+
+    memory::desc src_md({4, 100}, mdt::f32, tag::ab);
+    memory::desc dst_md({4, 8}, mdt::f32, tag::ab);
+    memory::desc idx_md({4, 8}, mdt::s32, tag::ab);
+
+    // k exceeds the row size.
+    memory::desc big_dst_md({4, 101}, mdt::f32, tag::ab);
+    memory::desc big_idx_md({4, 101}, mdt::s32, tag::ab);
+    EXPECT_ANY_THROW(
+            topk_t::pd_t(eng, 101, false, 1.f, src_md, big_dst_md, big_idx_md));
+
+    // Outputs must have k elements in the innermost dimension.
+    EXPECT_ANY_THROW(topk_t::pd_t(eng, 4, false, 1.f, src_md, dst_md, idx_md));
+
+    // Indices must be s32.
+    memory::desc f32_idx_md({4, 8}, mdt::f32, tag::ab);
+    EXPECT_ANY_THROW(
+            topk_t::pd_t(eng, 8, false, 1.f, src_md, dst_md, f32_idx_md));
+
+    // Temperature must be positive.
+    EXPECT_ANY_THROW(topk_t::pd_t(eng, 8, true, 0.f, src_md, dst_md, idx_md));
+}
+
+INSTANTIATE_TEST_SUITE_P(TestTopk, topk_test_t,
+        ::testing::Values(topk_params_t {8, 100, 5, false, 1.f, mdt::f32},
+                topk_params_t {3, 1000, 1, false, 1.f, mdt::f32},
+                topk_params_t {1, 50000, 40, false, 1.f, mdt::f32},
+                topk_params_t {1, 50000, 40, true, 0.7f, mdt::f32},
+                topk_params_t {2, 33000, 17, true, 1.f, mdt::bf16},
+                topk_params_t {5, 64, 64, true, 2.f, mdt::f16}));
+
+} // namespace dnnl
@@ -0,0 +1,130 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+namespace {
+
+std::string read_file(const std::string &path) {
+    std::ifstream ifs(path, std::ios::binary);
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    return ss.str();
+}
+
+void run_eltwise(const engine &eng, memory::dim size) {
+    auto strm = make_stream(eng);
+    memory::desc md({size}, memory::data_type::f32, memory::format_tag::a);
+    auto pd = eltwise_forward::primitive_desc(eng, prop_kind::forward_inference,
+            algorithm::eltwise_relu, md, md, 0.f, 0.f);
+    memory src(md, eng), dst(md, eng);
+    eltwise_forward(pd).execute(
+            strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    strm.wait();
+}
+
+} // namespace
+
+TEST(trace_test_t, TestChromeAndPerfetto) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "Tracing records CPU activity only.");
+    SKIP_IF(set_trace(1) == status::unimplemented,
+            "Tracing is disabled at build time.");
+
+    const std::string json_path = "onednn_test_trace.json";
+    const std::string pftrace_path = "onednn_test_trace.pftrace";
+
+    run_eltwise(engine(engine::kind::cpu, 0), 1 << 20);
+    ASSERT_EQ(set_trace(0), status::success);
+    ASSERT_EQ(dump_trace(json_path, trace_format::chrome_json),
+            status::success);
+    const std::string json = read_file(json_path);
+    std::remove(json_path.c_str());
+    ASSERT_EQ(json.front(), '{');
+    EXPECT_NE(json.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(json.find("\"cat\":\"create\""), std::string::npos);
+    EXPECT_NE(json.find("\"cat\":\"exec\""), std::string::npos);
+    EXPECT_NE(json.find("eltwise"), std::string::npos);
+
+    // Spans recorded while tracing is disabled are dropped.
+    run_eltwise(engine(engine::kind::cpu, 0), 16);
+    ASSERT_EQ(dump_trace(json_path, trace_format::chrome_json),
+            status::success);
+    EXPECT_EQ(read_file(json_path).find("\"cat\":\"exec\""),
+            std::string::npos);
+    std::remove(json_path.c_str());
+
+    ASSERT_EQ(set_trace(1), status::success);
+    run_eltwise(engine(engine::kind::cpu, 0), 1 << 20);
+    ASSERT_EQ(set_trace(0), status::success);
+    ASSERT_EQ(dump_trace(pftrace_path, trace_format::perfetto),
+            status::success);
+    const std::string pftrace = read_file(pftrace_path);
+    std::remove(pftrace_path.c_str());
+    // Every packet is the field 1 of the Trace message.
+    ASSERT_FALSE(pftrace.empty());
+    EXPECT_EQ(pftrace[0], '\x0a');
+    EXPECT_NE(pftrace.find("exec"), std::string::npos);
+}
+
+TEST(trace_test_t, TestDisabled) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "Tracing records CPU activity only.");
+    // Without DNNL_ENABLE_TRACE, tracing cannot be turned on and the dump
+    // carries no spans.
+    const status st = set_trace(0);
+    ASSERT_TRUE(st == status::success || st == status::unimplemented);
+    if (st == status::unimplemented) {
+        EXPECT_EQ(set_trace(1), status::unimplemented);
+    }
+
+    const std::string json_path = "onednn_test_trace_disabled.json";
+    // Drops the spans recorded before the test.
+    ASSERT_EQ(dump_trace(json_path, trace_format::chrome_json),
+            status::success);
+    run_eltwise(engine(engine::kind::cpu, 0), 16);
+    ASSERT_EQ(dump_trace(json_path, trace_format::chrome_json),
+            status::success);
+    const std::string json = read_file(json_path);
+    std::remove(json_path.c_str());
+    ASSERT_FALSE(json.empty());
+    EXPECT_EQ(json.front(), '{');
+    EXPECT_EQ(json.find("\"cat\":\"create\""), std::string::npos);
+    EXPECT_EQ(json.find("\"cat\":\"exec\""), std::string::npos);
+}
+
+TEST(trace_test_t, TestInvalidArguments) {
+    SKIP_IF(set_trace(0) == status::unimplemented,
+            "Tracing is disabled at build time.");
+    EXPECT_EQ(set_trace(2), status::invalid_arguments);
+    EXPECT_EQ(dnnl_dump_trace(nullptr, dnnl_trace_format_chrome_json),
+            dnnl_invalid_arguments);
+    EXPECT_EQ(dnnl_dump_trace("trace.json", (dnnl_trace_format_t)7),
+            dnnl_invalid_arguments);
+}
+
+} // namespace dnnl
@@ -0,0 +1,303 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct gemm_batch_params_t {
+    char transa, transb;
+    memory::dim M, N, K, batch;
+};
+
+class gemm_batch_test_t
+    : public ::testing::TestWithParam<gemm_batch_params_t> {
+protected:
+    void SetUp() override {
+        p = GetParam();
+        lda = p.transa == 'N' ? p.K : p.M;
+        ldb = p.transb == 'N' ? p.N : p.K;
+        ldc = p.N;
+        // Add some padding between the matrices to make sure strides are
+        // respected.
+        stride_a = p.M * p.K + 3;
+        stride_b = p.K * p.N + 5;
+        stride_c = p.M * p.N + 7;
+    }
+
+    template <typename T>
+    static void fill(std::vector<T> &v, int mod, int shift) {
+        for (size_t i = 0; i < v.size(); ++i)
+            v[i] = static_cast<T>(static_cast<int>((i * 13) % mod) - shift);
+    }
+
+    gemm_batch_params_t p;
+    memory::dim lda, ldb, ldc, stride_a, stride_b, stride_c;
+};
+
+TEST_P(gemm_batch_test_t, SgemmBatchStrided) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "GEMM batch API is CPU-only.");
+
+    std::vector<float> A(p.batch * stride_a), B(p.batch * stride_b);
+    std::vector<float> C(p.batch * stride_c, 1.f), C_ref(C);
+    fill(A, 7, 3);
+    fill(B, 5, 2);
+
+    const float alpha = 0.5f, beta = 1.f;
+    for (memory::dim i = 0; i < p.batch; ++i)
+        ASSERT_EQ(sgemm(p.transa, p.transb, p.M, p.N, p.K, alpha,
+                          A.data() + i * stride_a, lda, B.data() + i * stride_b,
+                          ldb, beta, C_ref.data() + i * stride_c, ldc),
+                status::success);
+
+    ASSERT_EQ(sgemm_batch_strided(p.transa, p.transb, p.M, p.N, p.K, alpha,
+                      A.data(), lda, stride_a, B.data(), ldb, stride_b, beta,
+                      C.data(), ldc, stride_c, p.batch),
+            status::success);
+
+    for (size_t i = 0; i < C.size(); ++i)
+        ASSERT_NEAR(C[i], C_ref[i], 1e-4f * p.K) << "at index " << i;
+}
+
+TEST_P(gemm_batch_test_t, SgemmBatch) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "GEMM batch API is CPU-only.");
+
+    std::vector<float> A(p.batch * stride_a), B(p.batch * stride_b);
+    std::vector<float> C(p.batch * stride_c, 0.f), C_ref(C);
+    fill(A, 11, 5);
+    fill(B, 3, 1);
+
+    std::vector<const float *> A_ptrs(p.batch), B_ptrs(p.batch);
+    std::vector<float *> C_ptrs(p.batch);
+    // Traverse the matrices in reverse order to make sure the pointers are
+    // used rather than the base addresses.
+    for (memory::dim i = 0; i < p.batch; ++i) {
+        const memory::dim j = p.batch - 1 - i;
+        A_ptrs[i] = A.data() + j * stride_a;
+        B_ptrs[i] = B.data() + j * stride_b;
+        C_ptrs[i] = C.data() + j * stride_c;
+        ASSERT_EQ(sgemm(p.transa, p.transb, p.M, p.N, p.K, 1.f, A_ptrs[i], lda,
+                          B_ptrs[i], ldb, 0.f, C_ref.data() + j * stride_c,
+                          ldc),
+                status::success);
+    }
+
+    ASSERT_EQ(sgemm_batch(p.transa, p.transb, p.M, p.N, p.K, 1.f,
+                      A_ptrs.data(), lda, B_ptrs.data(), ldb, 0.f,
+                      C_ptrs.data(), ldc, p.batch),
+            status::success);
+
+    for (size_t i = 0; i < C.size(); ++i)
+        ASSERT_NEAR(C[i], C_ref[i], 1e-4f * p.K) << "at index " << i;
+}
+
+TEST_P(gemm_batch_test_t, GemmU8S8S32BatchStrided) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "GEMM batch API is CPU-only.");
+
+    std::vector<uint8_t> A(p.batch * stride_a);
+    std::vector<int8_t> B(p.batch * stride_b);
+    std::vector<int32_t> C(p.batch * stride_c, 0), C_ref(C);
+    fill(A, 17, 0);
+    fill(B, 9, 4);
+
+    const int32_t co = 3;
+    for (memory::dim i = 0; i < p.batch; ++i)
+        ASSERT_EQ(gemm_u8s8s32(p.transa, p.transb, 'F', p.M, p.N, p.K, 1.f,
+                          A.data() + i * stride_a, lda, 1,
+                          B.data() + i * stride_b, ldb, 0, 0.f,
+                          C_ref.data() + i * stride_c, ldc, &co),
+                status::success);
+
+    ASSERT_EQ(gemm_u8s8s32_batch_strided(p.transa, p.transb, 'F', p.M, p.N,
+                      p.K, 1.f, A.data(), lda, stride_a, 1, B.data(), ldb,
+                      stride_b, 0, 0.f, C.data(), ldc, stride_c, &co, p.batch),
+            status::success);
+
+    for (size_t i = 0; i < C.size(); ++i)
+        ASSERT_EQ(C[i], C_ref[i]) << "at index " << i;
+}
+
+TEST_P(gemm_batch_test_t, GemmS8S8S32BatchStrided) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "GEMM batch API is CPU-only.");
+
+    std::vector<int8_t> A(p.batch * stride_a), B(p.batch * stride_b);
+    std::vector<int32_t> C(p.batch * stride_c, 2), C_ref(C);
+    fill(A, 13, 6);
+    fill(B, 9, 4);
+
+    const int32_t co = -5;
+    for (memory::dim i = 0; i < p.batch; ++i)
+        ASSERT_EQ(gemm_s8s8s32(p.transa, p.transb, 'F', p.M, p.N, p.K, 1.f,
+                          A.data() + i * stride_a, lda, 0,
+                          B.data() + i * stride_b, ldb, 0, 1.f,
+                          C_ref.data() + i * stride_c, ldc, &co),
+                status::success);
+
+    ASSERT_EQ(gemm_s8s8s32_batch_strided(p.transa, p.transb, 'F', p.M, p.N,
+                      p.K, 1.f, A.data(), lda, stride_a, 0, B.data(), ldb,
+                      stride_b, 0, 1.f, C.data(), ldc, stride_c, &co, p.batch),
+            status::success);
+
+    for (size_t i = 0; i < C.size(); ++i)
+        ASSERT_EQ(C[i], C_ref[i]) << "at index " << i;
+}
+
+TEST_P(gemm_batch_test_t, SgemmPackCompute) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "GEMM pack API is CPU-only.");
+
+    std::vector<float> A(p.M * p.K), B(p.K * p.N);
+    std::vector<float> C(p.M * p.N, 1.f), C_ref(C);
+    fill(A, 7, 3);
+    fill(B, 5, 2);
+
+    size_t size = 0;
+    auto st = sgemm_pack_get_size(
+            'B', p.transa, p.transb, p.M, p.N, p.K, lda, ldb, &size);
+    SKIP_IF(st == status::unimplemented, "GEMM pack API is not supported.");
+    ASSERT_EQ(st, status::success);
+
+    std::vector<float> B_packed(size / sizeof(float) + 1);
+    ASSERT_EQ(sgemm_pack('B', p.transa, p.transb, p.M, p.N, p.K, lda, ldb,
+                      B.data(), B_packed.data()),
+            status::success);
+
+    ASSERT_EQ(sgemm(p.transa, p.transb, p.M, p.N, p.K, 1.f, A.data(), lda,
+                      B.data(), ldb, 1.f, C_ref.data(), ldc),
+            status::success);
+    ASSERT_EQ(sgemm_compute(p.transa, 'P', p.M, p.N, p.K, A.data(), lda,
+                      B_packed.data(), ldb, 1.f, C.data(), ldc),
+            status::success);
+
+    for (size_t i = 0; i < C.size(); ++i)
+        ASSERT_NEAR(C[i], C_ref[i], 1e-4f * p.K) << "at index " << i;
+}
+
+TEST_P(gemm_batch_test_t, GemmU8S8S32PackCompute) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "GEMM pack API is CPU-only.");
+
+    std::vector<uint8_t> A(p.M * p.K);
+    std::vector<int8_t> B(p.K * p.N);
+    std::vector<int32_t> C(p.M * p.N, 1), C_ref(C);
+    fill(A, 17, 0);
+    fill(B, 9, 4);
+
+    size_t size = 0;
+    auto st = gemm_u8s8s32_pack_get_size(
+            'B', p.transa, p.transb, p.M, p.N, p.K, lda, ldb, &size);
+    SKIP_IF(st == status::unimplemented, "GEMM pack API is not supported.");
+    ASSERT_EQ(st, status::success);
+
+    std::vector<int8_t> B_packed(size);
+    ASSERT_EQ(gemm_u8s8s32_pack('B', p.transa, p.transb, p.M, p.N, p.K, lda,
+                      ldb, B.data(), B_packed.data()),
+            status::success);
+
+    const int32_t co = 0;
+    ASSERT_EQ(gemm_u8s8s32(p.transa, p.transb, 'F', p.M, p.N, p.K, 1.f,
+                      A.data(), lda, 0, B.data(), ldb, 0, 1.f, C_ref.data(),
+                      ldc, &co),
+            status::success);
+    ASSERT_EQ(gemm_u8s8s32_compute(p.transa, 'P', 'F', p.M, p.N, p.K,
+                      A.data(), lda, B_packed.data(), ldb, 1.f, C.data(), ldc,
+                      &co),
+            status::success);
+
+    for (size_t i = 0; i < C.size(); ++i)
+        ASSERT_EQ(C[i], C_ref[i]) << "at index " << i;
+}
+
+TEST_P(gemm_batch_test_t, GemmS8S8S32PackCompute) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "GEMM pack API is CPU-only.");
+
+    std::vector<int8_t> A(p.M * p.K), B(p.K * p.N);
+    std::vector<int32_t> C(p.M * p.N, 0), C_ref(C);
+    fill(A, 13, 6);
+    fill(B, 9, 4);
+
+    size_t size = 0;
+    auto st = gemm_s8s8s32_pack_get_size(
+            'A', p.transa, p.transb, p.M, p.N, p.K, lda, ldb, &size);
+    SKIP_IF(st == status::unimplemented, "GEMM pack API is not supported.");
+    ASSERT_EQ(st, status::success);
+
+    std::vector<int8_t> A_packed(size);
+    ASSERT_EQ(gemm_s8s8s32_pack('A', p.transa, p.transb, p.M, p.N, p.K, lda,
+                      ldb, A.data(), A_packed.data()),
+            status::success);
+
+    const int32_t co = 0;
+    ASSERT_EQ(gemm_s8s8s32(p.transa, p.transb, 'F', p.M, p.N, p.K, 1.f,
+                      A.data(), lda, 0, B.data(), ldb, 0, 0.f, C_ref.data(),
+                      ldc, &co),
+            status::success);
+    ASSERT_EQ(gemm_s8s8s32_compute('P', p.transb, 'F', p.M, p.N, p.K,
+                      A_packed.data(), lda, B.data(), ldb, 0.f, C.data(), ldc,
+                      &co),
+            status::success);
+
+    for (size_t i = 0; i < C.size(); ++i)
+        ASSERT_EQ(C[i], C_ref[i]) << "at index " << i;
+}
+
+TEST(gemm_batch_iface_test_t, InvalidPackIdentifier) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "GEMM pack API is CPU-only.");
+
+    size_t size = 0;
+    ASSERT_EQ(sgemm_pack_get_size('C', 'N', 'N', 4, 4, 4, 4, 4, &size),
+            status::invalid_arguments);
+    ASSERT_EQ(gemm_u8s8s32_pack_get_size('x', 'N', 'N', 4, 4, 4, 4, 4, &size),
+            status::invalid_arguments);
+    ASSERT_EQ(gemm_s8s8s32_pack_get_size('\0', 'N', 'N', 4, 4, 4, 4, 4, &size),
+            status::invalid_arguments);
+}
+
+TEST(gemm_batch_iface_test_t, InvalidBatch) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "GEMM batch API is CPU-only.");
+
+    float a = 1.f, b = 1.f, c = 0.f;
+    ASSERT_EQ(sgemm_batch_strided('N', 'N', 1, 1, 1, 1.f, &a, 1, 1, &b, 1, 1,
+                      0.f, &c, 1, 1, -1),
+            status::invalid_arguments);
+    ASSERT_EQ(sgemm_batch_strided('N', 'N', 1, 1, 1, 1.f, &a, 1, 1, &b, 1, 1,
+                      0.f, &c, 1, 1, 0),
+            status::success);
+    ASSERT_EQ(sgemm_batch('N', 'N', 1, 1, 1, 1.f, nullptr, 1, nullptr, 1, 0.f,
+                      nullptr, 1, 1),
+            status::invalid_arguments);
+}
+
+INSTANTIATE_TEST_SUITE_P(TestGemmBatch, gemm_batch_test_t,
+        ::testing::Values(gemm_batch_params_t {'N', 'N', 3, 4, 5, 1},
+                gemm_batch_params_t {'N', 'T', 7, 9, 8, 13},
+                gemm_batch_params_t {'T', 'N', 16, 16, 16, 64},
+                gemm_batch_params_t {'T', 'T', 33, 17, 65, 3},
+                gemm_batch_params_t {'N', 'N', 128, 96, 80, 5}));
+
+} // namespace dnnl
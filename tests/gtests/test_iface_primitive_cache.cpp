@@ -14,6 +14,12 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -47,6 +53,19 @@ void fill_primitive_cache(
     }
 }
 
+void fill_primitive_cache_binary(
+        int n, const engine &eng = engine(get_test_engine_kind(), 0)) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    for (int i = 0; i < n; i++) {
+        auto md = memory::desc({i + 1, 2, 3, 4}, dt::f32, tag::nchw);
+        auto add_pd = binary::primitive_desc(
+                eng, algorithm::binary_add, md, md, md);
+        auto add = binary(add_pd);
+    }
+}
+
 TEST(primitive_cache_test, TestDefaultCapacity) {
     custom_unsetenv("ONEDNN_PRIMITIVE_CACHE_CAPACITY");
     custom_unsetenv("DNNL_PRIMITIVE_CACHE_CAPACITY");
@@ -127,6 +146,132 @@ TEST(primitive_cache_test, TestCacheHit) {
 #endif
     ASSERT_EQ(get_primitive_cache_size(), 2);
 }
+
+TEST(primitive_cache_test, TestKindCapacity) {
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(16);
+    set_primitive_cache_capacity(primitive::kind::eltwise, 2);
+    const auto before = get_primitive_cache_stats(primitive::kind::eltwise);
+    ASSERT_EQ(before.capacity, 2);
+
+    fill_primitive_cache(5);
+    auto stats = get_primitive_cache_stats(primitive::kind::eltwise);
+    ASSERT_EQ(stats.size, 2);
+    ASSERT_EQ(stats.misses - before.misses, 5);
+    ASSERT_EQ(stats.evictions - before.evictions, 3);
+    ASSERT_EQ(get_primitive_cache_size(), 2);
+
+    const auto total = get_primitive_cache_stats();
+    ASSERT_EQ(total.size, 2);
+    ASSERT_EQ(total.capacity, 16);
+
+    // The last two primitives are still in the cache.
+    set_primitive_cache_capacity(primitive::kind::eltwise, -1);
+    fill_primitive_cache(5);
+    const auto after = get_primitive_cache_stats(primitive::kind::eltwise);
+    ASSERT_EQ(after.misses - stats.misses, 3);
+    ASSERT_EQ(after.hits - stats.hits, 2);
+    ASSERT_EQ(after.capacity, -1);
+    ASSERT_EQ(get_primitive_cache_size(), 5);
+
+    ASSERT_EQ(dnnl_set_primitive_cache_kind_capacity(dnnl_eltwise, -2),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_get_primitive_cache_stats(dnnl_eltwise, nullptr),
+            dnnl_invalid_arguments);
+}
+
+TEST(primitive_cache_test, TestBundle) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Primitive cache bundles are supported on CPU only.");
+    const std::string path = "test_primitive_cache_bundle.bin";
+    engine eng(get_test_engine_kind(), 0);
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(16);
+    fill_primitive_cache(5, eng);
+    ASSERT_EQ(save_primitive_cache_bundle(eng, path), 5);
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(16);
+    ASSERT_EQ(load_primitive_cache_bundle(eng, path), 5);
+    ASSERT_EQ(get_primitive_cache_size(), 5);
+
+    // The loaded primitives must be hit by the regular creation.
+    fill_primitive_cache(5, eng);
+    ASSERT_EQ(get_primitive_cache_size(), 5);
+
+    std::remove(path.c_str());
+}
+
+TEST(primitive_cache_test, TestBundleInvalid) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Primitive cache bundles are supported on CPU only.");
+    const std::string path = "test_primitive_cache_bundle_invalid.bin";
+    engine eng(get_test_engine_kind(), 0);
+    {
+        std::ofstream ofs(path, std::ios::binary);
+        ofs << "not a bundle";
+    }
+
+    int n_loaded = -1;
+    ASSERT_EQ(dnnl_primitive_cache_load_bundle(
+                      eng.get(), path.c_str(), &n_loaded),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(n_loaded, 0);
+
+    std::remove(path.c_str());
+}
+
+// A corrupt bundle must be rejected or loaded, but must not crash the
+// library.
+TEST(primitive_cache_test, TestBundleCorrupt) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Primitive cache bundles are supported on CPU only.");
+    const std::string path = "test_primitive_cache_bundle_corrupt.bin";
+    engine eng(get_test_engine_kind(), 0);
+
+    // Eltwise entries hold plain memory descriptors, binary entries hold an
+    // array of them.
+    using fill_func_t = void (*)(int, const engine &);
+    for (fill_func_t fill :
+            {&fill_primitive_cache, &fill_primitive_cache_binary}) {
+        set_primitive_cache_capacity(0);
+        set_primitive_cache_capacity(16);
+        fill(2, eng);
+        ASSERT_EQ(save_primitive_cache_bundle(eng, path), 2);
+
+        std::vector<char> data;
+        {
+            std::ifstream ifs(path, std::ios::binary);
+            data.assign(std::istreambuf_iterator<char>(ifs),
+                    std::istreambuf_iterator<char>());
+        }
+        ASSERT_FALSE(data.empty());
+
+        for (size_t i = 0; i < data.size(); i += 3) {
+            for (char mask : {'\x01', '\x80', '\xff'}) {
+                auto corrupt = data;
+                corrupt[i] ^= mask;
+                {
+                    std::ofstream ofs(
+                            path, std::ios::binary | std::ios::trunc);
+                    ofs.write(corrupt.data(), corrupt.size());
+                }
+                set_primitive_cache_capacity(0);
+                set_primitive_cache_capacity(16);
+                int n_loaded = -1;
+                const auto st = dnnl_primitive_cache_load_bundle(
+                        eng.get(), path.c_str(), &n_loaded);
+                ASSERT_TRUE(
+                        st == dnnl_success || st == dnnl_invalid_arguments)
+                        << "byte " << i;
+                ASSERT_TRUE(n_loaded >= 0 && n_loaded <= 2) << "byte " << i;
+            }
+        }
+    }
+
+    std::remove(path.c_str());
+}
 #endif
 
 } // namespace dnnl
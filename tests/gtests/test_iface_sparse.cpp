@@ -35,6 +35,19 @@ TEST(iface_sparse_test_t, TestSparseMDCreation) {
     ASSERT_NO_THROW(md = memory::desc::coo({64, 128}, dt::f32, nnz, dt::s32));
     // Packed.
     ASSERT_NO_THROW(md = memory::desc::packed({64, 128}, dt::f32, nnz));
+    // BSR.
+    ASSERT_NO_THROW(md = memory::desc::bsr({64, 128}, dt::f32, 4 * 16 * 16,
+                            {16, 16}, dt::s32, dt::s32));
+    // BSR: nnz is not a multiple of the block size.
+    EXPECT_ANY_THROW(memory::desc::bsr(
+            {64, 128}, dt::f32, nnz, {16, 16}, dt::s32, dt::s32));
+    // BSR: blocks do not divide the dimensions.
+    EXPECT_ANY_THROW(memory::desc::bsr(
+            {64, 128}, dt::f32, 0, {24, 16}, dt::s32, dt::s32));
+    // 2:4 structured.
+    ASSERT_NO_THROW(md = memory::desc::structured_2_4({64, 128}, dt::f32));
+    // 2:4 structured: the first dimension is not a multiple of 4.
+    EXPECT_ANY_THROW(memory::desc::structured_2_4({66, 128}, dt::f32));
 }
 
 TEST(iface_sparse_test_t, TestSparseMDComparison) {
@@ -94,6 +107,27 @@ TEST(iface_sparse_test_t, TestSparseMDComparison) {
     ASSERT_NO_THROW(md1 = memory::desc::packed({64, 128}, dt::f32, nnz));
     ASSERT_NO_THROW(md2 = memory::desc::packed({64, 128}, dt::f32, nnz + 1));
     ASSERT_NE(md1, md2);
+
+    // BSR.
+
+    // Equal memory descriptors.
+    ASSERT_NO_THROW(md1 = memory::desc::bsr({64, 128}, dt::f32, 2 * 16 * 32,
+                            {16, 32}, dt::s32, dt::s32));
+    ASSERT_NO_THROW(md2 = memory::desc::bsr({64, 128}, dt::f32, 2 * 16 * 32,
+                            {16, 32}, dt::s32, dt::s32));
+    ASSERT_EQ(md1, md2);
+
+    // Different block dimensions.
+    ASSERT_NO_THROW(md2 = memory::desc::bsr({64, 128}, dt::f32, 2 * 16 * 32,
+                            {32, 16}, dt::s32, dt::s32));
+    ASSERT_NE(md1, md2);
+
+    // 2:4 structured.
+
+    // Different value data types.
+    ASSERT_NO_THROW(md1 = memory::desc::structured_2_4({64, 128}, dt::bf16));
+    ASSERT_NO_THROW(md2 = memory::desc::structured_2_4({64, 128}, dt::s8));
+    ASSERT_NE(md1, md2);
 }
 
 TEST(iface_sparse_test_t, TestSparseMDQueries) {
@@ -139,6 +173,30 @@ TEST(iface_sparse_test_t, TestSparseMDQueries) {
 
     ASSERT_EQ(md.get_nnz(), nnz);
     ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::packed);
+
+    // BSR.
+    const int bsr_nnz = 3 * 8 * 32;
+    ASSERT_NO_THROW(md = memory::desc::bsr(dims, data_type, bsr_nnz, {8, 32},
+                            indices_dt, pointers_dt));
+    ASSERT_EQ(md.get_dims(), dims);
+    ASSERT_EQ(md.get_data_type(), data_type);
+    ASSERT_EQ(md.get_format_kind(), memory::format_kind::sparse);
+
+    ASSERT_EQ(md.get_nnz(), bsr_nnz);
+    ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::bsr);
+    ASSERT_EQ(md.get_data_type(1), indices_dt);
+    ASSERT_EQ(md.get_data_type(2), pointers_dt);
+
+    // 2:4 structured.
+    ASSERT_NO_THROW(md = memory::desc::structured_2_4(dims, data_type));
+    ASSERT_EQ(md.get_dims(), dims);
+    ASSERT_EQ(md.get_data_type(), data_type);
+    ASSERT_EQ(md.get_format_kind(), memory::format_kind::sparse);
+
+    ASSERT_EQ(md.get_nnz(), dims[0] * dims[1] / 2);
+    ASSERT_EQ(
+            md.get_sparse_encoding(), memory::sparse_encoding::structured_2_4);
+    ASSERT_EQ(md.get_data_type(1), dt::u8);
 }
 
 TEST(iface_sparse_test_t, TestSparseMDSize) {
@@ -194,6 +252,31 @@ TEST(iface_sparse_test_t, TestSparseMDSize) {
 
     // Size of bitmask.
     ASSERT_EQ(md.get_size(2), 0u);
+
+    // BSR.
+    const int nblocks = 5;
+    ASSERT_NO_THROW(md = memory::desc::bsr({64, 128}, dt::f32,
+                            nblocks * 16 * 16, {16, 16}, dt::s32, dt::s32));
+    // Size of values.
+    exp_values_size = nblocks * 16 * 16 * sizeof(float);
+    ASSERT_EQ(md.get_size(), exp_values_size);
+    ASSERT_EQ(md.get_size(0), exp_values_size);
+
+    // Size of block indices.
+    ASSERT_EQ(md.get_size(1), nblocks * sizeof(int32_t));
+
+    // Size of block pointers.
+    ASSERT_EQ(md.get_size(2), (64 / 16 + 1) * sizeof(int32_t));
+
+    // 2:4 structured.
+    ASSERT_NO_THROW(md = memory::desc::structured_2_4({64, 128}, dt::bf16));
+    // Size of values.
+    exp_values_size = 64 * 128 / 2 * memory::data_type_size(dt::bf16);
+    ASSERT_EQ(md.get_size(), exp_values_size);
+    ASSERT_EQ(md.get_size(0), exp_values_size);
+
+    // Size of metadata.
+    ASSERT_EQ(md.get_size(1), 64 / 4 * 128 * sizeof(uint8_t));
 }
 
 HANDLE_EXCEPTIONS_FOR_TEST(iface_sparse_test_t, TestSparseMemoryCreation) {
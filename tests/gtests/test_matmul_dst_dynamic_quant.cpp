@@ -0,0 +1,209 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+struct dst_dynamic_quant_params_t {
+    dt src_dt, dst_dt;
+    quantization_mode qmode;
+    memory::dim batch, M, N, K, group;
+};
+
+class matmul_dst_dynamic_quant_test_t
+    : public ::testing::TestWithParam<dst_dynamic_quant_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Dynamic destination quantization is checked on CPU only.");
+        p = GetParam();
+    }
+
+    // Returns `false` when the configuration is not implemented.
+    static bool make_pd(matmul::primitive_desc &pd, const memory::desc &src,
+            const memory::desc &wei, const memory::desc &dst,
+            const primitive_attr &attr) {
+        try {
+            pd = matmul::primitive_desc(get_test_engine(), src, wei, dst, attr);
+        } catch (const dnnl::error &e) {
+            if (e.status == dnnl_unimplemented) return false;
+            throw;
+        }
+        return true;
+    }
+
+    // Reorders @p from into a new memory of @p md.
+    static memory convert(memory from, const memory::desc &md) {
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+        memory to(md, eng);
+        reorder(from, to).execute(strm, from, to);
+        strm.wait();
+        return to;
+    }
+
+    static float max_value(dt d) {
+        switch (d) {
+            case dt::f8_e5m2: return 57344.f;
+            case dt::f8_e4m3: return 448.f;
+            case dt::f4_e2m1: return 6.f;
+            default: return 0.f;
+        }
+    }
+
+    dst_dynamic_quant_params_t p;
+};
+
+TEST_P(matmul_dst_dynamic_quant_test_t, CompareWithReference) {
+    const memory::dim B = p.batch, M = p.M, N = p.N, K = p.K, G = p.group;
+    const memory::dim N_groups = N / G;
+    const bool is_3d = B > 1;
+    const tag plain_tag = is_3d ? tag::abc : tag::ab;
+    auto dims = [&](memory::dim d0, memory::dim d1) {
+        return is_3d ? memory::dims {B, d0, d1} : memory::dims {d0, d1};
+    };
+    const bool is_mx = p.qmode == quantization_mode::dynamic_mx;
+    const dt scales_dt = is_mx ? dt::e8m0 : dt::f8_e4m3;
+
+    // Small integers keep f32 accumulation exact in any order. Every group
+    // holds a non-zero value.
+    std::vector<float> src(B * M * K), wei(B * K * N);
+    for (memory::dim i = 0; i < B * M * K; i++)
+        src[i] = static_cast<float>(static_cast<int>(i * 7 % 11) - 5);
+    for (memory::dim i = 0; i < B * K * N; i++)
+        wei[i] = static_cast<float>(static_cast<int>(i * 5 % 13) - 6);
+    src[0] = 1.f;
+
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+    const memory::desc src_md(dims(M, K), p.src_dt, plain_tag);
+    const memory::desc wei_md(dims(K, N), p.src_dt, plain_tag);
+    const memory::desc dst_md(dims(M, N), p.dst_dt, plain_tag);
+    const memory::desc f32_dst_md(dims(M, N), dt::f32, plain_tag);
+    const memory::desc scales_md({B * M * N_groups}, scales_dt, tag::a);
+    const memory::desc f32_scales_md({B * M * N_groups}, dt::f32, tag::a);
+
+    primitive_attr attr;
+    const int full_mask = is_3d ? 7 : 3;
+    attr.set_scales(DNNL_ARG_DST, full_mask, {1, G}, scales_dt, false, p.qmode);
+    matmul::primitive_desc pd;
+    SKIP_IF(!make_pd(pd, src_md, wei_md, dst_md, attr),
+            "Dynamic destination quantization configuration is not "
+            "supported.");
+
+    memory src_m = convert(
+            memory({dims(M, K), dt::f32, plain_tag}, eng, src.data()), src_md);
+    memory wei_m = convert(
+            memory({dims(K, N), dt::f32, plain_tag}, eng, wei.data()), wei_md);
+    memory dst_m(dst_md, eng);
+    memory scales_m(scales_md, eng);
+
+    matmul(pd).execute(strm,
+            {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_WEIGHTS, wei_m},
+                    {DNNL_ARG_DST, dst_m},
+                    {DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST, scales_m}});
+    strm.wait();
+
+    const float dst_max = max_value(p.dst_dt);
+    std::vector<float> acc(B * M * N), ref_scales(B * M * N_groups);
+    for_(memory::dim b = 0; b < B; b++)
+    for_(memory::dim m = 0; m < M; m++)
+    for (memory::dim g = 0; g < N_groups; g++) {
+        float amax = 0.f;
+        for (memory::dim i = 0; i < G; i++) {
+            const memory::dim n = g * G + i;
+            float &a = acc[(b * M + m) * N + n];
+            a = 0.f;
+            for (memory::dim k = 0; k < K; k++)
+                a += src[(b * M + m) * K + k] * wei[(b * K + k) * N + n];
+            amax = std::max(amax, std::fabs(a));
+        }
+
+        float &scale = ref_scales[(b * M + m) * N_groups + g];
+        scale = 1.f;
+        if (amax == 0.f) continue;
+        if (is_mx) {
+            // Both the maximum and the data type maximum are rounded down to
+            // a power of two.
+            const int e = static_cast<int>(std::floor(std::log2(amax)))
+                    - static_cast<int>(std::floor(std::log2(dst_max)));
+            scale = std::ldexp(1.f, e);
+        } else {
+            // Rounded to the scales data type below.
+            scale = amax / dst_max;
+        }
+    }
+    if (!is_mx) {
+        memory rounded_m = convert(
+                convert(memory(f32_scales_md, eng, ref_scales.data()),
+                        scales_md),
+                f32_scales_md);
+        const float *rounded
+                = static_cast<const float *>(rounded_m.get_data_handle());
+        ref_scales.assign(rounded, rounded + B * M * N_groups);
+    }
+
+    memory got_scales_m = convert(scales_m, f32_scales_md);
+    const float *got_scales
+            = static_cast<const float *>(got_scales_m.get_data_handle());
+    for (memory::dim i = 0; i < B * M * N_groups; i++)
+        ASSERT_EQ(got_scales[i], ref_scales[i]) << "scale i=" << i;
+
+    // The expected destination is produced by quantizing reference results
+    // with the same scales through a reorder.
+    std::vector<float> q(B * M * N);
+    for (memory::dim i = 0; i < B * M * N; i++)
+        q[i] = acc[i] * (1.f / ref_scales[i / G]);
+
+    memory ref_m = convert(memory(f32_dst_md, eng, q.data()), dst_md);
+    // Both destinations are compared as dequantized values to be independent
+    // from encodings of zeros.
+    memory got_f32_m = convert(dst_m, f32_dst_md);
+    memory ref_f32_m = convert(ref_m, f32_dst_md);
+    const float *got = static_cast<const float *>(got_f32_m.get_data_handle());
+    const float *ref = static_cast<const float *>(ref_f32_m.get_data_handle());
+    for (memory::dim i = 0; i < B * M * N; i++)
+        ASSERT_EQ(got[i], ref[i]) << "i=" << i;
+}
+
+INSTANTIATE_TEST_SUITE_P(TestMatmulDstDynamicQuant,
+        matmul_dst_dynamic_quant_test_t,
+        ::testing::Values(
+                dst_dynamic_quant_params_t {dt::f32, dt::f8_e4m3,
+                        quantization_mode::dynamic_mx, 1, 37, 64, 96, 32},
+                dst_dynamic_quant_params_t {dt::bf16, dt::f8_e5m2,
+                        quantization_mode::dynamic_mx, 2, 19, 96, 64, 32},
+                dst_dynamic_quant_params_t {dt::bf16, dt::f4_e2m1,
+                        quantization_mode::dynamic_mx, 1, 17, 160, 48, 32},
+                dst_dynamic_quant_params_t {dt::f32, dt::f4_e2m1,
+                        quantization_mode::dynamic_mx, 1, 9, 96, 32, 32},
+                dst_dynamic_quant_params_t {dt::f32, dt::f4_e2m1,
+                        quantization_mode::dynamic_fp, 1, 64, 128, 256, 16},
+                dst_dynamic_quant_params_t {dt::bf16, dt::f4_e2m1,
+                        quantization_mode::dynamic_fp, 3, 8, 64, 32, 16}));
+
+} // namespace dnnl
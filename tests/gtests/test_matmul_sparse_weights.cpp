@@ -0,0 +1,312 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+struct sparse_weights_params_t {
+    memory::sparse_encoding encoding;
+    dt src_dt, wei_dt, dst_dt;
+    memory::dim M, N, K;
+    // BSR block dimensions, ignored for 2:4 weights.
+    memory::dims block_dims;
+    bool with_bias, with_relu;
+};
+
+class matmul_sparse_weights_test_t
+    : public ::testing::TestWithParam<sparse_weights_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Structured sparse weights are supported on CPU only.");
+        p = GetParam();
+    }
+
+    // Returns `false` when the configuration is not implemented.
+    static bool make_pd(matmul::primitive_desc &pd, const memory::desc &src,
+            const memory::desc &wei, const memory::desc &bia,
+            const memory::desc &dst, const primitive_attr &attr) {
+        try {
+            pd = matmul::primitive_desc(
+                    get_test_engine(), src, wei, bia, dst, attr);
+        } catch (const dnnl::error &e) {
+            if (e.status == dnnl_unimplemented) return false;
+            throw;
+        }
+        return true;
+    }
+
+    // The values used in the test are small integers, so they are exactly
+    // representable in every data type.
+    static std::vector<uint8_t> to_bytes(const std::vector<float> &v, dt d) {
+        std::vector<uint8_t> bytes(v.size() * memory::data_type_size(d));
+        for (size_t i = 0; i < v.size(); i++) {
+            switch (d) {
+                case dt::f32:
+                    reinterpret_cast<float *>(bytes.data())[i] = v[i];
+                    break;
+                case dt::bf16:
+                    reinterpret_cast<bfloat16_t *>(bytes.data())[i] = v[i];
+                    break;
+                case dt::s8:
+                    reinterpret_cast<int8_t *>(bytes.data())[i]
+                            = static_cast<int8_t>(v[i]);
+                    break;
+                case dt::u8:
+                    bytes[i] = static_cast<uint8_t>(v[i]);
+                    break;
+                default: assert(!"unexpected data type");
+            }
+        }
+        return bytes;
+    }
+
+    static float from_bytes(const std::vector<uint8_t> &bytes, dt d, size_t i) {
+        switch (d) {
+            case dt::f32:
+                return reinterpret_cast<const float *>(bytes.data())[i];
+            case dt::bf16:
+                return reinterpret_cast<const bfloat16_t *>(bytes.data())[i];
+            default: assert(!"unexpected data type");
+        }
+        return NAN;
+    }
+
+    static float wei_value(memory::dim k, memory::dim n) {
+        const int v = static_cast<int>((k * 13 + n * 5) % 7) - 3;
+        return static_cast<float>(v == 0 ? 1 : v);
+    }
+
+    sparse_weights_params_t p;
+};
+
+TEST_P(matmul_sparse_weights_test_t, CompareWithDense) {
+    const memory::dim M = p.M, N = p.N, K = p.K;
+    const bool is_bsr = p.encoding == memory::sparse_encoding::bsr;
+    const bool is_int8 = p.src_dt == dt::u8;
+
+    std::vector<float> src(M * K), wei(K * N, 0.f), bias(N);
+    for (memory::dim i = 0; i < M * K; i++)
+        src[i] = is_int8 ? static_cast<float>(i * 7 % 4)
+                         : static_cast<float>(static_cast<int>(i * 7 % 5) - 2);
+    for (memory::dim n = 0; n < N; n++)
+        bias[n] = static_cast<float>(static_cast<int>(n % 5) - 2);
+
+    // Encode the weights and keep their dense copy for the reference.
+    std::vector<float> values;
+    std::vector<int32_t> indices, pointers;
+    std::vector<uint8_t> metadata;
+    memory::desc wei_md;
+    if (is_bsr) {
+        const memory::dim BK = p.block_dims[0], BN = p.block_dims[1];
+        pointers.push_back(0);
+        for (memory::dim kb = 0; kb < K / BK; kb++) {
+            for (memory::dim nb = 0; nb < N / BN; nb++) {
+                // Block column 1 is left empty on purpose.
+                if (nb == 1 || (kb + nb) % 2 != 0) continue;
+                indices.push_back(static_cast<int32_t>(nb));
+                for (memory::dim k = kb * BK; k < (kb + 1) * BK; k++)
+                    for (memory::dim n = nb * BN; n < (nb + 1) * BN; n++) {
+                        wei[k * N + n] = wei_value(k, n);
+                        values.push_back(wei[k * N + n]);
+                    }
+            }
+            pointers.push_back(static_cast<int32_t>(indices.size()));
+        }
+        wei_md = memory::desc::bsr({K, N}, p.wei_dt,
+                static_cast<memory::dim>(values.size()), p.block_dims, dt::s32,
+                dt::s32);
+    } else {
+        values.resize(K / 2 * N);
+        metadata.resize(K / 4 * N);
+        for (memory::dim g = 0; g < K / 4; g++)
+            for (memory::dim n = 0; n < N; n++) {
+                const int p0 = static_cast<int>((g + n) % 4);
+                const int p1 = static_cast<int>((p0 + 1 + n % 3) % 4);
+                const int pos[2] = {std::min(p0, p1), std::max(p0, p1)};
+                metadata[g * N + n]
+                        = static_cast<uint8_t>(pos[0] | (pos[1] << 2));
+                for (int j = 0; j < 2; j++) {
+                    const memory::dim k = 4 * g + pos[j];
+                    wei[k * N + n] = wei_value(k, n);
+                    values[(2 * g + j) * N + n] = wei[k * N + n];
+                }
+            }
+        wei_md = memory::desc::structured_2_4({K, N}, p.wei_dt);
+    }
+
+    const memory::desc src_md({M, K}, p.src_dt, tag::ab);
+    const memory::desc dst_md({M, N}, p.dst_dt, tag::ab);
+    const memory::desc bia_md = p.with_bias
+            ? memory::desc({1, N}, dt::f32, tag::ab)
+            : memory::desc();
+    primitive_attr attr;
+    if (p.with_relu) {
+        post_ops ops;
+        ops.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+        attr.set_post_ops(ops);
+    }
+    matmul::primitive_desc pd;
+    SKIP_IF(!make_pd(pd, src_md, wei_md, bia_md, dst_md, attr),
+            "Sparse weights configuration is not supported.");
+
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+    auto src_bytes = to_bytes(src, p.src_dt);
+    auto values_bytes = to_bytes(values, p.wei_dt);
+    std::vector<uint8_t> dst_bytes(dst_md.get_size());
+    memory src_m(src_md, eng, src_bytes.data());
+    memory wei_m = is_bsr
+            ? memory(wei_md, eng,
+                    {values_bytes.data(), indices.data(), pointers.data()})
+            : memory(wei_md, eng, {values_bytes.data(), metadata.data()});
+    memory bia_m(bia_md, eng, bias.data());
+    memory dst_m(dst_md, eng, dst_bytes.data());
+
+    matmul(pd).execute(strm,
+            {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_WEIGHTS, wei_m},
+                    {DNNL_ARG_BIAS, bia_m}, {DNNL_ARG_DST, dst_m}});
+    strm.wait();
+
+    for (memory::dim m = 0; m < M; m++)
+        for (memory::dim n = 0; n < N; n++) {
+            float ref = p.with_bias ? bias[n] : 0.f;
+            for (memory::dim k = 0; k < K; k++)
+                ref += src[m * K + k] * wei[k * N + n];
+            if (p.with_relu) ref = std::max(ref, 0.f);
+            const float got = from_bytes(dst_bytes, p.dst_dt, m * N + n);
+            const float eps = p.dst_dt == dt::bf16 ? 1e-2f * std::fabs(ref)
+                                                   : 1e-6f;
+            ASSERT_NEAR(got, ref, eps) << "m=" << m << " n=" << n;
+        }
+}
+
+// The optimized implementation validates the sparse structure of the weights
+// before using it to address memory.
+class matmul_sparse_weights_malformed_test_t : public ::testing::Test {
+protected:
+    static constexpr memory::dim M = 4, N = 32, K = 32;
+
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Structured sparse weights are supported on CPU only.");
+    }
+
+    // Returns the status of the execution, or `dnnl_unimplemented` when the
+    // weights are not handled by the optimized implementation.
+    static dnnl_status_t execute(
+            const memory::desc &wei_md, const std::vector<void *> &handles) {
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+        const memory::desc src_md({M, K}, dt::f32, tag::ab);
+        const memory::desc dst_md({M, N}, dt::f32, tag::ab);
+        matmul::primitive_desc pd;
+        try {
+            pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+        } catch (const dnnl::error &e) { return e.status; }
+        if (std::string(pd.impl_info_str()).find("brg_sparse")
+                == std::string::npos)
+            return dnnl_unimplemented;
+
+        std::vector<float> src(M * K, 1.f), dst(M * N);
+        try {
+            matmul(pd).execute(strm,
+                    {{DNNL_ARG_SRC, memory(src_md, eng, src.data())},
+                            {DNNL_ARG_WEIGHTS, memory(wei_md, eng, handles)},
+                            {DNNL_ARG_DST, memory(dst_md, eng, dst.data())}});
+            strm.wait();
+        } catch (const dnnl::error &e) { return e.status; }
+        return dnnl_success;
+    }
+};
+
+TEST_F(matmul_sparse_weights_malformed_test_t, BsrIndicesOutOfRange) {
+    const memory::dim nnz = 2 * 16 * 16;
+    std::vector<float> values(nnz, 1.f);
+    std::vector<int32_t> indices = {0, 2}, pointers = {0, 1, 2};
+    const auto wei_md = memory::desc::bsr(
+            {K, N}, dt::f32, nnz, {16, 16}, dt::s32, dt::s32);
+    const auto status = execute(
+            wei_md, {values.data(), indices.data(), pointers.data()});
+    SKIP_IF(status == dnnl_unimplemented,
+            "Sparse weights configuration is not supported.");
+    ASSERT_EQ(status, dnnl_invalid_arguments);
+}
+
+TEST_F(matmul_sparse_weights_malformed_test_t, BsrPointersOutOfRange) {
+    const memory::dim nnz = 2 * 16 * 16;
+    std::vector<float> values(nnz, 1.f);
+    std::vector<int32_t> indices = {0, 1}, pointers = {0, 2, 1};
+    const auto wei_md = memory::desc::bsr(
+            {K, N}, dt::f32, nnz, {16, 16}, dt::s32, dt::s32);
+    const auto status = execute(
+            wei_md, {values.data(), indices.data(), pointers.data()});
+    SKIP_IF(status == dnnl_unimplemented,
+            "Sparse weights configuration is not supported.");
+    ASSERT_EQ(status, dnnl_invalid_arguments);
+}
+
+TEST_F(matmul_sparse_weights_malformed_test_t, StructuredPositionsRepeated) {
+    std::vector<float> values(K / 2 * N, 1.f);
+    // Both kept values of the last group of the last column are at position
+    // 1.
+    std::vector<uint8_t> metadata(K / 4 * N, 0x1 | (0x3 << 2));
+    metadata.back() = 0x1 | (0x1 << 2);
+    const auto wei_md = memory::desc::structured_2_4({K, N}, dt::f32);
+    const auto status = execute(wei_md, {values.data(), metadata.data()});
+    SKIP_IF(status == dnnl_unimplemented,
+            "Sparse weights configuration is not supported.");
+    ASSERT_EQ(status, dnnl_invalid_arguments);
+}
+
+namespace {
+using se = memory::sparse_encoding;
+} // namespace
+
+INSTANTIATE_TEST_SUITE_P(TestMatmulBsrWeights, matmul_sparse_weights_test_t,
+        ::testing::Values(
+                sparse_weights_params_t {se::bsr, dt::f32, dt::f32, dt::f32,
+                        37, 64, 96, {16, 16}, false, false},
+                sparse_weights_params_t {se::bsr, dt::f32, dt::f32, dt::f32,
+                        64, 48, 96, {32, 1}, true, true},
+                sparse_weights_params_t {se::bsr, dt::bf16, dt::bf16,
+                        dt::bf16, 70, 64, 64, {16, 16}, true, true},
+                sparse_weights_params_t {se::bsr, dt::u8, dt::s8, dt::f32,
+                        19, 96, 128, {32, 32}, true, false}));
+
+INSTANTIATE_TEST_SUITE_P(TestMatmul24Weights, matmul_sparse_weights_test_t,
+        ::testing::Values(
+                sparse_weights_params_t {se::structured_2_4, dt::f32,
+                        dt::f32, dt::f32, 37, 80, 128, {}, false, false},
+                sparse_weights_params_t {se::structured_2_4, dt::bf16,
+                        dt::bf16, dt::f32, 65, 72, 64, {}, false, true},
+                sparse_weights_params_t {se::structured_2_4, dt::u8, dt::s8,
+                        dt::f32, 8, 130, 256, {}, true, true}));
+
+} // namespace dnnl
@@ -0,0 +1,179 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+struct src_dynamic_quant_params_t {
+    dt src_dt, wei_dt;
+    memory::dim batch, M, N, K;
+    bool with_bias, with_relu;
+};
+
+class matmul_src_dynamic_quant_test_t
+    : public ::testing::TestWithParam<src_dynamic_quant_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Dynamic source quantization is supported on CPU only.");
+        p = GetParam();
+    }
+
+    // Returns `false` when the configuration is not implemented.
+    static bool make_pd(matmul::primitive_desc &pd, const memory::desc &src,
+            const memory::desc &wei, const memory::desc &bia,
+            const memory::desc &dst, const primitive_attr &attr) {
+        try {
+            pd = matmul::primitive_desc(
+                    get_test_engine(), src, wei, bia, dst, attr);
+        } catch (const dnnl::error &e) {
+            if (e.status == dnnl_unimplemented) return false;
+            throw;
+        }
+        return true;
+    }
+
+    // Returns a memory of @p md filled with f32 values @p v.
+    static memory make_memory(const memory::desc &md, std::vector<float> &v) {
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+        const memory::desc f32_md(md.get_dims(), dt::f32,
+                md.get_ndims() == 3 ? tag::abc : tag::ab);
+        memory f32_m(f32_md, eng, v.data());
+        memory m(md, eng);
+        reorder(f32_m, m).execute(strm, f32_m, m);
+        strm.wait();
+        return m;
+    }
+
+    src_dynamic_quant_params_t p;
+};
+
+TEST_P(matmul_src_dynamic_quant_test_t, CompareWithUnquantized) {
+    const memory::dim B = p.batch, M = p.M, N = p.N, K = p.K;
+    const bool is_3d = B > 1;
+    const tag plain_tag = is_3d ? tag::abc : tag::ab;
+    auto dims = [&](memory::dim d0, memory::dim d1) {
+        return is_3d ? memory::dims {B, d0, d1} : memory::dims {d0, d1};
+    };
+
+    // The values are exactly representable in every source data type.
+    std::vector<float> src(B * M * K), wei(B * K * N), bias(N);
+    for (memory::dim i = 0; i < B * M * K; i++)
+        src[i] = 0.25f * static_cast<float>(static_cast<int>(i * 7 % 11) - 5);
+    for (memory::dim i = 0; i < B * K * N; i++)
+        wei[i] = static_cast<float>(static_cast<int>(i * 5 % 7) - 3);
+    for (memory::dim n = 0; n < N; n++)
+        bias[n] = static_cast<float>(static_cast<int>(n % 5) - 2);
+
+    const memory::desc src_md(dims(M, K), p.src_dt, plain_tag);
+    const memory::desc wei_md(dims(K, N), p.wei_dt, plain_tag);
+    const memory::desc dst_md(dims(M, N), dt::f32, plain_tag);
+    const memory::desc bia_md = p.with_bias
+            ? memory::desc(is_3d ? memory::dims {1, 1, N} : memory::dims {1, N},
+                    dt::f32, plain_tag)
+            : memory::desc();
+    const memory::desc scales_md({B * M}, dt::f32, tag::a);
+
+    primitive_attr attr;
+    const int full_mask = is_3d ? 7 : 3;
+    attr.set_scales(DNNL_ARG_SRC, full_mask, {1, K}, dt::f32, false,
+            quantization_mode::dynamic_fp);
+    if (p.with_relu) {
+        post_ops ops;
+        ops.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+        attr.set_post_ops(ops);
+    }
+    matmul::primitive_desc pd;
+    SKIP_IF(!make_pd(pd, src_md, wei_md, bia_md, dst_md, attr),
+            "Dynamic source quantization configuration is not supported.");
+
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+    memory src_m = make_memory(src_md, src);
+    memory wei_m = make_memory(wei_md, wei);
+    std::vector<float> dst(B * M * N), scales(B * M);
+    memory dst_m(dst_md, eng, dst.data());
+    memory scales_m(scales_md, eng, scales.data());
+
+    std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src_m},
+            {DNNL_ARG_WEIGHTS, wei_m}, {DNNL_ARG_DST, dst_m},
+            {DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, scales_m}};
+    if (p.with_bias)
+        args.insert({DNNL_ARG_BIAS, memory(bia_md, eng, bias.data())});
+    matmul(pd).execute(strm, args);
+    strm.wait();
+
+    const bool is_s8 = p.wei_dt == dt::s8;
+    const float q_max = is_s8 ? 127.f : 448.f;
+    for_(memory::dim b = 0; b < B; b++)
+    for (memory::dim m = 0; m < M; m++) {
+        const float *src_row = &src[(b * M + m) * K];
+        float amax = 0.f;
+        for (memory::dim k = 0; k < K; k++)
+            amax = std::max(amax, std::fabs(src_row[k]));
+        const float scale = amax == 0.f ? 1.f : amax / q_max;
+        ASSERT_NEAR(scales[b * M + m], scale, 1e-6f * scale)
+                << "b=" << b << " m=" << m;
+
+        for (memory::dim n = 0; n < N; n++) {
+            float ref = p.with_bias ? bias[n] : 0.f;
+            // Rounding to s8 loses up to a half of the scale per value,
+            // while e4m3 keeps 3 bits of mantissa.
+            float eps = 1e-5f;
+            for (memory::dim k = 0; k < K; k++) {
+                const float w = wei[(b * K + k) * N + n];
+                ref += src_row[k] * w;
+                eps += std::fabs(w)
+                        * (is_s8 ? 0.5f * scale
+                                 : 0.0625f * std::fabs(src_row[k]));
+            }
+            if (p.with_relu) ref = std::max(ref, 0.f);
+            ASSERT_NEAR(dst[(b * M + m) * N + n], ref, eps)
+                    << "b=" << b << " m=" << m << " n=" << n;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(TestMatmulSrcDynamicQuant,
+        matmul_src_dynamic_quant_test_t,
+        ::testing::Values(
+                src_dynamic_quant_params_t {
+                        dt::f32, dt::s8, 1, 37, 64, 96, false, false},
+                src_dynamic_quant_params_t {
+                        dt::f32, dt::s8, 1, 64, 48, 256, true, true},
+                src_dynamic_quant_params_t {
+                        dt::bf16, dt::s8, 3, 19, 32, 64, true, false},
+                src_dynamic_quant_params_t {
+                        dt::f16, dt::s8, 2, 5, 24, 1030, true, false},
+                src_dynamic_quant_params_t {
+                        dt::f32, dt::f8_e4m3, 1, 33, 64, 128, true, true},
+                src_dynamic_quant_params_t {
+                        dt::bf16, dt::f8_e4m3, 2, 8, 80, 64, false, false}));
+
+} // namespace dnnl
@@ -0,0 +1,164 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+// Processing a sequence chunk by chunk with the states updated in place must
+// match the processing of the whole sequence at once.
+class rnn_streaming_test_t
+    : public ::testing::TestWithParam<std::tuple<algorithm, memory::dim>> {
+protected:
+    static constexpr memory::dim L = 2, T = 6, MB = 2, C = 8;
+
+    void SetUp() override {
+        cell = std::get<0>(GetParam());
+        chunk = std::get<1>(GetParam());
+        G = cell == algorithm::vanilla_lstm ? 4 : 3;
+        fill(src_layer, T * MB * C, 1);
+        fill(states_init, L * MB * C, 2);
+        fill(weights_layer, L * C * G * C, 3);
+        fill(weights_iter, L * C * G * C, 4);
+        fill(bias, L * G * C, 5);
+    }
+
+    static void fill(std::vector<float> &v, memory::dim size, int seed) {
+        v.resize(size);
+        for (memory::dim i = 0; i < size; ++i)
+            v[i] = 0.5f * std::sin(0.29f * i + seed);
+    }
+
+    bool with_c() const { return cell == algorithm::vanilla_lstm; }
+
+    primitive_desc make_pd(memory::dim t) {
+        auto layer_md = memory::desc({t, MB, C}, dt::f32, tag::tnc);
+        auto iter_md = memory::desc({L, 1, MB, C}, dt::f32, tag::ldnc);
+        auto wei_md = memory::desc({L, 1, C, G, C}, dt::f32, tag::any);
+        auto bias_md = memory::desc({L, 1, G, C}, dt::f32, tag::ldgo);
+        if (with_c())
+            return lstm_forward::primitive_desc(get_test_engine(),
+                    prop_kind::forward_inference,
+                    rnn_direction::unidirectional_left2right, layer_md,
+                    iter_md, iter_md, wei_md, wei_md, bias_md, layer_md,
+                    iter_md, iter_md);
+        return gru_forward::primitive_desc(get_test_engine(),
+                prop_kind::forward_inference,
+                rnn_direction::unidirectional_left2right, layer_md, iter_md,
+                wei_md, wei_md, bias_md, layer_md, iter_md);
+    }
+
+    // Executes the primitive on `t` time steps starting at `t_off`. Passing
+    // the same buffers as source and destination states updates them in
+    // place.
+    void execute(const primitive_desc &pd, memory::dim t_off,
+            std::vector<float> &src_h, std::vector<float> &src_c,
+            std::vector<float> &dst_h, std::vector<float> &dst_c,
+            std::vector<float> &dst_layer) {
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+        auto md = [&](int arg) {
+            return pd.query_md(query::exec_arg_md, arg);
+        };
+        auto mem = [&](int arg, void *ptr) {
+            return memory(md(arg), eng, ptr);
+        };
+
+        auto wei_layer = memory(md(DNNL_ARG_WEIGHTS_LAYER), eng);
+        auto wei_iter = memory(md(DNNL_ARG_WEIGHTS_ITER), eng);
+        const auto plain_wei_md
+                = memory::desc({L, 1, C, G, C}, dt::f32, tag::ldigo);
+        auto plain_wei_layer = memory(plain_wei_md, eng, weights_layer.data());
+        auto plain_wei_iter = memory(plain_wei_md, eng, weights_iter.data());
+        reorder(plain_wei_layer, wei_layer)
+                .execute(strm, plain_wei_layer, wei_layer);
+        reorder(plain_wei_iter, wei_iter)
+                .execute(strm, plain_wei_iter, wei_iter);
+
+        auto h_src = mem(DNNL_ARG_SRC_ITER, src_h.data());
+        auto h_dst = src_h.data() == dst_h.data()
+                ? h_src
+                : mem(DNNL_ARG_DST_ITER, dst_h.data());
+        std::unordered_map<int, memory> args {
+                {DNNL_ARG_SRC_LAYER,
+                        mem(DNNL_ARG_SRC_LAYER,
+                                src_layer.data() + t_off * MB * C)},
+                {DNNL_ARG_SRC_ITER, h_src},
+                {DNNL_ARG_WEIGHTS_LAYER, wei_layer},
+                {DNNL_ARG_WEIGHTS_ITER, wei_iter},
+                {DNNL_ARG_BIAS, mem(DNNL_ARG_BIAS, bias.data())},
+                {DNNL_ARG_DST_LAYER,
+                        mem(DNNL_ARG_DST_LAYER,
+                                dst_layer.data() + t_off * MB * C)},
+                {DNNL_ARG_DST_ITER, h_dst}};
+        if (with_c()) {
+            auto c_src = mem(DNNL_ARG_SRC_ITER_C, src_c.data());
+            args[DNNL_ARG_SRC_ITER_C] = c_src;
+            args[DNNL_ARG_DST_ITER_C] = src_c.data() == dst_c.data()
+                    ? c_src
+                    : mem(DNNL_ARG_DST_ITER_C, dst_c.data());
+        }
+        primitive(pd).execute(strm, args);
+        strm.wait();
+    }
+
+    algorithm cell;
+    memory::dim chunk, G;
+    std::vector<float> src_layer, states_init;
+    std::vector<float> weights_layer, weights_iter, bias;
+};
+
+TEST_P(rnn_streaming_test_t, InPlaceStates) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "In-place states are tested on CPU only.");
+
+    std::vector<float> h0 = states_init, c0 = states_init;
+    std::vector<float> ref_h(L * MB * C), ref_c(L * MB * C);
+    std::vector<float> ref_dst_layer(T * MB * C);
+    execute(make_pd(T), 0, h0, c0, ref_h, ref_c, ref_dst_layer);
+
+    std::vector<float> h = states_init, c = states_init;
+    std::vector<float> dst_layer(T * MB * C);
+    auto pd = make_pd(chunk);
+    for (memory::dim t = 0; t < T; t += chunk)
+        execute(pd, t, h, c, h, c, dst_layer);
+
+    for (size_t i = 0; i < dst_layer.size(); ++i)
+        ASSERT_NEAR(dst_layer[i], ref_dst_layer[i], 1e-5f) << "at " << i;
+    for (size_t i = 0; i < h.size(); ++i)
+        ASSERT_NEAR(h[i], ref_h[i], 1e-5f) << "at " << i;
+    if (!with_c()) return;
+    for (size_t i = 0; i < c.size(); ++i)
+        ASSERT_NEAR(c[i], ref_c[i], 1e-5f) << "at " << i;
+}
+
+INSTANTIATE_TEST_SUITE_P(TestRnnStreaming, rnn_streaming_test_t,
+        ::testing::Combine(::testing::Values(algorithm::vanilla_lstm,
+                                   algorithm::vanilla_gru),
+                ::testing::Values(1, 2, 3)));
+
+} // namespace dnnl
@@ -0,0 +1,239 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+class rnn_variable_length_test_t
+    : public ::testing::TestWithParam<rnn_direction> {
+protected:
+    static constexpr memory::dim L = 2, T = 5, MB = 3, C = 4, G = 4;
+
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Variable-length sequences are supported on CPU only.");
+        direction = GetParam();
+        D = (direction == rnn_direction::bidirectional_concat
+                    || direction == rnn_direction::bidirectional_sum)
+                ? 2
+                : 1;
+        DLC = direction == rnn_direction::bidirectional_concat ? 2 * C : C;
+
+        fill(src_layer, T * MB * C, 1);
+        fill(src_iter, L * D * MB * C, 2);
+        fill(src_iter_c, L * D * MB * C, 3);
+        fill(weights_layer, L * D * C * G * C, 4);
+        fill(weights_iter, L * D * C * G * C, 5);
+        fill(bias, L * D * G * C, 6);
+    }
+
+    static void fill(std::vector<float> &v, memory::dim size, int seed) {
+        v.resize(size);
+        for (memory::dim i = 0; i < size; ++i)
+            v[i] = 0.5f * std::sin(0.37f * i + seed);
+    }
+
+    // Computes a plain LSTM with the given minibatch and time steps.
+    lstm_forward::primitive_desc make_pd(
+            memory::dim t, memory::dim mb, bool varlen) {
+        auto eng = get_test_engine();
+        auto src_layer_md = memory::desc({t, mb, C}, dt::f32, tag::tnc);
+        auto iter_md = memory::desc({L, D, mb, C}, dt::f32, tag::ldnc);
+        auto wei_md = memory::desc({L, D, C, G, C}, dt::f32, tag::ldigo);
+        auto bias_md = memory::desc({L, D, G, C}, dt::f32, tag::ldgo);
+        auto dst_layer_md = memory::desc({t, mb, DLC}, dt::f32, tag::tnc);
+
+        if (!varlen)
+            return lstm_forward::primitive_desc(eng,
+                    prop_kind::forward_inference, direction, src_layer_md,
+                    iter_md, iter_md, wei_md, wei_md, bias_md, dst_layer_md,
+                    iter_md, iter_md);
+
+        // The flags are only exposed through the C API
+        dnnl_primitive_desc_t c_pd = nullptr;
+        error::wrap_c_api(
+                dnnl_lstm_forward_primitive_desc_create(&c_pd, eng.get(),
+                        dnnl_forward_inference, convert_to_c(direction),
+                        src_layer_md.get(), iter_md.get(), iter_md.get(),
+                        wei_md.get(), wei_md.get(), nullptr, nullptr,
+                        bias_md.get(), dst_layer_md.get(), iter_md.get(),
+                        iter_md.get(), dnnl_rnn_flags_variable_length,
+                        nullptr),
+                "could not create a variable-length lstm primitive "
+                "descriptor");
+        return lstm_forward::primitive_desc(c_pd);
+    }
+
+    rnn_direction direction;
+    memory::dim D, DLC;
+    std::vector<float> src_layer, src_iter, src_iter_c;
+    std::vector<float> weights_layer, weights_iter, bias;
+};
+
+TEST_P(rnn_variable_length_test_t, MatchesPerSampleExecution) {
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    std::vector<int32_t> seq_lengths = {5, 3, 1};
+    auto pd = make_pd(T, MB, true);
+    ASSERT_EQ(pd.seq_lengths_desc(), memory::desc({MB}, dt::s32, tag::a));
+
+    std::vector<float> dst_layer(T * MB * DLC, -1.f);
+    std::vector<float> dst_iter(L * D * MB * C), dst_iter_c(L * D * MB * C);
+    auto mem = [&](const memory::desc &md, void *ptr) {
+        return memory(md, eng, ptr);
+    };
+    lstm_forward(pd).execute(strm,
+            {{DNNL_ARG_SRC_LAYER, mem(pd.src_layer_desc(), src_layer.data())},
+                    {DNNL_ARG_SRC_ITER,
+                            mem(pd.src_iter_desc(), src_iter.data())},
+                    {DNNL_ARG_SRC_ITER_C,
+                            mem(pd.src_iter_c_desc(), src_iter_c.data())},
+                    {DNNL_ARG_WEIGHTS_LAYER,
+                            mem(pd.weights_layer_desc(), weights_layer.data())},
+                    {DNNL_ARG_WEIGHTS_ITER,
+                            mem(pd.weights_iter_desc(), weights_iter.data())},
+                    {DNNL_ARG_BIAS, mem(pd.bias_desc(), bias.data())},
+                    {DNNL_ARG_SEQ_LENGTHS,
+                            mem(pd.seq_lengths_desc(), seq_lengths.data())},
+                    {DNNL_ARG_DST_LAYER,
+                            mem(pd.dst_layer_desc(), dst_layer.data())},
+                    {DNNL_ARG_DST_ITER,
+                            mem(pd.dst_iter_desc(), dst_iter.data())},
+                    {DNNL_ARG_DST_ITER_C,
+                            mem(pd.dst_iter_c_desc(), dst_iter_c.data())}});
+    strm.wait();
+
+    for (memory::dim b = 0; b < MB; ++b) {
+        const memory::dim len = seq_lengths[b];
+        // Gather the sample into a dense single-sample problem
+        std::vector<float> s_src_layer(len * C);
+        std::vector<float> s_src_iter(L * D * C), s_src_iter_c(L * D * C);
+        for (memory::dim t = 0; t < len; ++t)
+            for (memory::dim c = 0; c < C; ++c)
+                s_src_layer[t * C + c] = src_layer[(t * MB + b) * C + c];
+        for (memory::dim ld = 0; ld < L * D; ++ld)
+            for (memory::dim c = 0; c < C; ++c) {
+                s_src_iter[ld * C + c] = src_iter[(ld * MB + b) * C + c];
+                s_src_iter_c[ld * C + c] = src_iter_c[(ld * MB + b) * C + c];
+            }
+
+        std::vector<float> s_dst_layer(len * DLC);
+        std::vector<float> s_dst_iter(L * D * C), s_dst_iter_c(L * D * C);
+        auto s_pd = make_pd(len, 1, false);
+        lstm_forward(s_pd).execute(strm,
+                {{DNNL_ARG_SRC_LAYER,
+                         mem(s_pd.src_layer_desc(), s_src_layer.data())},
+                        {DNNL_ARG_SRC_ITER,
+                                mem(s_pd.src_iter_desc(), s_src_iter.data())},
+                        {DNNL_ARG_SRC_ITER_C,
+                                mem(s_pd.src_iter_c_desc(),
+                                        s_src_iter_c.data())},
+                        {DNNL_ARG_WEIGHTS_LAYER,
+                                mem(s_pd.weights_layer_desc(),
+                                        weights_layer.data())},
+                        {DNNL_ARG_WEIGHTS_ITER,
+                                mem(s_pd.weights_iter_desc(),
+                                        weights_iter.data())},
+                        {DNNL_ARG_BIAS, mem(s_pd.bias_desc(), bias.data())},
+                        {DNNL_ARG_DST_LAYER,
+                                mem(s_pd.dst_layer_desc(), s_dst_layer.data())},
+                        {DNNL_ARG_DST_ITER,
+                                mem(s_pd.dst_iter_desc(), s_dst_iter.data())},
+                        {DNNL_ARG_DST_ITER_C,
+                                mem(s_pd.dst_iter_c_desc(),
+                                        s_dst_iter_c.data())}});
+        strm.wait();
+
+        for (memory::dim t = 0; t < T; ++t)
+            for (memory::dim c = 0; c < DLC; ++c) {
+                const float got = dst_layer[(t * MB + b) * DLC + c];
+                const float exp = t < len ? s_dst_layer[t * DLC + c] : 0.f;
+                ASSERT_NEAR(got, exp, 1e-5f)
+                        << "dst_layer t=" << t << " b=" << b << " c=" << c;
+            }
+        for (memory::dim ld = 0; ld < L * D; ++ld)
+            for (memory::dim c = 0; c < C; ++c) {
+                ASSERT_NEAR(dst_iter[(ld * MB + b) * C + c],
+                        s_dst_iter[ld * C + c], 1e-5f)
+                        << "dst_iter ld=" << ld << " b=" << b << " c=" << c;
+                ASSERT_NEAR(dst_iter_c[(ld * MB + b) * C + c],
+                        s_dst_iter_c[ld * C + c], 1e-5f)
+                        << "dst_iter_c ld=" << ld << " b=" << b << " c=" << c;
+            }
+    }
+}
+
+TEST_P(rnn_variable_length_test_t, InvalidLengths) {
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+    auto pd = make_pd(T, MB, true);
+
+    std::vector<float> dst_layer(T * MB * DLC);
+    std::vector<float> dst_iter(L * D * MB * C), dst_iter_c(L * D * MB * C);
+    auto mem = [&](const memory::desc &md, void *ptr) {
+        return memory(md, eng, ptr);
+    };
+
+    // Unsorted, zero and out-of-range lengths are rejected at execution
+    for (const auto &lengths : {std::vector<int32_t> {3, 5, 1},
+                 std::vector<int32_t> {5, 3, 0},
+                 std::vector<int32_t> {6, 3, 1}}) {
+        std::vector<int32_t> seq_lengths = lengths;
+        EXPECT_ANY_THROW(lstm_forward(pd).execute(strm,
+                {{DNNL_ARG_SRC_LAYER,
+                         mem(pd.src_layer_desc(), src_layer.data())},
+                        {DNNL_ARG_SRC_ITER,
+                                mem(pd.src_iter_desc(), src_iter.data())},
+                        {DNNL_ARG_SRC_ITER_C,
+                                mem(pd.src_iter_c_desc(), src_iter_c.data())},
+                        {DNNL_ARG_WEIGHTS_LAYER,
+                                mem(pd.weights_layer_desc(),
+                                        weights_layer.data())},
+                        {DNNL_ARG_WEIGHTS_ITER,
+                                mem(pd.weights_iter_desc(),
+                                        weights_iter.data())},
+                        {DNNL_ARG_BIAS, mem(pd.bias_desc(), bias.data())},
+                        {DNNL_ARG_SEQ_LENGTHS,
+                                mem(pd.seq_lengths_desc(),
+                                        seq_lengths.data())},
+                        {DNNL_ARG_DST_LAYER,
+                                mem(pd.dst_layer_desc(), dst_layer.data())},
+                        {DNNL_ARG_DST_ITER,
+                                mem(pd.dst_iter_desc(), dst_iter.data())},
+                        {DNNL_ARG_DST_ITER_C,
+                                mem(pd.dst_iter_c_desc(),
+                                        dst_iter_c.data())}}));
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(TestRnnVariableLength, rnn_variable_length_test_t,
+        ::testing::Values(rnn_direction::unidirectional_left2right,
+                rnn_direction::unidirectional_right2left,
+                rnn_direction::bidirectional_concat,
+                rnn_direction::bidirectional_sum));
+
+} // namespace dnnl
@@ -0,0 +1,155 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+// A multi-layer f32 forward training LSTM runs on the gemm-based cells, and
+// its cells are small enough to be executed along the wavefronts of the
+// (layer, iteration) grid when more than one thread is available. A
+// single-layer unidirectional problem has no independent cells, so chaining
+// such primitives computes the same network layer by layer.
+class rnn_wavefront_test_t : public ::testing::TestWithParam<rnn_direction> {
+protected:
+    static constexpr memory::dim L = 4, T = 6, MB = 3, C = 8, G = 4;
+
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Wavefront execution is implemented on CPU only.");
+        direction = GetParam();
+        D = direction == rnn_direction::bidirectional_sum ? 2 : 1;
+
+        fill(src_layer, T * MB * C, 1);
+        fill(src_iter, L * D * MB * C, 2);
+        fill(src_iter_c, L * D * MB * C, 3);
+        fill(weights_layer, L * D * C * G * C, 4);
+        fill(weights_iter, L * D * C * G * C, 5);
+        fill(bias, L * D * G * C, 6);
+    }
+
+    static void fill(std::vector<float> &v, memory::dim size, int seed) {
+        v.resize(size);
+        for (memory::dim i = 0; i < size; ++i)
+            v[i] = 0.5f * std::sin(0.37f * i + seed);
+    }
+
+    lstm_forward::primitive_desc make_pd(
+            rnn_direction dir, memory::dim l, memory::dim d) {
+        auto src_layer_md = memory::desc({T, MB, C}, dt::f32, tag::tnc);
+        auto iter_md = memory::desc({l, d, MB, C}, dt::f32, tag::ldnc);
+        auto wei_md = memory::desc({l, d, C, G, C}, dt::f32, tag::ldigo);
+        auto bias_md = memory::desc({l, d, G, C}, dt::f32, tag::ldgo);
+        return lstm_forward::primitive_desc(get_test_engine(),
+                prop_kind::forward_training, dir, src_layer_md, iter_md,
+                iter_md, wei_md, wei_md, bias_md, src_layer_md, iter_md,
+                iter_md);
+    }
+
+    // Executes @p pd with the states and the weights starting at the
+    // direction @p ld of the flattened (layer, direction) dimension.
+    void execute(const lstm_forward::primitive_desc &pd, memory::dim ld,
+            const float *src, float *dst, std::vector<float> &dst_iter,
+            std::vector<float> &dst_iter_c) {
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+        auto mem = [&](const memory::desc &md, const float *ptr) {
+            return memory(md, eng, const_cast<float *>(ptr));
+        };
+        const memory::dim iter_off = ld * MB * C, wei_off = ld * C * G * C;
+        lstm_forward(pd).execute(strm,
+                {{DNNL_ARG_SRC_LAYER, mem(pd.src_layer_desc(), src)},
+                        {DNNL_ARG_SRC_ITER,
+                                mem(pd.src_iter_desc(),
+                                        src_iter.data() + iter_off)},
+                        {DNNL_ARG_SRC_ITER_C,
+                                mem(pd.src_iter_c_desc(),
+                                        src_iter_c.data() + iter_off)},
+                        {DNNL_ARG_WEIGHTS_LAYER,
+                                mem(pd.weights_layer_desc(),
+                                        weights_layer.data() + wei_off)},
+                        {DNNL_ARG_WEIGHTS_ITER,
+                                mem(pd.weights_iter_desc(),
+                                        weights_iter.data() + wei_off)},
+                        {DNNL_ARG_BIAS,
+                                mem(pd.bias_desc(), bias.data() + ld * G * C)},
+                        {DNNL_ARG_DST_LAYER, mem(pd.dst_layer_desc(), dst)},
+                        {DNNL_ARG_DST_ITER,
+                                mem(pd.dst_iter_desc(),
+                                        dst_iter.data() + iter_off)},
+                        {DNNL_ARG_DST_ITER_C,
+                                mem(pd.dst_iter_c_desc(),
+                                        dst_iter_c.data() + iter_off)},
+                        {DNNL_ARG_WORKSPACE,
+                                memory(pd.workspace_desc(), eng)}});
+        strm.wait();
+    }
+
+    rnn_direction direction;
+    memory::dim D;
+    std::vector<float> src_layer, src_iter, src_iter_c;
+    std::vector<float> weights_layer, weights_iter, bias;
+};
+
+TEST_P(rnn_wavefront_test_t, MatchesLayerByLayerExecution) {
+    std::vector<float> dst_layer(T * MB * C);
+    std::vector<float> dst_iter(L * D * MB * C), dst_iter_c(L * D * MB * C);
+    execute(make_pd(direction, L, D), 0, src_layer.data(), dst_layer.data(),
+            dst_iter, dst_iter_c);
+
+    // Each direction of a bidirectional network is a separate stack of
+    // layers, only the outputs of the last layers are summed.
+    const auto l2r = rnn_direction::unidirectional_left2right;
+    const auto r2l = rnn_direction::unidirectional_right2left;
+    const rnn_direction dirs[2] = {D == 2 ? l2r : direction, r2l};
+    std::vector<float> ref_dst(T * MB * C, 0.f);
+    std::vector<float> ref_iter(L * D * MB * C), ref_iter_c(L * D * MB * C);
+    for (memory::dim d = 0; d < D; ++d) {
+        std::vector<float> ref_src(src_layer), ref_dir_dst(T * MB * C);
+        for (memory::dim l = 0; l < L; ++l) {
+            execute(make_pd(dirs[d], 1, 1), l * D + d, ref_src.data(),
+                    ref_dir_dst.data(), ref_iter, ref_iter_c);
+            std::swap(ref_src, ref_dir_dst);
+        }
+        for (memory::dim i = 0; i < T * MB * C; ++i)
+            ref_dst[i] += ref_src[i];
+    }
+
+    for (memory::dim i = 0; i < T * MB * C; ++i)
+        ASSERT_NEAR(dst_layer[i], ref_dst[i], 1e-5f) << "dst_layer i=" << i;
+    for (memory::dim i = 0; i < L * D * MB * C; ++i) {
+        ASSERT_NEAR(dst_iter[i], ref_iter[i], 1e-5f) << "dst_iter i=" << i;
+        ASSERT_NEAR(dst_iter_c[i], ref_iter_c[i], 1e-5f)
+                << "dst_iter_c i=" << i;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(TestRnnWavefront, rnn_wavefront_test_t,
+        ::testing::Values(rnn_direction::unidirectional_left2right,
+                rnn_direction::unidirectional_right2left,
+                rnn_direction::bidirectional_sum));
+
+} // namespace dnnl